@@ -0,0 +1,187 @@
+#ifndef ATOMICFILE_H
+#define ATOMICFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#ifndef NOMINMAX
+#define NOMINMAX //otherwise limits ::max() gets polluted by windows max and min
+#endif
+#include <winsock2.h> //must come before Windows.h, which otherwise pulls in the old winsock.h
+#include <Windows.h>
+
+//crash safe file replacement. Readers and a crash at any point see either the old file or the new one, never a torn mix
+namespace AtomicFile
+{
+	//identity of a file version as far as the file system can tell without opening it
+	struct FileStamp
+	{
+		uint64_t size = 0;
+		uint64_t time = 0; //last write, FILETIME ticks
+
+		bool operator== (const FileStamp& other) const { return size == other.size && time == other.time; }
+		bool operator!= (const FileStamp& other) const { return !(*this == other); }
+	};
+
+	//size and write time of path in one stat. False if path is missing or a directory
+	bool stamp(const char* path, FileStamp& out)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA data;
+
+		if (!GetFileAttributesExA(path, GetFileExInfoStandard, &data) || (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+			return false;
+
+		out.size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+		out.time = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+
+		return true;
+	}
+
+	//replace for data that arrives in pieces: write appends to "<path>.tmp", commit renames it over path.
+	//sync = false still protects against a crashed process (the rename is atomic), sync = true also survives power loss.
+	//a Writer dropped without commit, by an exception say, deletes the temp file and leaves path as it was
+	class Writer
+	{
+	private:
+		HANDLE m_file = INVALID_HANDLE_VALUE;
+		char m_path[MAX_PATH];
+		char m_tmpPath[MAX_PATH];
+
+	public:
+		explicit Writer(const char* path)
+		{
+			std::size_t pathLength = strlen(path);
+
+			if (pathLength + 5 > sizeof(m_tmpPath))
+				throw std::runtime_error("Path too long");
+
+			std::memcpy(m_path, path, pathLength + 1);
+			std::memcpy(m_tmpPath, path, pathLength);
+			std::memcpy(m_tmpPath + pathLength, ".tmp", 5);
+
+			m_file = CreateFileA(m_tmpPath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+			if (m_file == INVALID_HANDLE_VALUE)
+				throw std::runtime_error("Could not create temp file");
+		}
+
+		~Writer()
+		{
+			if (m_file != INVALID_HANDLE_VALUE)
+			{
+				CloseHandle(m_file);
+				DeleteFileA(m_tmpPath);
+			}
+		}
+
+		Writer(const Writer&) = delete;
+		Writer& operator= (const Writer&) = delete;
+
+		void write(const uint8_t* data, std::size_t size)
+		{
+			//WriteFile takes a DWORD count, write in <= 1GB pieces
+			constexpr std::size_t maxChunk = 1u << 30;
+
+			while (size > 0)
+			{
+				DWORD toWrite = static_cast<DWORD>(size < maxChunk ? size : maxChunk);
+				DWORD written = 0;
+
+				if (!WriteFile(m_file, data, toWrite, &written, nullptr) || written != toWrite)
+					throw std::runtime_error("Could not write temp file");
+
+				data += written;
+				size -= written;
+			}
+		}
+
+		//Windows has no directory fsync, MOVEFILE_WRITE_THROUGH makes the rename itself durable before returning.
+		//overwrite = false fails instead of replacing a path that already exists
+		void commit(bool sync, bool overwrite = true)
+		{
+			bool ok = !sync || FlushFileBuffers(m_file);
+
+			CloseHandle(m_file);
+			m_file = INVALID_HANDLE_VALUE;
+
+			if (!ok)
+			{
+				DeleteFileA(m_tmpPath);
+				throw std::runtime_error("Could not write temp file");
+			}
+
+			DWORD flags = (overwrite ? MOVEFILE_REPLACE_EXISTING : 0) | (sync ? MOVEFILE_WRITE_THROUGH : 0);
+
+			//a reader holding path open makes the rename fail with a sharing violation. The writer waits it out, readers never wait on the writer.
+			//with nothing to replace there is nothing to wait for
+			bool moved = MoveFileExA(m_tmpPath, m_path, flags);
+
+			for (int attempt{ 0 }; !moved && overwrite && attempt < 200; ++attempt)
+			{
+				Sleep(5);
+				moved = MoveFileExA(m_tmpPath, m_path, flags);
+			}
+
+			if (!moved)
+			{
+				DeleteFileA(m_tmpPath);
+				throw std::runtime_error(overwrite ? "Could not replace file" : "File already exists");
+			}
+		}
+	};
+
+	//write data to "<path>.tmp", optionally flush it to the disk, then rename it over path
+	void replace(const char* path, const uint8_t* data, std::size_t size, bool sync)
+	{
+		Writer out(path);
+		out.write(data, size);
+		out.commit(sync);
+	}
+
+	//like replace, but path must not exist yet. Fails rather than overwrite it
+	void create(const char* path, const uint8_t* data, std::size_t size, bool sync)
+	{
+		Writer out(path);
+		out.write(data, size);
+		out.commit(sync, false);
+	}
+
+	//exclusive advisory lock on path (created if missing), held for the object's lifetime.
+	//only writers take it, so saves from separate processes run one at a time while readers go straight to the file
+	class Lock
+	{
+	private:
+		HANDLE m_file = INVALID_HANDLE_VALUE;
+		OVERLAPPED m_range{};
+
+	public:
+		explicit Lock(const char* path)
+		{
+			m_file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+			if (m_file == INVALID_HANDLE_VALUE)
+				throw std::runtime_error("Could not open lock file");
+
+			//blocks until every other writer has released it
+			if (!LockFileEx(m_file, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &m_range))
+			{
+				CloseHandle(m_file);
+				throw std::runtime_error("Could not lock vault");
+			}
+		}
+
+		~Lock()
+		{
+			UnlockFileEx(m_file, 0, 1, 0, &m_range);
+			CloseHandle(m_file);
+		}
+
+		Lock(const Lock&) = delete;
+		Lock& operator= (const Lock&) = delete;
+	};
+}
+
+#endif
\ No newline at end of file
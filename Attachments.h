@@ -0,0 +1,132 @@
+#ifndef ATTACHMENTS_H
+#define ATTACHMENTS_H
+
+#include "AtomicFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include <bcrypt.h>
+#pragma comment(lib, "bcrypt.lib")
+
+//blob store for attachments (SSH keys, certificates, long notes) kept out of the vault file. Each attachment is its own
+//file, attachments/<id>.blob, encrypted in chunks so it is written and read back a chunk at a time whatever its size.
+//an entry holds only the id, so loading and saving the vault never touches attachment bytes
+namespace Attachments
+{
+	constexpr const char* DIR = "attachments";
+
+	//blob: ["PMAT"][uint16 format][uint16 0][uint64 plaintext size][uint32 chunk count], then [uint32 size][DPAPI blob] per chunk
+	constexpr char MAGIC[4] = { 'P', 'M', 'A', 'T' };
+	constexpr uint16_t FORMAT = 1;
+	constexpr std::size_t HEADER_SIZE = 20;
+	constexpr std::size_t CHUNK = 64 * 1024; //plaintext per chunk, every chunk but the last is full
+	constexpr uint32_t MAX_CHUNK_CIPHER = 1024 * 1024;
+
+	constexpr std::size_t ID_SIZE = 16;
+	constexpr std::size_t ID_TEXT = ID_SIZE * 2; //hex, as stored in the entry
+
+	struct Header
+	{
+		uint64_t size = 0;
+		uint32_t count = 0;
+	};
+
+	void writeHeader(uint8_t (&out)[HEADER_SIZE], const Header& header)
+	{
+		uint16_t zero = 0;
+
+		std::memcpy(out, MAGIC, 4);
+		std::memcpy(out + 4, &FORMAT, sizeof(FORMAT));
+		std::memcpy(out + 6, &zero, sizeof(zero));
+		std::memcpy(out + 8, &header.size, sizeof(header.size));
+		std::memcpy(out + 16, &header.count, sizeof(header.count));
+	}
+
+	Header parseHeader(const uint8_t (&data)[HEADER_SIZE])
+	{
+		Header header;
+		uint16_t format;
+
+		if (std::memcmp(data, MAGIC, 4) != 0)
+			throw std::runtime_error("Not an attachment");
+
+		std::memcpy(&format, data + 4, sizeof(format));
+
+		if (format > FORMAT)
+			throw std::runtime_error("Attachment was written by a newer version");
+
+		std::memcpy(&header.size, data + 8, sizeof(header.size));
+		std::memcpy(&header.count, data + 16, sizeof(header.count));
+
+		if (header.count != (header.size + CHUNK - 1) / CHUNK)
+			throw std::runtime_error("Corrupt attachment");
+
+		return header;
+	}
+
+	//fresh random id as hex
+	void newId(char (&out)[ID_TEXT + 1])
+	{
+		static const char hex[] = "0123456789abcdef";
+		uint8_t id[ID_SIZE];
+
+		if (!BCRYPT_SUCCESS(BCryptGenRandom(nullptr, id, ID_SIZE, BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+			throw std::runtime_error("Could not generate attachment id");
+
+		for (std::size_t i{ 0 }; i < ID_SIZE; ++i)
+		{
+			out[i * 2] = hex[id[i] >> 4];
+			out[i * 2 + 1] = hex[id[i] & 0xF];
+		}
+
+		out[ID_TEXT] = '\0';
+	}
+
+	//hex id -> bytes. False for anything that is not exactly ID_TEXT lowercase hex digits, so an id from a file can't name a path
+	bool parseId(const char* text, uint8_t (&out)[ID_SIZE])
+	{
+		auto digit = [](char c) { return c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1; };
+
+		if (std::strlen(text) != ID_TEXT)
+			return false;
+
+		for (std::size_t i{ 0 }; i < ID_SIZE; ++i)
+		{
+			int high = digit(text[i * 2]);
+			int low = digit(text[i * 2 + 1]);
+
+			if (high < 0 || low < 0)
+				return false;
+
+			out[i] = static_cast<uint8_t>(high << 4 | low);
+		}
+
+		return true;
+	}
+
+	//"attachments/<id>.blob"
+	void blobPath(const char* id, char (&out)[MAX_PATH])
+	{
+		uint8_t bytes[ID_SIZE];
+
+		if (!parseId(id, bytes))
+			throw std::runtime_error("Corrupt attachment id");
+
+		if (snprintf(out, MAX_PATH, "%s/%s.blob", DIR, id) >= MAX_PATH)
+			throw std::runtime_error("Path too long");
+	}
+
+	//DPAPI entropy for chunk index of count in the blob id: a chunk moved to another blob or position fails to decrypt
+	void chunkEntropy(uint8_t (&out)[ID_SIZE + 8], const uint8_t (&id)[ID_SIZE], uint32_t index, uint32_t count)
+	{
+		std::memcpy(out, id, ID_SIZE);
+		std::memcpy(out + ID_SIZE, &index, sizeof(index));
+		std::memcpy(out + ID_SIZE + 4, &count, sizeof(count));
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,254 @@
+#ifndef BACKUP_H
+#define BACKUP_H
+
+#include "AtomicFile.h"
+#include "Vector.h"
+
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <stdexcept>
+
+#include <bcrypt.h>
+#pragma comment(lib, "bcrypt.lib")
+
+//deduplicating backup store. A backup directory holds chunks/<digest>, one encrypted file per unique chunk of the
+//serialized record stream, and a small manifest per backup listing its chunks in order. Chunk boundaries come from a
+//rolling hash of the content, so an edit only changes the chunks around it and the next backup shares all the others
+namespace Backup
+{
+	constexpr std::size_t MIN_CHUNK = 2 * 1024;
+	constexpr std::size_t MAX_CHUNK = 64 * 1024;
+	constexpr unsigned AVERAGE_BITS = 13; //a cut every 8KB on average
+
+	constexpr std::size_t DIGEST_SIZE = 32; //HMAC-SHA256
+	constexpr std::size_t KEY_SIZE = 32;
+
+	//manifest: ["PMBK"][uint16 format][uint16 0][uint64 vault generation][uint64 stream size][uint32 chunk count],
+	//then [digest][uint32 size] per chunk
+	constexpr char MAGIC[4] = { 'P', 'M', 'B', 'K' };
+	constexpr uint16_t FORMAT = 3;
+	constexpr uint16_t FORMAT_COMPACT = 2; //the stream holds compact vault records, format 1 the older length prefixed ones
+	constexpr uint16_t FORMAT_RECORD_NAMES = 3; //as vault format 4, before that names were numbered across the stream
+	constexpr std::size_t MANIFEST_HEADER = 28;
+	constexpr std::size_t MANIFEST_ENTRY = DIGEST_SIZE + sizeof(uint32_t);
+
+	//random 64 bit value per byte for the gear hash, fixed so every run cuts the same content the same way
+	struct GearTable
+	{
+		uint64_t values[256];
+
+		constexpr GearTable()
+			: values{}
+		{
+			//splitmix64
+			uint64_t x = 0x9E3779B97F4A7C15ull;
+
+			for (uint64_t& v : values)
+			{
+				x += 0x9E3779B97F4A7C15ull;
+				uint64_t z = x;
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+				v = z ^ (z >> 31);
+			}
+		}
+	};
+
+	constexpr GearTable GEAR{};
+
+	//end offset of every chunk of data. A cut falls where the gear hash of the last 64 bytes has its top AVERAGE_BITS
+	//clear, no sooner than MIN_CHUNK and no later than MAX_CHUNK into the chunk
+	Vector<std::size_t> chunkEnds(const uint8_t* data, std::size_t size)
+	{
+		Vector<std::size_t> ends;
+		std::size_t start = 0;
+
+		while (start < size)
+		{
+			std::size_t limit = size - start < MAX_CHUNK ? size : start + MAX_CHUNK;
+			std::size_t at = start + MIN_CHUNK < limit ? start + MIN_CHUNK : limit;
+			uint64_t hash = 0;
+
+			for (; at < limit; ++at)
+			{
+				hash = (hash << 1) + GEAR.values[data[at]];
+
+				if ((hash >> (64 - AVERAGE_BITS)) == 0)
+				{
+					++at;
+					break;
+				}
+			}
+
+			ends.emplace_back(at);
+			start = at;
+		}
+
+		return ends;
+	}
+
+	//keyed digest naming a chunk. Keyed so the chunk names don't let anyone confirm a guess at what a chunk holds
+	class Digester
+	{
+	private:
+		BCRYPT_ALG_HANDLE m_alg = nullptr;
+		const uint8_t* m_key;
+
+	public:
+		explicit Digester(const uint8_t* key)
+			: m_key{ key }
+		{
+			if (!BCRYPT_SUCCESS(BCryptOpenAlgorithmProvider(&m_alg, BCRYPT_SHA256_ALGORITHM, nullptr, BCRYPT_ALG_HANDLE_HMAC_FLAG)))
+				throw std::runtime_error("Could not open SHA-256");
+		}
+
+		~Digester()
+		{
+			BCryptCloseAlgorithmProvider(m_alg, 0);
+		}
+
+		Digester(const Digester&) = delete;
+		Digester& operator= (const Digester&) = delete;
+
+		void operator()(const uint8_t* data, std::size_t size, uint8_t (&out)[DIGEST_SIZE]) const
+		{
+			if (size > ULONG_MAX || !BCRYPT_SUCCESS(BCryptHash(m_alg, const_cast<uint8_t*>(m_key), KEY_SIZE,
+				const_cast<uint8_t*>(data), static_cast<ULONG>(size), out, DIGEST_SIZE)))
+				throw std::runtime_error("Could not hash chunk");
+		}
+	};
+
+	//fresh key for a new backup directory
+	void randomKey(uint8_t (&out)[KEY_SIZE])
+	{
+		if (!BCRYPT_SUCCESS(BCryptGenRandom(nullptr, out, KEY_SIZE, BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+			throw std::runtime_error("Could not generate backup key");
+	}
+
+	//"<dir>/chunks/<digest in hex>"
+	void chunkPath(const char* dir, const uint8_t (&digest)[DIGEST_SIZE], char (&out)[MAX_PATH])
+	{
+		static const char hex[] = "0123456789abcdef";
+		char name[DIGEST_SIZE * 2 + 1];
+
+		for (std::size_t i{ 0 }; i < DIGEST_SIZE; ++i)
+		{
+			name[i * 2] = hex[digest[i] >> 4];
+			name[i * 2 + 1] = hex[digest[i] & 0xF];
+		}
+
+		name[DIGEST_SIZE * 2] = '\0';
+
+		if (snprintf(out, MAX_PATH, "%s/chunks/%s", dir, name) >= MAX_PATH)
+			throw std::runtime_error("Path too long");
+	}
+
+	//"<dir>/<file>"
+	void dirPath(const char* dir, const char* file, char (&out)[MAX_PATH])
+	{
+		if (snprintf(out, MAX_PATH, "%s/%s", dir, file) >= MAX_PATH)
+			throw std::runtime_error("Path too long");
+	}
+
+	//"<dir>/vault-YYYYMMDD-HHMMSS-mmm.backup" for now, local time to the millisecond so the names sort and read as when they
+	//were taken, and back to back backups get names of their own. The manifest is created without overwriting, so two in the
+	//same millisecond fail rather than one replacing the other
+	void manifestPath(const char* dir, char (&out)[MAX_PATH])
+	{
+		auto now = std::chrono::system_clock::now();
+		std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+		auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+
+		std::tm local{};
+		localtime_s(&local, &seconds);
+
+		char stamp[32];
+		std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &local);
+
+		char name[48];
+		snprintf(name, sizeof(name), "vault-%s-%03d.backup", stamp, static_cast<int>(millis));
+
+		dirPath(dir, name, out);
+	}
+
+	struct Manifest
+	{
+		uint16_t format = FORMAT;
+		uint64_t generation = 0;
+		uint64_t size = 0; //bytes in the record stream, the sum of the chunk sizes
+		Vector<uint8_t> digests; //DIGEST_SIZE bytes per chunk
+		Vector<uint32_t> sizes;
+	};
+
+	Vector<uint8_t> writeManifest(const Manifest& manifest)
+	{
+		uint32_t count = static_cast<uint32_t>(manifest.sizes.size());
+		Vector<uint8_t> bytes(MANIFEST_HEADER + count * MANIFEST_ENTRY);
+		uint16_t zero = 0;
+
+		std::memcpy(bytes.data(), MAGIC, 4);
+		std::memcpy(bytes.data() + 4, &FORMAT, sizeof(FORMAT));
+		std::memcpy(bytes.data() + 6, &zero, sizeof(zero));
+		std::memcpy(bytes.data() + 8, &manifest.generation, sizeof(manifest.generation));
+		std::memcpy(bytes.data() + 16, &manifest.size, sizeof(manifest.size));
+		std::memcpy(bytes.data() + 24, &count, sizeof(count));
+
+		uint8_t* cursor = bytes.data() + MANIFEST_HEADER;
+
+		for (uint32_t i{ 0 }; i < count; ++i)
+		{
+			std::memcpy(cursor, manifest.digests.data() + i * DIGEST_SIZE, DIGEST_SIZE);
+			std::memcpy(cursor + DIGEST_SIZE, &manifest.sizes[i], sizeof(uint32_t));
+			cursor += MANIFEST_ENTRY;
+		}
+
+		return bytes;
+	}
+
+	Manifest parseManifest(const uint8_t* data, std::size_t size)
+	{
+		Manifest manifest;
+		uint32_t count;
+
+		if (size < MANIFEST_HEADER || std::memcmp(data, MAGIC, 4) != 0)
+			throw std::runtime_error("Not a vault backup");
+
+		std::memcpy(&manifest.format, data + 4, sizeof(manifest.format));
+
+		if (manifest.format > FORMAT)
+			throw std::runtime_error("Backup was written by a newer version");
+
+		std::memcpy(&manifest.generation, data + 8, sizeof(manifest.generation));
+		std::memcpy(&manifest.size, data + 16, sizeof(manifest.size));
+		std::memcpy(&count, data + 24, sizeof(count));
+
+		if ((size - MANIFEST_HEADER) / MANIFEST_ENTRY != count || (size - MANIFEST_HEADER) % MANIFEST_ENTRY != 0)
+			throw std::runtime_error("Truncated backup manifest");
+
+		manifest.digests = Vector<uint8_t>(count * DIGEST_SIZE);
+		manifest.sizes = Vector<uint32_t>(count);
+
+		const uint8_t* cursor = data + MANIFEST_HEADER;
+		uint64_t total = 0;
+
+		for (uint32_t i{ 0 }; i < count; ++i)
+		{
+			std::memcpy(manifest.digests.data() + i * DIGEST_SIZE, cursor, DIGEST_SIZE);
+			std::memcpy(&manifest.sizes[i], cursor + DIGEST_SIZE, sizeof(uint32_t));
+			total += manifest.sizes[i];
+			cursor += MANIFEST_ENTRY;
+		}
+
+		if (total != manifest.size)
+			throw std::runtime_error("Corrupt backup manifest");
+
+		return manifest;
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,142 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "AtomicFile.h"
+#include "Vector.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+//micro benchmarks run through "pm bench". Scratch files only, the vault itself is never written
+namespace Bench
+{
+	//bytes to write per round: the current entries.bin if there is one, otherwise 1000 entries worth of filler
+	Vector<uint8_t> samplePayload()
+	{
+		std::error_code ec;
+		uint64_t size = std::filesystem::file_size("entries.bin", ec);
+
+		if (!ec && size > 0)
+		{
+			Vector<uint8_t> bytes(size);
+			std::ifstream in("entries.bin", std::ios::binary);
+			in.read(reinterpret_cast<char*>(bytes.data()), size);
+
+			if (in)
+				return bytes;
+		}
+
+		Vector<uint8_t> bytes(1000 * 64);
+		for (std::size_t i{ 0 }; i < bytes.size(); ++i)
+			bytes[i] = static_cast<uint8_t>(i * 131);
+
+		return bytes;
+	}
+
+	//time rounds calls of work, print total and per round cost. rounds must be at least 1. The row is formatted in its own
+	//stream so std::cout keeps the flags and precision it had
+	template <typename Work>
+	void timeRounds(const char* label, std::size_t rounds, Work&& work)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		for (std::size_t i{ 0 }; i < rounds; ++i)
+			work(i);
+
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		std::ostringstream row;
+		row << std::setw(34) << std::left << label
+			<< std::setw(12) << std::right << std::fixed << std::setprecision(2) << ms << " ms"
+			<< std::setw(12) << (ms * 1000.0 / rounds) << " us each\n";
+
+		std::cout << row.str();
+	}
+
+	//count made up but realistically shaped records for row(website, username, password): a few dozen popular sites
+	//in the url spellings browsers save, email style usernames and random passwords. Same records every run
+	template <typename Row>
+	void sampleRecords(std::size_t count, Row&& row)
+	{
+		static const char* sites[] = { "google.com", "github.com", "amazon.com", "microsoft.com", "apple.com", "facebook.com",
+			"netflix.com", "paypal.com", "reddit.com", "linkedin.com", "twitter.com", "dropbox.com", "spotify.com", "ebay.com",
+			"yahoo.com", "adobe.com", "steampowered.com", "discord.com", "slack.com", "atlassian.net", "stackoverflow.com",
+			"instagram.com", "twitch.tv", "zoom.us", "chase.com", "bankofamerica.com", "wellsfargo.com", "airbnb.com",
+			"booking.com", "uber.com", "notion.so", "gitlab.com", "bitbucket.org", "digitalocean.com", "cloudflare.com",
+			"godaddy.com", "namecheap.com", "bbc.co.uk", "nytimes.com", "medium.com" };
+		static const char* forms[] = { "%s", "www.%s", "https://%s/login", "https://www.%s/", "https://accounts.%s/signin" };
+		static const char* names[] = { "alex", "sam", "jordan", "taylor", "morgan", "casey", "jamie", "riley", "drew", "quinn" };
+		static const char* mails[] = { "gmail.com", "outlook.com", "yahoo.com", "proton.me", "icloud.com" };
+		static const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789!@#$%^&*-_";
+
+		uint64_t seed = 0x2545F4914F6CDD1Dull;
+		auto next = [&]()
+			{
+				seed ^= seed << 13;
+				seed ^= seed >> 7;
+				seed ^= seed << 17;
+				return seed;
+			};
+
+		char website[128];
+		char username[64];
+		char password[32];
+
+		for (std::size_t i{ 0 }; i < count; ++i)
+		{
+			snprintf(website, sizeof(website), forms[next() % 5], sites[next() % 40]);
+			snprintf(username, sizeof(username), "%s.%s%u@%s", names[next() % 10], names[next() % 10], static_cast<unsigned>(next() % 100), mails[next() % 5]);
+
+			std::size_t length = 12 + next() % 9;
+			for (std::size_t c{ 0 }; c < length; ++c)
+				password[c] = charset[next() % (sizeof(charset) - 1)];
+			password[length] = '\0';
+
+			row(website, username, password);
+		}
+	}
+
+	//cost of each save path on the same payload: the old truncate and overwrite against atomic replace at several flush intervals
+	void saveDurability(std::size_t rounds)
+	{
+		Vector<uint8_t> payload = samplePayload();
+		const char* scratch = "bench.bin";
+
+		std::cout << "\n" << rounds << " saves of " << payload.size() << " bytes\n";
+
+		timeRounds("ofstream truncate (old, unsafe)", rounds, [&](std::size_t)
+			{
+				std::ofstream of(scratch, std::ios::binary);
+				of.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+			});
+
+		timeRounds("atomic rename, no flush", rounds, [&](std::size_t)
+			{
+				AtomicFile::replace(scratch, payload.data(), payload.size(), false);
+			});
+
+		timeRounds("atomic rename, flush every 10", rounds, [&](std::size_t i)
+			{
+				AtomicFile::replace(scratch, payload.data(), payload.size(), i % 10 == 9);
+			});
+
+		timeRounds("atomic rename, flush every save", rounds, [&](std::size_t)
+			{
+				AtomicFile::replace(scratch, payload.data(), payload.size(), true);
+			});
+
+		std::error_code ec;
+		std::filesystem::remove(scratch, ec);
+
+		std::cout << "\n";
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,187 @@
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+#include "Vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+
+//blocked bloom filter. Each key touches one 512 bit block (one cache line) and sets one bit in each of its 8 words,
+//so a probe is a single cache miss. Keys are 64 bit hashes computed by the caller, run through SipHash under the filter's
+//secret key first: the bits alone don't let anyone holding a copy of the filter test which hosts or accounts went in
+class BloomFilter
+{
+public:
+	static constexpr std::size_t KEY_SIZE = 16;
+
+private:
+	static constexpr std::size_t WORDS_PER_BLOCK = 8;
+	static constexpr std::size_t BITS_PER_KEY = 16; //~0.1% false positives at full capacity
+
+	Vector<uint64_t> m_words;
+	uint32_t m_blocks = 0;
+	uint32_t m_count = 0; //keys added
+	uint32_t m_capacity = 0; //keys the filter was sized for
+
+	uint64_t m_key[2]{};
+	bool m_keyed = false;
+
+	static uint64_t rotl(uint64_t x, int bits)
+	{
+		return x << bits | x >> (64 - bits);
+	}
+
+	//SipHash-2-4 of the 8 bytes of hash
+	uint64_t keyed(uint64_t hash) const
+	{
+		uint64_t v0 = m_key[0] ^ 0x736F6D6570736575ull;
+		uint64_t v1 = m_key[1] ^ 0x646F72616E646F6Dull;
+		uint64_t v2 = m_key[0] ^ 0x6C7967656E657261ull;
+		uint64_t v3 = m_key[1] ^ 0x7465646279746573ull;
+
+		auto round = [&]()
+			{
+				v0 += v1; v1 = rotl(v1, 13); v1 ^= v0; v0 = rotl(v0, 32);
+				v2 += v3; v3 = rotl(v3, 16); v3 ^= v2;
+				v0 += v3; v3 = rotl(v3, 21); v3 ^= v0;
+				v2 += v1; v1 = rotl(v1, 17); v1 ^= v2; v2 = rotl(v2, 32);
+			};
+
+		//the one message block, then the final block holding only the length
+		const uint64_t last = 8ull << 56;
+
+		v3 ^= hash; round(); round(); v0 ^= hash;
+		v3 ^= last; round(); round(); v0 ^= last;
+
+		v2 ^= 0xFF;
+		round(); round(); round(); round();
+
+		return v0 ^ v1 ^ v2 ^ v3;
+	}
+
+	//block index from the high half of the hash, multiply-shift instead of modulo
+	uint32_t blockOf(uint64_t hash) const
+	{
+		return static_cast<uint32_t>(((hash >> 32) * m_blocks) >> 32);
+	}
+
+	//bit for word w of the block, 6 bits of a remixed hash each
+	static uint64_t bitFor(uint64_t hash, std::size_t w)
+	{
+		uint64_t mixed = hash * 0x9E3779B97F4A7C15ull;
+		return 1ull << ((mixed >> (w * 6 + 16)) & 63);
+	}
+
+public:
+	BloomFilter() = default;
+
+	//empty filter sized for expected keys
+	explicit BloomFilter(std::size_t expected)
+	{
+		reset(expected);
+	}
+
+	bool hasKey() const { return m_keyed; }
+
+	//keys hash differently under another key, so only set it on an empty filter
+	void setKey(const uint8_t (&key)[KEY_SIZE])
+	{
+		std::memcpy(m_key, key, KEY_SIZE);
+		m_keyed = true;
+	}
+
+	void key(uint8_t (&out)[KEY_SIZE]) const
+	{
+		std::memcpy(out, m_key, KEY_SIZE);
+	}
+
+	//empty, keeps the key
+	void reset(std::size_t expected)
+	{
+		if (expected < 64)
+			expected = 64;
+
+		std::size_t blocks = (expected * BITS_PER_KEY + 511) / 512;
+
+		m_words = Vector<uint64_t>(blocks * WORDS_PER_BLOCK, 0);
+		m_blocks = static_cast<uint32_t>(blocks);
+		m_count = 0;
+		m_capacity = static_cast<uint32_t>(expected);
+	}
+
+	bool empty() const { return m_blocks == 0; }
+
+	//past capacity the false positive rate climbs, the owner should rebuild bigger
+	bool full() const { return m_count >= m_capacity; }
+
+	void add(uint64_t hash)
+	{
+		hash = keyed(hash);
+		uint64_t* block = m_words.data() + blockOf(hash) * WORDS_PER_BLOCK;
+
+		for (std::size_t w{ 0 }; w < WORDS_PER_BLOCK; ++w)
+			block[w] |= bitFor(hash, w);
+
+		++m_count;
+	}
+
+	//false means definitely absent, true means maybe present
+	bool mayContain(uint64_t hash) const
+	{
+		if (m_blocks == 0)
+			return true;
+
+		hash = keyed(hash);
+		const uint64_t* block = m_words.data() + blockOf(hash) * WORDS_PER_BLOCK;
+
+		for (std::size_t w{ 0 }; w < WORDS_PER_BLOCK; ++w)
+			if ((block[w] & bitFor(hash, w)) == 0)
+				return false;
+
+		return true;
+	}
+
+	//[blocks][count][capacity][words...] to out.write(const uint8_t*, size), e.g. an AtomicFile::Writer. The key is not
+	//part of it, the owner stores that protected
+	template <typename Out>
+	void write(Out& out) const
+	{
+		out.write(reinterpret_cast<const uint8_t*>(&m_blocks), sizeof(m_blocks));
+		out.write(reinterpret_cast<const uint8_t*>(&m_count), sizeof(m_count));
+		out.write(reinterpret_cast<const uint8_t*>(&m_capacity), sizeof(m_capacity));
+		out.write(reinterpret_cast<const uint8_t*>(m_words.data()), m_words.size() * sizeof(uint64_t));
+	}
+
+	//returns false and leaves the filter empty on a short or malformed read. The key has to be set separately
+	bool read(std::istream& in)
+	{
+		uint32_t blocks = 0;
+		uint32_t count = 0;
+		uint32_t capacity = 0;
+
+		in.read(reinterpret_cast<char*>(&blocks), sizeof(blocks));
+		in.read(reinterpret_cast<char*>(&count), sizeof(count));
+		in.read(reinterpret_cast<char*>(&capacity), sizeof(capacity));
+
+		//1 << 20 blocks is 64MB, far past any real vault
+		if (!in || blocks == 0 || blocks > (1u << 20))
+			return false;
+
+		Vector<uint64_t> words(blocks * WORDS_PER_BLOCK, 0);
+		in.read(reinterpret_cast<char*>(words.data()), words.size() * sizeof(uint64_t));
+
+		if (!in)
+			return false;
+
+		m_words = std::move(words);
+		m_blocks = blocks;
+		m_count = count;
+		m_capacity = capacity;
+
+		return true;
+	}
+};
+
+#endif
\ No newline at end of file
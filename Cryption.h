@@ -4,46 +4,72 @@
 #include "Vector.h"
 #include "UniquePointer.h"
 #include "Sort.h"
+#include "FlatMultimap.h"
+#include "Website.h"
+#include "BloomFilter.h"
+#include "SaveWorker.h"
+#include "Import.h"
+#include "Bench.h"
+#include "Export.h"
+#include "Lz.h"
+#include "EntryExtras.h"
+#include "TagIndex.h"
 
 #include <fstream>
 #include <iostream>
 #include <filesystem>
+#include <string>
 #include <cstring>
 #include <cstdint>
 #include <limits>
 #include <iostream>
 #include <type_traits>
+#include <utility>
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <thread>
 
 #include <stdio.h>
 #include <stdint.h>
 
 #define NOMINMAX //otherwise limits ::max() gets polluted by windows max and min
+#include <winsock2.h> //must come before Windows.h, which otherwise pulls in the old winsock.h
 #include <Windows.h>
 #include <Wincrypt.h>
 #include <dpapi.h>
 
+#include "AtomicFile.h"
+#include "Backup.h"
+#include "Attachments.h"
+
 namespace Crypto
 {
-	Vector<uint8_t> encryptData(const Vector<uint8_t>& plainBytesVector)
+	//optional entropy binds a blob to where it belongs, it only decrypts with the same entropy bytes
+	Vector<uint8_t> encryptData(const uint8_t* plainBytes, std::size_t size, const uint8_t* entropy = nullptr, std::size_t entropySize = 0)
 	{
 		//max value a DWORD can safely store
 		constexpr DWORD DWORD_MAX = (std::numeric_limits<DWORD>::max)();
 
 		//size constraint, size cannot be more than the max value a DWORD can hold (0xFFFFFFFF)
-		if (plainBytesVector.size() > DWORD_MAX)
+		if (size > DWORD_MAX)
 			throw std::runtime_error("Out of bounds size");
 
 		//init input and output blobs
 		DATA_BLOB inBlob;
-		inBlob.cbData = static_cast<DWORD>(plainBytesVector.size()); //number of bytes in Vector, cbData expects DWORD
-		inBlob.pbData = reinterpret_cast<BYTE*>(const_cast<uint8_t*>(plainBytesVector.data())); //ptr to first plaintext byte, pbData expects BYTE*
+		inBlob.cbData = static_cast<DWORD>(size); //number of bytes, cbData expects DWORD
+		inBlob.pbData = reinterpret_cast<BYTE*>(const_cast<uint8_t*>(plainBytes)); //ptr to first plaintext byte, pbData expects BYTE*
+
+		DATA_BLOB entropyBlob;
+		entropyBlob.cbData = static_cast<DWORD>(entropySize);
+		entropyBlob.pbData = reinterpret_cast<BYTE*>(const_cast<uint8_t*>(entropy));
 
 		DATA_BLOB outBlob;
 		outBlob.cbData = 0; //number of bytes
 		outBlob.pbData = nullptr; // pointer to first byte
 
 		//convert from in to out, and check for success
-		if (!CryptProtectData(&inBlob, nullptr, nullptr, nullptr, nullptr, CRYPTPROTECT_UI_FORBIDDEN, &outBlob))
+		if (!CryptProtectData(&inBlob, nullptr, entropy ? &entropyBlob : nullptr, nullptr, nullptr, CRYPTPROTECT_UI_FORBIDDEN, &outBlob))
 			throw std::runtime_error("Encryption failed");
 
 		//encrypted Vector to own data
@@ -59,22 +85,32 @@ namespace Crypto
 		return encrypted;
 	}
 
-	Vector<uint8_t> decryptData(const Vector <uint8_t>& encrypted)
+	Vector<uint8_t> encryptData(const Vector<uint8_t>& plainBytesVector)
+	{
+		return encryptData(plainBytesVector.data(), plainBytesVector.size());
+	}
+
+	//decrypt size bytes at encrypted, lets callers skip a file header without copying the rest
+	Vector<uint8_t> decryptData(const uint8_t* encrypted, std::size_t size, const uint8_t* entropy = nullptr, std::size_t entropySize = 0)
 	{
 		constexpr DWORD DWORD_MAX = (std::numeric_limits<DWORD>::max)();
 
-		if (encrypted.size() > DWORD_MAX || encrypted.size() == 0)
+		if (size > DWORD_MAX || size == 0)
 			throw std::runtime_error("Out of bounds size");
 
 		DATA_BLOB inBlob;
-		inBlob.cbData = static_cast<DWORD>(encrypted.size()); //number of bytes in Vector, cbData expects DWORD
-		inBlob.pbData = reinterpret_cast<BYTE*>(const_cast<uint8_t*>(encrypted.data())); //ptr to first plaintext byte, pbData expects BYTE*
+		inBlob.cbData = static_cast<DWORD>(size); //number of bytes, cbData expects DWORD
+		inBlob.pbData = reinterpret_cast<BYTE*>(const_cast<uint8_t*>(encrypted)); //ptr to first encrypted byte, pbData expects BYTE*
+
+		DATA_BLOB entropyBlob;
+		entropyBlob.cbData = static_cast<DWORD>(entropySize);
+		entropyBlob.pbData = reinterpret_cast<BYTE*>(const_cast<uint8_t*>(entropy));
 
 		DATA_BLOB outBlob;
 		outBlob.cbData = 0;
 		outBlob.pbData = nullptr;
 
-		if (!CryptUnprotectData(&inBlob, nullptr, nullptr, nullptr, nullptr, CRYPTPROTECT_UI_FORBIDDEN, &outBlob))
+		if (!CryptUnprotectData(&inBlob, nullptr, entropy ? &entropyBlob : nullptr, nullptr, nullptr, CRYPTPROTECT_UI_FORBIDDEN, &outBlob))
 			throw std::runtime_error("Unencryption phase failed");
 
 		Vector<uint8_t> unencrypted(outBlob.cbData);
@@ -86,14 +122,193 @@ namespace Crypto
 
 		return unencrypted;
 	}
+
+	Vector<uint8_t> decryptData(const Vector <uint8_t>& encrypted)
+	{
+		return decryptData(encrypted.data(), encrypted.size());
+	}
 };
 
+//entries.bin layout: ["PMVH"][uint16 format][uint16 flags][uint64 generation][payload].
+//the header is plaintext so a reader can tell which save it is looking at without decrypting.
+//format 2 payload: [uint32 chunk count] then [uint32 size][DPAPI blob] per chunk, each chunk holding whole records,
+//so a reader can decrypt and walk one chunk at a time. Format 1 payload is a single DPAPI blob.
+//format 3 chunks hold compact records (see putRecord), older ones [uint32 length][bytes + '\0'] for each of the three fields.
+//format 4 writes tag and field names out in every record, format 3 numbered them across the stream (see NameReader).
+//format 5 keeps each chunk's names in a table at its head and its records refer to them by index (see tableChunk).
+//format 6 payload: [uint32 chunk count][uint32 record count][uint32 size][DPAPI host index] before the chunks (see hostIndex).
+//files written before the header existed are a bare DPAPI blob, they read as generation 0.
+//a sharded vault keeps its entries in entries.s<i>.bin (same layout each) and entries.bin shrinks to a manifest:
+//the header with FLAG_SHARDED, then [uint32 shard count] and no blob.
+//FLAG_COMPRESSED: every chunk decrypts to [uint32 plaintext size][Lz stream] instead of plaintext
+namespace VaultFile
+{
+	constexpr char MAGIC[4] = { 'P', 'M', 'V', 'H' };
+	constexpr uint16_t FORMAT = 6;
+	constexpr uint16_t FORMAT_CHUNKED = 2;
+	constexpr uint16_t FORMAT_COMPACT = 3;
+	constexpr uint16_t FORMAT_RECORD_NAMES = 4;
+	constexpr uint16_t FORMAT_NAME_TABLE = 5;
+	constexpr uint16_t FORMAT_HOST_INDEX = 6;
+	constexpr std::size_t HEADER_SIZE = 16;
+
+	constexpr std::size_t CHUNK = 64 * 1024; //plaintext per chunk, a single bigger record gets a chunk of its own
+	constexpr std::size_t MAX_CHUNK_CIPHER = 16 * 1024 * 1024; //three 1MB fields plus DPAPI overhead fit easily
+
+	constexpr uint16_t FLAG_SHARDED = 1;
+	constexpr uint16_t FLAG_COMPRESSED = 2;
+	constexpr uint16_t KNOWN_FLAGS = FLAG_SHARDED | FLAG_COMPRESSED;
+	constexpr uint32_t MAX_SHARDS = 64; //touched shards travel as a uint64_t mask
+
+	struct Header
+	{
+		uint16_t format = 0; //0 = legacy file without a header
+		uint16_t flags = 0;
+		uint64_t generation = 0; //bumped by every save, never reused
+		uint32_t shards = 0; //manifests only, 0 = entries live in this file
+	};
+
+	//bytes before the blob: HEADER_SIZE, plus the shard count in a manifest
+	std::size_t headerSize(const Header& header)
+	{
+		return HEADER_SIZE + ((header.flags & FLAG_SHARDED) ? sizeof(header.shards) : 0);
+	}
+
+	void writeHeader(uint8_t* out, const Header& header)
+	{
+		std::memcpy(out, MAGIC, 4);
+		std::memcpy(out + 4, &header.format, sizeof(header.format));
+		std::memcpy(out + 6, &header.flags, sizeof(header.flags));
+		std::memcpy(out + 8, &header.generation, sizeof(header.generation));
+
+		if (header.flags & FLAG_SHARDED)
+			std::memcpy(out + HEADER_SIZE, &header.shards, sizeof(header.shards));
+	}
+
+	//header of the size bytes at data, returns its length (see headerSize), or 0 for a legacy file
+	std::size_t parseHeader(const uint8_t* data, std::size_t size, Header& header)
+	{
+		header = Header{};
+
+		if (size < HEADER_SIZE || std::memcmp(data, MAGIC, 4) != 0)
+			return 0;
+
+		std::memcpy(&header.format, data + 4, sizeof(header.format));
+		std::memcpy(&header.flags, data + 6, sizeof(header.flags));
+		std::memcpy(&header.generation, data + 8, sizeof(header.generation));
+
+		if (header.format > FORMAT || (header.flags & ~KNOWN_FLAGS))
+			throw std::runtime_error("Vault was written by a newer version");
+
+		if (header.flags & FLAG_SHARDED)
+		{
+			if (size < HEADER_SIZE + sizeof(header.shards))
+				throw std::runtime_error("Truncated vault manifest");
+
+			std::memcpy(&header.shards, data + HEADER_SIZE, sizeof(header.shards));
+
+			if (header.shards < 2 || header.shards > MAX_SHARDS)
+				throw std::runtime_error("Bad shard count in vault manifest");
+		}
+
+		return headerSize(header);
+	}
+
+	//read just the header of path. False if it can't be read or the file is legacy, header is zeroed then
+	bool readHeader(const char* path, Header& header)
+	{
+		uint8_t bytes[HEADER_SIZE + sizeof(header.shards)];
+		std::ifstream in(path, std::ios::binary);
+
+		in.read(reinterpret_cast<char*>(bytes), sizeof(bytes));
+
+		return parseHeader(bytes, static_cast<std::size_t>(in.gcount()), header) != 0;
+	}
+
+	//generation of the file at path, 0 when it is missing or legacy
+	uint64_t diskGeneration(const char* path)
+	{
+		Header header;
+
+		return readHeader(path, header) ? header.generation : 0;
+	}
+
+	//DPAPI entropy for chunk index of count in a file of generation. A chunk moved to another position,
+	//another file or a truncated file no longer decrypts
+	void chunkEntropy(uint8_t (&out)[16], uint64_t generation, uint32_t index, uint32_t count)
+	{
+		std::memcpy(out, &generation, sizeof(generation));
+		std::memcpy(out + 8, &index, sizeof(index));
+		std::memcpy(out + 12, &count, sizeof(count));
+	}
+
+	//======================================== compact records ========================================//
+
+	//record: [uint8 field bitmap][LEB128 length][bytes] for each field whose bit is set, in ENTRY_FIELDS order, then the
+	//extras if the top bit is set. Empty fields are left out entirely, and nothing is NUL terminated on disk. The codec itself follows Entry
+	constexpr uint32_t MAX_FIELD = 1024 * 1024;
+	constexpr uint8_t EXTRAS = 0x80;
+
+	std::size_t varintSize(uint32_t value)
+	{
+		std::size_t size = 1;
+
+		for (; value >= 0x80; value >>= 7)
+			++size;
+
+		return size;
+	}
+
+	uint8_t* putVarint(uint8_t* out, uint32_t value)
+	{
+		for (; value >= 0x80; value >>= 7)
+			*out++ = static_cast<uint8_t>(value | 0x80);
+
+		*out++ = static_cast<uint8_t>(value);
+		return out;
+	}
+
+	//LEB128 at cursor into value, advances cursor. False if it runs past end or over 5 bytes
+	bool getVarint(const uint8_t*& cursor, const uint8_t* end, uint32_t& value)
+	{
+		value = 0;
+
+		for (unsigned shift{ 0 }; shift < 35 && cursor < end; shift += 7)
+		{
+			uint8_t byte = *cursor++;
+			value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+
+			if (!(byte & 0x80))
+				return true;
+		}
+
+		return false;
+	}
+
+	//"entries.bin" -> "entries.s3.bin"
+	void shardPath(const char* path, uint32_t shard, char (&out)[MAX_PATH])
+	{
+		const char* dot = std::strrchr(path, '.');
+		int stem = static_cast<int>(dot ? dot - path : strlen(path));
+
+		if (snprintf(out, MAX_PATH, "%.*s.s%u%s", stem, path, shard, dot ? dot : "") >= MAX_PATH)
+			throw std::runtime_error("Path too long");
+	}
+
+	//shard holding website. By host, so every spelling of a site lands in the same file
+	uint32_t shardOf(const char* website, uint32_t shards)
+	{
+		return static_cast<uint32_t>(Website::placementHash(website) % shards);
+	}
+}
+
 //owns memory for each entry, MUST deallocate mem
 struct Entry
 {
 	char* website_ = nullptr;
 	char* username_ = nullptr;
 	char* password_ = nullptr;
+	UniquePtr<EntryExtras> extras_; //tags and custom fields, null for the usual entry that has none
 
 	//disable copying
 	Entry(const Entry&) = delete;
@@ -116,7 +331,7 @@ struct Entry
 
 	//move constructor
 	Entry(Entry&& other) noexcept
-		: website_{ other.website_ }, username_{ other.username_ }, password_{ other.password_ }
+		: website_{ other.website_ }, username_{ other.username_ }, password_{ other.password_ }, extras_{ std::move(other.extras_) }
 	{
 		other.website_ = nullptr;
 		other.username_ = nullptr;
@@ -136,6 +351,7 @@ struct Entry
 		website_ = other.website_;
 		username_ = other.username_;
 		password_ = other.password_;
+		extras_ = std::move(other.extras_);
 
 		other.website_ = nullptr;
 		other.username_ = nullptr;
@@ -150,331 +366,3666 @@ struct Entry
 		delete[] username_;
 		delete[] password_;
 	}
-};
 
-class Vault
-{
-private:
-	mutable Vector<Entry> m_entries;
-	mutable bool m_loaded = false;
+	//deep copy, extras included. Named rather than a copy constructor so copies stay visible at the call site
+	Entry clone() const
+	{
+		Entry copy(website_, username_, password_);
+
+		if (extras_)
+			copy.extras_ = makeUnique<EntryExtras>(*extras_);
 
-	void writeTemp()
+		return copy;
+	}
+
+	//extras to fill in, created on first use
+	EntryExtras& extras()
 	{
-		uint64_t totalSize = 0;
-		uint32_t ut32Size = sizeof(uint32_t);
+		if (!extras_)
+			extras_ = makeUnique<EntryExtras>();
 
-		//compute total serialized size (bytes). Could use uint32_t but 64_t helps prevent risk of overflow
-		for (const auto& e : m_entries)
-		{
-			//reserve space for [size] [contents] for web, user, pass
-			uint64_t websiteBytes = (ut32Size + (strlen(e.website_) + 1));
-			uint64_t usernameBytes = (ut32Size + (strlen(e.username_) + 1));
-			uint64_t passwordBytes = (ut32Size + (strlen(e.password_) + 1));
+		return *extras_;
+	}
+};
 
-			totalSize += websiteBytes + usernameBytes + passwordBytes;
-		}
+//stored fields of Entry in file order. Only the record codec (recordSize, putRecord, forEachCompact) and sameEntry and
+//entryHash expand over this list; each field is read and written by straight line code and a field appended here (its
+//position is its bit in the record bitmap) reads as "" from older files. Everything else still names the three fields:
+//Entry's constructor and moves, the forEachCompact callbacks, display, search, the indices, Import and the Daemon, so a
+//new field also means touching those. Optional and rarely set data belongs in EntryExtras instead
+struct EntryField
+{
+	char* Entry::* member;
+	const char* name;
+};
 
-		//allocate buffer of exactly totalSize
-		Vector<uint8_t> buffer(totalSize);
+constexpr EntryField ENTRY_FIELDS[] = {
+	{ &Entry::website_, "website" },
+	{ &Entry::username_, "username" },
+	{ &Entry::password_, "password" },
+};
 
-		uint8_t* cursor = buffer.data();//ptr for advancing through buffer
+constexpr std::size_t ENTRY_FIELD_COUNT = sizeof(ENTRY_FIELDS) / sizeof(ENTRY_FIELDS[0]);
 
-		//[size][contents]
-		for (const auto& e : m_entries)
-		{
-			auto writeToBuffer = [&](const char* s) -> void
-				{
-					//compute entry.x, +1 for null terminator
-					uint32_t length = static_cast<uint32_t>((strlen(s) + 1));
+static_assert(ENTRY_FIELD_COUNT <= 7, "the record bitmap is one byte, the top bit marks extras");
+
+//fn(std::integral_constant<std::size_t, I>) for every field I, unrolled. I is a constant, so ENTRY_FIELDS[I].member is too
+template <typename Fn, std::size_t... I>
+void forEachField(Fn&& fn, std::index_sequence<I...>)
+{
+	(fn(std::integral_constant<std::size_t, I>{}), ...);
+}
 
-					//[size] into buffer
-					std::memcpy(cursor, &length, ut32Size);
-					cursor += ut32Size;
+template <typename Fn>
+void forEachField(Fn&& fn)
+{
+	forEachField(fn, std::make_index_sequence<ENTRY_FIELD_COUNT>{});
+}
 
-					//[contents] into buffer
-					std::memcpy(cursor, s, length);
-					cursor += length;
-				};
+//fn(fields[0], fields[1], ..., extras), one argument per field
+template <typename Fn, std::size_t... I>
+void applyFields(Fn&& fn, const char* const* fields, const EntryExtras* extras, std::index_sequence<I...>)
+{
+	fn(fields[I]..., extras);
+}
 
-			//website
-			writeToBuffer(e.website_);
-			writeToBuffer(e.username_);
-			writeToBuffer(e.password_);
-		}
+namespace VaultFile
+{
+	constexpr uint8_t KNOWN_FIELDS = static_cast<uint8_t>((1u << ENTRY_FIELD_COUNT) - 1) | EXTRAS;
 
-		//encrypted buffer
-		Vector<uint8_t> cipher = Crypto::encryptData(buffer);
+	//extras: [LEB128 tag count][name]... [LEB128 field count]([name][uint8 type][value])... A Text or Attachment value is
+	//[LEB128 length][bytes], a Date value LEB128 days. The record stream (serialize, and so every backup) spells each name out
+	//the same way, so a record's bytes depend on that record alone and an edit only changes the backup chunks (user-044)
+	//around it. A vault file chunk keeps its names once in a table instead (tableChunk)
 
-		//name, write as bytes | overwrite to end of file
-		std::ofstream of("entries.bin", std::ios::binary);
+	//[LEB128 length][bytes] of s
+	std::size_t textSize(const char* s)
+	{
+		std::size_t length = std::strlen(s);
+		return varintSize(static_cast<uint32_t>(length)) + length;
+	}
 
-		//write expects char. write entire buffer to entries.bin
-		of.write(reinterpret_cast<const char*>(cipher.data()), cipher.size());
-		of.close();
+	uint8_t* putText(uint8_t* out, const char* s)
+	{
+		uint32_t length = static_cast<uint32_t>(std::strlen(s));
 
-		m_loaded = true;
+		out = putVarint(out, length);
+		std::memcpy(out, s, length);
+		return out + length;
 	}
 
-	void readTemp(const char* fileName) const
+	//tag and field names as the decoder meets them, spelled one of three ways:
+	//Inline: [LEB128 length][bytes] in every record. The record stream, backups and vault format 4
+	//Table: [LEB128 index] into the table at the head of the chunk (vault format 5, tableChunk), loaded by readTable
+	//Numbered: vault format 3 numbered names across the whole stream, [0][LEB128 length][bytes] where one first appeared and
+	//[LEB128 its number + 1] after that. Every later record's bytes depended on the names before it, so a new tag early in
+	//the vault changed most backup chunks
+	class NameReader
 	{
-		//clear
-		m_entries.clear();
+	public:
+		enum Mode : uint8_t
+		{
+			Inline,
+			Table,
+			Numbered
+		};
+
+	private:
+		Mode m_mode;
+		Vector<char> m_text;
+		Vector<uint32_t> m_offsets;
+
+		//[LEB128 length][bytes] at cursor onto m_text, returns its offset there
+		uint32_t append(const uint8_t*& cursor, const uint8_t* end)
+		{
+			uint32_t length;
 
-		//avoid repeated calc
-		uint32_t ut32Size = sizeof(uint32_t);
-		std::size_t oneMBSize = 1024 * 1024;
+			if (!getVarint(cursor, end, length) || length == 0 || length > MAX_FIELD || length > static_cast<std::size_t>(end - cursor))
+				throw std::runtime_error("Corrupt vault record");
 
-		//read file in as binary data
-		std::ifstream inFile(fileName, std::ios::binary);
+			uint32_t offset = appendText(m_text, reinterpret_cast<const char*>(cursor), length);
+			cursor += length;
 
-		if (!inFile)
-			throw std::runtime_error("File not found");
+			return offset;
+		}
 
-		//get file size in bytes
-		uint64_t totalSize = std::filesystem::file_size(fileName);
+	public:
+		explicit NameReader(Mode mode)
+			: m_mode{ mode }
+		{
+		}
 
-		//init buffer
-		Vector<uint8_t> buffer(totalSize);
+		//load the name table at the head of a format 5 chunk [data, end), returns where its records start
+		const uint8_t* readTable(const uint8_t* data, const uint8_t* end)
+		{
+			uint32_t count;
 
-		//read totalSize data into buffer. inFile expects chars, so cast
-		inFile.read(reinterpret_cast<char*>(buffer.data()), totalSize);
+			//a name is at least two bytes
+			if (!getVarint(data, end, count) || count > static_cast<std::size_t>(end - data) / 2)
+				throw std::runtime_error("Corrupt vault record");
 
-		if (!inFile)
-			throw std::runtime_error("Could not read file");
+			m_text.clear();
+			m_offsets.clear();
+			m_offsets.reserve(count);
 
-		//decryption
-		Vector<uint8_t> plainBytes = Crypto::decryptData(buffer);
+			for (uint32_t i{ 0 }; i < count; ++i)
+				m_offsets.emplace_back(append(data, end));
 
-		//for decrypted container traversal
-		uint8_t* end = plainBytes.data() + plainBytes.size();
-		uint8_t* cursor = plainBytes.data();
+			return data;
+		}
 
-		//clear and rebuild m_entries instead of temp Vector<Entry> and then moving
-		m_entries.clear();
+		//the name at cursor, advancing past it. Valid until the next read
+		const char* read(const uint8_t*& cursor, const uint8_t* end)
+		{
+			uint32_t ref;
 
-		//init length to store length for each entry, copy into it, advance ptr, temp storage for [contents], copy into, advance, return
-		auto readFromBuffer = [&]()
+			if (m_mode == Table)
 			{
-				//bounds check there is enough room left for [size]
-				if (cursor + ut32Size > end)
-					throw std::runtime_error("Insufficient remaining space");
+				if (!getVarint(cursor, end, ref) || ref >= m_offsets.size())
+					throw std::runtime_error("Corrupt vault record");
 
-				//move [length] into length and advance cursor to read [contents] next
-				uint32_t length;
-				std::memcpy(&length, cursor, ut32Size);
-				cursor += ut32Size;
-
-				//bounds check there is enough room left for [contents]
-				if (cursor + length > end || length == 0 || length > oneMBSize)
-					throw std::runtime_error("Insufficient remaining space for length OR length is 0");
+				return m_text.data() + m_offsets[ref];
+			}
 
-				//char* entry = new char[length];
-				UniquePtr<char[]> entry = makeUnique<char[]>(length);
+			if (m_mode == Numbered)
+			{
+				if (!getVarint(cursor, end, ref) || ref > m_offsets.size())
+					throw std::runtime_error("Corrupt vault record");
 
-				std::memcpy(entry.get(), cursor, length);
-				cursor += length;
+				if (ref > 0)
+					return m_text.data() + m_offsets[ref - 1];
+			}
+			else
+				m_text.clear(); //nothing refers back, only the latest name is kept
 
-				return entry;
-			};
+			uint32_t offset = append(cursor, end);
 
-		while (cursor < end)
-		{
-			UniquePtr<char[]> website = readFromBuffer();
-			UniquePtr<char[]> username = readFromBuffer();
-			UniquePtr<char[]> password = readFromBuffer();
+			if (m_mode == Numbered)
+				m_offsets.emplace_back(offset);
 
-			//construct directly into m_entries
-			m_entries.emplace_back(website.get(), username.get(), password.get());
+			return m_text.data() + offset;
 		}
+	};
 
-		m_loaded = true;
+	bool hasExtras(const Entry& e)
+	{
+		return e.extras_ && !e.extras_->empty();
 	}
 
-public:
-	//disable copying because Entry cannot copy construct
-	Vault(const Vault&) = delete;
-	Vault& operator= (const Vault&) = delete;
+	//bytes putRecord writes for e
+	std::size_t recordSize(const Entry& e)
+	{
+		std::size_t size = 1;
 
-	//default constructor
-	Vault() = default;
+		forEachField([&](auto i)
+			{
+				std::size_t length = std::strlen(e.*ENTRY_FIELDS[i].member);
 
-	//move constructor
-	Vault(Vault&& other) = default;
+				if (length > 0)
+					size += varintSize(static_cast<uint32_t>(length)) + length;
+			});
 
-	//deep move assignment operator
-	Vault& operator= (Vault&& other) = default;
+		if (!hasExtras(e))
+			return size;
 
-	//destructor
-	~Vault() = default;
+		const EntryExtras& x = *e.extras_;
 
-	//user is intended to call this one, readTemp is for testing purposes and if the filename needs to be changed
-	void readVault() const
-	{
-		if (m_loaded)
-			return;
+		size += varintSize(static_cast<uint32_t>(x.tags.size())) + varintSize(static_cast<uint32_t>(x.fields.size()));
 
-		readTemp("entries.bin");
+		for (uint32_t tag : x.tags)
+			size += textSize(x.str(tag));
+
+		for (const EntryExtras::Field& f : x.fields)
+			size += textSize(x.str(f.name)) + 1 + (f.hasText() ? textSize(x.str(f.value)) : varintSize(f.value));
+
+		return size;
 	}
 
-	void addEntryAndSave(const char* website, const char* username, const char* password)
+	uint8_t* putRecord(uint8_t* out, const Entry& e)
 	{
-		//file exists, is regular file, and has some data in it
-		if (std::filesystem::exists("entries.bin") && std::filesystem::is_regular_file("entries.bin") && std::filesystem::file_size("entries.bin") > 0)
-			 readVault();
+		uint8_t* bitmap = out++;
+		*bitmap = 0;
 
-		//prevent duplicate entries
-		for (const auto& e : m_entries)
-		{
-			if (std::strcmp(e.website_, website) == 0 && std::strcmp(e.username_, username) == 0 && std::strcmp(e.password_, password) == 0)
+		forEachField([&](auto i)
 			{
-				std::cout << "Duplicate entry, not appending\n";
-				return;
-			}
-		}
+				const char* field = e.*ENTRY_FIELDS[i].member;
+				uint32_t length = static_cast<uint32_t>(std::strlen(field));
 
-		m_entries.emplace_back(website, username, password);
+				if (length == 0)
+					return;
 
-		writeTemp();
-		listAllEntries();
-	}
+				*bitmap |= static_cast<uint8_t>(1u << i);
+				out = putVarint(out, length);
+				std::memcpy(out, field, length);
+				out += length;
+			});
 
-	//non const since Sort is called. Container is modified.
-	void deleteEntryAndSave(Vector<std::size_t>& list)
-	{
-		if (list.size() < 1)
-			throw std::runtime_error("Must have atleast one value to delete");
+		if (!hasExtras(e))
+			return out;
 
-		//file exists, is regular file, and has some data in it
-		if (std::filesystem::exists("entries.bin") && std::filesystem::is_regular_file("entries.bin") && std::filesystem::file_size("entries.bin") > 0)
-			//load all Entry
-			readVault();
-		else
-			throw std::runtime_error("Vault is empty or missing");
+		const EntryExtras& x = *e.extras_;
+		*bitmap |= EXTRAS;
 
-		//personal Sort
-		Sort(list.data(), list.data() + list.size());
+		out = putVarint(out, static_cast<uint32_t>(x.tags.size()));
 
-		//Make sure index is correct
-		std::cout << "Delete Entry containing contents: \n";
+		for (uint32_t tag : x.tags)
+			out = putText(out, x.str(tag));
 
-		//make sure no duplicate indices, if there are, throw because user is silly
-		for (std::size_t i{ 1 }; i < list.size(); ++i)
-		{
-			if (list[i] == list[i - 1])
-				throw std::runtime_error("Duplicate index provided. That's really dumb.");
-		}
+		out = putVarint(out, static_cast<uint32_t>(x.fields.size()));
 
-		//preview
-		for (std::size_t i{ 0 }; i < list.size(); ++i)
+		for (const EntryExtras::Field& f : x.fields)
 		{
-			//[[[Entry[args[i]]. Get the Entry at args position, for each args starting from the 0th (because list is a stored as a Vector)
-			//
-			//[Entry1][Entry2][Entry3][Entry4][Entry5]
-			//(0, 2)
-			//i = 0			i < 2
-			const Entry& e = m_entries[list[i]];
-			std::cout << std::setw(4) << "[Index " << list[i] << " - " << "Website: "
-				<< std::setw(12) << std::left << e.website_ << " | Username: "
-				<< std::setw(12) << std::left << e.username_ << " | Password: "
-				<< std::setw(12) << std::left << e.password_ << "]\n";
+			out = putText(out, x.str(f.name));
+			*out++ = f.type;
+
+			if (f.hasText())
+				out = putText(out, x.str(f.value));
+			else
+				out = putVarint(out, f.value);
 		}
 
-		//confirm or deny
-		for (;;)
-		{
-			std::cout << "Delete these entries? ";
-			
-			//enough for "yes\0" and "no\0"
-			UniquePtr<char[]> response = makeUnique<char[]>(16);
+		return out;
+	}
+
+	//walk the record at cursor of a stream putRecord wrote: bytes(from, to) for each run that is not a tag or field name and
+	//name(bytes, length) for each name between them, in order. Returns the end of the record. Trusted input, only the saver walks it
+	template <typename Bytes, typename Name>
+	const uint8_t* walkRecord(const uint8_t* cursor, Bytes&& bytes, Name&& name)
+	{
+		const uint8_t* run = cursor;
+		uint8_t bitmap = *cursor++;
+		uint32_t value = 0;
 
-			//consume all leading whitespace
-			std::cin >> std::ws;
+		auto skipBytes = [&]()
+			{
+				getVarint(cursor, cursor + 5, value);
+				cursor += value;
+			};
 
-			//read up to 15 chars
-			std::cin.getline(response.get(), 16);
+		//the run so far, then the name at cursor
+		auto takeName = [&]()
+			{
+				bytes(run, cursor);
+				getVarint(cursor, cursor + 5, value);
+				name(cursor, value);
+				cursor += value;
+				run = cursor;
+			};
 
-			//cast all to lower
-			for (char* p = response.get(); *p; ++p)
-				*p = std::tolower(static_cast<unsigned char>(*p));
+		for (uint8_t fields = bitmap & ~EXTRAS; fields; fields >>= 1)
+			if (fields & 1)
+				skipBytes();
 
-			if (strcmp(response.get(), "no") == 0 || strcmp(response.get(), "n") == 0)
-				return; //exit
-				
+		if (bitmap & EXTRAS)
+		{
+			uint32_t count;
+			getVarint(cursor, cursor + 5, count);
 
-			if (strcmp(response.get(), "yes") == 0 || strcmp(response.get(), "y") == 0) 
-				break; //exit for loop and continue downwards
-				
+			for (uint32_t i{ 0 }; i < count; ++i)
+				takeName();
 
-			else
+			getVarint(cursor, cursor + 5, count);
+
+			for (uint32_t i{ 0 }; i < count; ++i)
 			{
-				std::cout << "Invalid input, try again\n";
-				continue;
-			}
+				takeName();
 
+				if (*cursor++ != EntryExtras::Date)
+					skipBytes();
+				else
+					getVarint(cursor, cursor + 5, value);
+			}
 		}
 
-		//erase specified Entrys at indices
-		for (std::size_t i{ list.size() }; i > 0; --i)
-			m_entries.erase_index(list[i - 1]);
-
-		//write and save
-		writeTemp();
-		listAllEntries();
-
-		m_loaded = true;
+		bytes(run, cursor);
+		return cursor;
 	}
 
-	//Overload for variadic template. Delegates to Vector param version. Enable if to ensure only numbers passed.
-	template <typename... Args, typename = std::enable_if_t<(std::is_integral<Args>::value && ...)>>
-	void deleteEntryAndSave(Args... args)
+	//offset just past the record at offset at of a stream putRecord wrote
+	std::size_t recordEnd(const uint8_t* data, std::size_t at)
 	{
-		static_assert(sizeof...(Args) > 0, "requires at least one index");
-
-		//cast args to a size_t Vector for ease of use later
-		Vector<std::size_t> list = { static_cast<std::size_t>(args)... };
-
-		deleteEntryAndSave(list);
+		return static_cast<std::size_t>(walkRecord(data + at, [](const uint8_t*, const uint8_t*) {}, [](const uint8_t*, uint32_t) {}) - data);
 	}
 
-	void editAndSave(std::size_t index, const char* newWebsite, const char* newUsername, const char* newPassword)
+	//format 5 chunk for the records putRecord wrote to [data, data + size): the tag and field names they use, once each, as
+	//[LEB128 count]([LEB128 length][bytes])..., then the records with every name replaced by [LEB128 its index in that table].
+	//Tags repeat on most tagged records and compression is off by default, so a name costs its bytes once per chunk rather than
+	//once per record. The table is per chunk, so each chunk still decodes on its own and an edit stays within its chunk
+	Vector<uint8_t> tableChunk(const uint8_t* data, std::size_t size)
 	{
-		//retrieve all Entry into entries Vector
-		readVault();
+		struct Name
+		{
+			const uint8_t* bytes;
+			uint32_t length;
+		};
 
-		//make sure in bounds index
-		if (index >= m_entries.size())
-			throw std::runtime_error("Out of bounds index");
+		Vector<Name> table;
+		FlatMultimap<uint32_t> lookup;
+		const uint8_t* end = data + size;
 
-		//move construct new Entry at index
-		m_entries[index] = Entry(newWebsite, newUsername, newPassword);
+		//index of the name, added to the table on first use
+		auto indexOf = [&](const uint8_t* bytes, uint32_t length)
+			{
+				uint64_t hash = fnv1a(reinterpret_cast<const char*>(bytes), length);
+				uint32_t index = static_cast<uint32_t>(table.size());
 
-		//write to file
-		writeTemp();
-		listAllEntries();
-	}
+				lookup.forEach(hash, [&](uint32_t i)
+					{
+						if (table[i].length == length && std::memcmp(table[i].bytes, bytes, length) == 0)
+							index = i;
+					});
 
-	//overload for taking an Entry to add
-	void editAndSave(std::size_t index, const Entry& et)
-	{
-		editAndSave(index, et.website_, et.username_, et.password_);
-	}
+				if (index == table.size())
+				{
+					lookup.insert(hash, index);
+					table.emplace_back(Name{ bytes, length });
+				}
 
-	//just formatting for entries to look more even
-	void listAllEntries() const
-	{
-		readVault();
+				return index;
+			};
 
-		std::cout << "\n";
+		//first pass numbers the names and sizes the output, the second writes it
+		std::size_t total = 0;
+
+		for (const uint8_t* record = data; record < end; )
+		{
+			record = walkRecord(record,
+				[&](const uint8_t* from, const uint8_t* to) { total += static_cast<std::size_t>(to - from); },
+				[&](const uint8_t* bytes, uint32_t length) { total += varintSize(indexOf(bytes, length)); });
+		}
+
+		total += varintSize(static_cast<uint32_t>(table.size()));
+
+		for (const Name& n : table)
+			total += varintSize(n.length) + n.length;
+
+		Vector<uint8_t> out(total);
+		uint8_t* write = putVarint(out.data(), static_cast<uint32_t>(table.size()));
+
+		for (const Name& n : table)
+		{
+			write = putVarint(write, n.length);
+			std::memcpy(write, n.bytes, n.length);
+			write += n.length;
+		}
+
+		for (const uint8_t* record = data; record < end; )
+		{
+			record = walkRecord(record,
+				[&](const uint8_t* from, const uint8_t* to)
+				{
+					std::memcpy(write, from, static_cast<std::size_t>(to - from));
+					write += to - from;
+				},
+				[&](const uint8_t* bytes, uint32_t length) { write = putVarint(write, indexOf(bytes, length)); });
+		}
+
+		return out;
+	}
+
+	//======================================== host index ========================================//
+
+	//format 6 host index, ahead of the chunks: for each chunk [LEB128 records][LEB128 key count] and its keys, ascending and
+	//delta coded as LEB128. A chunk's keys are hostKey of Website::hash and Website::domainHash of its records' websites, so
+	//pm get/has/match decrypt the index and then only the chunks that can hold their answer. It is encrypted like a chunk
+	//(chunkEntropy with index == count), plain hashes of host names are reversed by hashing a list of likely names
+	uint32_t hostKey(uint64_t hash)
+	{
+		return static_cast<uint32_t>(hash);
+	}
+
+	static_assert(ENTRY_FIELDS[0].member == &Entry::website_, "chunkKeys reads the website as the first field of a record");
+
+	//ascending, distinct keys of the records putRecord wrote to [data, data + size), their number into records
+	Vector<uint32_t> chunkKeys(const uint8_t* data, std::size_t size, uint32_t& records)
+	{
+		Vector<uint32_t> keys;
+		Vector<char> website(Website::MAX_HOST);
+		const uint8_t* end = data + size;
+
+		records = 0;
+
+		for (const uint8_t* record = data; record < end; ++records)
+		{
+			//the website is bit 0 of the bitmap, absent means ""
+			const uint8_t* cursor = record + 1;
+			uint32_t length = 0;
+
+			if (*record & 1)
+				getVarint(cursor, cursor + 5, length);
+
+			if (website.size() <= length)
+				website = Vector<char>(length + 1);
+
+			std::memcpy(website.data(), cursor, length);
+			website[length] = '\0';
+
+			keys.emplace_back(hostKey(Website::hash(website.data())));
+			keys.emplace_back(hostKey(Website::domainHash(website.data())));
+
+			record = walkRecord(record, [](const uint8_t*, const uint8_t*) {}, [](const uint8_t*, uint32_t) {});
+		}
+
+		Sort(keys.data(), keys.data() + keys.size());
+
+		std::size_t distinct = 0;
+
+		for (std::size_t i{ 0 }; i < keys.size(); ++i)
+			if (distinct == 0 || keys[i] != keys[distinct - 1])
+				keys[distinct++] = keys[i];
+
+		keys.erase(keys.data() + distinct, keys.data() + keys.size());
+
+		return keys;
+	}
+
+	//plaintext host index of a file whose chunk i holds records[i] records with keys[i]
+	Vector<uint8_t> hostIndex(const Vector<Vector<uint32_t>>& keys, const Vector<uint32_t>& records)
+	{
+		std::size_t total = 0;
+
+		for (std::size_t i{ 0 }; i < keys.size(); ++i)
+		{
+			total += varintSize(records[i]) + varintSize(static_cast<uint32_t>(keys[i].size()));
+
+			for (std::size_t k{ 0 }; k < keys[i].size(); ++k)
+				total += varintSize(keys[i][k] - (k == 0 ? 0 : keys[i][k - 1]));
+		}
+
+		Vector<uint8_t> out(total);
+		uint8_t* write = out.data();
+
+		for (std::size_t i{ 0 }; i < keys.size(); ++i)
+		{
+			write = putVarint(write, records[i]);
+			write = putVarint(write, static_cast<uint32_t>(keys[i].size()));
+
+			for (std::size_t k{ 0 }; k < keys[i].size(); ++k)
+				write = putVarint(write, keys[i][k] - (k == 0 ? 0 : keys[i][k - 1]));
+		}
+
+		return out;
+	}
+
+	//hit(chunk, first, records) for every one of count chunks whose keys in the host index at [data, data + size) hold key,
+	//first being how many records come before it in the file
+	template <typename Hit>
+	void findInIndex(const uint8_t* data, std::size_t size, uint32_t count, uint32_t key, Hit&& hit)
+	{
+		const uint8_t* cursor = data;
+		const uint8_t* end = data + size;
+		std::size_t first = 0;
+
+		for (uint32_t i{ 0 }; i < count; ++i)
+		{
+			uint32_t records;
+			uint32_t keys;
+
+			if (!getVarint(cursor, end, records) || !getVarint(cursor, end, keys) || keys > static_cast<std::size_t>(end - cursor))
+				throw std::runtime_error("Corrupt vault index");
+
+			uint32_t value = 0;
+			bool found = false;
+
+			for (uint32_t k{ 0 }; k < keys; ++k)
+			{
+				uint32_t delta;
+
+				if (!getVarint(cursor, end, delta))
+					throw std::runtime_error("Corrupt vault index");
+
+				value += delta;
+				found = found || value == key;
+			}
+
+			if (found)
+				hit(i, first, records);
+
+			first += records;
+		}
+
+		if (cursor != end)
+			throw std::runtime_error("Corrupt vault index");
+	}
+
+	//fn(website, username, password, extras), one argument per field, for every compact record in size bytes. Fields are copied
+	//out with terminators into one reusable buffer, absent ones are "". extras is null for a record without any, and like the
+	//fields only valid during the call. names decodes the tag and field names: it holds a format 5 chunk's table, and carries
+	//a format 3 stream's numbering from one call to the next over the stream's chunks
+	template <typename Fn>
+	void forEachCompact(const uint8_t* data, std::size_t size, NameReader& names, Fn&& fn)
+	{
+		const uint8_t* cursor = data;
+		const uint8_t* end = data + size;
+
+		Vector<char> text;
+		EntryExtras extras;
+
+		//LEB128 count of items at least a byte each, so no more than what is left
+		auto readCount = [&]()
+			{
+				uint32_t count;
+
+				if (!getVarint(cursor, end, count) || count > static_cast<std::size_t>(end - cursor))
+					throw std::runtime_error("Corrupt vault record");
+
+				return count;
+			};
+
+		while (cursor < end)
+		{
+			uint8_t bitmap = *cursor++;
+
+			if (bitmap & ~KNOWN_FIELDS)
+				throw std::runtime_error("Vault was written by a newer version");
+
+			const uint8_t* starts[ENTRY_FIELD_COUNT] = {};
+			uint32_t lengths[ENTRY_FIELD_COUNT] = {};
+			std::size_t total = ENTRY_FIELD_COUNT;
+
+			forEachField([&](auto i)
+				{
+					if (!(bitmap & (1u << i)))
+						return;
+
+					if (!getVarint(cursor, end, lengths[i]) || lengths[i] > MAX_FIELD || lengths[i] > static_cast<std::size_t>(end - cursor))
+						throw std::runtime_error("Corrupt vault record");
+
+					starts[i] = cursor;
+					cursor += lengths[i];
+					total += lengths[i];
+				});
+
+			if (bitmap & EXTRAS)
+			{
+				extras.clear();
+
+				for (uint32_t tags = readCount(); tags > 0; --tags)
+					extras.tags.emplace_back(extras.addText(names.read(cursor, end)));
+
+				for (uint32_t fields = readCount(); fields > 0; --fields)
+				{
+					uint32_t name = extras.addText(names.read(cursor, end));
+					uint32_t value;
+
+					if (cursor == end)
+						throw std::runtime_error("Corrupt vault record");
+
+					uint8_t type = *cursor++;
+
+					if (type > EntryExtras::Attachment)
+						throw std::runtime_error("Vault was written by a newer version");
+
+					if (!getVarint(cursor, end, value))
+						throw std::runtime_error("Corrupt vault record");
+
+					if (type != EntryExtras::Date)
+					{
+						if (value > MAX_FIELD || value > static_cast<std::size_t>(end - cursor))
+							throw std::runtime_error("Corrupt vault record");
+
+						std::size_t length = value;
+						value = appendText(extras.text, reinterpret_cast<const char*>(cursor), length);
+						cursor += length;
+					}
+
+					extras.fields.emplace_back(EntryExtras::Field{ name, static_cast<EntryExtras::Type>(type), value });
+				}
+			}
+
+			if (text.size() < total)
+				text = Vector<char>(total);
+
+			const char* fields[ENTRY_FIELD_COUNT];
+			char* out = text.data();
+
+			forEachField([&](auto i)
+				{
+					fields[i] = out;
+
+					if (lengths[i] > 0)
+						std::memcpy(out, starts[i], lengths[i]);
+
+					out += lengths[i];
+					*out++ = '\0';
+				});
+
+			applyFields(fn, fields, (bitmap & EXTRAS) ? &extras : nullptr, std::make_index_sequence<ENTRY_FIELD_COUNT>{});
+		}
+	}
+}
+
+//positions in entries whose website or username contains term, case insensitive
+Vector<std::size_t> searchEntries(const Vector<Entry>& entries, const char* term)
+{
+	Vector<std::size_t> matches;
+	std::size_t termLength = strlen(term);
+
+	auto contains = [&](const char* field)
+		{
+			std::size_t fieldLength = strlen(field);
+
+			for (std::size_t i{ 0 }; i + termLength <= fieldLength; ++i)
+			{
+				std::size_t j = 0;
+				while (j < termLength && Website::lower(field[i + j]) == Website::lower(term[j]))
+					++j;
+
+				if (j == termLength)
+					return true;
+			}
+
+			return false;
+		};
+
+	for (std::size_t i{ 0 }; i < entries.size(); ++i)
+		if (contains(entries[i].website_) || contains(entries[i].username_))
+			matches.emplace_back(i);
+
+	return matches;
+}
+
+//true if both hold the same value in every field
+bool sameEntry(const Entry& a, const Entry& b)
+{
+	bool same = true;
+
+	forEachField([&](auto i)
+		{
+			same = same && std::strcmp(a.*ENTRY_FIELDS[i].member, b.*ENTRY_FIELDS[i].member) == 0;
+		});
+
+	return same && sameExtras(a.extras_.get(), b.extras_.get());
+}
+
+//one mutation, recorded by content rather than position so it can be replayed onto a vault another process saved in the meantime
+struct JournalOp
+{
+	enum Kind : uint8_t { Add, Delete, Edit };
+
+	Kind kind;
+	Entry entry; //Add: the new entry. Delete, Edit: the entry as it was
+	UniquePtr<Entry> replacement; //Edit only
+
+	JournalOp(Kind k, const Entry& e)
+		: kind(k), entry(e.clone())
+	{
+	}
+
+	JournalOp(const Entry& before, const Entry& after)
+		: kind(Edit), entry(before.clone()), replacement(makeUnique<Entry>(after.clone()))
+	{
+	}
+
+	JournalOp(const JournalOp& other)
+		: kind(other.kind), entry(other.entry.clone())
+	{
+		if (other.replacement)
+			replacement = makeUnique<Entry>(other.replacement->clone());
+	}
+
+	JournalOp(JournalOp&&) = default;
+	JournalOp& operator= (JournalOp&&) = default;
+};
+
+//hash of every field, equal entries hash equal
+uint64_t entryHash(const Entry& e)
+{
+	uint64_t h = FNV_OFFSET;
+
+	forEachField([&](auto i)
+		{
+			const char* value = e.*ENTRY_FIELDS[i].member;
+			h = fnv1aStep(fnv1a(value, strlen(value), h), 0); //separator so ("ab", "c") != ("a", "bc")
+		});
+
+	return h;
+}
+
+//apply journal on top of entries. Every op is idempotent, so ops the other side already has are no-ops:
+//adds skip existing entries, deletes of missing entries do nothing, an edit whose original is gone keeps the new value as an add.
+//entries are looked up through a hash of the vault built once, so replaying a big import costs O(n + m) rather than a scan per op.
+//deletes leave their slot in place until the end, then the survivors close ranks in one pass
+void replayJournal(Vector<Entry>& entries, const Vector<JournalOp>& journal)
+{
+	if (journal.empty())
+		return;
+
+	FlatMultimap<uint32_t> positions;
+	positions.reserve(entries.size() + journal.size());
+
+	for (std::size_t i{ 0 }; i < entries.size(); ++i)
+		positions.insert(entryHash(entries[i]), static_cast<uint32_t>(i));
+
+	Vector<std::size_t> deleted;
+
+	//position of the first live Entry equal to e, or entries.size()
+	auto find = [&](const Entry& e)
+		{
+			std::size_t at = entries.size();
+
+			positions.forEach(entryHash(e), [&](uint32_t p)
+				{
+					if (p < at && sameEntry(entries[p], e))
+						at = p;
+				});
+
+			return at;
+		};
+
+	auto append = [&](const Entry& e)
+		{
+			entries.emplace_back(e.clone());
+			positions.insert(entryHash(e), static_cast<uint32_t>(entries.size() - 1));
+		};
+
+	for (const JournalOp& op : journal)
+	{
+		std::size_t at = find(op.entry);
+		bool found = at < entries.size();
+
+		if (op.kind == JournalOp::Add)
+		{
+			if (!found)
+				append(op.entry);
+		}
+		else if (op.kind == JournalOp::Delete)
+		{
+			if (found)
+			{
+				positions.erase(entryHash(entries[at]), static_cast<uint32_t>(at));
+				deleted.emplace_back(at);
+			}
+		}
+		else
+		{
+			const Entry& next = *op.replacement;
+
+			if (found)
+			{
+				positions.erase(entryHash(entries[at]), static_cast<uint32_t>(at));
+				entries[at] = next.clone();
+				positions.insert(entryHash(entries[at]), static_cast<uint32_t>(at));
+			}
+			else if (find(next) == entries.size())
+				append(next);
+		}
+	}
+
+	//each position is deleted at most once, it leaves positions when it is
+	Sort(deleted.data(), deleted.data() + deleted.size());
+	entries.erase_indices(deleted.data(), deleted.data() + deleted.size());
+}
+
+//records sharing a key: same normalized host and username. The password is the value a merge reconciles
+bool sameKey(const Entry& a, const Entry& b)
+{
+	return std::strcmp(a.username_, b.username_) == 0 && Website::equal(a.website_, b.website_);
+}
+
+//outcome of a three way merge, as changes to ours
+struct MergePlan
+{
+	struct Conflict
+	{
+		const Entry* entry; //any record with the key, for reporting
+		const char* reason;
+	};
+
+	Vector<std::size_t> drop; //positions in ours to delete, ascending
+	Vector<std::size_t> take; //positions in theirs to add
+	Vector<Conflict> conflicts; //keys both sides changed differently, ours is kept
+};
+
+//three way merge of ours and theirs against their common ancestor base, key by key. A key one side left as it was in base
+//takes the other side's records, a key both sides changed the same way is already merged, anything else is a conflict.
+//records are grouped through one hash map per side, so the whole merge is O(n)
+MergePlan planMerge(const Vector<Entry>& base, const Vector<Entry>& ours, const Vector<Entry>& theirs)
+{
+	const Vector<Entry>* sides[3] = { &ours, &theirs, &base };
+	FlatMultimap<uint32_t> index[3];
+
+	for (int s{ 0 }; s < 3; ++s)
+	{
+		index[s].reserve(sides[s]->size());
+
+		for (std::size_t i{ 0 }; i < sides[s]->size(); ++i)
+			index[s].insert(Website::credentialHash((*sides[s])[i].website_, (*sides[s])[i].username_), static_cast<uint32_t>(i));
+	}
+
+	//positions on side s with key, ascending
+	auto group = [&](int s, uint64_t h, const Entry& key)
+		{
+			Vector<std::size_t> matches;
+
+			index[s].forEach(h, [&](uint32_t i)
+				{
+					if (sameKey((*sides[s])[i], key))
+						matches.emplace_back(i);
+				});
+
+			Sort(matches.data(), matches.data() + matches.size());
+			return matches;
+		};
+
+	//same passwords and extras, counting repeats, in any order. Groups are a handful of records at most
+	auto sameGroup = [&](int a, const Vector<std::size_t>& ga, int b, const Vector<std::size_t>& gb)
+		{
+			if (ga.size() != gb.size())
+				return false;
+
+			Vector<bool> used(gb.size());
+
+			for (std::size_t i : ga)
+			{
+				std::size_t j = 0;
+
+				auto differs = [&](const Entry& x, const Entry& y)
+					{
+						return std::strcmp(x.password_, y.password_) != 0 || !sameExtras(x.extras_.get(), y.extras_.get());
+					};
+
+				while (j < gb.size() && (used[j] || differs((*sides[a])[i], (*sides[b])[gb[j]])))
+					++j;
+
+				if (j == gb.size())
+					return false;
+
+				used[j] = true;
+			}
+
+			return true;
+		};
+
+	MergePlan plan;
+
+	//visit every key once, at its first record in ours, then theirs, then base
+	for (int s{ 0 }; s < 3; ++s)
+	{
+		for (std::size_t i{ 0 }; i < sides[s]->size(); ++i)
+		{
+			const Entry& key = (*sides[s])[i];
+			uint64_t h = Website::credentialHash(key.website_, key.username_);
+
+			Vector<std::size_t> groups[3];
+			bool seen = false;
+
+			for (int t{ 0 }; t <= s && !seen; ++t)
+			{
+				groups[t] = group(t, h, key);
+				seen = t < s ? !groups[t].empty() : groups[t][0] != i;
+			}
+
+			if (seen)
+				continue;
+
+			for (int t{ s + 1 }; t < 3; ++t)
+				groups[t] = group(t, h, key);
+
+			const Vector<std::size_t>& here = groups[0];
+			const Vector<std::size_t>& there = groups[1];
+			const Vector<std::size_t>& before = groups[2];
+
+			//unchanged there, or both made the same change
+			if (sameGroup(1, there, 2, before) || sameGroup(0, here, 1, there))
+				continue;
+
+			//unchanged here: theirs wins
+			if (sameGroup(0, here, 2, before))
+			{
+				for (std::size_t pos : here)
+					plan.drop.emplace_back(pos);
+
+				for (std::size_t pos : there)
+					plan.take.emplace_back(pos);
+
+				continue;
+			}
+
+			const char* reason = before.empty() ? "added differently on both sides"
+				: here.empty() ? "deleted here, changed there"
+				: there.empty() ? "changed here, deleted there"
+				: "changed differently on both sides";
+
+			plan.conflicts.emplace_back(MergePlan::Conflict{ &key, reason });
+		}
+	}
+
+	Sort(plan.drop.data(), plan.drop.data() + plan.drop.size());
+
+	return plan;
+}
+
+//what the background saver last wrote, so the Vault can tell its own saves apart from other processes'
+struct SaveStatus
+{
+	std::atomic<uint64_t> generation{ 0 }; //header generation of the last file written
+	std::atomic<bool> merged{ false }; //a write found another process's save and merged into it
+};
+
+//immutable copy of the entry table and its host index, published for concurrent readers.
+//never modified after publish, readers hold it through a shared_ptr so the writer can swap in the next version without waiting on them
+struct VaultSnapshot
+{
+	Vector<Entry> entries;
+	FlatMultimap<uint32_t> siteIndex;
+	BloomFilter bloom; //empty if the vault had none, lets the background saver restamp entries.bloom
+	uint64_t version = 0;
+	uint64_t base = 0; //entries.bin header generation the entries were read from
+	Vector<JournalOp> journal; //changes since base, for the saver to replay if another process saved first
+
+	//positions whose host matches website, ascending
+	Vector<std::size_t> findWebsite(const char* website) const
+	{
+		Vector<std::size_t> matches;
+
+		siteIndex.forEach(Website::hash(website), [&](uint32_t pos)
+			{
+				if (Website::equal(entries[pos].website_, website))
+					matches.emplace_back(pos);
+			});
+
+		Sort(matches.data(), matches.data() + matches.size());
+
+		return matches;
+	}
+
+	Vector<std::size_t> findText(const char* term) const
+	{
+		return searchEntries(entries, term);
+	}
+};
+
+//atomic slot for the current snapshot. Wrapped so Vault keeps its move operations (std::atomic itself is not movable)
+class SnapshotSlot
+{
+private:
+	std::atomic<std::shared_ptr<const VaultSnapshot>> m_current;
+
+public:
+	SnapshotSlot() = default;
+
+	SnapshotSlot(SnapshotSlot&& other) noexcept
+		: m_current(other.m_current.load())
+	{
+	}
+
+	SnapshotSlot& operator= (SnapshotSlot&& other) noexcept
+	{
+		m_current.store(other.m_current.load());
+		return *this;
+	}
+
+	std::shared_ptr<const VaultSnapshot> load() const { return m_current.load(std::memory_order_acquire); }
+
+	void store(std::shared_ptr<const VaultSnapshot> next) { m_current.store(std::move(next), std::memory_order_release); }
+};
+
+//how deleteEntryAndSave gets its yes/no. Ask prompts on std::cin, non interactive callers pick Always or Refuse
+enum class ConfirmPolicy
+{
+	Ask,
+	Always,
+	Refuse
+};
+
+class Vault
+{
+private:
+	mutable Vector<Entry> m_entries;
+	mutable bool m_loaded = false;
+
+	//which entries.bin m_entries came from, or was last saved as. Lets readVault skip the decrypt when nothing changed
+	mutable AtomicFile::FileStamp m_stamp;
+	mutable uint64_t m_generation = 0;
+
+	//changes not yet known to be on disk. A save that finds another process saved first replays these onto its file
+	mutable Vector<JournalOp> m_journal;
+	std::size_t m_journalMark = 0; //journal size at beginTransaction, abort drops everything after it
+
+	//concurrent mode: committed state is copied into an immutable snapshot that readers on any thread pick up without locking
+	mutable SnapshotSlot m_published;
+	mutable bool m_snapshots = false;
+	mutable uint64_t m_version = 0;
+
+	//copy the committed state into a fresh snapshot and swap it in. O(n), runs on the writer, readers keep whatever version they hold
+	void publish() const
+	{
+		if (!m_snapshots)
+			return;
+
+		std::shared_ptr<VaultSnapshot> next = std::make_shared<VaultSnapshot>();
+		next->entries.reserve(m_entries.size());
+
+		for (const Entry& e : m_entries)
+			next->entries.emplace_back(e.clone());
+
+		next->siteIndex = m_siteIndex;
+		next->version = ++m_version;
+		next->base = m_generation;
+
+		next->journal.reserve(m_journal.size());
+		for (const JournalOp& op : m_journal)
+			next->journal.emplace_back(op);
+
+		if (m_bloomValid)
+			next->bloom = m_bloom;
+
+		m_published.store(std::move(next));
+	}
+
+	//background saver, null unless enableAsyncSave was called
+	UniquePtr<SaveWorker<VaultSnapshot>> m_saver;
+	std::shared_ptr<SaveStatus> m_saveStatus;
+
+	//persist the committed state: write it here, or publish it and hand the snapshot to the background saver
+	void save()
+	{
+		if (m_saver)
+		{
+			publish();
+			m_saver->submit(m_published.load());
+			m_loaded = true;
+			return;
+		}
+
+		writeTemp();
+		publish();
+	}
+
+	ConfirmPolicy m_confirm = ConfirmPolicy::Ask;
+	bool m_quiet = false; //skip the full listing after each save, for callers that are not a terminal
+
+	//open begin/commit transaction: mutations stay in memory and one writeTemp runs at commit
+	bool m_inTransaction = false;
+	bool m_dirty = false; //m_entries differs from entries.bin
+
+	//write now, or defer to commit while a transaction is open
+	void saveAndList()
+	{
+		if (m_inTransaction)
+		{
+			m_dirty = true;
+			return;
+		}
+
+		save();
+
+		if (!m_quiet)
+			listAllEntries();
+	}
+
+	//normalized host -> position in m_entries
+	mutable FlatMultimap<uint32_t> m_siteIndex;
+
+	//registrable domain -> position in m_entries, for autofill style lookups
+	mutable FlatMultimap<uint32_t> m_domainIndex;
+
+	//tag -> positions in m_entries, for tag queries
+	mutable TagIndex m_tagIndex;
+
+	//add the Entry at index to both website indexes and its tags to the tag index
+	void indexEntry(std::size_t index) const
+	{
+		const Entry& e = m_entries[index];
+
+		m_siteIndex.insert(Website::hash(e.website_), static_cast<uint32_t>(index));
+		m_domainIndex.insert(Website::domainHash(e.website_), static_cast<uint32_t>(index));
+
+		if (e.extras_)
+			for (uint32_t tag : e.extras_->tags)
+				m_tagIndex.add(e.extras_->str(tag), static_cast<uint32_t>(index));
+	}
+
+	//remove the Entry at index from every index, call before the Entry changes
+	void unindexEntry(std::size_t index) const
+	{
+		const Entry& e = m_entries[index];
+
+		m_siteIndex.erase(Website::hash(e.website_), static_cast<uint32_t>(index));
+		m_domainIndex.erase(Website::domainHash(e.website_), static_cast<uint32_t>(index));
+
+		if (e.extras_)
+			for (uint32_t tag : e.extras_->tags)
+				m_tagIndex.remove(e.extras_->str(tag), static_cast<uint32_t>(index));
+	}
+
+	//rebuild the website and tag indexes from scratch, used after a load or after positions shift
+	void rebuildSiteIndex() const
+	{
+		m_siteIndex.clear();
+		m_domainIndex.clear();
+		m_tagIndex.clear();
+		m_siteIndex.reserve(m_entries.size());
+		m_domainIndex.reserve(m_entries.size());
+
+		for (std::size_t i{ 0 }; i < m_entries.size(); ++i)
+			indexEntry(i);
+	}
+
+	//prefilter for "is anything stored for this host / credential" questions. Persisted next to the vault as entries.bloom
+	mutable BloomFilter m_bloom;
+	mutable bool m_bloomValid = false; //m_bloom covers every Entry currently in the vault
+
+	//both keys for the Entry at index
+	void bloomEntry(std::size_t index) const
+	{
+		m_bloom.add(Website::hash(m_entries[index].website_));
+		m_bloom.add(Website::credentialHash(m_entries[index].website_, m_entries[index].username_));
+	}
+
+	//size for two keys per Entry plus headroom for adds, then fill. A vault without a filter yet gets a fresh secret key
+	void rebuildBloom() const
+	{
+		if (!m_bloom.hasKey())
+		{
+			uint8_t key[BloomFilter::KEY_SIZE];
+
+			if (!BCRYPT_SUCCESS(BCryptGenRandom(nullptr, key, sizeof(key), BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+				throw std::runtime_error("Could not generate filter key");
+
+			m_bloom.setKey(key);
+		}
+
+		m_bloom.reset((m_entries.size() + m_entries.size() / 2) * 2);
+
+		for (std::size_t i{ 0 }; i < m_entries.size(); ++i)
+			bloomEntry(i);
+
+		m_bloomValid = true;
+	}
+
+	//keep the filter in step with an appended or edited Entry, rebuild bigger once it fills up
+	void updateBloom(std::size_t index) const
+	{
+		if (!m_bloomValid || m_bloom.full())
+			rebuildBloom();
+		else
+			bloomEntry(index);
+	}
+
+	//["PMB2"][vault size][vault time][uint32 size][DPAPI encrypted filter key][filter], stamped against entries.bin as it is on
+	//disk right now so a filter from another vault state is never trusted. Only the vault's owner can unwrap the key, and without
+	//it the filter bits say nothing about which hosts are in the vault. The magic changes whenever the hashed host does, so an
+	//older filter is rebuilt rather than missing hosts (PMB2: a leading "www." only goes where Website::dropsWww says)
+	static void writeBloomFile(const BloomFilter& bloom)
+	{
+		AtomicFile::FileStamp stamp;
+
+		if (!AtomicFile::stamp("entries.bin", stamp))
+			return;
+
+		uint8_t key[BloomFilter::KEY_SIZE];
+		bloom.key(key);
+
+		Vector<uint8_t> wrapped = Crypto::encryptData(key, sizeof(key));
+		uint32_t wrappedSize = static_cast<uint32_t>(wrapped.size());
+
+		//a cache, rebuilt from the vault if lost, so no flush
+		AtomicFile::Writer out("entries.bloom");
+
+		out.write(reinterpret_cast<const uint8_t*>("PMB2"), 4);
+		out.write(reinterpret_cast<const uint8_t*>(&stamp.size), sizeof(stamp.size));
+		out.write(reinterpret_cast<const uint8_t*>(&stamp.time), sizeof(stamp.time));
+		out.write(reinterpret_cast<const uint8_t*>(&wrappedSize), sizeof(wrappedSize));
+		out.write(wrapped.data(), wrapped.size());
+		bloom.write(out);
+
+		out.commit(false);
+	}
+
+	void writeBloom() const
+	{
+		if (m_bloomValid)
+			writeBloomFile(m_bloom);
+	}
+
+	//adopt entries.bloom if it matches entries.bin. Only reads the sidecar and unwraps its key, the vault itself stays encrypted on disk
+	bool loadBloom() const
+	{
+		AtomicFile::FileStamp stamp;
+
+		if (!AtomicFile::stamp("entries.bin", stamp))
+			return false;
+
+		std::ifstream in("entries.bloom", std::ios::binary);
+
+		if (!in)
+			return false;
+
+		char magic[4]{};
+		AtomicFile::FileStamp saved;
+		uint32_t wrappedSize = 0;
+
+		in.read(magic, 4);
+		in.read(reinterpret_cast<char*>(&saved.size), sizeof(saved.size));
+		in.read(reinterpret_cast<char*>(&saved.time), sizeof(saved.time));
+		in.read(reinterpret_cast<char*>(&wrappedSize), sizeof(wrappedSize));
+
+		//a DPAPI blob of 16 bytes is a few hundred bytes
+		if (!in || std::memcmp(magic, "PMB2", 4) != 0 || saved != stamp || wrappedSize > 4096)
+			return false;
+
+		Vector<uint8_t> wrapped(wrappedSize);
+		in.read(reinterpret_cast<char*>(wrapped.data()), wrappedSize);
+
+		if (!in)
+			return false;
+
+		Vector<uint8_t> key;
+
+		try
+		{
+			key = Crypto::decryptData(wrapped);
+		}
+		catch (const std::exception&)
+		{
+			return false;
+		}
+
+		if (key.size() != BloomFilter::KEY_SIZE)
+			return false;
+
+		BloomFilter loaded;
+
+		if (!loaded.read(in))
+			return false;
+
+		uint8_t raw[BloomFilter::KEY_SIZE];
+		std::memcpy(raw, key.data(), sizeof(raw));
+		loaded.setKey(raw);
+
+		m_bloom = std::move(loaded);
+		m_bloomValid = true;
+
+		return true;
+	}
+
+	//true only when the filter proves key is absent. Falls back to the sidecar before the vault is loaded
+	bool definitelyAbsent(uint64_t key) const
+	{
+		if (!m_bloomValid && !m_loaded)
+			loadBloom();
+
+		return m_bloomValid && !m_bloom.mayContain(key);
+	}
+
+	//positions whose website passes match, ascending
+	template <typename Match>
+	Vector<std::size_t> collect(const FlatMultimap<uint32_t>& index, uint64_t hash, Match&& match) const
+	{
+		Vector<std::size_t> matches;
+
+		index.forEach(hash, [&](uint32_t pos)
+			{
+				//hash matched, confirm the actual website
+				if (match(m_entries[pos].website_))
+					matches.emplace_back(pos);
+			});
+
+		Sort(matches.data(), matches.data() + matches.size());
+
+		return matches;
+	}
+
+	//print a list of positions or a not found line, returns how many were printed. The entries come from m_entries, or from
+	//found when findUnloaded answered without loading the vault (found[i] sits at matches[i])
+	std::size_t printMatches(const Vector<std::size_t>& matches, const char* website, const Vector<Entry>* found = nullptr) const
+	{
+		std::cout << "\n";
+
+		if (matches.empty())
+			std::cout << "No entries for " << website << "\n";
+
+		for (std::size_t i{ 0 }; i < matches.size(); ++i)
+			printEntry(matches[i], found ? (*found)[i] : m_entries[matches[i]]);
+
+		std::cout << "\n";
+
+		return matches.size();
+	}
+
+	//single row of listAllEntries formatting, entry being the one at index
+	static void printEntry(std::size_t index, const Entry& entry)
+	{
+		std::cout << std::setw(4) << "[Index " << index << " - " << "Website: "
+			<< std::setw(16) << std::left << entry.website_ << " | Username: "
+			<< std::setw(16) << std::left << entry.username_ << " | Password: "
+			<< std::setw(16) << std::left << entry.password_ << "]\n";
+
+		if (VaultFile::hasExtras(entry))
+			printExtras(*entry.extras_);
+	}
+
+	//"[attachment, N bytes]" from the blob header alone, the contents stay on disk
+	static void printAttachment(const char* id)
+	{
+		char path[MAX_PATH];
+		uint8_t idBytes[Attachments::ID_SIZE];
+
+		if (!Attachments::parseId(id, idBytes))
+		{
+			std::cout << "[corrupt attachment id]";
+			return;
+		}
+
+		Attachments::blobPath(id, path);
+
+		std::ifstream in(path, std::ios::binary);
+		uint8_t bytes[Attachments::HEADER_SIZE];
+
+		if (!in.read(reinterpret_cast<char*>(bytes), sizeof(bytes)))
+		{
+			std::cout << "[attachment missing]";
+			return;
+		}
+
+		std::cout << "[attachment, " << Attachments::parseHeader(bytes).size << " bytes]";
+	}
+
+	//indented line of tags and custom fields under an entry: "      tags: a, b | notes: text | rotated: 2026-01-31"
+	static void printExtras(const EntryExtras& x)
+	{
+		std::cout << "      ";
+
+		const char* separator = "";
+
+		if (!x.tags.empty())
+		{
+			std::cout << "tags: ";
+
+			for (std::size_t i{ 0 }; i < x.tags.size(); ++i)
+				std::cout << (i == 0 ? "" : ", ") << x.str(x.tags[i]);
+
+			separator = " | ";
+		}
+
+		for (const EntryExtras::Field& f : x.fields)
+		{
+			std::cout << separator << x.str(f.name) << ": ";
+			separator = " | ";
+
+			if (f.type == EntryExtras::Text)
+				std::cout << x.str(f.value);
+			else if (f.type == EntryExtras::Date)
+			{
+				char date[16];
+				Dates::format(f.value, date);
+				std::cout << date;
+			}
+			else
+				printAttachment(x.str(f.value));
+		}
+
+		std::cout << "\n";
+	}
+
+	//compact record (VaultFile::putRecord) of every Entry that passes keep. Static so the background saver can run it on a snapshot
+	template <typename Keep>
+	static Vector<uint8_t> serialize(const Vector<Entry>& entries, Keep&& keep)
+	{
+		//compute total serialized size (bytes). Could use uint32_t but 64_t helps prevent risk of overflow
+		uint64_t totalSize = 0;
+
+		for (const auto& e : entries)
+			if (keep(e))
+				totalSize += VaultFile::recordSize(e);
+
+		//allocate buffer of exactly totalSize
+		Vector<uint8_t> buffer(totalSize);
+
+		uint8_t* cursor = buffer.data();//ptr for advancing through buffer
+
+		for (const auto& e : entries)
+			if (keep(e))
+				cursor = VaultFile::putRecord(cursor, e);
+
+		return buffer;
+	}
+
+	static Vector<uint8_t> serialize(const Vector<Entry>& entries)
+	{
+		return serialize(entries, [](const Entry&) { return true; });
+	}
+
+	//encrypt plainBytes, a stream serialize wrote, in chunks of whole records behind a header carrying generation and atomically
+	//replace path with them. Each chunk has its names moved into a table (VaultFile::tableChunk) and is Lz compressed first if
+	//compressed is set, the host index (VaultFile::hostIndex) goes ahead of them. A crash mid save leaves the previous file intact
+	static void writeEncrypted(const char* path, const Vector<uint8_t>& plainBytes, uint64_t generation, bool sync, bool compressed = false)
+	{
+		//cut points: a chunk closes before the record that would take it past CHUNK
+		Vector<std::size_t> cuts;
+		const uint8_t* plain = plainBytes.data();
+		std::size_t start = 0;
+		std::size_t at = 0;
+
+		while (at < plainBytes.size())
+		{
+			std::size_t record = VaultFile::recordEnd(plain, at);
+
+			if (at > start && record - start > VaultFile::CHUNK)
+			{
+				cuts.push_back(at);
+				start = at;
+			}
+
+			at = record;
+		}
+
+		if (at > start)
+			cuts.push_back(at);
+
+		uint32_t count = static_cast<uint32_t>(cuts.size());
+		Vector<Vector<uint8_t>> ciphers(count);
+		Vector<Vector<uint32_t>> keys(count);
+		Vector<uint32_t> records(count);
+		uint32_t recordCount = 0;
+
+		//[uint32 size][Lz stream] per chunk, reused across chunks
+		Vector<uint8_t> packed;
+
+		for (uint32_t i{ 0 }; i < count; ++i)
+		{
+			std::size_t from = i == 0 ? 0 : cuts[i - 1];
+			Vector<uint8_t> chunk = VaultFile::tableChunk(plain + from, cuts[i] - from);
+			keys[i] = VaultFile::chunkKeys(plain + from, cuts[i] - from, records[i]);
+			recordCount += records[i];
+
+			uint32_t size = static_cast<uint32_t>(chunk.size());
+			uint8_t entropy[16];
+			VaultFile::chunkEntropy(entropy, generation, i, count);
+
+			if (compressed)
+			{
+				if (packed.size() < sizeof(size) + Lz::bound(size))
+					packed = Vector<uint8_t>(sizeof(size) + Lz::bound(size));
+
+				std::memcpy(packed.data(), &size, sizeof(size));
+				std::size_t packedSize = sizeof(size) + Lz::compress(chunk.data(), size, packed.data() + sizeof(size));
+
+				ciphers[i] = Crypto::encryptData(packed.data(), packedSize, entropy, sizeof(entropy));
+			}
+			else
+				ciphers[i] = Crypto::encryptData(chunk.data(), size, entropy, sizeof(entropy));
+		}
+
+		Vector<uint8_t> indexPlain = VaultFile::hostIndex(keys, records);
+		uint8_t indexEntropy[16];
+		VaultFile::chunkEntropy(indexEntropy, generation, count, count);
+
+		Vector<uint8_t> index = Crypto::encryptData(indexPlain.data(), indexPlain.size(), indexEntropy, sizeof(indexEntropy));
+		uint32_t indexSize = static_cast<uint32_t>(index.size());
+
+		std::size_t total = VaultFile::HEADER_SIZE + sizeof(count) + sizeof(recordCount) + sizeof(indexSize) + index.size();
+
+		for (const Vector<uint8_t>& cipher : ciphers)
+			total += sizeof(uint32_t) + cipher.size();
+
+		VaultFile::Header header;
+		header.format = VaultFile::FORMAT;
+		header.flags = compressed ? VaultFile::FLAG_COMPRESSED : 0;
+		header.generation = generation;
+
+		Vector<uint8_t> file(total);
+		VaultFile::writeHeader(file.data(), header);
+
+		uint8_t* cursor = file.data() + VaultFile::HEADER_SIZE;
+		std::memcpy(cursor, &count, sizeof(count));
+		cursor += sizeof(count);
+		std::memcpy(cursor, &recordCount, sizeof(recordCount));
+		cursor += sizeof(recordCount);
+		std::memcpy(cursor, &indexSize, sizeof(indexSize));
+		std::memcpy(cursor + sizeof(indexSize), index.data(), index.size());
+		cursor += sizeof(indexSize) + index.size();
+
+		for (const Vector<uint8_t>& cipher : ciphers)
+		{
+			uint32_t size = static_cast<uint32_t>(cipher.size());
+			std::memcpy(cursor, &size, sizeof(size));
+			std::memcpy(cursor + sizeof(size), cipher.data(), cipher.size());
+			cursor += sizeof(size) + cipher.size();
+		}
+
+		//write path.tmp, flush if sync, rename over path
+		AtomicFile::replace(path, file.data(), file.size(), sync);
+	}
+
+	//run work(shard) for every shard in mask, one thread each. Rethrows the first failure once all have finished
+	template <typename Work>
+	static void forEachShard(uint64_t mask, Work&& work)
+	{
+		Vector<std::thread> threads;
+		std::exception_ptr errors[VaultFile::MAX_SHARDS];
+
+		for (uint32_t i{ 0 }; i < VaultFile::MAX_SHARDS; ++i)
+		{
+			if (!(mask & (uint64_t{ 1 } << i)))
+				continue;
+
+			threads.emplace_back([&work, &errors, i]()
+				{
+					try
+					{
+						work(i);
+					}
+					catch (...)
+					{
+						errors[i] = std::current_exception();
+					}
+				});
+		}
+
+		for (std::thread& t : threads)
+			t.join();
+
+		for (const std::exception_ptr& error : errors)
+			if (error)
+				std::rethrow_exception(error);
+	}
+
+	//mask with every one of shards set
+	static uint64_t allShards(uint32_t shards)
+	{
+		return shards >= 64 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << shards) - 1;
+	}
+
+	//shards whose contents differ once journal is applied, the only ones a save has to rewrite
+	static uint64_t touchedShards(const Vector<JournalOp>& journal, uint32_t shards)
+	{
+		uint64_t mask = 0;
+
+		if (shards == 0)
+			return mask;
+
+		for (const JournalOp& op : journal)
+		{
+			mask |= uint64_t{ 1 } << VaultFile::shardOf(op.entry.website_, shards);
+
+			if (op.replacement)
+				mask |= uint64_t{ 1 } << VaultFile::shardOf(op.replacement->website_, shards);
+		}
+
+		return mask;
+	}
+
+	//write entries as generation. shards = 0 is the single entries.bin, otherwise the shards in touched, in parallel, then a new manifest.
+	//each file is replaced atomically and the manifest goes last, so its new generation is the signal that the whole save is on disk
+	static void writeVault(const Vector<Entry>& entries, uint64_t generation, bool sync, uint32_t shards, uint64_t touched, bool compressed)
+	{
+		if (shards == 0)
+		{
+			writeEncrypted("entries.bin", serialize(entries), generation, sync, compressed);
+			return;
+		}
+
+		forEachShard(touched, [&](uint32_t shard)
+			{
+				char path[MAX_PATH];
+				VaultFile::shardPath("entries.bin", shard, path);
+
+				writeEncrypted(path, serialize(entries, [&](const Entry& e) { return VaultFile::shardOf(e.website_, shards) == shard; }), generation, sync, compressed);
+			});
+
+		VaultFile::Header manifest;
+		manifest.format = VaultFile::FORMAT;
+		manifest.flags = VaultFile::FLAG_SHARDED | (compressed ? VaultFile::FLAG_COMPRESSED : 0);
+		manifest.generation = generation;
+		manifest.shards = shards;
+
+		uint8_t bytes[VaultFile::HEADER_SIZE + sizeof(manifest.shards)];
+		VaultFile::writeHeader(bytes, manifest);
+
+		AtomicFile::replace("entries.bin", bytes, sizeof(bytes), sync);
+	}
+
+	//flush to disk on every m_syncEvery-th save. 1 = every save (default), 0 = never, rely on the atomic rename alone
+	unsigned m_syncEvery = 1;
+	unsigned m_unsynced = 0;
+
+	//true if this save should flush, advances the batch counter
+	bool syncDue()
+	{
+		if (m_syncEvery == 0)
+			return false;
+
+		if (++m_unsynced < m_syncEvery)
+			return false;
+
+		m_unsynced = 0;
+		return true;
+	}
+
+	//another process saved since m_entries was read: start from its file and replay our journal on top
+	void mergeFromDisk()
+	{
+		AtomicFile::FileStamp stamp;
+		VaultFile::Header header;
+		Vector<Entry> theirs;
+
+		if (AtomicFile::stamp("entries.bin", stamp) && stamp.size > 0)
+			readEntries("entries.bin", theirs, header, stamp);
+
+		replayJournal(theirs, m_journal);
+		m_entries = std::move(theirs);
+
+		rebuildSiteIndex();
+		rebuildBloom();
+
+		if (!m_quiet)
+			std::cout << "Vault was changed by another process, merged\n";
+	}
+
+	static constexpr uint32_t KEEP_SHARDS = ~0u;
+
+	enum class Compression { Keep, On, Off };
+
+	//save m_entries. reshard: switch to that many shard files (0 = single entries.bin), compression: turn chunk compression
+	//on or off. Either rewrites every file, otherwise the layout stays as it is on disk
+	void writeTemp(uint32_t reshard = KEEP_SHARDS, Compression compression = Compression::Keep)
+	{
+		//writers take turns on entries.lock, readers never touch it
+		AtomicFile::Lock lock("entries.lock");
+
+		//optimistic: the file is normally still the generation we read. If not, merge instead of overwriting
+		VaultFile::Header disk;
+		VaultFile::readHeader("entries.bin", disk);
+
+		if (disk.generation != m_generation)
+			mergeFromDisk();
+
+		bool compressed = compression == Compression::Keep ? (disk.flags & VaultFile::FLAG_COMPRESSED) != 0 : compression == Compression::On;
+
+		//a sharded save rewrites only the shards the journal touched, the rest are already current on disk
+		if (reshard == KEEP_SHARDS && compression == Compression::Keep)
+			writeVault(m_entries, disk.generation + 1, syncDue(), disk.shards, touchedShards(m_journal, disk.shards), compressed);
+		else
+		{
+			uint32_t shards = reshard == KEEP_SHARDS ? disk.shards : reshard;
+
+			writeVault(m_entries, disk.generation + 1, true, shards, allShards(shards), compressed);
+
+			//shard files the new layout no longer uses
+			for (uint32_t i{ shards }; i < disk.shards; ++i)
+			{
+				char path[MAX_PATH];
+				VaultFile::shardPath("entries.bin", i, path);
+				DeleteFileA(path);
+			}
+		}
+
+		m_generation = disk.generation + 1;
+		m_journal.clear();
+		AtomicFile::stamp("entries.bin", m_stamp);
+
+		m_loaded = true;
+
+		//restamp the sidecar against the file just written
+		writeBloom();
+	}
+
+	//take over freshly read entries. When m_entries is a prefix of them, e.g. another process appended, only the new tail gets indexed
+	void adopt(Vector<Entry>& loaded) const
+	{
+		std::size_t common = 0;
+
+		if (m_loaded && loaded.size() >= m_entries.size())
+		{
+			while (common < m_entries.size() && sameEntry(m_entries[common], loaded[common]))
+				++common;
+		}
+
+		if (m_loaded && common == m_entries.size())
+		{
+			for (std::size_t i{ common }; i < loaded.size(); ++i)
+			{
+				m_entries.emplace_back(std::move(loaded[i]));
+				indexEntry(i);
+				updateBloom(i);
+			}
+
+			return;
+		}
+
+		m_entries = std::move(loaded);
+
+		rebuildSiteIndex();
+		rebuildBloom();
+	}
+
+	//open fileName positioned at its payload, returns the payload size. stamp describes the version opened
+	static uint64_t openVaultFile(const char* fileName, std::ifstream& in, VaultFile::Header& header, AtomicFile::FileStamp& stamp)
+	{
+		in.open(fileName, std::ios::binary);
+
+		if (!in)
+			throw std::runtime_error("File not found");
+
+		//stamp after opening so it describes the file being read, not one renamed in before the open
+		if (!AtomicFile::stamp(fileName, stamp))
+			throw std::runtime_error("File not found");
+
+		uint8_t bytes[VaultFile::HEADER_SIZE + sizeof(header.shards)];
+		in.read(reinterpret_cast<char*>(bytes), sizeof(bytes));
+
+		//legacy files have no header and start straight with the encrypted blob
+		std::size_t headerSize = VaultFile::parseHeader(bytes, static_cast<std::size_t>(in.gcount()), header);
+
+		//a short file leaves the stream failed at eof
+		in.clear();
+		in.seekg(headerSize);
+
+		return stamp.size - headerSize;
+	}
+
+	//fn(website, username, password, nullptr) for every record in size plaintext bytes of a format 1 or 2 file, which had no extras
+	template <typename Fn>
+	static void forEachRecord(const uint8_t* plain, std::size_t size, Fn&& fn)
+	{
+		//avoid repeated calc
+		uint32_t ut32Size = sizeof(uint32_t);
+		std::size_t oneMBSize = 1024 * 1024;
+
+		//for decrypted container traversal
+		const uint8_t* end = plain + size;
+		const uint8_t* cursor = plain;
+
+		//[length][contents], contents are handed out in place
+		auto readFromBuffer = [&]()
+			{
+				//bounds check there is enough room left for [size]
+				if (static_cast<std::size_t>(end - cursor) < ut32Size)
+					throw std::runtime_error("Insufficient remaining space");
+
+				//move [length] into length and advance cursor to read [contents] next
+				uint32_t length;
+				std::memcpy(&length, cursor, ut32Size);
+				cursor += ut32Size;
+
+				//bounds check there is enough room left for [contents], which must end in its terminator
+				if (static_cast<std::size_t>(end - cursor) < length || length == 0 || length > oneMBSize || cursor[length - 1] != '\0')
+					throw std::runtime_error("Insufficient remaining space for length OR length is 0");
+
+				const char* field = reinterpret_cast<const char*>(cursor);
+				cursor += length;
+
+				return field;
+			};
+
+		while (cursor < end)
+		{
+			const char* website = readFromBuffer();
+			const char* username = readFromBuffer();
+			const char* password = readFromBuffer();
+
+			fn(website, username, password, nullptr);
+		}
+	}
+
+	//[size] bytes of in into bytes, throws if the file ends first
+	static void readBytes(std::istream& in, Vector<uint8_t>& bytes, uint64_t size)
+	{
+		bytes = Vector<uint8_t>(size);
+		in.read(reinterpret_cast<char*>(bytes.data()), size);
+
+		if (!in)
+			throw std::runtime_error("Could not read file");
+	}
+
+	//[uint32 size] of the next chunk or index of a chunked file, checked against the left bytes of the payload it takes off
+	static uint32_t readBlobSize(std::istream& in, uint64_t& left)
+	{
+		uint32_t size;
+
+		if (left < sizeof(size) || !in.read(reinterpret_cast<char*>(&size), sizeof(size)))
+			throw std::runtime_error("Truncated vault file");
+
+		left -= sizeof(size);
+
+		if (size > left || size > VaultFile::MAX_CHUNK_CIPHER)
+			throw std::runtime_error("Truncated vault file");
+
+		left -= size;
+		return size;
+	}
+
+	//the tag and field name decoding a file of header's format uses
+	static VaultFile::NameReader::Mode nameMode(const VaultFile::Header& header)
+	{
+		return header.format >= VaultFile::FORMAT_NAME_TABLE ? VaultFile::NameReader::Table
+			: header.format >= VaultFile::FORMAT_RECORD_NAMES ? VaultFile::NameReader::Inline : VaultFile::NameReader::Numbered;
+	}
+
+	//decrypt cipher, chunk index of count in a chunked file, and pass each of its records to fn. raw is the decompression
+	//buffer, reused across chunks
+	template <typename Fn>
+	static void decodeChunk(const VaultFile::Header& header, const Vector<uint8_t>& cipher, uint32_t index, uint32_t count,
+		VaultFile::NameReader& names, Vector<uint8_t>& raw, Fn&& fn)
+	{
+		//compact records since format 3, behind the chunk's name table since format 5. Before 3 length prefixed and terminated
+		auto records = [&](const uint8_t* plain, std::size_t size)
+			{
+				if (header.format >= VaultFile::FORMAT_NAME_TABLE)
+				{
+					const uint8_t* body = names.readTable(plain, plain + size);
+					VaultFile::forEachCompact(body, size - static_cast<std::size_t>(body - plain), names, fn);
+				}
+				else if (header.format >= VaultFile::FORMAT_COMPACT)
+					VaultFile::forEachCompact(plain, size, names, fn);
+				else
+					forEachRecord(plain, size, fn);
+			};
+
+		uint8_t entropy[16];
+		VaultFile::chunkEntropy(entropy, header.generation, index, count);
+
+		Vector<uint8_t> plainBytes = Crypto::decryptData(cipher.data(), cipher.size(), entropy, sizeof(entropy));
+
+		if (!(header.flags & VaultFile::FLAG_COMPRESSED))
+		{
+			records(plainBytes.data(), plainBytes.size());
+			return;
+		}
+
+		uint32_t rawSize;
+
+		if (plainBytes.size() < sizeof(rawSize))
+			throw std::runtime_error("Corrupt compressed data");
+
+		std::memcpy(&rawSize, plainBytes.data(), sizeof(rawSize));
+
+		if (rawSize > VaultFile::MAX_CHUNK_CIPHER)
+			throw std::runtime_error("Corrupt compressed data");
+
+		if (raw.size() < rawSize)
+			raw = Vector<uint8_t>(rawSize);
+
+		Lz::decompress(plainBytes.data() + sizeof(rawSize), plainBytes.size() - sizeof(rawSize), raw.data(), rawSize);
+		records(raw.data(), rawSize);
+	}
+
+	//decrypt the payload of an entry file opened by openVaultFile and pass each record to fn.
+	//chunked files hold one chunk in memory at a time, older files are a single blob and decrypt whole
+	template <typename Fn>
+	static void decodePayload(std::istream& in, const VaultFile::Header& header, uint64_t payloadSize, Fn&& fn)
+	{
+		Vector<uint8_t> cipher;
+
+		if (header.format < VaultFile::FORMAT_CHUNKED)
+		{
+			readBytes(in, cipher, payloadSize);
+
+			Vector<uint8_t> plainBytes = Crypto::decryptData(cipher);
+			forEachRecord(plainBytes.data(), plainBytes.size(), fn);
+			return;
+		}
+
+		uint32_t count;
+		uint64_t left = payloadSize;
+
+		//decompressed chunk, reused
+		Vector<uint8_t> raw;
+		VaultFile::NameReader names(nameMode(header));
+
+		if (left < sizeof(count) || !in.read(reinterpret_cast<char*>(&count), sizeof(count)))
+			throw std::runtime_error("Truncated vault file");
+
+		left -= sizeof(count);
+
+		//a full read has no use for the host index
+		if (header.format >= VaultFile::FORMAT_HOST_INDEX)
+		{
+			uint32_t records;
+
+			if (left < sizeof(records) || !in.read(reinterpret_cast<char*>(&records), sizeof(records)))
+				throw std::runtime_error("Truncated vault file");
+
+			left -= sizeof(records);
+			in.seekg(readBlobSize(in, left), std::ios::cur);
+		}
+
+		for (uint32_t i{ 0 }; i < count; ++i)
+		{
+			readBytes(in, cipher, readBlobSize(in, left));
+			decodeChunk(header, cipher, i, count, names, raw, fn);
+		}
+	}
+
+	//number of records in the file opened by openVaultFile, from the plain count of a format 6 payload. False for older files
+	static bool recordCount(std::istream& in, const VaultFile::Header& header, uint64_t payloadSize, uint32_t& records)
+	{
+		uint32_t counts[2];
+
+		if (header.format < VaultFile::FORMAT_HOST_INDEX)
+			return false;
+
+		if (payloadSize < sizeof(counts) || !in.read(reinterpret_cast<char*>(counts), sizeof(counts)))
+			throw std::runtime_error("Truncated vault file");
+
+		records = counts[1];
+		return true;
+	}
+
+	//fn(position, website, username, password, extras) for every record of the format 6 file opened by openVaultFile in a
+	//chunk whose host index holds key, position counting from first. Decrypts the index and those chunks, seeks past the rest
+	template <typename Fn>
+	static void lookupChunks(std::istream& in, const VaultFile::Header& header, uint64_t payloadSize, uint32_t key, std::size_t first, Fn&& fn)
+	{
+		uint32_t counts[2];
+		uint64_t left = payloadSize;
+
+		if (left < sizeof(counts) || !in.read(reinterpret_cast<char*>(counts), sizeof(counts)))
+			throw std::runtime_error("Truncated vault file");
+
+		left -= sizeof(counts);
+
+		uint32_t count = counts[0];
+		Vector<uint8_t> cipher;
+		readBytes(in, cipher, readBlobSize(in, left));
+
+		uint8_t entropy[16];
+		VaultFile::chunkEntropy(entropy, header.generation, count, count);
+
+		Vector<uint8_t> index = Crypto::decryptData(cipher.data(), cipher.size(), entropy, sizeof(entropy));
+
+		Vector<uint8_t> raw;
+		VaultFile::NameReader names(nameMode(header));
+		uint32_t next = 0;
+
+		VaultFile::findInIndex(index.data(), index.size(), count, key, [&](uint32_t chunk, std::size_t before, uint32_t records)
+			{
+				for (; next < chunk; ++next)
+					in.seekg(readBlobSize(in, left), std::ios::cur);
+
+				readBytes(in, cipher, readBlobSize(in, left));
+				++next;
+
+				std::size_t position = first + before;
+				uint32_t seen = 0;
+
+				decodeChunk(header, cipher, chunk, count, names, raw, [&](const char* website, const char* username, const char* password, const EntryExtras* extras)
+					{
+						fn(position++, website, username, password, extras);
+						++seen;
+					});
+
+				if (seen != records)
+					throw std::runtime_error("Corrupt vault index");
+			});
+	}
+
+	//entries on website's host, or with domain set on its registrable domain, straight from the vault files for a one shot query:
+	//only the host indices and the chunks they point at are decrypted. positions are where found sits once the vault is loaded.
+	//False when entries.bin or one of its shards predates the index (format 6), the caller loads the vault instead
+	static bool findUnloaded(const char* website, bool domain, Vector<std::size_t>& positions, Vector<Entry>& found)
+	{
+		uint32_t key = VaultFile::hostKey(domain ? Website::domainHash(website) : Website::hash(website));
+
+		//the index only narrows it down to chunks, and keys are 32 bits
+		auto keep = [&](std::size_t position, const char* stored, const char* username, const char* password, const EntryExtras* extras)
+			{
+				if (domain ? !Website::sameDomain(stored, website) : !Website::equal(stored, website))
+					return;
+
+				positions.emplace_back(position);
+				found.emplace_back(stored, username, password);
+
+				if (extras)
+					found.back().extras_ = makeUnique<EntryExtras>(*extras);
+			};
+
+		std::ifstream in;
+		VaultFile::Header header;
+		AtomicFile::FileStamp stamp;
+		uint64_t payloadSize = openVaultFile("entries.bin", in, header, stamp);
+
+		if (!(header.flags & VaultFile::FLAG_SHARDED))
+		{
+			if (header.format < VaultFile::FORMAT_HOST_INDEX)
+				return false;
+
+			lookupChunks(in, header, payloadSize, key, 0, keep);
+			return true;
+		}
+
+		//a loaded vault is the shards one after another, so a shard's positions start after the records of those before it
+		Vector<std::size_t> firsts(header.shards);
+		std::size_t first = 0;
+
+		for (uint32_t shard{ 0 }; shard < header.shards; ++shard)
+		{
+			char path[MAX_PATH];
+			VaultFile::shardPath("entries.bin", shard, path);
+
+			std::ifstream shardIn;
+			AtomicFile::FileStamp shardStamp;
+			VaultFile::Header shardHeader;
+			uint64_t shardSize = openVaultFile(path, shardIn, shardHeader, shardStamp);
+			uint32_t records;
+
+			if (!recordCount(shardIn, shardHeader, shardSize, records))
+				return false;
+
+			firsts[shard] = first;
+			first += records;
+		}
+
+		//a host's entries sit in the shard of either spelling of it, see Website::placementHash. A domain spans every shard
+		uint64_t mask = allShards(header.shards);
+
+		if (!domain)
+		{
+			char host[Website::MAX_HOST];
+			char prefixed[Website::MAX_HOST + 4];
+			Website::normalizeHost(website, host);
+			snprintf(prefixed, sizeof(prefixed), "www.%s", host);
+
+			mask = (uint64_t{ 1 } << VaultFile::shardOf(host, header.shards)) | (uint64_t{ 1 } << VaultFile::shardOf(prefixed, header.shards));
+		}
+
+		for (uint32_t shard{ 0 }; shard < header.shards; ++shard)
+		{
+			if (!(mask & (uint64_t{ 1 } << shard)))
+				continue;
+
+			char path[MAX_PATH];
+			VaultFile::shardPath("entries.bin", shard, path);
+
+			std::ifstream shardIn;
+			AtomicFile::FileStamp shardStamp;
+			VaultFile::Header shardHeader;
+			uint64_t shardSize = openVaultFile(path, shardIn, shardHeader, shardStamp);
+
+			lookupChunks(shardIn, shardHeader, shardSize, key, firsts[shard], keep);
+		}
+
+		return true;
+	}
+
+	//decrypt and parse fileName into out, following a manifest to its shards. Static so the background saver can read another process's save
+	static void readEntries(const char* fileName, Vector<Entry>& out, VaultFile::Header& header, AtomicFile::FileStamp& stamp)
+	{
+		std::ifstream in;
+		uint64_t payloadSize = openVaultFile(fileName, in, header, stamp);
+
+		out.clear();
+
+		if (!(header.flags & VaultFile::FLAG_SHARDED))
+		{
+			decodePayload(in, header, payloadSize, [&](const char* website, const char* username, const char* password, const EntryExtras* extras)
+				{
+					out.emplace_back(website, username, password);
+
+					if (extras)
+						out.back().extras_ = makeUnique<EntryExtras>(*extras);
+				});
+			return;
+		}
+
+		//every shard is read and decrypted on its own thread, then concatenated in shard order
+		Vector<Vector<Entry>> parts(header.shards);
+
+		forEachShard(allShards(header.shards), [&](uint32_t shard)
+			{
+				char path[MAX_PATH];
+				VaultFile::shardPath(fileName, shard, path);
+
+				std::ifstream shardIn;
+				AtomicFile::FileStamp shardStamp;
+				VaultFile::Header shardHeader;
+
+				uint64_t shardSize = openVaultFile(path, shardIn, shardHeader, shardStamp);
+
+				decodePayload(shardIn, shardHeader, shardSize, [&](const char* website, const char* username, const char* password, const EntryExtras* extras)
+					{
+						parts[shard].emplace_back(website, username, password);
+
+						if (extras)
+							parts[shard].back().extras_ = makeUnique<EntryExtras>(*extras);
+					});
+			});
+
+		std::size_t total = 0;
+		for (const Vector<Entry>& part : parts)
+			total += part.size();
+
+		out.reserve(total);
+
+		for (Vector<Entry>& part : parts)
+			for (Entry& e : part)
+				out.emplace_back(std::move(e));
+	}
+
+	void readTemp(const char* fileName) const
+	{
+		//parse into a fresh Vector, adopt compares it with what is already in memory
+		Vector<Entry> loaded;
+		VaultFile::Header header;
+		AtomicFile::FileStamp stamp;
+
+		readEntries(fileName, loaded, header, stamp);
+
+		//changes that never reached the disk, e.g. after a failed background save, stay applied
+		replayJournal(loaded, m_journal);
+
+		adopt(loaded);
+
+		m_generation = header.generation;
+		m_stamp = stamp;
+		m_loaded = true;
+
+		publish();
+	}
+
+	//bring m_entries in line with entries.bin, true if it was reread. Costs one stat when nothing changed.
+	//required: a missing or empty vault throws, otherwise it just leaves m_loaded false
+	bool refresh(bool required) const
+	{
+		//staged changes are newer than anything on disk, and a pending background save merges whatever another process wrote
+		if (m_loaded && (m_inTransaction || m_dirty || (m_saver && !m_saver->idle())))
+			return false;
+
+		AtomicFile::FileStamp stamp;
+
+		if (!AtomicFile::stamp("entries.bin", stamp) || stamp.size == 0)
+		{
+			//keep what is in memory, a pending background save recreates the file
+			if (m_loaded || !required)
+				return false;
+
+			throw std::runtime_error("File not found");
+		}
+
+		if (m_loaded && stamp == m_stamp)
+			return false;
+
+		//stamp moved but the header says it is the file we already have, nothing new to read.
+		//legacy files have no generation, any change to them is a reload
+		VaultFile::Header header;
+		bool hasHeader = m_loaded && VaultFile::readHeader("entries.bin", header);
+
+		if (hasHeader && header.generation == m_generation)
+		{
+			m_stamp = stamp;
+			return false;
+		}
+
+		//the background saver wrote it and nothing is pending, so every journaled change is on disk
+		if (hasHeader && m_saveStatus && header.generation == m_saveStatus->generation)
+		{
+			m_journal.clear();
+
+			//a plain write of our own state, memory already matches
+			if (!m_saveStatus->merged.exchange(false))
+			{
+				m_generation = header.generation;
+				m_stamp = stamp;
+				return false;
+			}
+
+			//it merged another process's save, read the combined file
+		}
+
+		readTemp("entries.bin");
+		return true;
+	}
+
+public:
+	//disable copying because Entry cannot copy construct
+	Vault(const Vault&) = delete;
+	Vault& operator= (const Vault&) = delete;
+
+	//default constructor
+	Vault() = default;
+
+	//move constructor
+	Vault(Vault&& other) = default;
+
+	//deep move assignment operator
+	Vault& operator= (Vault&& other) = default;
+
+	//destructor
+	~Vault() = default;
+
+	//user is intended to call this one, readTemp is for testing purposes and if the filename needs to be changed
+	void readVault() const
+	{
+		refresh(true);
+	}
+
+	//pick up a save made by another process, true if the vault was reread. Readers keep the old snapshot until the new one is published.
+	//staged transaction changes are never replaced. Not thread safe, call it where other mutations are serialized
+	bool reloadIfChanged()
+	{
+		return m_loaded && refresh(false);
+	}
+
+	//false when the exact entry is already in the vault, nothing is added then
+	bool addEntryAndSave(const char* website, const char* username, const char* password)
+	{
+		//load if there is a vault, a first add starts from empty
+		refresh(false);
+
+		//prevent duplicate entries
+		for (const auto& e : m_entries)
+		{
+			if (std::strcmp(e.website_, website) == 0 && std::strcmp(e.username_, username) == 0 && std::strcmp(e.password_, password) == 0)
+			{
+				if (!m_quiet)
+					std::cout << "Duplicate entry, not appending\n";
+
+				return false;
+			}
+		}
+
+		m_entries.emplace_back(website, username, password);
+
+		try
+		{
+			m_journal.emplace_back(JournalOp::Add, m_entries.back());
+		}
+		catch (...)
+		{
+			m_entries.pop_back();
+			throw;
+		}
+
+		indexEntry(m_entries.size() - 1);
+		updateBloom(m_entries.size() - 1);
+
+		saveAndList();
+
+		return true;
+	}
+
+	//non const since Sort is called. Container is modified.
+	void deleteEntryAndSave(Vector<std::size_t>& list)
+	{
+		if (list.size() < 1)
+			throw std::runtime_error("Must have atleast one value to delete");
+
+		//load all Entry. Entries staged in a transaction are kept as they are
+		refresh(false);
+
+		if (!m_loaded)
+			throw std::runtime_error("Vault is empty or missing");
+
+		//personal Sort
+		Sort(list.data(), list.data() + list.size());
+
+		//Make sure index is correct
+		if (!m_quiet)
+			std::cout << "Delete Entry containing contents: \n";
+
+		//make sure no duplicate indices, if there are, throw because user is silly
+		for (std::size_t i{ 1 }; i < list.size(); ++i)
+		{
+			if (list[i] == list[i - 1])
+				throw std::runtime_error("Duplicate index provided. That's really dumb.");
+		}
+
+		//sorted, so the last index is the largest. Checked before anything is journaled or erased
+		if (list[list.size() - 1] >= m_entries.size())
+			throw std::runtime_error("Out of bounds index");
+
+		//preview
+		for (std::size_t i{ 0 }; i < list.size() && !m_quiet; ++i)
+		{
+			//[[[Entry[args[i]]. Get the Entry at args position, for each args starting from the 0th (because list is a stored as a Vector)
+			//
+			//[Entry1][Entry2][Entry3][Entry4][Entry5]
+			//(0, 2)
+			//i = 0			i < 2
+			const Entry& e = m_entries[list[i]];
+			std::cout << std::setw(4) << "[Index " << list[i] << " - " << "Website: "
+				<< std::setw(12) << std::left << e.website_ << " | Username: "
+				<< std::setw(12) << std::left << e.username_ << " | Password: "
+				<< std::setw(12) << std::left << e.password_ << "]\n";
+		}
+
+		//confirm or deny, scripts decide up front through the confirm policy
+		if (m_confirm == ConfirmPolicy::Refuse)
+			throw std::runtime_error("Delete needs confirmation, rerun with --yes");
+
+		if (m_confirm == ConfirmPolicy::Ask)
+		{
+			for (;;)
+			{
+				std::cout << "Delete these entries? ";
+			
+				//enough for "yes\0" and "no\0"
+				UniquePtr<char[]> response = makeUnique<char[]>(16);
+
+				//consume all leading whitespace
+				std::cin >> std::ws;
+
+				//read up to 15 chars
+				std::cin.getline(response.get(), 16);
+
+				//cast all to lower
+				for (char* p = response.get(); *p; ++p)
+					*p = std::tolower(static_cast<unsigned char>(*p));
+
+				if (strcmp(response.get(), "no") == 0 || strcmp(response.get(), "n") == 0)
+					return; //exit
+				
+
+				if (strcmp(response.get(), "yes") == 0 || strcmp(response.get(), "y") == 0) 
+					break; //exit for loop and continue downwards
+				
+
+				else
+				{
+					std::cout << "Invalid input, try again\n";
+					continue;
+				}
+
+			}
+		}
+
+		for (std::size_t index : list)
+			m_journal.emplace_back(JournalOp::Delete, m_entries[index]);
+
+		//erase specified Entrys at indices, one compaction pass over m_entries
+		m_entries.erase_indices(list.data(), list.data() + list.size());
+
+		//positions after the first deleted index shifted and bloom filters cannot unset keys, rebuild
+		rebuildSiteIndex();
+		rebuildBloom();
+
+		//write and save
+		saveAndList();
+	}
+
+	//Overload for variadic template. Delegates to Vector param version. Enable if to ensure only numbers passed.
+	template <typename... Args, typename = std::enable_if_t<(std::is_integral<Args>::value && ...)>>
+	void deleteEntryAndSave(Args... args)
+	{
+		static_assert(sizeof...(Args) > 0, "requires at least one index");
+
+		//cast args to a size_t Vector for ease of use later
+		Vector<std::size_t> list = { static_cast<std::size_t>(args)... };
+
+		deleteEntryAndSave(list);
+	}
+
+	//swap replacement in for the Entry at index, journaled and indexed, then save
+	void replaceAndSave(std::size_t index, Entry&& replacement)
+	{
+		m_journal.emplace_back(m_entries[index], replacement);
+
+		unindexEntry(index);
+
+		//move construct new Entry at index
+		m_entries[index] = std::move(replacement);
+
+		indexEntry(index);
+		updateBloom(index);
+
+		//write to file
+		saveAndList();
+	}
+
+	//new website, username and password for the Entry at index. Its tags and custom fields stay
+	void editAndSave(std::size_t index, const char* newWebsite, const char* newUsername, const char* newPassword)
+	{
+		//retrieve all Entry into entries Vector
+		readVault();
+
+		//make sure in bounds index
+		if (index >= m_entries.size())
+			throw std::runtime_error("Out of bounds index");
+
+		//construct before touching the index in case newWebsite points into the old Entry
+		Entry replacement(newWebsite, newUsername, newPassword);
+
+		if (m_entries[index].extras_)
+			replacement.extras_ = makeUnique<EntryExtras>(*m_entries[index].extras_);
+
+		replaceAndSave(index, std::move(replacement));
+	}
+
+	//overload for taking an Entry to put in place, extras and all
+	void editAndSave(std::size_t index, const Entry& et)
+	{
+		readVault();
+
+		if (index >= m_entries.size())
+			throw std::runtime_error("Out of bounds index");
+
+		replaceAndSave(index, et.clone());
+	}
+
+	//copy of the Entry at index with change(extras) applied, saved in its place if change returns true
+	template <typename Change>
+	bool editExtrasAndSave(std::size_t index, Change&& change)
+	{
+		readVault();
+
+		if (index >= m_entries.size())
+			throw std::runtime_error("Out of bounds index");
+
+		Entry replacement = m_entries[index].clone();
+
+		if (!change(replacement.extras()))
+		{
+			std::cout << "Nothing to change\n";
+			return false;
+		}
+
+		//an entry left with nothing extra goes back to carrying no extras at all
+		if (replacement.extras_->empty())
+			replacement.extras_.reset();
+
+		replaceAndSave(index, std::move(replacement));
+		return true;
+	}
+
+	//tags are single words so a tag query can be parsed around them
+	static void checkTag(const char* tag)
+	{
+		if (*tag == '\0' || std::strpbrk(tag, " \t\r\n,&|!()") != nullptr)
+			throw std::runtime_error("Tags must be non empty and without spaces, commas or & | ! ( )");
+	}
+
+	//add count tags to the Entry at index, one save. Tags it already has are skipped
+	void tagAndSave(std::size_t index, const char* const* tags, std::size_t count)
+	{
+		for (std::size_t i{ 0 }; i < count; ++i)
+			checkTag(tags[i]);
+
+		editExtrasAndSave(index, [&](EntryExtras& x)
+			{
+				bool changed = false;
+
+				for (std::size_t i{ 0 }; i < count; ++i)
+					changed = x.addTag(tags[i]) || changed;
+
+				return changed;
+			});
+	}
+
+	//remove count tags from the Entry at index, one save
+	void untagAndSave(std::size_t index, const char* const* tags, std::size_t count)
+	{
+		editExtrasAndSave(index, [&](EntryExtras& x)
+			{
+				bool changed = false;
+
+				for (std::size_t i{ 0 }; i < count; ++i)
+					changed = x.removeTag(tags[i]) || changed;
+
+				return changed;
+			});
+	}
+
+	//set the custom field name of the Entry at index to value, "text" or "date" (YYYY-MM-DD)
+	void setFieldAndSave(std::size_t index, const char* name, const char* value, const char* type = "text")
+	{
+		if (*name == '\0')
+			throw std::runtime_error("Field name is empty");
+
+		bool isDate = std::strcmp(type, "date") == 0;
+
+		if (!isDate && std::strcmp(type, "text") != 0)
+			throw std::runtime_error("Unknown field type, use text or date");
+
+		if (!isDate && *value == '\0')
+			throw std::runtime_error("Field value is empty, use unfield to remove a field");
+
+		uint32_t days = isDate ? Dates::parse(value) : 0;
+
+		editExtrasAndSave(index, [&](EntryExtras& x)
+			{
+				if (isDate)
+					x.setDate(name, days);
+				else
+					x.setText(name, value);
+
+				return true;
+			});
+	}
+
+	//remove the custom field name from the Entry at index. An attachment's blob goes with it once nothing else refers to it
+	void clearFieldAndSave(std::size_t index, const char* name)
+	{
+		char id[Attachments::ID_TEXT + 1] = "";
+
+		editExtrasAndSave(index, [&](EntryExtras& x)
+			{
+				std::size_t at = x.findField(name);
+
+				if (at < x.fields.size() && x.fields[at].type == EntryExtras::Attachment)
+					snprintf(id, sizeof(id), "%s", x.str(x.fields[at].value));
+
+				return x.removeField(name);
+			});
+
+		//an aborted transaction would bring the reference back, prune picks the blob up later instead
+		if (*id && !m_inTransaction && !attachmentReferenced(id))
+		{
+			char path[MAX_PATH];
+			Attachments::blobPath(id, path);
+			std::filesystem::remove(path);
+		}
+	}
+
+	//true if any Entry has an attachment field with blob id
+	bool attachmentReferenced(const char* id) const
+	{
+		for (const Entry& e : m_entries)
+			if (e.extras_)
+				for (const EntryExtras::Field& f : e.extras_->fields)
+					if (f.type == EntryExtras::Attachment && std::strcmp(e.extras_->str(f.value), id) == 0)
+						return true;
+
+		return false;
+	}
+
+	//the attachment field name of the Entry at index, its blob id out of the extras
+	const char* attachmentId(std::size_t index, const char* name) const
+	{
+		readVault();
+
+		if (index >= m_entries.size())
+			throw std::runtime_error("Out of bounds index");
+
+		const Entry& e = m_entries[index];
+		std::size_t at = e.extras_ ? e.extras_->findField(name) : 0;
+
+		if (!e.extras_ || at == e.extras_->fields.size() || e.extras_->fields[at].type != EntryExtras::Attachment)
+			throw std::runtime_error("No attachment by that name");
+
+		return e.extras_->str(e.extras_->fields[at].value);
+	}
+
+	//store the file at source as attachment name of the Entry at index. The file is read, encrypted and written a chunk at a
+	//time into a new blob, which is on disk before the entry refers to it. Returns the bytes attached
+	uint64_t attachAndSave(std::size_t index, const char* name, const char* source)
+	{
+		if (*name == '\0')
+			throw std::runtime_error("Field name is empty");
+
+		readVault();
+
+		if (index >= m_entries.size())
+			throw std::runtime_error("Out of bounds index");
+
+		AtomicFile::FileStamp stamp;
+		std::ifstream in(source, std::ios::binary);
+
+		if (!in || !AtomicFile::stamp(source, stamp))
+			throw std::runtime_error("Could not open file to attach");
+
+		char id[Attachments::ID_TEXT + 1];
+		uint8_t idBytes[Attachments::ID_SIZE];
+		Attachments::newId(id);
+		Attachments::parseId(id, idBytes);
+
+		char path[MAX_PATH];
+		Attachments::blobPath(id, path);
+		std::filesystem::create_directories(Attachments::DIR);
+
+		Attachments::Header header;
+		header.size = stamp.size;
+		header.count = static_cast<uint32_t>((stamp.size + Attachments::CHUNK - 1) / Attachments::CHUNK);
+
+		AtomicFile::Writer out(path);
+
+		uint8_t head[Attachments::HEADER_SIZE];
+		Attachments::writeHeader(head, header);
+		out.write(head, sizeof(head));
+
+		Vector<uint8_t> plain(Attachments::CHUNK);
+
+		for (uint32_t i{ 0 }; i < header.count; ++i)
+		{
+			std::size_t size = i + 1 < header.count ? Attachments::CHUNK : static_cast<std::size_t>(header.size - uint64_t{ i } * Attachments::CHUNK);
+
+			if (!in.read(reinterpret_cast<char*>(plain.data()), size))
+				throw std::runtime_error("File changed while attaching it");
+
+			uint8_t entropy[Attachments::ID_SIZE + 8];
+			Attachments::chunkEntropy(entropy, idBytes, i, header.count);
+
+			Vector<uint8_t> cipher = Crypto::encryptData(plain.data(), size, entropy, sizeof(entropy));
+			uint32_t cipherSize = static_cast<uint32_t>(cipher.size());
+
+			out.write(reinterpret_cast<const uint8_t*>(&cipherSize), sizeof(cipherSize));
+			out.write(cipher.data(), cipher.size());
+		}
+
+		if (in.peek() != std::ifstream::traits_type::eof())
+			throw std::runtime_error("File changed while attaching it");
+
+		out.commit(true);
+
+		//replacing an attachment of the same name leaves the old blob for prune, the entry save may yet fail
+		editExtrasAndSave(index, [&](EntryExtras& x)
+			{
+				x.setAttachment(name, id);
+				return true;
+			});
+
+		std::cout << "Attached " << source << " (" << header.size << " bytes) to entry " << index << " as " << name << "\n";
+
+		return header.size;
+	}
+
+	//write attachment name of the Entry at index to path ("-" for stdout), decrypting one chunk at a time. Returns the bytes written
+	uint64_t extractAttachment(std::size_t index, const char* name, const char* path)
+	{
+		char id[Attachments::ID_TEXT + 1];
+		snprintf(id, sizeof(id), "%s", attachmentId(index, name));
+
+		uint8_t idBytes[Attachments::ID_SIZE];
+		char blob[MAX_PATH];
+		Attachments::blobPath(id, blob);
+		Attachments::parseId(id, idBytes);
+
+		std::ifstream in(blob, std::ios::binary);
+		uint8_t head[Attachments::HEADER_SIZE];
+
+		if (!in.read(reinterpret_cast<char*>(head), sizeof(head)))
+			throw std::runtime_error("Attachment is missing");
+
+		Attachments::Header header = Attachments::parseHeader(head);
+
+		std::ofstream file;
+		bool toStdout = std::strcmp(path, "-") == 0;
+
+		if (!toStdout)
+		{
+			file.open(path, std::ios::binary | std::ios::trunc);
+
+			if (!file)
+				throw std::runtime_error("Could not open output file");
+		}
+
+		std::ostream& out = toStdout ? std::cout : file;
+		uint64_t written = 0;
+
+		try
+		{
+			Vector<uint8_t> cipher;
+
+			for (uint32_t i{ 0 }; i < header.count; ++i)
+			{
+				uint32_t size;
+
+				if (!in.read(reinterpret_cast<char*>(&size), sizeof(size)) || size > Attachments::MAX_CHUNK_CIPHER)
+					throw std::runtime_error("Corrupt attachment");
+
+				cipher = Vector<uint8_t>(size);
+
+				if (!in.read(reinterpret_cast<char*>(cipher.data()), size))
+					throw std::runtime_error("Corrupt attachment");
+
+				uint8_t entropy[Attachments::ID_SIZE + 8];
+				Attachments::chunkEntropy(entropy, idBytes, i, header.count);
+
+				Vector<uint8_t> plain = Crypto::decryptData(cipher.data(), cipher.size(), entropy, sizeof(entropy));
+
+				if (plain.size() != (i + 1 < header.count ? Attachments::CHUNK : header.size - written))
+					throw std::runtime_error("Corrupt attachment");
+
+				out.write(reinterpret_cast<const char*>(plain.data()), plain.size());
+				written += plain.size();
+			}
+
+			out.flush();
+
+			if (!out)
+				throw std::runtime_error("Could not write attachment");
+		}
+		catch (...)
+		{
+			//no half written key files left behind
+			if (!toStdout)
+			{
+				file.close();
+				std::filesystem::remove(path);
+			}
+
+			throw;
+		}
+
+		if (!toStdout)
+			std::cout << "Wrote " << written << " bytes to " << path << "\n";
+
+		return written;
+	}
+
+	//delete every blob no Entry refers to: left by deleted entries, replaced attachments, or an attach whose save failed.
+	//run it while no other process is attaching, a blob is unreferenced until its entry is saved. Returns the number deleted
+	std::size_t pruneAttachments()
+	{
+		if (m_inTransaction)
+			throw std::runtime_error("Commit or abort the transaction first");
+
+		flush();
+		refresh(false);
+
+		std::size_t removed = 0;
+		uint64_t bytes = 0;
+		std::error_code error;
+
+		for (const std::filesystem::directory_entry& file : std::filesystem::directory_iterator(Attachments::DIR, error))
+		{
+			//"<id>.blob", or "<id>.blob.tmp" from an attach that never finished
+			const std::string fileName = file.path().filename().string();
+			const char* dot = std::strchr(fileName.c_str(), '.');
+
+			char id[Attachments::ID_TEXT + 1];
+			uint8_t idBytes[Attachments::ID_SIZE];
+
+			if (!dot || static_cast<std::size_t>(dot - fileName.c_str()) != Attachments::ID_TEXT)
+				continue;
+
+			std::memcpy(id, fileName.c_str(), Attachments::ID_TEXT);
+			id[Attachments::ID_TEXT] = '\0';
+
+			if (!Attachments::parseId(id, idBytes) || (std::strcmp(dot, ".blob") == 0 && attachmentReferenced(id)))
+				continue;
+
+			bytes += file.file_size(error);
+
+			if (std::filesystem::remove(file.path(), error))
+				++removed;
+		}
+
+		std::cout << "Removed " << removed << " unused attachments, " << bytes << " bytes\n";
+
+		return removed;
+	}
+
+	//bulk add every record source(row) passes to row(website, username, password[, extras]), skipping ones already in the vault or
+	//repeated in the source. expected sizes the tables up front. One index rebuild and one save at the end, returns the number added
+	template <typename Source>
+	std::size_t addUnique(std::size_t expected, Source&& source, std::size_t& duplicates, std::size_t& noWebsite)
+	{
+		//exact (website, username, password) triples, the same rule addEntryAndSave uses for duplicates
+		auto tripleHash = [](const char* website, const char* username, const char* password)
+			{
+				uint64_t h = fnv1a(website, strlen(website));
+				h = fnv1a(username, strlen(username), fnv1aStep(h, 0));
+				return fnv1a(password, strlen(password), fnv1aStep(h, 0));
+			};
+
+		m_entries.reserve(m_entries.size() + expected);
+
+		FlatMultimap<uint32_t> seen;
+		seen.reserve(m_entries.size() + expected);
+
+		for (std::size_t i{ 0 }; i < m_entries.size(); ++i)
+			seen.insert(tripleHash(m_entries[i].website_, m_entries[i].username_, m_entries[i].password_), static_cast<uint32_t>(i));
+
+		std::size_t before = m_entries.size();
+		std::size_t journalBefore = m_journal.size();
+
+		try
+		{
+			source([&](const char* website, const char* username, const char* password, const EntryExtras* extras = nullptr)
+				{
+					if (*website == '\0')
+					{
+						++noWebsite;
+						return;
+					}
+
+					uint64_t h = tripleHash(website, username, password);
+					bool duplicate = false;
+
+					seen.forEach(h, [&](uint32_t pos)
+						{
+							const Entry& e = m_entries[pos];
+							duplicate = duplicate || (std::strcmp(e.website_, website) == 0 && std::strcmp(e.username_, username) == 0 && std::strcmp(e.password_, password) == 0);
+						});
+
+					if (duplicate)
+					{
+						++duplicates;
+						return;
+					}
+
+					seen.insert(h, static_cast<uint32_t>(m_entries.size()));
+					m_entries.emplace_back(website, username, password);
+
+					if (extras)
+						m_entries.back().extras_ = makeUnique<EntryExtras>(*extras);
+
+					m_journal.emplace_back(JournalOp::Add, m_entries.back());
+				});
+		}
+		catch (...)
+		{
+			//nothing was indexed or saved yet, dropping the tail restores the vault
+			m_entries.erase(m_entries.data() + before, m_entries.data() + m_entries.size());
+			m_journal.erase(m_journal.data() + journalBefore, m_journal.data() + m_journal.size());
+			throw;
+		}
+
+		std::size_t added = m_entries.size() - before;
+
+		if (added > 0)
+		{
+			rebuildSiteIndex();
+			rebuildBloom();
+
+			if (m_inTransaction)
+				m_dirty = true;
+			else
+				save();
+		}
+
+		return added;
+	}
+
+	//bulk add every row of a CSV or JSON export at path. Rows already in the vault or repeated in the file are skipped.
+	//one index rebuild and one save at the end however many rows there are, returns the number added
+	std::size_t importFile(const char* path)
+	{
+		refresh(false);
+
+		//a row in a typical export is 40 to 80 bytes, reserve for the short end so one import rarely regrows
+		AtomicFile::FileStamp stamp;
+		std::size_t expected = AtomicFile::stamp(path, stamp) ? static_cast<std::size_t>(stamp.size / 40) : 0;
+
+		std::size_t duplicates = 0;
+		std::size_t noWebsite = 0;
+
+		std::size_t added = addUnique(expected, [&](auto&& row) { Import::readFile(path, row); }, duplicates, noWebsite);
+
+		std::cout << "Imported " << added << " entries, skipped " << duplicates << " duplicates";
+		if (noWebsite > 0)
+			std::cout << " and " << noWebsite << " rows without a website";
+		std::cout << "\n";
+
+		return added;
+	}
+
+	//the other side as of the last merge, the common ancestor for the next one
+	static constexpr const char* MERGE_BASE = "entries.base.bin";
+
+	//three way merge of the vault file at path (another machine's entries.bin, or a copy of it) into this vault, against
+	//basePath or else the copy of the other side the last merge left in entries.base.bin. Without any ancestor it is a two way merge that
+	//unions both sides. The result is one save. Conflicts are listed and keep this vault's records. Returns the number of conflicts
+	std::size_t mergeFile(const char* path, const char* basePath = nullptr)
+	{
+		if (m_inTransaction)
+			throw std::runtime_error("Commit or abort the transaction first");
+
+		flush();
+		refresh(false);
+
+		AtomicFile::FileStamp stamp;
+		Vector<Entry> theirs;
+		VaultFile::Header theirHeader;
+
+		if (!AtomicFile::stamp(path, stamp))
+			throw std::runtime_error("File not found");
+
+		readEntries(path, theirs, theirHeader, stamp);
+
+		Vector<Entry> base;
+		VaultFile::Header baseHeader;
+		const char* ancestor = basePath ? basePath : MERGE_BASE;
+		bool haveBase = basePath != nullptr || AtomicFile::stamp(ancestor, stamp);
+
+		if (haveBase)
+			readEntries(ancestor, base, baseHeader, stamp);
+
+		MergePlan plan = planMerge(base, m_entries, theirs);
+
+		for (const MergePlan::Conflict& c : plan.conflicts)
+			std::cout << "Conflict: " << c.entry->website_ << " | " << c.entry->username_ << ": " << c.reason << ", kept this vault's version\n";
+
+		if (!plan.drop.empty() || !plan.take.empty())
+		{
+			//grow both up front so a full vault throws before anything is dropped
+			m_entries.reserve(m_entries.size() - plan.drop.size() + plan.take.size());
+			m_journal.reserve(m_journal.size() + plan.drop.size() + plan.take.size());
+
+			for (std::size_t pos : plan.drop)
+				m_journal.emplace_back(JournalOp::Delete, m_entries[pos]);
+
+			m_entries.erase_indices(plan.drop.data(), plan.drop.data() + plan.drop.size());
+
+			for (std::size_t pos : plan.take)
+			{
+				m_entries.emplace_back(theirs[pos].clone());
+				m_journal.emplace_back(JournalOp::Add, m_entries.back());
+			}
+
+			rebuildSiteIndex();
+			rebuildBloom();
+
+			save();
+			flush();
+		}
+
+		//everything in theirs is now merged here, so theirs is the ancestor of the next merge with that copy.
+		//ours then counts as the later change for the conflicts above, they are reported once and not again
+		writeEncrypted(MERGE_BASE, serialize(theirs), theirHeader.generation, true);
+
+		std::cout << "Merged " << path;
+		if (haveBase)
+			std::cout << " against base generation " << baseHeader.generation;
+		else
+			std::cout << " without a common ancestor";
+		std::cout << ": " << plan.take.size() << " records taken, " << plan.drop.size() << " removed, " << plan.conflicts.size() << " conflicts\n";
+
+		return plan.conflicts.size();
+	}
+
+	//every byte of a small file such as a backup manifest, key or chunk
+	static Vector<uint8_t> readWhole(const char* path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		AtomicFile::FileStamp stamp;
+
+		if (!in || !AtomicFile::stamp(path, stamp))
+			throw std::runtime_error("File not found");
+
+		Vector<uint8_t> bytes(stamp.size);
+		in.read(reinterpret_cast<char*>(bytes.data()), stamp.size);
+
+		if (!in)
+			throw std::runtime_error("Could not read file");
+
+		return bytes;
+	}
+
+	//chunk digest key of the backup directory dir, kept there DPAPI encrypted. Created for a new directory when create is set
+	static void backupKey(const char* dir, uint8_t (&key)[Backup::KEY_SIZE], bool create)
+	{
+		char path[MAX_PATH];
+		Backup::dirPath(dir, "backup.key", path);
+
+		AtomicFile::FileStamp stamp;
+
+		if (!AtomicFile::stamp(path, stamp))
+		{
+			if (!create)
+				throw std::runtime_error("Backup key not found");
+
+			Backup::randomKey(key);
+
+			Vector<uint8_t> cipher = Crypto::encryptData(key, sizeof(key));
+			AtomicFile::replace(path, cipher.data(), cipher.size(), true);
+			return;
+		}
+
+		Vector<uint8_t> plain = Crypto::decryptData(readWhole(path));
+
+		if (plain.size() != sizeof(key))
+			throw std::runtime_error("Bad backup key");
+
+		std::memcpy(key, plain.data(), sizeof(key));
+	}
+
+	//incremental backup of the saved vault into dir: its record stream cut into content defined chunks, each unique chunk
+	//stored once under its digest, plus a manifest naming this backup's chunks. Returns the number of new chunks written
+	std::size_t backup(const char* dir)
+	{
+		if (m_inTransaction)
+			throw std::runtime_error("Commit or abort the transaction first");
+
+		flush();
+		refresh(false);
+
+		std::filesystem::create_directories(std::filesystem::path(dir) / "chunks");
+
+		uint8_t key[Backup::KEY_SIZE];
+		backupKey(dir, key, true);
+
+		Backup::Digester digest(key);
+
+		Vector<uint8_t> stream = serialize(m_entries);
+		Vector<std::size_t> ends = Backup::chunkEnds(stream.data(), stream.size());
+
+		Backup::Manifest manifest;
+		manifest.generation = VaultFile::diskGeneration("entries.bin");
+		manifest.size = stream.size();
+		manifest.digests = Vector<uint8_t>(ends.size() * Backup::DIGEST_SIZE);
+		manifest.sizes = Vector<uint32_t>(ends.size());
+
+		std::size_t newChunks = 0;
+		uint64_t newBytes = 0;
+
+		for (std::size_t i{ 0 }; i < ends.size(); ++i)
+		{
+			std::size_t from = i == 0 ? 0 : ends[i - 1];
+			std::size_t size = ends[i] - from;
+
+			uint8_t name[Backup::DIGEST_SIZE];
+			digest(stream.data() + from, size, name);
+
+			std::memcpy(manifest.digests.data() + i * Backup::DIGEST_SIZE, name, sizeof(name));
+			manifest.sizes[i] = static_cast<uint32_t>(size);
+
+			//same digest, same bytes: an earlier backup already stored it
+			char path[MAX_PATH];
+			AtomicFile::FileStamp stamp;
+			Backup::chunkPath(dir, name, path);
+
+			if (AtomicFile::stamp(path, stamp))
+				continue;
+
+			//the digest as entropy ties the blob to its name, a chunk swapped for another one fails to decrypt
+			Vector<uint8_t> cipher = Crypto::encryptData(stream.data() + from, size, name, sizeof(name));
+			AtomicFile::replace(path, cipher.data(), cipher.size(), true);
+
+			++newChunks;
+			newBytes += cipher.size();
+		}
+
+		//chunks are all durable before the manifest that names them appears
+		char path[MAX_PATH];
+		Backup::manifestPath(dir, path);
+
+		Vector<uint8_t> bytes = Backup::writeManifest(manifest);
+		AtomicFile::create(path, bytes.data(), bytes.size(), true);
+
+		std::cout << "Backed up " << m_entries.size() << " entries to " << path << ": " << newChunks << " of " << ends.size()
+			<< " chunks new, " << newBytes << " bytes written\n";
+
+		return newChunks;
+	}
+
+	//add back every record of the backup whose manifest is at path that the vault no longer has. Nothing in the vault is
+	//removed or overwritten, so restoring an old backup only recovers what was deleted or changed since. Returns the number added
+	std::size_t restoreBackup(const char* path)
+	{
+		refresh(false);
+
+		Vector<uint8_t> bytes = readWhole(path);
+		Backup::Manifest manifest = Backup::parseManifest(bytes.data(), bytes.size());
+
+		//the backup directory is the one holding the manifest
+		const char* slash = std::strrchr(path, '/');
+		const char* backslash = std::strrchr(path, '\\');
+		if (backslash > slash)
+			slash = backslash;
+
+		char dir[MAX_PATH];
+		if (snprintf(dir, sizeof(dir), "%.*s", slash ? static_cast<int>(slash - path) : 1, slash ? path : ".") >= MAX_PATH)
+			throw std::runtime_error("Path too long");
+
+		uint8_t key[Backup::KEY_SIZE];
+		backupKey(dir, key, false);
+
+		Backup::Digester digest(key);
+
+		//reassemble the record stream, checking every chunk against its digest
+		Vector<uint8_t> stream(manifest.size);
+		uint8_t* cursor = stream.data();
+
+		for (std::size_t i{ 0 }; i < manifest.sizes.size(); ++i)
+		{
+			uint8_t name[Backup::DIGEST_SIZE];
+			std::memcpy(name, manifest.digests.data() + i * Backup::DIGEST_SIZE, sizeof(name));
+
+			char chunk[MAX_PATH];
+			Backup::chunkPath(dir, name, chunk);
+
+			Vector<uint8_t> cipher = readWhole(chunk);
+			Vector<uint8_t> plain = Crypto::decryptData(cipher.data(), cipher.size(), name, sizeof(name));
+
+			uint8_t check[Backup::DIGEST_SIZE];
+			digest(plain.data(), plain.size(), check);
+
+			if (plain.size() != manifest.sizes[i] || std::memcmp(check, name, sizeof(name)) != 0)
+				throw std::runtime_error("Backup chunk is corrupt");
+
+			std::memcpy(cursor, plain.data(), plain.size());
+			cursor += plain.size();
+		}
+
+		std::size_t duplicates = 0;
+		std::size_t noWebsite = 0;
+
+		//backups before format 2 hold the length prefixed records of the vault format at the time
+		std::size_t added = addUnique(static_cast<std::size_t>(manifest.size / 40), [&](auto&& row)
+			{
+				VaultFile::NameReader names(manifest.format < Backup::FORMAT_RECORD_NAMES ? VaultFile::NameReader::Numbered : VaultFile::NameReader::Inline);
+
+				if (manifest.format >= Backup::FORMAT_COMPACT)
+					VaultFile::forEachCompact(stream.data(), stream.size(), names, row);
+				else
+					forEachRecord(stream.data(), stream.size(), row);
+			}, duplicates, noWebsite);
+
+		std::cout << "Restored " << added << " entries from generation " << manifest.generation << ", "
+			<< duplicates << " were already in the vault\n";
+
+		return added;
+	}
+
+	//write the saved vault to path ("-" for stdout) as CSV or JSON, format defaults to path's extension. Streams from the files
+	//on disk a chunk at a time rather than from m_entries, so memory stays flat whatever the vault size. Returns the number written
+	std::size_t exportFile(const char* path, const char* format = nullptr)
+	{
+		Export::Format kind = Export::formatOf(format, path);
+
+		//everything saved so far, staged transaction changes are not part of the vault yet
+		flush();
+
+		std::ofstream file;
+		bool toStdout = std::strcmp(path, "-") == 0;
+
+		if (!toStdout)
+		{
+			file.open(path, std::ios::binary | std::ios::trunc);
+
+			if (!file)
+				throw std::runtime_error("Could not open export file");
+		}
+
+		Export::Writer writer(toStdout ? std::cout : file, kind);
+
+		//tags and custom fields have no column in the Import formats and stay in the vault
+		auto row = [&](const char* website, const char* username, const char* password, const EntryExtras*)
+			{
+				writer.row(website, username, password);
+			};
+
+		std::size_t written = 0;
+
+		//copies of the vault files taken under the writer lock, deleted once the export is done. Ciphertext like the vault
+		struct Snapshot
+		{
+			char path[MAX_PATH]{};
+			uint32_t shards = 0; //shard copies made so far
+
+			~Snapshot()
+			{
+				for (uint32_t shard{ 0 }; shard < shards; ++shard)
+				{
+					char shardCopy[MAX_PATH];
+					VaultFile::shardPath(path, shard, shardCopy);
+					DeleteFileA(shardCopy);
+				}
+
+				if (path[0] != '\0')
+					DeleteFileA(path);
+			}
+		} copy;
+
+		auto copyFile = [](const char* from, const char* to)
+			{
+				if (!CopyFileA(from, to, FALSE))
+					throw std::runtime_error("Could not copy the vault for export");
+			};
+
+		try
+		{
+			VaultFile::Header header;
+			bool any = false;
+
+			//the lock is held only while the files are copied, so a slow reader of the export never holds up a save.
+			//no saver can swap shards underneath meanwhile, so the copies of a sharded vault are one consistent generation
+			{
+				AtomicFile::Lock lock("entries.lock");
+
+				AtomicFile::FileStamp stamp;
+
+				if (AtomicFile::stamp("entries.bin", stamp) && stamp.size > 0)
+				{
+					snprintf(copy.path, MAX_PATH, "entries.export%lu.bin", static_cast<unsigned long>(GetCurrentProcessId()));
+					copyFile("entries.bin", copy.path);
+
+					//legacy files have no header and are never sharded
+					if (VaultFile::readHeader(copy.path, header) && (header.flags & VaultFile::FLAG_SHARDED))
+					{
+						for (uint32_t shard{ 0 }; shard < header.shards; ++shard)
+						{
+							char shardFile[MAX_PATH];
+							char shardCopy[MAX_PATH];
+							VaultFile::shardPath("entries.bin", shard, shardFile);
+							VaultFile::shardPath(copy.path, shard, shardCopy);
+
+							copyFile(shardFile, shardCopy);
+							copy.shards = shard + 1;
+						}
+					}
+
+					any = true;
+				}
+			}
+
+			if (any)
+			{
+				std::ifstream in;
+				AtomicFile::FileStamp stamp;
+				uint64_t payloadSize = openVaultFile(copy.path, in, header, stamp);
+
+				if (!(header.flags & VaultFile::FLAG_SHARDED))
+					decodePayload(in, header, payloadSize, row);
+				else
+				{
+					//one shard after another, so only one chunk is ever decrypted at a time
+					for (uint32_t shard{ 0 }; shard < header.shards; ++shard)
+					{
+						char shardFile[MAX_PATH];
+						VaultFile::shardPath(copy.path, shard, shardFile);
+
+						std::ifstream shardIn;
+						VaultFile::Header shardHeader;
+						AtomicFile::FileStamp shardStamp;
+
+						uint64_t shardSize = openVaultFile(shardFile, shardIn, shardHeader, shardStamp);
+						decodePayload(shardIn, shardHeader, shardSize, row);
+					}
+				}
+			}
+
+			written = writer.end();
+		}
+		catch (...)
+		{
+			//don't leave a truncated export that looks complete
+			if (!toStdout)
+			{
+				file.close();
+				DeleteFileA(path);
+			}
+
+			throw;
+		}
+
+		if (!toStdout && !m_quiet)
+			std::cout << "Exported " << written << " entries to " << path << "\n";
+
+		return written;
+	}
+
+	//start staging mutations in memory. The on disk vault is the rollback point
+	void beginTransaction()
+	{
+		if (m_inTransaction)
+			throw std::runtime_error("Transaction already open");
+
+		//abort rolls back to entries.bin, so it must hold everything saved so far
+		flush();
+
+		//capture the pre transaction state, a missing vault starts as an empty one
+		refresh(false);
+		m_loaded = true;
+
+		m_inTransaction = true;
+		m_dirty = false;
+		m_journalMark = m_journal.size();
+
+		std::cout << "Transaction started\n";
+	}
+
+	//one save for everything staged since begin
+	void commitTransaction()
+	{
+		if (!m_inTransaction)
+			throw std::runtime_error("No open transaction");
+
+		m_inTransaction = false;
+
+		if (m_dirty)
+			save();
+
+		m_dirty = false;
+
+		std::cout << "Transaction committed\n";
+
+		if (!m_quiet)
+			listAllEntries();
+	}
+
+	//drop everything staged since begin. Nothing was written, so reloading entries.bin restores the pre transaction state
+	void abortTransaction()
+	{
+		if (!m_inTransaction)
+			throw std::runtime_error("No open transaction");
+
+		m_inTransaction = false;
+
+		//staged ops never happened
+		m_journal.erase(m_journal.data() + m_journalMark, m_journal.data() + m_journal.size());
+
+		AtomicFile::FileStamp stamp;
+
+		if (m_dirty)
+		{
+			if (AtomicFile::stamp("entries.bin", stamp) && stamp.size > 0)
+				readTemp("entries.bin");
+			else
+			{
+				m_entries.clear();
+				rebuildSiteIndex();
+				rebuildBloom();
+				m_loaded = false;
+				publish();
+			}
+		}
+
+		m_dirty = false;
+
+		std::cout << "Transaction aborted\n";
+	}
+
+	bool inTransaction() const { return m_inTransaction; }
+
+	void setConfirmPolicy(ConfirmPolicy policy) { m_confirm = policy; }
+
+	void setQuiet(bool quiet) { m_quiet = quiet; }
+
+	//flush entries.bin to disk on every n-th save, 0 never flushes. Saves stay atomic either way, n trades power loss exposure for throughput
+	void setSyncEvery(unsigned n)
+	{
+		m_syncEvery = n;
+		m_unsynced = 0;
+	}
+
+	//spread the vault over n shard files by website hash (2 to 64), or back into a single entries.bin with 0 or 1.
+	//shards load in parallel and a save rewrites only the shards it touched
+	void setShards(uint32_t n)
+	{
+		if (n == 1)
+			n = 0;
+
+		if (n > VaultFile::MAX_SHARDS)
+			throw std::runtime_error("At most 64 shards");
+
+		if (m_inTransaction)
+			throw std::runtime_error("Commit or abort the transaction first");
+
+		flush();
+		refresh(false);
+
+		writeTemp(n);
+		publish();
+
+		if (!m_quiet)
+			std::cout << "Vault now uses " << (n == 0 ? 1 : n) << (n == 0 ? " file\n" : " shards\n");
+	}
+
+	//Lz compress each chunk before it is encrypted. Rewrites the whole vault once, later saves keep the setting from the file
+	void setCompression(bool on)
+	{
+		if (m_inTransaction)
+			throw std::runtime_error("Commit or abort the transaction first");
+
+		flush();
+		refresh(false);
+
+		writeTemp(KEEP_SHARDS, on ? Compression::On : Compression::Off);
+		publish();
+
+		if (!m_quiet)
+			std::cout << "Vault compression is now " << (on ? "on\n" : "off\n");
+	}
+
+	//size, save and load time of this vault (or generated records when it is empty) with and without compression.
+	//scratch files only, run through "pm bench"
+	void benchCompression(std::size_t rounds)
+	{
+		refresh(false);
+
+		Vector<Entry> generated;
+		const Vector<Entry>* entries = &m_entries;
+
+		if (m_entries.empty())
+		{
+			Bench::sampleRecords(20000, [&](const char* website, const char* username, const char* password)
+				{
+					generated.emplace_back(website, username, password);
+				});
+
+			entries = &generated;
+		}
+
+		const char* scratch = "bench.bin";
+		std::size_t plainSize = serialize(*entries).size();
+
+		std::cout << entries->size() << (entries == &generated ? " generated" : "") << " entries, " << plainSize << " bytes serialized\n";
+
+		for (bool compressed : { false, true })
+		{
+			Bench::timeRounds(compressed ? "save, compressed" : "save, uncompressed", rounds, [&](std::size_t)
+				{
+					writeEncrypted(scratch, serialize(*entries), 1, false, compressed);
+				});
+
+			Bench::timeRounds(compressed ? "load, compressed" : "load, uncompressed", rounds, [&](std::size_t)
+				{
+					Vector<Entry> loaded;
+					VaultFile::Header header;
+					AtomicFile::FileStamp stamp;
+
+					readEntries(scratch, loaded, header, stamp);
+				});
+
+			AtomicFile::FileStamp stamp;
+			AtomicFile::stamp(scratch, stamp);
+
+			std::ostringstream row;
+			row << std::setw(34) << std::left << "  file size" << std::setw(12) << std::right << stamp.size << " bytes"
+				<< std::setw(12) << std::fixed << std::setprecision(2) << (static_cast<double>(stamp.size) / plainSize) << " of serialized\n";
+
+			std::cout << row.str();
+		}
+
+		DeleteFileA(scratch);
+
+		std::cout << "\n";
+	}
+
+	//turn on snapshot publication for multi threaded readers and publish the current state right away.
+	//after this, only one thread may mutate the vault at a time, any number may read through snapshot()
+	void enableSnapshots()
+	{
+		refresh(false);
+
+		m_snapshots = true;
+		publish();
+	}
+
+	//hand saves to a background thread so mutations return without waiting on serialize, encrypt and write.
+	//back to back saves coalesce into one write of the newest state, flush() waits for it. Implies enableSnapshots
+	void enableAsyncSave()
+	{
+		if (m_saver)
+			return;
+
+		enableSnapshots();
+
+		m_saveStatus = std::make_shared<SaveStatus>();
+
+		//base of the last plain write, a later snapshot with the same base only extends it. NO_LINEAGE after a merge,
+		//the file then holds another process's entries the snapshots lack, so each write merges until the vault reloads
+		constexpr uint64_t NO_LINEAGE = ~uint64_t{ 0 };
+
+		//the worker keeps its own batch counter, configure setSyncEvery before enabling
+		m_saver = makeUnique<SaveWorker<VaultSnapshot>>([syncEvery = m_syncEvery, unsynced = 0u, status = m_saveStatus, lineage = NO_LINEAGE](const VaultSnapshot& snapshot) mutable
+			{
+				bool sync = syncEvery != 0 && ++unsynced >= syncEvery;
+				if (sync)
+					unsynced = 0;
+
+				AtomicFile::Lock lock("entries.lock");
+
+				VaultFile::Header disk;
+				VaultFile::readHeader("entries.bin", disk);
+
+				uint64_t touched = touchedShards(snapshot.journal, disk.shards);
+				bool compressed = (disk.flags & VaultFile::FLAG_COMPRESSED) != 0;
+
+				if (disk.generation == snapshot.base || (disk.generation == status->generation && lineage == snapshot.base))
+				{
+					writeVault(snapshot.entries, disk.generation + 1, sync, disk.shards, touched, compressed);
+					lineage = snapshot.base;
+				}
+				else
+				{
+					//another process saved since snapshot.base was read, replay our changes onto its file
+					Vector<Entry> merged;
+					VaultFile::Header header;
+					AtomicFile::FileStamp stamp;
+
+					if (AtomicFile::stamp("entries.bin", stamp) && stamp.size > 0)
+						readEntries("entries.bin", merged, header, stamp);
+
+					replayJournal(merged, snapshot.journal);
+					writeVault(merged, disk.generation + 1, sync, disk.shards, touched, compressed);
+
+					lineage = NO_LINEAGE;
+					status->merged = true;
+				}
+
+				status->generation = disk.generation + 1;
+
+				//the snapshot's filter only describes a plain write
+				if (lineage != NO_LINEAGE && !snapshot.bloom.empty())
+					writeBloomFile(snapshot.bloom);
+			});
+	}
+
+	//durability point: returns once every save so far is on disk. No-op for synchronous saves
+	void flush()
+	{
+		if (m_saver)
+			m_saver->flush();
+	}
+
+	//latest committed state. Safe from any thread, never blocks on or is blocked by a writer or a save
+	std::shared_ptr<const VaultSnapshot> snapshot() const
+	{
+		return m_published.load();
+	}
+
+	//number of entries, loads the vault if needed
+	std::size_t size() const
+	{
+		readVault();
+		return m_entries.size();
+	}
+
+	//just formatting for entries to look more even
+	void listAllEntries() const
+	{
+		readVault();
+
+		std::cout << "\n";
 
 		for (std::size_t i{ 0 }; i < m_entries.size(); ++i)
-			std::cout << std::setw(4) << "[Index " << i << " - " << "Website: "
-			<< std::setw(16) << std::left << m_entries[i].website_ << " | Username: "
-			<< std::setw(16) << std::left << m_entries[i].username_ << " | Password: "
-			<< std::setw(16) << std::left << m_entries[i].password_ << "]\n";
+			printEntry(i, m_entries[i]);
 		
 		std::cout << "\n";
 	}
 
+	//positions of every Entry whose host matches, ascending. Hash lookup instead of scanning m_entries
+	Vector<std::size_t> findWebsite(const char* website) const
+	{
+		readVault();
+
+		return collect(m_siteIndex, Website::hash(website), [&](const char* stored) { return Website::equal(stored, website); });
+	}
+
+	//positions of every Entry on the same registrable domain as url ("https://login.example.co.uk/x" -> example.co.uk), ascending
+	Vector<std::size_t> findDomain(const char* url) const
+	{
+		readVault();
+
+		return collect(m_domainIndex, Website::domainHash(url), [&](const char* stored) { return Website::sameDomain(stored, url); });
+	}
+
+	//true if an Entry exists for website, and for username too if given. Misses are usually answered by the bloom filter without loading the vault
+	bool hasCredentials(const char* website, const char* username = nullptr) const
+	{
+		//nothing saved yet
+		AtomicFile::FileStamp stamp;
+
+		if (!m_loaded && !AtomicFile::stamp("entries.bin", stamp))
+			return false;
+
+		uint64_t key = username ? Website::credentialHash(website, username) : Website::hash(website);
+
+		if (definitelyAbsent(key))
+			return false;
+
+		//maybe present, confirm against the real entries: those in the chunks the host index points at when nothing is loaded
+		Vector<std::size_t> matches;
+		Vector<Entry> found;
+		bool unloaded = !m_loaded && findUnloaded(website, false, matches, found);
+
+		if (!unloaded)
+			matches = findWebsite(website);
+
+		for (std::size_t i{ 0 }; i < matches.size(); ++i)
+			if (!username || std::strcmp((unloaded ? found[i] : m_entries[matches[i]]).username_, username) == 0)
+				return true;
+
+		return false;
+	}
+
+	//positions whose website or username contains term, case insensitive. Full scan, term can be any fragment
+	Vector<std::size_t> findText(const char* term) const
+	{
+		readVault();
+
+		return searchEntries(m_entries, term);
+	}
+
+	//list every Entry containing term, returns the number listed
+	std::size_t listText(const char* term) const
+	{
+		return printMatches(findText(term), term);
+	}
+
+	//list every account stored for one host, returns the number listed
+	std::size_t listWebsite(const char* website) const
+	{
+		if (definitelyAbsent(Website::hash(website)))
+			return printMatches(Vector<std::size_t>(), website);
+
+		Vector<std::size_t> matches;
+		Vector<Entry> found;
+
+		if (!m_loaded && findUnloaded(website, false, matches, found))
+			return printMatches(matches, website, &found);
+
+		return printMatches(findWebsite(website), website);
+	}
+
+	//list every account usable on url's site, returns the number listed
+	std::size_t listDomain(const char* url) const
+	{
+		Vector<std::size_t> matches;
+		Vector<Entry> found;
+
+		if (!m_loaded && findUnloaded(url, true, matches, found))
+			return printMatches(matches, url, &found);
+
+		return printMatches(findDomain(url), url);
+	}
+
+	//positions of every Entry matching a tag query such as "tag:prod & tag:db", ascending. Answered from the tag index
+	Vector<std::size_t> findTagged(const char* expression) const
+	{
+		readVault();
+
+		RoaringBitmap matches = m_tagIndex.query(expression, static_cast<uint32_t>(m_entries.size()));
+
+		Vector<std::size_t> positions;
+		positions.reserve(matches.cardinality());
+		matches.forEach([&](uint32_t pos) { positions.emplace_back(pos); });
+
+		return positions;
+	}
+
+	//list every Entry matching a tag query, returns the number listed
+	std::size_t listTagged(const char* expression) const
+	{
+		return printMatches(findTagged(expression), expression);
+	}
+
 	//non const getter
 	Entry& get(std::size_t index)
 	{
@@ -500,10 +4051,23 @@ public:
 		std::cout << "\n";
 
 		std::cout << "Commands: \n"
-			<< "Display all entries: display\n"
+			<< "Display all entries: display, or those matching a tag query: display(tag:a & (tag:b | !tag:c))\n"
 			<< "Add an entry: add(website, username, password)\n"
-			<< "Edit an entry: edit(index)\n"
-			<< "Delete entries: delete(i,j,k...)\n\n";
+			<< "Accounts for a website: get(website)\n"
+			<< "Accounts usable on a url: match(url)\n"
+			<< "Search websites and usernames: find(text)\n"
+			<< "Check for credentials: has(website) or has(website, username)\n"
+			<< "Edit an entry: edit(index) or edit(index, website, username, password)\n"
+			<< "Tag an entry: tag(index, tag...) or untag(index, tag...)\n"
+			<< "Custom fields: field(index, name, value) or field(index, name, YYYY-MM-DD, date), unfield(index, name)\n"
+			<< "Attachments: attach(index, name, file), extract(index, name, file), prune deletes unused ones\n"
+			<< "Delete entries: delete(i,j,k...)\n"
+			<< "Import a CSV or JSON export: import(path)\n"
+			<< "Export to CSV or JSON: export(path) or export(path, csv|json)\n"
+			<< "Merge another copy of the vault: merge(other.bin) or merge(other.bin, base.bin)\n"
+			<< "Incremental backup: backup(dir), restore(dir/vault-<date>.backup) adds back missing entries\n"
+			<< "Group changes into one save: begin, then commit or abort\n"
+			<< "Wait for pending saves to reach disk: flush\n\n";
 	}
 	
 
@@ -0,0 +1,627 @@
+#ifndef DAEMON_H
+#define DAEMON_H
+
+#include "Cryption.h"
+#include "FileWatcher.h"
+#include "Vector.h"
+#include "UniquePointer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <afunix.h>
+#include <sddl.h>
+
+#pragma comment(lib, "Ws2_32.lib")
+#pragma comment(lib, "Advapi32.lib")
+
+//resident vault server. One process keeps the Vault decrypted in memory and answers over a local AF_UNIX socket (Windows 10 1803+),
+//so clients skip the file read and the decrypt. Anyone who can reach the socket can connect, so every connection first has to
+//present the session token the server wrote to pm.token, a file only the user running the server can read
+namespace Daemon
+{
+	constexpr const char* SOCKET_PATH = "pm.sock";
+	constexpr const char* TOKEN_PATH = "pm.token";
+	constexpr std::size_t TOKEN_SIZE = 32;
+
+	//no legitimate frame comes close, anything bigger is a broken or hostile client
+	constexpr uint32_t MAX_FRAME = 16 * 1024 * 1024;
+
+	//a client that stops sending or reading mid conversation is dropped after this long, so it can't hold off Stop or the idle exit
+	constexpr DWORD CLIENT_TIMEOUT_MS = 10000;
+
+	enum Op : uint8_t
+	{
+		Get = 1,
+		Find = 2,
+		Add = 3,
+		Edit = 4,
+		Delete = 5,
+		Stop = 6
+	};
+
+	enum Status : uint8_t
+	{
+		Ok = 0,
+		NotFound = 1,
+		Error = 2
+	};
+
+	//wire format, little endian
+	//frame:    [uint32 length][length bytes]
+	//hello:    [TOKEN_SIZE bytes from pm.token], the first frame on every connection
+	//request:  [uint8 op][string]...
+	//response: [uint8 status][uint32 count][record]...  or  [uint8 Error][string message]
+	//string:   [uint32 length][bytes], record: [uint32 index][website][username][password]
+
+	void putU32(Vector<uint8_t>& out, uint32_t value)
+	{
+		for (std::size_t i{ 0 }; i < 4; ++i)
+			out.emplace_back(static_cast<uint8_t>(value >> (i * 8)));
+	}
+
+	void putString(Vector<uint8_t>& out, const char* s)
+	{
+		uint32_t length = static_cast<uint32_t>(strlen(s));
+		putU32(out, length);
+
+		for (uint32_t i{ 0 }; i < length; ++i)
+			out.emplace_back(static_cast<uint8_t>(s[i]));
+	}
+
+	uint32_t getU32(const uint8_t*& cursor, const uint8_t* end)
+	{
+		if (end - cursor < 4)
+			throw std::runtime_error("Truncated frame");
+
+		uint32_t value = 0;
+		for (std::size_t i{ 0 }; i < 4; ++i)
+			value |= static_cast<uint32_t>(cursor[i]) << (i * 8);
+
+		cursor += 4;
+		return value;
+	}
+
+	UniquePtr<char[]> getString(const uint8_t*& cursor, const uint8_t* end)
+	{
+		uint32_t length = getU32(cursor, end);
+
+		if (static_cast<std::size_t>(end - cursor) < length)
+			throw std::runtime_error("Truncated frame");
+
+		UniquePtr<char[]> s = makeUnique<char[]>(length + 1);
+		std::memcpy(s.get(), cursor, length);
+		s[length] = '\0';
+
+		cursor += length;
+		return s;
+	}
+
+	bool sendAll(SOCKET s, const uint8_t* data, std::size_t n)
+	{
+		while (n > 0)
+		{
+			int sent = send(s, reinterpret_cast<const char*>(data), static_cast<int>(n), 0);
+			if (sent <= 0)
+				return false;
+
+			data += sent;
+			n -= static_cast<std::size_t>(sent);
+		}
+
+		return true;
+	}
+
+	bool recvAll(SOCKET s, uint8_t* data, std::size_t n)
+	{
+		while (n > 0)
+		{
+			int got = recv(s, reinterpret_cast<char*>(data), static_cast<int>(n), 0);
+			if (got <= 0)
+				return false;
+
+			data += got;
+			n -= static_cast<std::size_t>(got);
+		}
+
+		return true;
+	}
+
+	bool sendFrame(SOCKET s, const Vector<uint8_t>& body)
+	{
+		Vector<uint8_t> header;
+		putU32(header, static_cast<uint32_t>(body.size()));
+
+		return sendAll(s, header.data(), header.size()) && sendAll(s, body.data(), body.size());
+	}
+
+	//false on disconnect or an oversized frame
+	bool recvFrame(SOCKET s, Vector<uint8_t>& body)
+	{
+		uint8_t header[4];
+		if (!recvAll(s, header, 4))
+			return false;
+
+		const uint8_t* cursor = header;
+		uint32_t length = getU32(cursor, header + 4);
+
+		if (length > MAX_FRAME)
+			return false;
+
+		body = Vector<uint8_t>(length);
+		return recvAll(s, body.data(), length);
+	}
+
+	//WSAStartup / WSACleanup for the lifetime of a scope
+	struct WinsockSession
+	{
+		WinsockSession()
+		{
+			WSADATA data;
+			if (WSAStartup(MAKEWORD(2, 2), &data) != 0)
+				throw std::runtime_error("Winsock startup failed");
+		}
+
+		~WinsockSession() { WSACleanup(); }
+
+		WinsockSession(const WinsockSession&) = delete;
+		WinsockSession& operator= (const WinsockSession&) = delete;
+	};
+
+	//fresh random token in pm.token, created with a DACL that grants the current user and nobody else.
+	//an existing pm.token is deleted first and the new one must not exist yet, so nobody can plant one with a looser ACL
+	void writeToken(uint8_t (&token)[TOKEN_SIZE])
+	{
+		if (!BCRYPT_SUCCESS(BCryptGenRandom(nullptr, token, TOKEN_SIZE, BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+			throw std::runtime_error("Could not generate session token");
+
+		HANDLE process;
+		if (!OpenProcessToken(GetCurrentProcess(), TOKEN_QUERY, &process))
+			throw std::runtime_error("Could not read the current user");
+
+		uint8_t user[256];
+		DWORD length = 0;
+		BOOL gotUser = GetTokenInformation(process, TokenUser, user, sizeof(user), &length);
+		CloseHandle(process);
+
+		char* sid = nullptr;
+		if (!gotUser || !ConvertSidToStringSidA(reinterpret_cast<TOKEN_USER*>(user)->User.Sid, &sid))
+			throw std::runtime_error("Could not read the current user");
+
+		//protected DACL, full access for this user only
+		char sddl[256];
+		int written = snprintf(sddl, sizeof(sddl), "D:P(A;;FA;;;%s)", sid);
+		LocalFree(sid);
+
+		PSECURITY_DESCRIPTOR descriptor = nullptr;
+		if (written < 0 || written >= static_cast<int>(sizeof(sddl)) || !ConvertStringSecurityDescriptorToSecurityDescriptorA(sddl, SDDL_REVISION_1, &descriptor, nullptr))
+			throw std::runtime_error("Could not build the token file ACL");
+
+		SECURITY_ATTRIBUTES attributes{};
+		attributes.nLength = sizeof(attributes);
+		attributes.lpSecurityDescriptor = descriptor;
+		attributes.bInheritHandle = FALSE;
+
+		DeleteFileA(TOKEN_PATH);
+		HANDLE file = CreateFileA(TOKEN_PATH, GENERIC_WRITE, 0, &attributes, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+		LocalFree(descriptor);
+
+		if (file == INVALID_HANDLE_VALUE)
+			throw std::runtime_error("Could not create pm.token");
+
+		DWORD wrote = 0;
+		bool ok = WriteFile(file, token, TOKEN_SIZE, &wrote, nullptr) && wrote == TOKEN_SIZE;
+		CloseHandle(file);
+
+		if (!ok)
+		{
+			DeleteFileA(TOKEN_PATH);
+			throw std::runtime_error("Could not write pm.token");
+		}
+	}
+
+	//false if there is no token to read, i.e. no server of ours is running
+	bool readToken(uint8_t (&token)[TOKEN_SIZE])
+	{
+		std::ifstream in(TOKEN_PATH, std::ios::binary);
+		in.read(reinterpret_cast<char*>(token), TOKEN_SIZE);
+
+		return in.gcount() == static_cast<std::streamsize>(TOKEN_SIZE);
+	}
+
+	//compares every byte whatever the first mismatch, so the reply time says nothing about how much of a guess was right
+	bool sameToken(const Vector<uint8_t>& hello, const uint8_t (&token)[TOKEN_SIZE])
+	{
+		if (hello.size() != TOKEN_SIZE)
+			return false;
+
+		uint8_t difference = 0;
+		for (std::size_t i{ 0 }; i < TOKEN_SIZE; ++i)
+			difference |= hello.data()[i] ^ token[i];
+
+		return difference == 0;
+	}
+
+	//decimal entry index from a request. Throws on empty, partly numeric or overflowing text rather than reading it as 0;
+	//whether the index exists is checked by the Vault under the write lock
+	std::size_t parseIndex(const char* text)
+	{
+		char* stop = nullptr;
+		errno = 0;
+		unsigned long long value = std::strtoull(text, &stop, 10);
+
+		if (*text < '0' || *text > '9' || *stop != '\0' || errno == ERANGE || value > (std::numeric_limits<std::size_t>::max)())
+			throw std::runtime_error("Bad index");
+
+		return static_cast<std::size_t>(value);
+	}
+
+	sockaddr_un socketAddress()
+	{
+		sockaddr_un address{};
+		address.sun_family = AF_UNIX;
+		std::memcpy(address.sun_path, SOCKET_PATH, strlen(SOCKET_PATH) + 1);
+
+		return address;
+	}
+
+	void putRecords(Vector<uint8_t>& out, const VaultSnapshot& snapshot, const Vector<std::size_t>& positions)
+	{
+		out.emplace_back(positions.empty() ? NotFound : Ok);
+		putU32(out, static_cast<uint32_t>(positions.size()));
+
+		for (std::size_t pos : positions)
+		{
+			const Entry& e = snapshot.entries[pos];
+
+			putU32(out, static_cast<uint32_t>(pos));
+			putString(out, e.website_);
+			putString(out, e.username_);
+			putString(out, e.password_);
+		}
+	}
+
+	//answer one request. Reads run on the published snapshot without locking, mutations take writeLock.
+	//returns false when the client asked the server to stop
+	bool handle(Vault& vault, std::mutex& writeLock, const Vector<uint8_t>& request, Vector<uint8_t>& response)
+	{
+		response.clear();
+
+		try
+		{
+			const uint8_t* cursor = request.data();
+			const uint8_t* end = request.data() + request.size();
+
+			if (cursor == end)
+				throw std::runtime_error("Empty request");
+
+			uint8_t op = *cursor++;
+
+			switch (op)
+			{
+			case Get:
+			{
+				UniquePtr<char[]> website = getString(cursor, end);
+
+				std::shared_ptr<const VaultSnapshot> snapshot = vault.snapshot();
+				putRecords(response, *snapshot, snapshot->findWebsite(website.get()));
+				break;
+			}
+			case Find:
+			{
+				UniquePtr<char[]> term = getString(cursor, end);
+
+				std::shared_ptr<const VaultSnapshot> snapshot = vault.snapshot();
+				putRecords(response, *snapshot, snapshot->findText(term.get()));
+				break;
+			}
+			case Add:
+			{
+				UniquePtr<char[]> website = getString(cursor, end);
+				UniquePtr<char[]> username = getString(cursor, end);
+				UniquePtr<char[]> password = getString(cursor, end);
+
+				{
+					std::lock_guard<std::mutex> lock(writeLock);
+
+					if (!vault.addEntryAndSave(website.get(), username.get(), password.get()))
+						throw std::runtime_error("Duplicate entry, not appending");
+				}
+
+				std::shared_ptr<const VaultSnapshot> snapshot = vault.snapshot();
+				putRecords(response, *snapshot, snapshot->findWebsite(website.get()));
+				break;
+			}
+			case Edit:
+			{
+				UniquePtr<char[]> index = getString(cursor, end);
+				UniquePtr<char[]> website = getString(cursor, end);
+				UniquePtr<char[]> username = getString(cursor, end);
+				UniquePtr<char[]> password = getString(cursor, end);
+
+				{
+					std::lock_guard<std::mutex> lock(writeLock);
+					vault.editAndSave(parseIndex(index.get()), website.get(), username.get(), password.get());
+				}
+
+				std::shared_ptr<const VaultSnapshot> snapshot = vault.snapshot();
+				putRecords(response, *snapshot, snapshot->findWebsite(website.get()));
+				break;
+			}
+			case Delete:
+			{
+				Vector<std::size_t> list;
+
+				while (cursor < end)
+				{
+					UniquePtr<char[]> index = getString(cursor, end);
+					list.emplace_back(parseIndex(index.get()));
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(writeLock);
+					vault.deleteEntryAndSave(list);
+				}
+
+				response.emplace_back(Ok);
+				putU32(response, 0);
+				break;
+			}
+			case Stop:
+			{
+				response.emplace_back(Ok);
+				putU32(response, 0);
+				return false;
+			}
+			default:
+				throw std::runtime_error("Unknown op");
+			}
+		}
+		catch (const std::exception& e)
+		{
+			response.clear();
+			response.emplace_back(Error);
+			putString(response, e.what());
+		}
+
+		return true;
+	}
+
+	//serve until a Stop request or idleSeconds with no connection. One thread per connection,
+	//so concurrent lookups scale with cores and never wait behind a save. watch: reload when another process saves entries.bin
+	int serve(Vault& vault, unsigned idleSeconds, bool watch)
+	{
+		WinsockSession session;
+
+		//the client asked for the mutation explicitly, and nobody is at this terminal to answer prompts
+		vault.setConfirmPolicy(ConfirmPolicy::Always);
+		vault.setQuiet(true);
+
+		//decrypt once up front and publish the first snapshot, every request after this is served from memory.
+		//saves run in the background so a writer holds writeLock only for the in memory change
+		vault.enableAsyncSave();
+
+		SOCKET listener = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (listener == INVALID_SOCKET)
+			throw std::runtime_error("Could not create socket");
+
+		//stale socket file from a previous run
+		std::error_code ec;
+		std::filesystem::remove(SOCKET_PATH, ec);
+
+		sockaddr_un address = socketAddress();
+		if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR || listen(listener, 64) == SOCKET_ERROR)
+		{
+			closesocket(listener);
+			throw std::runtime_error("Could not bind pm.sock");
+		}
+
+		uint8_t token[TOKEN_SIZE];
+		writeToken(token);
+
+		std::cout << "Serving " << SOCKET_PATH << ", idle timeout " << idleSeconds << "s\n";
+
+		using Clock = std::chrono::steady_clock;
+
+		std::mutex writeLock;
+		std::atomic<bool> running{ true };
+		std::atomic<int> active{ 0 };
+		std::atomic<Clock::rep> lastActivity{ Clock::now().time_since_epoch().count() };
+
+		//reloads are mutations, they take writeLock like any other. Lookups keep answering from the previous snapshot meanwhile
+		UniquePtr<FileWatcher> watcher;
+
+		if (watch)
+		{
+			watcher = makeUnique<FileWatcher>("entries.bin", [&]()
+				{
+					std::lock_guard<std::mutex> lock(writeLock);
+
+					try
+					{
+						if (vault.reloadIfChanged())
+							std::cout << "entries.bin changed on disk, reloaded\n";
+					}
+					catch (const std::exception& e)
+					{
+						std::cerr << "Reload failed: " << e.what() << "\n";
+					}
+				});
+		}
+
+		auto serveClient = [&](SOCKET client)
+			{
+				Vector<uint8_t> request;
+				Vector<uint8_t> response;
+
+				DWORD timeout = CLIENT_TIMEOUT_MS;
+				bool ok = setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout)) == 0
+					&& setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout)) == 0;
+
+				//no reply to a wrong token, the connection just closes
+				ok = ok && recvFrame(client, request) && sameToken(request, token);
+
+				//a client may pipeline several requests on one connection
+				while (ok && running && recvFrame(client, request))
+				{
+					if (!handle(vault, writeLock, request, response))
+						running = false;
+
+					lastActivity = Clock::now().time_since_epoch().count();
+
+					if (!sendFrame(client, response))
+						break;
+				}
+
+				closesocket(client);
+				--active;
+			};
+
+		while (running)
+		{
+			fd_set readable;
+			FD_ZERO(&readable);
+			FD_SET(listener, &readable);
+
+			//wake up every second to notice Stop and the idle deadline
+			timeval timeout{};
+			timeout.tv_sec = 1;
+
+			int ready = select(static_cast<int>(listener) + 1, &readable, nullptr, nullptr, &timeout);
+			if (ready < 0)
+				break;
+
+			if (ready == 0)
+			{
+				Clock::duration idle = Clock::now().time_since_epoch() - Clock::duration(lastActivity.load());
+
+				if (active == 0 && idle > std::chrono::seconds(idleSeconds))
+					break;
+
+				continue;
+			}
+
+			SOCKET client = accept(listener, nullptr, nullptr);
+			if (client == INVALID_SOCKET)
+				continue;
+
+			++active;
+			lastActivity = Clock::now().time_since_epoch().count();
+
+			std::thread(serveClient, client).detach();
+		}
+
+		closesocket(listener);
+		std::filesystem::remove(SOCKET_PATH, ec);
+		std::filesystem::remove(TOKEN_PATH, ec);
+
+		//detached clients reference this frame, let them drain
+		while (active > 0)
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+		std::cout << "Server stopped\n";
+
+		//the last background save has to land before exit, and a failed one has nobody else to report it
+		try
+		{
+			vault.flush();
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << e.what() << "\n";
+			return 1;
+		}
+
+		return 0;
+	}
+
+	//client side. Sends one request to a running server and prints the reply.
+	//returns the exit code, or -1 if no server is listening so the caller can fall back to opening the vault itself
+	int request(Op op, char* const* args, std::size_t count)
+	{
+		uint8_t token[TOKEN_SIZE];
+
+		if (!std::filesystem::exists(SOCKET_PATH) || !readToken(token))
+			return -1;
+
+		WinsockSession session;
+
+		SOCKET s = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (s == INVALID_SOCKET)
+			return -1;
+
+		sockaddr_un address = socketAddress();
+		if (connect(s, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR)
+		{
+			closesocket(s);
+			return -1;
+		}
+
+		Vector<uint8_t> body;
+		body.emplace_back(op);
+
+		for (std::size_t i{ 0 }; i < count; ++i)
+			putString(body, args[i]);
+
+		Vector<uint8_t> hello(TOKEN_SIZE);
+		std::memcpy(hello.data(), token, TOKEN_SIZE);
+
+		Vector<uint8_t> reply;
+		bool ok = sendFrame(s, hello) && sendFrame(s, body) && recvFrame(s, reply);
+		closesocket(s);
+
+		if (!ok || reply.empty())
+		{
+			std::cerr << "Server closed the connection\n";
+			return 1;
+		}
+
+		const uint8_t* cursor = reply.data();
+		const uint8_t* end = reply.data() + reply.size();
+		uint8_t status = *cursor++;
+
+		if (status == Error)
+		{
+			std::cerr << getString(cursor, end).get() << "\n";
+			return 1;
+		}
+
+		uint32_t records = getU32(cursor, end);
+
+		std::cout << "\n";
+
+		for (uint32_t i{ 0 }; i < records; ++i)
+		{
+			uint32_t index = getU32(cursor, end);
+			UniquePtr<char[]> website = getString(cursor, end);
+			UniquePtr<char[]> username = getString(cursor, end);
+			UniquePtr<char[]> password = getString(cursor, end);
+
+			std::cout << std::setw(4) << "[Index " << index << " - " << "Website: "
+				<< std::setw(16) << std::left << website.get() << " | Username: "
+				<< std::setw(16) << std::left << username.get() << " | Password: "
+				<< std::setw(16) << std::left << password.get() << "]\n";
+		}
+
+		if (status == NotFound && (op == Get || op == Find))
+			std::cout << "No entries for " << args[0] << "\n";
+
+		std::cout << "\n";
+
+		return status == Ok ? 0 : 1;
+	}
+}
+
+#endif
\ No newline at end of file
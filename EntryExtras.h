@@ -0,0 +1,274 @@
+#ifndef ENTRYEXTRAS_H
+#define ENTRYEXTRAS_H
+
+#include "Vector.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+//calendar dates as days since 1970-01-01, the unit date fields are kept and stored in
+namespace Dates
+{
+	//proleptic Gregorian year, month, day -> days since 1970-01-01 (Hinnant's days_from_civil)
+	int64_t fromCivil(int64_t year, unsigned month, unsigned day)
+	{
+		year -= month <= 2;
+
+		int64_t era = (year >= 0 ? year : year - 399) / 400;
+		unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+		unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+		unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+		return era * 146097 + static_cast<int64_t>(dayOfEra) - 719468;
+	}
+
+	//inverse of fromCivil
+	void toCivil(int64_t days, int64_t& year, unsigned& month, unsigned& day)
+	{
+		days += 719468;
+
+		int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+		unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+		unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+		unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+		unsigned shifted = (5 * dayOfYear + 2) / 153; //month counted from March
+
+		day = dayOfYear - (153 * shifted + 2) / 5 + 1;
+		month = shifted < 10 ? shifted + 3 : shifted - 9;
+		year = static_cast<int64_t>(yearOfEra) + era * 400 + (month <= 2);
+	}
+
+	//"YYYY-MM-DD" from 1970 on -> days. Throws on anything else, including days the month does not have
+	uint32_t parse(const char* text)
+	{
+		unsigned year, month, day;
+		char rest;
+
+		if (std::strlen(text) != 10 || std::sscanf(text, "%4u-%2u-%2u%c", &year, &month, &day, &rest) != 3 || year < 1970 || month < 1 || month > 12 || day < 1)
+			throw std::runtime_error("Dates are YYYY-MM-DD");
+
+		int64_t days = fromCivil(year, month, day);
+
+		//a day past the end of the month comes back as a different date
+		int64_t checkYear;
+		unsigned checkMonth, checkDay;
+		toCivil(days, checkYear, checkMonth, checkDay);
+
+		if (checkYear != year || checkMonth != month || checkDay != day)
+			throw std::runtime_error("No such date");
+
+		return static_cast<uint32_t>(days);
+	}
+
+	//days -> "YYYY-MM-DD"
+	void format(uint32_t days, char (&out)[16])
+	{
+		int64_t year;
+		unsigned month, day;
+		toCivil(days, year, month, day);
+
+		std::snprintf(out, sizeof(out), "%04lld-%02u-%02u", static_cast<long long>(year), month, day);
+	}
+}
+
+//append length bytes of s and a terminator to text, returns the offset they start at. Grows by half again, not to the byte
+uint32_t appendText(Vector<char>& text, const char* s, std::size_t length)
+{
+	std::size_t offset = text.size();
+	std::size_t needed = offset + length + 1;
+
+	if (text.capacity() < needed)
+		text.reserve(std::max(needed, std::min(text.capacity() + text.capacity() / 2, text.max_size())));
+
+	text.resize(needed);
+	std::memcpy(text.data() + offset, s, length);
+	text[needed - 1] = '\0';
+
+	return static_cast<uint32_t>(offset);
+}
+
+//what an Entry holds besides website, username and password: tags, and named fields for notes, rotation dates and the like.
+//entries without any have no EntryExtras at all. Names and text values sit NUL terminated back to back in text and
+//tags and fields refer to them by offset, so however much an entry carries it is three allocations
+struct EntryExtras
+{
+	enum Type : uint8_t { Text, Date, Attachment };
+
+	struct Field
+	{
+		uint32_t name; //offset in text
+		Type type;
+		uint32_t value; //Text: offset in text. Date: days since 1970-01-01. Attachment: offset of its blob id in text
+
+		//value is an offset in text rather than a number
+		bool hasText() const
+		{
+			return type != Date;
+		}
+	};
+
+	Vector<uint32_t> tags; //offsets in text, in the order they were added
+	Vector<Field> fields;
+	Vector<char> text;
+
+	const char* str(uint32_t offset) const
+	{
+		return text.data() + offset;
+	}
+
+	bool empty() const
+	{
+		return tags.empty() && fields.empty();
+	}
+
+	void clear()
+	{
+		tags.clear();
+		fields.clear();
+		text.clear();
+	}
+
+	uint32_t addText(const char* s)
+	{
+		return appendText(text, s, std::strlen(s));
+	}
+
+	//position of tag in tags, or tags.size()
+	std::size_t findTag(const char* tag) const
+	{
+		std::size_t i = 0;
+
+		while (i < tags.size() && std::strcmp(str(tags[i]), tag) != 0)
+			++i;
+
+		return i;
+	}
+
+	//position of the field called name, or fields.size()
+	std::size_t findField(const char* name) const
+	{
+		std::size_t i = 0;
+
+		while (i < fields.size() && std::strcmp(str(fields[i].name), name) != 0)
+			++i;
+
+		return i;
+	}
+
+	//false if tag was already there
+	bool addTag(const char* tag)
+	{
+		if (findTag(tag) < tags.size())
+			return false;
+
+		tags.emplace_back(addText(tag));
+		return true;
+	}
+
+	//false if tag was not there
+	bool removeTag(const char* tag)
+	{
+		std::size_t at = findTag(tag);
+
+		if (at == tags.size())
+			return false;
+
+		tags.erase_index(at);
+		pack();
+		return true;
+	}
+
+	//add the field or replace its value
+	void setText(const char* name, const char* value)
+	{
+		removeField(name);
+		fields.emplace_back(Field{ addText(name), Text, addText(value) });
+	}
+
+	void setDate(const char* name, uint32_t days)
+	{
+		removeField(name);
+		fields.emplace_back(Field{ addText(name), Date, days });
+	}
+
+	//reference to the attachment blob with id
+	void setAttachment(const char* name, const char* id)
+	{
+		removeField(name);
+		fields.emplace_back(Field{ addText(name), Attachment, addText(id) });
+	}
+
+	//false if there was no field called name
+	bool removeField(const char* name)
+	{
+		std::size_t at = findField(name);
+
+		if (at == fields.size())
+			return false;
+
+		fields.erase_index(at);
+		pack();
+		return true;
+	}
+
+	//same tags and fields, in any order
+	bool same(const EntryExtras& other) const
+	{
+		if (tags.size() != other.tags.size() || fields.size() != other.fields.size())
+			return false;
+
+		for (uint32_t tag : tags)
+			if (other.findTag(str(tag)) == other.tags.size())
+				return false;
+
+		for (const Field& f : fields)
+		{
+			std::size_t at = other.findField(str(f.name));
+
+			if (at == other.fields.size() || other.fields[at].type != f.type)
+				return false;
+
+			const Field& g = other.fields[at];
+
+			if (f.hasText() ? std::strcmp(str(f.value), other.str(g.value)) != 0 : f.value != g.value)
+				return false;
+		}
+
+		return true;
+	}
+
+private:
+	//drop the text nothing refers to any more
+	void pack()
+	{
+		Vector<char> packed;
+
+		for (uint32_t& tag : tags)
+			tag = appendText(packed, str(tag), std::strlen(str(tag)));
+
+		for (Field& f : fields)
+		{
+			f.name = appendText(packed, str(f.name), std::strlen(str(f.name)));
+
+			if (f.hasText())
+				f.value = appendText(packed, str(f.value), std::strlen(str(f.value)));
+		}
+
+		text.swap(packed);
+	}
+};
+
+//no extras and empty extras are the same thing
+bool sameExtras(const EntryExtras* a, const EntryExtras* b)
+{
+	if (!a || a->empty())
+		return !b || b->empty();
+
+	return b && a->same(*b);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,153 @@
+#ifndef EXPORT_H
+#define EXPORT_H
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+
+//writer for plaintext exports in the formats Import reads back: CSV with a website,username,password header row,
+//or a JSON array of flat objects. Rows go straight to the stream as they are decrypted, nothing is collected here
+namespace Export
+{
+	enum Format { Csv, Json };
+
+	//"csv" or "json". Without a name the extension of path decides, anything but .json is CSV
+	Format formatOf(const char* name, const char* path)
+	{
+		if (name && *name)
+		{
+			if (std::strcmp(name, "csv") == 0)
+				return Csv;
+
+			if (std::strcmp(name, "json") == 0)
+				return Json;
+
+			throw std::runtime_error("Unknown export format, use csv or json");
+		}
+
+		const char* dot = std::strrchr(path, '.');
+
+		return (dot && std::strcmp(dot, ".json") == 0) ? Json : Csv;
+	}
+
+	//======================================== CSV ========================================//
+
+	//RFC 4180: quote a field holding a separator, quote or line break (and one with edge spaces, which readers trim), double the quotes
+	void csvField(std::ostream& out, const char* s)
+	{
+		std::size_t length = std::strlen(s);
+		bool quote = std::strpbrk(s, ",\"\r\n") != nullptr || (length > 0 && (s[0] == ' ' || s[length - 1] == ' '));
+
+		if (!quote)
+		{
+			out.write(s, length);
+			return;
+		}
+
+		out.put('"');
+
+		for (; *s; ++s)
+		{
+			if (*s == '"')
+				out.put('"');
+
+			out.put(*s);
+		}
+
+		out.put('"');
+	}
+
+	//======================================== JSON ========================================//
+
+	//string literal with ", \ and control characters escaped. Bytes from 0x80 up are UTF-8 already and pass through
+	void jsonString(std::ostream& out, const char* s)
+	{
+		static const char hex[] = "0123456789abcdef";
+
+		out.put('"');
+
+		for (; *s; ++s)
+		{
+			unsigned char c = static_cast<unsigned char>(*s);
+
+			switch (c)
+			{
+			case '"': out << "\\\""; break;
+			case '\\': out << "\\\\"; break;
+			case '\n': out << "\\n"; break;
+			case '\r': out << "\\r"; break;
+			case '\t': out << "\\t"; break;
+			default:
+				if (c < 0x20)
+					out << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+				else
+					out.put(*s);
+			}
+		}
+
+		out.put('"');
+	}
+
+	//========================================================================================//
+
+	//streams rows in format to out: begin, row per entry, end
+	class Writer
+	{
+	public:
+		Writer(std::ostream& out, Format format)
+			: m_out{ out }, m_format{ format }
+		{
+			if (m_format == Csv)
+				m_out << "website,username,password\r\n";
+			else
+				m_out << "[";
+		}
+
+		void row(const char* website, const char* username, const char* password)
+		{
+			if (m_format == Csv)
+			{
+				csvField(m_out, website);
+				m_out.put(',');
+				csvField(m_out, username);
+				m_out.put(',');
+				csvField(m_out, password);
+				m_out << "\r\n";
+			}
+			else
+			{
+				m_out << (m_rows == 0 ? "\n  {\"website\": " : ",\n  {\"website\": ");
+				jsonString(m_out, website);
+				m_out << ", \"username\": ";
+				jsonString(m_out, username);
+				m_out << ", \"password\": ";
+				jsonString(m_out, password);
+				m_out << "}";
+			}
+
+			++m_rows;
+		}
+
+		//close the JSON array, returns the number of rows written
+		std::size_t end()
+		{
+			if (m_format == Json)
+				m_out << (m_rows == 0 ? "]\n" : "\n]\n");
+
+			m_out.flush();
+
+			if (!m_out)
+				throw std::runtime_error("Could not write export");
+
+			return m_rows;
+		}
+
+	private:
+		std::ostream& m_out;
+		Format m_format;
+		std::size_t m_rows = 0;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,102 @@
+#ifndef FILEWATCHER_H
+#define FILEWATCHER_H
+
+#include "AtomicFile.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#ifndef NOMINMAX
+#define NOMINMAX //otherwise limits ::max() gets polluted by windows max and min
+#endif
+#include <winsock2.h> //must come before Windows.h, which otherwise pulls in the old winsock.h
+#include <Windows.h>
+
+//background thread that calls onChange whenever path is replaced or rewritten by anyone.
+//waits on a directory change notification, and falls back to polling the stamp where notifications are unavailable (network shares).
+//onChange runs on the watcher thread, the owner serializes it with its own mutators
+class FileWatcher
+{
+private:
+	const char* m_path;
+	std::chrono::milliseconds m_poll;
+	std::function<void()> m_onChange;
+
+	std::atomic<bool> m_stop{ false };
+	std::mutex m_mutex; //only for the polling sleep, so stop wakes it right away
+	std::condition_variable m_wake;
+
+	std::thread m_thread;
+
+	void run()
+	{
+		AtomicFile::FileStamp seen;
+		bool exists = AtomicFile::stamp(m_path, seen);
+
+		//the vault lives in the working directory. Renames cover the atomic save, last write covers in place writers
+		HANDLE notify = FindFirstChangeNotificationA(".", FALSE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE);
+
+		while (!m_stop)
+		{
+			if (notify != INVALID_HANDLE_VALUE)
+			{
+				//wakes on any change in the directory, the timeout bounds how long stop takes to notice
+				if (WaitForSingleObject(notify, static_cast<DWORD>(m_poll.count())) == WAIT_OBJECT_0)
+					FindNextChangeNotification(notify);
+			}
+			else
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_wake.wait_for(lock, m_poll, [this] { return m_stop.load(); });
+			}
+
+			if (m_stop)
+				break;
+
+			//other files in the directory (temp files, the bloom sidecar) fire notifications too, only a new stamp on path counts
+			AtomicFile::FileStamp current;
+			bool nowExists = AtomicFile::stamp(m_path, current);
+
+			if (nowExists == exists && (!exists || current == seen))
+				continue;
+
+			seen = current;
+			exists = nowExists;
+
+			if (exists)
+				m_onChange();
+		}
+
+		if (notify != INVALID_HANDLE_VALUE)
+			FindCloseChangeNotification(notify);
+	}
+
+public:
+	//path must outlive the watcher. onChange must not throw
+	FileWatcher(const char* path, std::function<void()> onChange, std::chrono::milliseconds poll = std::chrono::milliseconds(500))
+		: m_path(path), m_poll(poll), m_onChange(std::move(onChange))
+	{
+		m_thread = std::thread(&FileWatcher::run, this);
+	}
+
+	~FileWatcher()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+
+		m_wake.notify_one();
+		m_thread.join();
+	}
+
+	FileWatcher(const FileWatcher&) = delete;
+	FileWatcher& operator= (const FileWatcher&) = delete;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,174 @@
+#ifndef FLATMULTIMAP_H
+#define FLATMULTIMAP_H
+
+#include "Vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+//64 bit FNV-1a, used for every hashed lookup in the vault
+constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+constexpr uint64_t fnv1aStep(uint64_t hash, unsigned char byte)
+{
+	return (hash ^ byte) * FNV_PRIME;
+}
+
+constexpr uint64_t fnv1a(const char* s, std::size_t length, uint64_t hash = FNV_OFFSET)
+{
+	for (std::size_t i{ 0 }; i < length; ++i)
+		hash = fnv1aStep(hash, static_cast<unsigned char>(s[i]));
+
+	return hash;
+}
+
+//open addressing hash multimap. Keys are 64 bit hashes, the caller verifies the real key through the stored value.
+//slots live in one flat array (linear probing, backward shift deletion) so a lookup touches a handful of adjacent cache lines instead of chasing bucket nodes
+template <typename V>
+class FlatMultimap
+{
+private:
+	struct Slot
+	{
+		uint64_t hash = 0; //0 marks an empty slot
+		V value{};
+	};
+
+	Vector<Slot> m_slots;
+	std::size_t m_size = 0;
+	std::size_t m_mask = 0; //capacity - 1, capacity is always a power of two
+
+	//0 is reserved for empty slots, so remap it
+	static uint64_t fixHash(uint64_t hash) { return hash == 0 ? 1 : hash; }
+
+	void rehash(std::size_t newCapacity)
+	{
+		Vector<Slot> old(newCapacity);
+		old.swap(m_slots);
+
+		m_mask = newCapacity - 1;
+		m_size = 0;
+
+		for (const Slot& s : old)
+			if (s.hash != 0)
+				insertNoGrow(s.hash, s.value);
+	}
+
+	void insertNoGrow(uint64_t hash, const V& value)
+	{
+		std::size_t i = static_cast<std::size_t>(hash) & m_mask;
+
+		while (m_slots[i].hash != 0)
+			i = (i + 1) & m_mask;
+
+		m_slots[i].hash = hash;
+		m_slots[i].value = value;
+		++m_size;
+	}
+
+public:
+	FlatMultimap()
+		: m_slots(16), m_size(0), m_mask(15)
+	{
+	}
+
+	std::size_t size() const { return m_size; }
+
+	bool empty() const { return m_size == 0; }
+
+	//keep capacity, drop all slots
+	void clear()
+	{
+		for (std::size_t i{ 0 }; i <= m_mask; ++i)
+			m_slots[i].hash = 0;
+
+		m_size = 0;
+	}
+
+	//size the table for n values up front so a rebuild never rehashes midway
+	void reserve(std::size_t n)
+	{
+		std::size_t capacity = m_mask + 1;
+
+		//keep load factor <= 0.5
+		while (capacity < n * 2)
+			capacity *= 2;
+
+		if (capacity != m_mask + 1)
+			rehash(capacity);
+	}
+
+	void insert(uint64_t hash, const V& value)
+	{
+		hash = fixHash(hash);
+
+		//grow at 50% load, probe sequences stay short
+		if ((m_size + 1) * 2 > m_mask + 1)
+			rehash((m_mask + 1) * 2);
+
+		insertNoGrow(hash, value);
+	}
+
+	//remove one (hash, value) pair. Returns false if it was not present
+	bool erase(uint64_t hash, const V& value)
+	{
+		hash = fixHash(hash);
+		std::size_t i = static_cast<std::size_t>(hash) & m_mask;
+
+		while (m_slots[i].hash != 0)
+		{
+			if (m_slots[i].hash == hash && m_slots[i].value == value)
+				break;
+
+			i = (i + 1) & m_mask;
+		}
+
+		if (m_slots[i].hash == 0)
+			return false;
+
+		//backward shift: pull later members of the probe run into the hole so no tombstones are needed
+		std::size_t hole = i;
+		std::size_t j = (i + 1) & m_mask;
+
+		while (m_slots[j].hash != 0)
+		{
+			std::size_t home = static_cast<std::size_t>(m_slots[j].hash) & m_mask;
+
+			//slot j may move into the hole only if its home is not in (hole, j]
+			bool movable = (hole <= j) ? (home <= hole || home > j) : (home <= hole && home > j);
+
+			if (movable)
+			{
+				m_slots[hole] = m_slots[j];
+				hole = j;
+			}
+
+			j = (j + 1) & m_mask;
+		}
+
+		m_slots[hole].hash = 0;
+		--m_size;
+
+		return true;
+	}
+
+	//call fn(value) for every value stored under hash. Callers must still compare the real key
+	template <typename Fn>
+	void forEach(uint64_t hash, Fn&& fn) const
+	{
+		hash = fixHash(hash);
+		std::size_t i = static_cast<std::size_t>(hash) & m_mask;
+
+		while (m_slots[i].hash != 0)
+		{
+			if (m_slots[i].hash == hash)
+				fn(m_slots[i].value);
+
+			i = (i + 1) & m_mask;
+		}
+	}
+};
+
+#endif
\ No newline at end of file
@@ -1,20 +1,27 @@
 #ifndef HELPERS_H
 #define HELPERS_H
 
+#include "Bench.h"
 #include "Cryption.h"
+#include "Daemon.h"
 #include "Vector.h"
 #include "UniquePointer.h"
 
 #include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <limits>
+#include <string>
 
 #include <stdio.h>
 
 namespace Helpers
 {
 
-	void parseUserInput(const char* userInput, Vault& vault)
+	//interactive: someone is at the terminal to answer the prompts of edit(index). Scripts pass false, their next lines are not answers
+	void parseUserInput(const char* userInput, Vault& vault, bool interactive = true)
 	{
 		//get length of user input for init dynamic c-string
 		std::size_t len = strlen(userInput);
@@ -211,7 +218,25 @@ namespace Helpers
 			};
 
 		if (strcmp(cmd, "display") == 0)
-			vault.listAllEntries();
+		{
+			while (*p && std::isspace(static_cast<unsigned char>(*p)))
+				++p;
+
+			if (*p != '(')
+			{
+				vault.listAllEntries();
+				return;
+			}
+
+			//display(tag query). The query has parentheses of its own, so it runs to the last ')'
+			char* close = std::strrchr(p, ')');
+
+			if (!close)
+				throw std::runtime_error("Incorrect format, must be display(tag:a & tag:b)");
+
+			*close = '\0';
+			vault.listTagged(p + 1);
+		}
 
 		else if (strcmp(cmd, "add") == 0)
 		{
@@ -225,6 +250,41 @@ namespace Helpers
 			//delegate to addEntryAndSave with extracted params
 			vault.addEntryAndSave(param1.get(), param2.get(), param3.get());
 		}
+		else if (strcmp(cmd, "get") == 0)
+		{
+			//extract website
+			UniquePtr<char[]> website = truncateStart();
+
+			vault.listWebsite(website.get());
+		}
+		else if (strcmp(cmd, "has") == 0)
+		{
+			//extract website
+			UniquePtr<char[]> website = truncateStart();
+
+			//optional username
+			if (*p == ',')
+			{
+				UniquePtr<char[]> username = truncateX();
+				std::cout << (vault.hasCredentials(website.get(), username.get()) ? "yes\n" : "no\n");
+			}
+			else
+				std::cout << (vault.hasCredentials(website.get()) ? "yes\n" : "no\n");
+		}
+		else if (strcmp(cmd, "find") == 0)
+		{
+			//extract search text
+			UniquePtr<char[]> term = truncateStart();
+
+			vault.listText(term.get());
+		}
+		else if (strcmp(cmd, "match") == 0)
+		{
+			//extract url
+			UniquePtr<char[]> url = truncateStart();
+
+			vault.listDomain(url.get());
+		}
 		else if (strcmp(cmd, "edit") == 0)
 		{
 			//p -> edit(HERE.....) after parseStart
@@ -233,40 +293,118 @@ namespace Helpers
 			//returns user-passed index as std::size_t
 			std::size_t index = truncateNum();
 
-			//retrieve Entry at index of vault
-			Entry& et = vault.get(index);
+			//edit(index, website, username, password) replaces the fields without prompting, for scripts
+			if (*p == ',')
+			{
+				UniquePtr<char[]> website = truncateX();
+				UniquePtr<char[]> username = truncateX();
+				UniquePtr<char[]> password = truncateX();
+
+				vault.editAndSave(index, website.get(), username.get(), password.get());
+				return;
+			}
+
+			if (!interactive)
+				throw std::runtime_error("Scripts must use edit(index, website, username, password)");
+
+			//retrieve Entry at index of vault. Left untouched until editAndSave so the vault can unindex the old website
+			const Entry& et = vault.get(index);
 			char temp[64]; //stack allocate
 
-			//if the user entered nothing, dont adjust it. If they did, adjust field to new user string
-			auto updateField = [&](char*& field)
+			//if the user entered nothing, keep the current field. If they did, take the new user string
+			auto readField = [&](const char* current)
 				{
-					if (temp[0] != '\0')
-					{
-						delete[] field;
+					std::cin.getline(temp, sizeof(temp));
 
-						std::size_t dstSize = strlen(temp) + 1;
-						field = new char[dstSize];
-						strcpy_s(field, dstSize, temp); //destination, destinationSize, source
-					}
+					const char* src = (temp[0] != '\0') ? temp : current;
+
+					std::size_t dstSize = strlen(src) + 1;
+					UniquePtr<char[]> field = makeUnique<char[]>(dstSize);
+					strcpy_s(field.get(), dstSize, src); //destination, destinationSize, source
+
+					return field;
 				};
 
 			//adj website
 			std::cout << "Website [" << et.website_ << "]: ";
-			std::cin.getline(temp, sizeof(temp));
-			updateField(et.website_);
+			UniquePtr<char[]> website = readField(et.website_);
 
 			//adj ussername
 			std::cout << "Username [" << et.username_ << "]: ";
-			std::cin.getline(temp, sizeof(temp));
-			updateField(et.username_);
+			UniquePtr<char[]> username = readField(et.username_);
 
 			//adj password
 			std::cout << "Password [" << et.password_ << "]: ";
-			std::cin.getline(temp, sizeof(temp));
-			updateField(et.password_);
+			UniquePtr<char[]> password = readField(et.password_);
+
+			vault.editAndSave(index, website.get(), username.get(), password.get());
+		}
+		else if (strcmp(cmd, "tag") == 0 || strcmp(cmd, "untag") == 0)
+		{
+			truncateStartNum();
+			std::size_t index = truncateNum();
+
+			//tag(index, tag, tag...)
+			Vector<UniquePtr<char[]>> storage;
+			Vector<const char*> tags;
+
+			while (*p == ',')
+			{
+				storage.emplace_back(truncateX());
+				tags.emplace_back(storage.back().get());
+			}
+
+			if (tags.empty())
+				throw std::runtime_error("Incorrect format, must be tag(index, tag...)");
+
+			if (strcmp(cmd, "tag") == 0)
+				vault.tagAndSave(index, tags.data(), tags.size());
+			else
+				vault.untagAndSave(index, tags.data(), tags.size());
+		}
+		else if (strcmp(cmd, "field") == 0)
+		{
+			truncateStartNum();
+			std::size_t index = truncateNum();
+
+			//field(index, name, value) or field(index, name, value, date)
+			UniquePtr<char[]> name = truncateX();
+			UniquePtr<char[]> value = truncateX();
+
+			if (*p == ',')
+			{
+				UniquePtr<char[]> type = truncateX();
+				vault.setFieldAndSave(index, name.get(), value.get(), type.get());
+			}
+			else
+				vault.setFieldAndSave(index, name.get(), value.get());
+		}
+		else if (strcmp(cmd, "attach") == 0 || strcmp(cmd, "extract") == 0)
+		{
+			truncateStartNum();
+			std::size_t index = truncateNum();
+
+			//attach(index, name, file) or extract(index, name, file). The file path may not contain ',' or ')'
+			UniquePtr<char[]> name = truncateX();
+			UniquePtr<char[]> path = truncateX();
+
+			if (strcmp(cmd, "attach") == 0)
+				vault.attachAndSave(index, name.get(), path.get());
+			else
+				vault.extractAttachment(index, name.get(), path.get());
+		}
+		else if (strcmp(cmd, "prune") == 0)
+		{
+			vault.pruneAttachments();
+		}
+		else if (strcmp(cmd, "unfield") == 0)
+		{
+			truncateStartNum();
+			std::size_t index = truncateNum();
+
+			UniquePtr<char[]> name = truncateX();
 
-			//overloaded for taking an entry
-			vault.editAndSave(index, et);
+			vault.clearFieldAndSave(index, name.get());
 		}
 		else if (strcmp(cmd, "delete") == 0)
 		{
@@ -285,6 +423,72 @@ namespace Helpers
 
 			vault.deleteEntryAndSave(storage);
 		}
+		else if (strcmp(cmd, "import") == 0)
+		{
+			//extract path, may not contain ',' or ')'
+			UniquePtr<char[]> path = truncateStart();
+
+			vault.importFile(path.get());
+		}
+		else if (strcmp(cmd, "merge") == 0)
+		{
+			//extract path, may not contain ',' or ')'
+			UniquePtr<char[]> path = truncateStart();
+
+			//optional common ancestor, otherwise the one the last merge left
+			if (*p == ',')
+			{
+				UniquePtr<char[]> base = truncateX();
+				vault.mergeFile(path.get(), base.get());
+			}
+			else
+				vault.mergeFile(path.get());
+		}
+		else if (strcmp(cmd, "backup") == 0)
+		{
+			//extract directory, may not contain ',' or ')'
+			UniquePtr<char[]> dir = truncateStart();
+
+			vault.backup(dir.get());
+		}
+		else if (strcmp(cmd, "restore") == 0)
+		{
+			//extract manifest path, may not contain ',' or ')'
+			UniquePtr<char[]> path = truncateStart();
+
+			vault.restoreBackup(path.get());
+		}
+		else if (strcmp(cmd, "export") == 0)
+		{
+			//extract path, may not contain ',' or ')'
+			UniquePtr<char[]> path = truncateStart();
+
+			//optional format, otherwise the extension decides
+			if (*p == ',')
+			{
+				UniquePtr<char[]> format = truncateX();
+				vault.exportFile(path.get(), format.get());
+			}
+			else
+				vault.exportFile(path.get());
+		}
+		else if (strcmp(cmd, "begin") == 0)
+		{
+			vault.beginTransaction();
+		}
+		else if (strcmp(cmd, "commit") == 0)
+		{
+			vault.commitTransaction();
+		}
+		else if (strcmp(cmd, "abort") == 0 || strcmp(cmd, "rollback") == 0)
+		{
+			vault.abortTransaction();
+		}
+		else if (strcmp(cmd, "flush") == 0 || strcmp(cmd, "sync") == 0)
+		{
+			vault.flush();
+			std::cout << "All changes saved\n";
+		}
 		else if (strcmp(cmd, "cmds") == 0 || strcmp(cmd, "cmd") == 0)
 		{
 			vault.displayCmds();
@@ -294,6 +498,328 @@ namespace Helpers
 			std::cout << "Unable to parse user input\n";
 		}
 	}
+
+	//one shot mode: pm <command> [args...]. Arguments come straight from argv, so they may contain commas.
+	//the vault loads lazily, a has/get miss is answered from entries.bloom without reading entries.bin and get/has/match decrypt
+	//only the chunks of entries.bin holding their host (Vault::findUnloaded). Returns the process exit code
+	int runCommand(int argc, char* argv[], Vault& vault)
+	{
+		auto usage = []()
+			{
+				std::cerr << "usage: pm get <website> | find <text> | match <url> | has <website> [username] | display [\"tag:a & !tag:b\"]\n"
+					<< "       pm add <website> <username> <password> | edit <index> <website> <username> <password> | import <csv or json>\n"
+					<< "       pm tag <index> <tag>... | untag <index> <tag>... | field <index> <name> <value> [text | date] | unfield <index> <name>\n"
+					<< "       pm attach <index> <name> <file> | extract <index> <name> <file or -> | prune\n"
+					<< "       pm export <path or -> [csv | json] | merge <other.bin> [base.bin]\n"
+					<< "       pm backup <dir> | restore <dir/vault-<date>.backup>\n"
+					<< "       pm delete <index>... --yes | --batch <file | -> [--yes]\n"
+					<< "       pm serve [--idle seconds] [--watch] | stop | bench [rounds] | shard <count> | compress <on | off>\n"
+					<< "       pm --watch for an interactive session that picks up saves from other processes\n"
+					<< "       add --time to print cold start to answer latency, --sync-every N to flush to disk every Nth save\n";
+				return 2;
+			};
+
+		auto start = std::chrono::steady_clock::now();
+
+		//strip flags, what is left is the command and its arguments
+		Vector<char*> args;
+		bool time = false;
+		bool yes = false;
+		unsigned idleSeconds = 15 * 60;
+		bool watch = false;
+
+		vault.setConfirmPolicy(ConfirmPolicy::Refuse);
+
+		for (int i{ 1 }; i < argc; ++i)
+		{
+			if (strcmp(argv[i], "--yes") == 0)
+			{
+				yes = true;
+				vault.setConfirmPolicy(ConfirmPolicy::Always);
+			}
+			else if (strcmp(argv[i], "--time") == 0)
+				time = true;
+			else if (strcmp(argv[i], "--watch") == 0)
+				watch = true;
+			else if (strcmp(argv[i], "--idle") == 0 && i + 1 < argc)
+				idleSeconds = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+			else if (strcmp(argv[i], "--sync-every") == 0 && i + 1 < argc)
+				vault.setSyncEvery(static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10)));
+			else
+				args.emplace_back(argv[i]);
+		}
+
+		if (args.empty())
+			return usage();
+
+		const char* cmd = args[0];
+		std::size_t params = args.size() - 1;
+		int code = 0;
+
+		auto finish = [&]()
+			{
+				if (time)
+					std::cerr << "answered in " << std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() << "us\n";
+
+				return code;
+			};
+
+		//a running server already holds the vault decrypted, ask it first
+		Daemon::Op remoteOp = Daemon::Stop;
+		bool remote = true;
+
+		if (strcmp(cmd, "get") == 0 && params == 1)
+			remoteOp = Daemon::Get;
+		else if (strcmp(cmd, "find") == 0 && params == 1)
+			remoteOp = Daemon::Find;
+		else if (strcmp(cmd, "add") == 0 && params == 3)
+			remoteOp = Daemon::Add;
+		else if (strcmp(cmd, "edit") == 0 && params == 4)
+			remoteOp = Daemon::Edit;
+		else if (strcmp(cmd, "delete") == 0 && params >= 1 && yes)
+			remoteOp = Daemon::Delete;
+		else if (strcmp(cmd, "stop") == 0 && params == 0)
+			remoteOp = Daemon::Stop;
+		else
+			remote = false;
+
+		if (remote)
+		{
+			try
+			{
+				code = Daemon::request(remoteOp, args.data() + 1, params);
+			}
+			catch (const std::exception& e)
+			{
+				std::cerr << e.what() << "\n";
+				code = 1;
+			}
+
+			if (code >= 0)
+				return finish();
+
+			if (remoteOp == Daemon::Stop)
+			{
+				std::cerr << "No server running\n";
+				return 1;
+			}
+
+			//no server, fall through and open the vault here
+			code = 0;
+		}
+
+		try
+		{
+			if (strcmp(cmd, "serve") == 0 && params == 0)
+				return Daemon::serve(vault, idleSeconds, watch);
+
+			else if (strcmp(cmd, "import") == 0 && params == 1)
+				vault.importFile(args[1]);
+
+			else if (strcmp(cmd, "merge") == 0 && (params == 1 || params == 2))
+				code = vault.mergeFile(args[1], params == 2 ? args[2] : nullptr) == 0 ? 0 : 1;
+
+			else if (strcmp(cmd, "backup") == 0 && params == 1)
+				vault.backup(args[1]);
+
+			else if (strcmp(cmd, "restore") == 0 && params == 1)
+				vault.restoreBackup(args[1]);
+
+			else if (strcmp(cmd, "export") == 0 && (params == 1 || params == 2))
+				vault.exportFile(args[1], params == 2 ? args[2] : nullptr);
+
+			else if (strcmp(cmd, "shard") == 0 && params == 1)
+				vault.setShards(static_cast<uint32_t>(std::stoul(args[1])));
+
+			else if (strcmp(cmd, "bench") == 0 && params <= 1)
+			{
+				std::size_t rounds = 100;
+
+				if (params == 1)
+				{
+					//stoull reads "-1" as the largest value
+					if (args[1][0] < '0' || args[1][0] > '9')
+						throw std::runtime_error("Rounds must be a positive number");
+
+					rounds = static_cast<std::size_t>(std::stoull(args[1]));
+				}
+
+				if (rounds == 0)
+					throw std::runtime_error("Rounds must be a positive number");
+
+				Bench::saveDurability(rounds);
+				vault.benchCompression(rounds);
+			}
+
+			else if (strcmp(cmd, "compress") == 0 && params == 1 && (strcmp(args[1], "on") == 0 || strcmp(args[1], "off") == 0))
+				vault.setCompression(strcmp(args[1], "on") == 0);
+
+			else if (strcmp(cmd, "get") == 0 && params == 1)
+				code = vault.listWebsite(args[1]) > 0 ? 0 : 1;
+
+			else if (strcmp(cmd, "find") == 0 && params == 1)
+				code = vault.listText(args[1]) > 0 ? 0 : 1;
+
+			else if (strcmp(cmd, "match") == 0 && params == 1)
+				code = vault.listDomain(args[1]) > 0 ? 0 : 1;
+
+			else if (strcmp(cmd, "has") == 0 && (params == 1 || params == 2))
+			{
+				bool found = vault.hasCredentials(args[1], params == 2 ? args[2] : nullptr);
+				std::cout << (found ? "yes\n" : "no\n");
+				code = found ? 0 : 1;
+			}
+
+			else if (strcmp(cmd, "display") == 0 && params == 0)
+				vault.listAllEntries();
+
+			else if (strcmp(cmd, "display") == 0 && params == 1)
+				code = vault.listTagged(args[1]) > 0 ? 0 : 1;
+
+			else if (strcmp(cmd, "add") == 0 && params == 3)
+				vault.addEntryAndSave(args[1], args[2], args[3]);
+
+			else if (strcmp(cmd, "edit") == 0 && params == 4)
+				vault.editAndSave(static_cast<std::size_t>(std::stoull(args[1])), args[2], args[3], args[4]);
+
+			else if ((strcmp(cmd, "tag") == 0 || strcmp(cmd, "untag") == 0) && params >= 2)
+			{
+				std::size_t index = static_cast<std::size_t>(std::stoull(args[1]));
+
+				if (strcmp(cmd, "tag") == 0)
+					vault.tagAndSave(index, args.data() + 2, params - 1);
+				else
+					vault.untagAndSave(index, args.data() + 2, params - 1);
+			}
+
+			else if (strcmp(cmd, "field") == 0 && (params == 3 || params == 4))
+				vault.setFieldAndSave(static_cast<std::size_t>(std::stoull(args[1])), args[2], args[3], params == 4 ? args[4] : "text");
+
+			else if (strcmp(cmd, "attach") == 0 && params == 3)
+				vault.attachAndSave(static_cast<std::size_t>(std::stoull(args[1])), args[2], args[3]);
+
+			else if (strcmp(cmd, "extract") == 0 && params == 3)
+				vault.extractAttachment(static_cast<std::size_t>(std::stoull(args[1])), args[2], args[3]);
+
+			else if (strcmp(cmd, "prune") == 0 && params == 0)
+				vault.pruneAttachments();
+
+			else if (strcmp(cmd, "unfield") == 0 && params == 2)
+				vault.clearFieldAndSave(static_cast<std::size_t>(std::stoull(args[1])), args[2]);
+
+			else if (strcmp(cmd, "delete") == 0 && params >= 1)
+			{
+				Vector<std::size_t> list;
+
+				for (std::size_t i{ 1 }; i <= params; ++i)
+					list.emplace_back(static_cast<std::size_t>(std::stoull(args[i])));
+
+				vault.deleteEntryAndSave(list);
+			}
+
+			else
+				return usage();
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << e.what() << "\n";
+			code = 1;
+		}
+
+		return finish();
+	}
+
+	//run every line of in as a command against one loaded vault, inside one transaction so the whole script costs a single save.
+	//reads in 64KB blocks instead of a char at a time. Blank lines and lines starting with '#' are skipped. Returns the number of failed lines
+	std::size_t runBatch(std::istream& in, Vault& vault)
+	{
+		constexpr std::size_t blockSize = 64 * 1024;
+
+		auto start = std::chrono::steady_clock::now();
+
+		std::size_t commands = 0;
+		std::size_t failures = 0;
+		std::size_t lineNumber = 0;
+
+		Vector<char> block(blockSize);
+		Vector<char> line;
+
+		auto runLine = [&]()
+			{
+				++lineNumber;
+
+				//tolerate CRLF scripts
+				if (!line.empty() && line[line.size() - 1] == '\r')
+					line.pop_back();
+
+				line.push_back('\0');
+
+				const char* cmd = line.data();
+				while (*cmd && std::isspace(static_cast<unsigned char>(*cmd)))
+					++cmd;
+
+				if (*cmd != '\0' && *cmd != '#')
+				{
+					++commands;
+
+					try
+					{
+						parseUserInput(cmd, vault, false);
+					}
+					catch (const std::exception& e)
+					{
+						++failures;
+						std::cerr << "line " << lineNumber << ": " << e.what() << "\n";
+					}
+				}
+
+				line.clear();
+			};
+
+		vault.beginTransaction();
+
+		while (in)
+		{
+			in.read(block.data(), blockSize);
+			std::size_t got = static_cast<std::size_t>(in.gcount());
+
+			//split on '\n', a partial last line carries over to the next block
+			const char* cursor = block.data();
+			const char* end = block.data() + got;
+
+			while (cursor < end)
+			{
+				const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+				const char* stop = newline ? newline : end;
+
+				for (const char* c = cursor; c < stop; ++c)
+					line.emplace_back(*c);
+
+				if (!newline)
+					break;
+
+				runLine();
+				cursor = newline + 1;
+			}
+		}
+
+		//last line without a trailing newline
+		if (!line.empty())
+			runLine();
+
+		//a script may have closed the transaction itself
+		if (vault.inTransaction())
+			vault.commitTransaction();
+
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		std::cerr << commands << " commands, " << failures << " failed, in " << seconds << "s";
+		if (seconds > 0)
+			std::cerr << " (" << static_cast<std::size_t>(commands / seconds) << " commands/s)";
+		std::cerr << "\n";
+
+		return failures;
+	}
 }
 
 
@@ -0,0 +1,502 @@
+#ifndef IMPORT_H
+#define IMPORT_H
+
+#include "UniquePointer.h"
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+//streaming reader for password exports. CSV (RFC 4180: quoted fields, "" escapes, commas and line breaks inside quotes)
+//or JSON (an array of flat objects, or one object per line). The file is read in 1MB blocks and every field is
+//unescaped in place and handed out as a pointer into the block, so a row costs no allocation here
+namespace Import
+{
+	constexpr std::size_t BLOCK = 1024 * 1024;
+
+	//which entry field a CSV column or JSON key holds
+	enum Field { Website, Username, Password, Other };
+
+	bool equalsIgnoreCase(const char* a, std::size_t length, const char* b)
+	{
+		for (std::size_t i{ 0 }; i < length; ++i, ++b)
+			if (*b == '\0' || std::tolower(static_cast<unsigned char>(a[i])) != *b)
+				return false;
+
+		return *b == '\0';
+	}
+
+	//column and key names used by the common browser and password manager exports
+	Field fieldOf(const char* name, std::size_t length)
+	{
+		for (const char* n : { "website", "url", "uri", "login_uri", "site" })
+			if (equalsIgnoreCase(name, length, n))
+				return Website;
+
+		for (const char* n : { "username", "user", "login", "login_username", "email" })
+			if (equalsIgnoreCase(name, length, n))
+				return Username;
+
+		for (const char* n : { "password", "login_password", "pass" })
+			if (equalsIgnoreCase(name, length, n))
+				return Password;
+
+		return Other;
+	}
+
+	//======================================== CSV ========================================//
+
+	//end of the record starting at p, just past its line break. nullptr if the block ends first and more input is needed
+	char* csvRecordEnd(char* p, char* end, bool eof)
+	{
+		bool quoted = false;
+
+		for (; p < end; ++p)
+		{
+			//"" inside quotes toggles twice, so escapes need no special case here
+			if (*p == '"')
+				quoted = !quoted;
+			else if (*p == '\n' && !quoted)
+				return p + 1;
+		}
+
+		return eof ? end : nullptr;
+	}
+
+	//split the complete record [p, end) into fields, unescaping and null terminating each in place.
+	//writes up to maxFields pointers into fields, returns how many fields the record has. end[0] must be writable
+	std::size_t csvFields(char* p, char* end, char** fields, std::size_t maxFields)
+	{
+		//the line break is not part of the last field
+		while (end > p && (end[-1] == '\n' || end[-1] == '\r'))
+			--end;
+
+		std::size_t count = 0;
+
+		for (;;)
+		{
+			char* field = p;
+			char* out = p;
+
+			if (p < end && *p == '"')
+			{
+				//unescaped text is never longer than the quoted text, so it can be written over it
+				++p;
+
+				while (p < end)
+				{
+					if (*p == '"')
+					{
+						if (p + 1 < end && p[1] == '"')
+						{
+							*out++ = '"';
+							p += 2;
+							continue;
+						}
+
+						++p;
+						break;
+					}
+
+					*out++ = *p++;
+				}
+
+				//anything between the closing quote and the comma is malformed, drop it
+				while (p < end && *p != ',')
+					++p;
+			}
+			else
+			{
+				while (p < end && *p != ',')
+					++p;
+
+				out = p;
+			}
+
+			bool last = p >= end;
+
+			*out = '\0';
+
+			if (count < maxFields)
+				fields[count] = field;
+
+			++count;
+
+			if (last)
+				return count;
+
+			++p;
+		}
+	}
+
+	//======================================== JSON ========================================//
+
+	char* skipSpace(char* p, char* end)
+	{
+		while (p < end && std::isspace(static_cast<unsigned char>(*p)))
+			++p;
+
+		return p;
+	}
+
+	//end of the object starting at the '{' at p, just past its '}'. nullptr if the block ends first
+	char* jsonObjectEnd(char* p, char* end)
+	{
+		int depth = 0;
+		bool inString = false;
+
+		for (; p < end; ++p)
+		{
+			if (inString)
+			{
+				if (*p == '\\')
+					++p;
+				else if (*p == '"')
+					inString = false;
+			}
+			else if (*p == '"')
+				inString = true;
+			else if (*p == '{' || *p == '[')
+				++depth;
+			else if (*p == '}' || *p == ']')
+			{
+				if (--depth == 0)
+					return p + 1;
+			}
+		}
+
+		return nullptr;
+	}
+
+	//append code point as UTF-8 at out
+	char* putUtf8(char* out, uint32_t code)
+	{
+		if (code < 0x80)
+			*out++ = static_cast<char>(code);
+		else if (code < 0x800)
+		{
+			*out++ = static_cast<char>(0xC0 | (code >> 6));
+			*out++ = static_cast<char>(0x80 | (code & 0x3F));
+		}
+		else if (code < 0x10000)
+		{
+			*out++ = static_cast<char>(0xE0 | (code >> 12));
+			*out++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+			*out++ = static_cast<char>(0x80 | (code & 0x3F));
+		}
+		else
+		{
+			*out++ = static_cast<char>(0xF0 | (code >> 18));
+			*out++ = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+			*out++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+			*out++ = static_cast<char>(0x80 | (code & 0x3F));
+		}
+
+		return out;
+	}
+
+	//4 hex digits at p
+	uint32_t hex4(const char* p, const char* end)
+	{
+		if (end - p < 4)
+			throw std::runtime_error("Bad \\u escape in JSON");
+
+		uint32_t value = 0;
+
+		for (int i{ 0 }; i < 4; ++i)
+		{
+			char c = p[i];
+			value <<= 4;
+
+			if (c >= '0' && c <= '9')
+				value |= c - '0';
+			else if (c >= 'a' && c <= 'f')
+				value |= c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F')
+				value |= c - 'A' + 10;
+			else
+				throw std::runtime_error("Bad \\u escape in JSON");
+		}
+
+		return value;
+	}
+
+	//unescape the string whose opening quote is at p in place and null terminate it. Returns the position after the closing quote
+	char* jsonString(char* p, char* end, char*& text)
+	{
+		++p;
+		text = p;
+		char* out = p;
+
+		while (p < end && *p != '"')
+		{
+			if (*p != '\\')
+			{
+				*out++ = *p++;
+				continue;
+			}
+
+			if (++p >= end)
+				break;
+
+			char c = *p++;
+
+			switch (c)
+			{
+			case 'b': *out++ = '\b'; break;
+			case 'f': *out++ = '\f'; break;
+			case 'n': *out++ = '\n'; break;
+			case 'r': *out++ = '\r'; break;
+			case 't': *out++ = '\t'; break;
+			case 'u':
+			{
+				uint32_t code = hex4(p, end);
+				p += 4;
+
+				//surrogate pair, the UTF-8 form (4 bytes) still fits in the 12 escaped ones
+				if (code >= 0xD800 && code < 0xDC00 && end - p >= 6 && p[0] == '\\' && p[1] == 'u')
+				{
+					uint32_t low = hex4(p + 2, end);
+
+					if (low >= 0xDC00 && low < 0xE000)
+					{
+						code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+						p += 6;
+					}
+				}
+
+				out = putUtf8(out, code);
+				break;
+			}
+			default: *out++ = c; break; //\" \\ \/
+			}
+		}
+
+		if (p >= end)
+			throw std::runtime_error("Unterminated string in JSON");
+
+		*out = '\0';
+
+		return p + 1;
+	}
+
+	//skip the value at p: string, number, literal, object or array. Returns the position after it
+	char* jsonSkipValue(char* p, char* end)
+	{
+		if (p < end && (*p == '{' || *p == '['))
+		{
+			char* close = jsonObjectEnd(p, end);
+			if (!close)
+				throw std::runtime_error("Unterminated value in JSON");
+
+			return close;
+		}
+
+		if (p < end && *p == '"')
+		{
+			char* text;
+			return jsonString(p, end, text);
+		}
+
+		while (p < end && *p != ',' && *p != '}' && !std::isspace(static_cast<unsigned char>(*p)))
+			++p;
+
+		return p;
+	}
+
+	//fields of the complete object [p, end), in place. String values of known keys land in values, others are skipped
+	void jsonFields(char* p, char* end, const char** values)
+	{
+		p = skipSpace(p + 1, end); //past '{'
+
+		while (p < end && *p != '}')
+		{
+			if (*p != '"')
+				throw std::runtime_error("Expected a key in JSON object");
+
+			char* key;
+			p = jsonString(p, end, key);
+			Field field = fieldOf(key, strlen(key));
+
+			p = skipSpace(p, end);
+			if (p >= end || *p != ':')
+				throw std::runtime_error("Expected ':' in JSON object");
+
+			p = skipSpace(p + 1, end);
+
+			if (field != Other && p < end && *p == '"')
+			{
+				char* text;
+				p = jsonString(p, end, text);
+				values[field] = text;
+			}
+			else
+				p = jsonSkipValue(p, end);
+
+			p = skipSpace(p, end);
+			if (p < end && *p == ',')
+				p = skipSpace(p + 1, end);
+		}
+	}
+
+	//===================================== streaming =====================================//
+
+	//calls row(website, username, password) for every record in path. Missing fields are "".
+	//the pointers are into the read buffer, valid only during the call. Returns the number of records seen
+	template <typename Row>
+	std::size_t readFile(const char* path, Row&& row)
+	{
+		std::ifstream in(path, std::ios::binary);
+
+		if (!in)
+			throw std::runtime_error("Could not open import file");
+
+		//+1 so a final field without a line break can still be null terminated in place
+		std::size_t capacity = BLOCK;
+		UniquePtr<char[]> buffer = makeUnique<char[]>(capacity + 1);
+		std::size_t filled = 0;
+		std::size_t records = 0;
+
+		bool json = false;
+		bool formatKnown = false;
+
+		//CSV column of each field, Website/Username/Password by default when the file has no header row
+		std::size_t column[3] = { 0, 1, 2 };
+		bool headerChecked = false;
+
+		for (;;)
+		{
+			in.read(buffer.get() + filled, static_cast<std::streamsize>(capacity - filled));
+			filled += static_cast<std::size_t>(in.gcount());
+
+			bool eof = !in;
+
+			char* begin = buffer.get();
+			char* end = begin + filled;
+			char* p = begin;
+
+			if (!formatKnown)
+			{
+				//skip a UTF-8 byte order mark
+				if (filled >= 3 && static_cast<unsigned char>(p[0]) == 0xEF && static_cast<unsigned char>(p[1]) == 0xBB && static_cast<unsigned char>(p[2]) == 0xBF)
+					p += 3;
+
+				char* first = skipSpace(p, end);
+				json = first < end && (*first == '[' || *first == '{');
+				formatKnown = first < end || eof;
+			}
+
+			while (p < end)
+			{
+				if (json)
+				{
+					//between objects: whitespace, '[', ',' and ']'
+					while (p < end && *p != '{')
+						++p;
+
+					if (p >= end)
+						break;
+
+					char* close = jsonObjectEnd(p, end);
+					if (!close)
+						break;
+
+					const char* values[3] = { "", "", "" };
+					jsonFields(p, close, values);
+
+					row(values[Website], values[Username], values[Password]);
+					++records;
+
+					p = close;
+				}
+				else
+				{
+					char* close = csvRecordEnd(p, end, eof);
+					if (!close)
+						break;
+
+					constexpr std::size_t MAX_FIELDS = 32;
+					char* fields[MAX_FIELDS];
+					std::size_t count = csvFields(p, close, fields, MAX_FIELDS);
+					std::size_t kept = count < MAX_FIELDS ? count : MAX_FIELDS;
+
+					//blank line
+					if (count == 1 && fields[0][0] == '\0')
+					{
+						p = close;
+						continue;
+					}
+
+					//a first row naming the columns maps them, otherwise it is data in website, username, password order
+					if (!headerChecked)
+					{
+						headerChecked = true;
+						bool header = false;
+
+						for (std::size_t i{ 0 }; i < kept; ++i)
+						{
+							Field field = fieldOf(fields[i], strlen(fields[i]));
+
+							if (field != Other)
+							{
+								//first match wins, Chrome exports have both "name" and "url" but only url maps
+								if (!header)
+									column[Website] = column[Username] = column[Password] = MAX_FIELDS;
+
+								if (column[field] == MAX_FIELDS)
+									column[field] = i;
+
+								header = true;
+							}
+						}
+
+						if (header)
+						{
+							p = close;
+							continue;
+						}
+					}
+
+					auto get = [&](Field field) -> const char*
+						{
+							return column[field] < kept ? fields[column[field]] : "";
+						};
+
+					row(get(Website), get(Username), get(Password));
+					++records;
+
+					p = close;
+				}
+			}
+
+			if (eof)
+			{
+				if (p < end && json && skipSpace(p, end) < end && *skipSpace(p, end) == '{')
+					throw std::runtime_error("Unterminated object at end of JSON");
+
+				return records;
+			}
+
+			//carry the unfinished record to the front. If it fills the whole buffer, one record is bigger than a block, grow
+			std::size_t rest = static_cast<std::size_t>(end - p);
+
+			if (p == begin && filled == capacity)
+			{
+				UniquePtr<char[]> bigger = makeUnique<char[]>(capacity * 2 + 1);
+				std::memcpy(bigger.get(), begin, rest);
+
+				buffer = std::move(bigger);
+				capacity *= 2;
+			}
+			else
+				std::memmove(begin, p, rest);
+
+			filled = rest;
+		}
+	}
+}
+
+#endif
\ No newline at end of file
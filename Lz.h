@@ -0,0 +1,181 @@
+#ifndef LZ_H
+#define LZ_H
+
+#include "UniquePointer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+//byte oriented LZ77 in the LZ4 block layout. A sequence is [token: literal count << 4 | match length - 4]
+//[longer literal count][literals][uint16 offset][longer match length], counts of 15 and up continue in 255 valued bytes.
+//the last sequence is literals only. Fast and small rather than tight: serialized vaults repeat hosts, usernames
+//and length prefixes within a few KB, which is exactly what a 64KB window with a single hash probe finds
+namespace Lz
+{
+	constexpr std::size_t MIN_MATCH = 4;
+	constexpr std::size_t MAX_OFFSET = 65535;
+	constexpr unsigned HASH_BITS = 14;
+
+	//largest output compress can produce for size input bytes
+	constexpr std::size_t bound(std::size_t size)
+	{
+		return size + size / 255 + 16;
+	}
+
+	//count of 15 or more goes on after the token as 255, 255, ..., rest
+	uint8_t* writeLength(uint8_t* out, std::size_t length)
+	{
+		for (; length >= 255; length -= 255)
+			*out++ = 255;
+
+		*out++ = static_cast<uint8_t>(length);
+		return out;
+	}
+
+	//one sequence: literals, then a match of length at offset back, or no match when length is 0
+	uint8_t* writeSequence(uint8_t* out, const uint8_t* literals, std::size_t literalCount, std::size_t offset, std::size_t length)
+	{
+		std::size_t matchCode = length == 0 ? 0 : length - MIN_MATCH;
+		uint8_t* token = out++;
+
+		*token = static_cast<uint8_t>(((literalCount < 15 ? literalCount : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+
+		if (literalCount >= 15)
+			out = writeLength(out, literalCount - 15);
+
+		std::memcpy(out, literals, literalCount);
+		out += literalCount;
+
+		if (length == 0)
+			return out;
+
+		uint16_t offset16 = static_cast<uint16_t>(offset);
+		std::memcpy(out, &offset16, sizeof(offset16));
+		out += sizeof(offset16);
+
+		if (matchCode >= 15)
+			out = writeLength(out, matchCode - 15);
+
+		return out;
+	}
+
+	//compress size bytes at src into dst, which must hold bound(size). Returns the compressed size
+	std::size_t compress(const uint8_t* src, std::size_t size, uint8_t* dst)
+	{
+		//last position each 4 byte sequence was seen at
+		UniquePtr<uint32_t[]> table = makeUnique<uint32_t[]>(std::size_t{ 1 } << HASH_BITS);
+
+		uint8_t* out = dst;
+		std::size_t anchor = 0; //first byte not yet emitted
+		std::size_t at = 0;
+
+		while (at + MIN_MATCH <= size)
+		{
+			uint32_t sequence;
+			std::memcpy(&sequence, src + at, sizeof(sequence));
+
+			uint32_t slot = (sequence * 2654435761u) >> (32 - HASH_BITS);
+			std::size_t candidate = table[slot];
+			table[slot] = static_cast<uint32_t>(at);
+
+			if (candidate >= at || at - candidate > MAX_OFFSET || std::memcmp(src + candidate, src + at, MIN_MATCH) != 0)
+			{
+				++at;
+				continue;
+			}
+
+			std::size_t length = MIN_MATCH;
+			while (at + length < size && src[candidate + length] == src[at + length])
+				++length;
+
+			out = writeSequence(out, src + anchor, at - anchor, at - candidate, length);
+
+			at += length;
+			anchor = at;
+		}
+
+		out = writeSequence(out, src + anchor, size - anchor, 0, 0);
+
+		return static_cast<std::size_t>(out - dst);
+	}
+
+	//decompress size bytes at src into exactly rawSize bytes at dst. Throws on anything that does not decode to rawSize
+	void decompress(const uint8_t* src, std::size_t size, uint8_t* dst, std::size_t rawSize)
+	{
+		const uint8_t* in = src;
+		const uint8_t* end = src + size;
+		uint8_t* out = dst;
+		uint8_t* outEnd = dst + rawSize;
+
+		auto readLength = [&](std::size_t length)
+			{
+				if (length < 15)
+					return length;
+
+				uint8_t next;
+
+				do
+				{
+					if (in == end)
+						throw std::runtime_error("Corrupt compressed data");
+
+					next = *in++;
+					length += next;
+				} while (next == 255);
+
+				return length;
+			};
+
+		for (;;)
+		{
+			if (in == end)
+				throw std::runtime_error("Corrupt compressed data");
+
+			uint8_t token = *in++;
+
+			std::size_t literals = readLength(token >> 4);
+
+			if (literals > static_cast<std::size_t>(end - in) || literals > static_cast<std::size_t>(outEnd - out))
+				throw std::runtime_error("Corrupt compressed data");
+
+			std::memcpy(out, in, literals);
+			in += literals;
+			out += literals;
+
+			//literals only: the last sequence
+			if (in == end)
+				break;
+
+			uint16_t offset;
+
+			if (end - in < static_cast<std::ptrdiff_t>(sizeof(offset)))
+				throw std::runtime_error("Corrupt compressed data");
+
+			std::memcpy(&offset, in, sizeof(offset));
+			in += sizeof(offset);
+
+			std::size_t length = readLength(token & 15) + MIN_MATCH;
+
+			if (offset == 0 || offset > out - dst || length > static_cast<std::size_t>(outEnd - out))
+				throw std::runtime_error("Corrupt compressed data");
+
+			const uint8_t* match = out - offset;
+
+			//a match closer than its length overlaps the bytes it is producing, copy those byte by byte
+			if (offset >= length)
+				std::memcpy(out, match, length);
+			else
+				for (std::size_t i{ 0 }; i < length; ++i)
+					out[i] = match[i];
+
+			out += length;
+		}
+
+		if (out != outEnd)
+			throw std::runtime_error("Corrupt compressed data");
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,168 @@
+#ifndef PUBLICSUFFIX_H
+#define PUBLICSUFFIX_H
+
+#include "FlatMultimap.h"
+
+#include <cstddef>
+#include <cstdint>
+
+//public suffix table. Rules follow the publicsuffix.org format: plain suffix, "*." wildcard and "!" exception.
+//PublicSuffixRules.h holds the whole list and its hash table, generated by tools/gen_public_suffix.py from
+//public_suffix_list.dat, so nothing is parsed or allocated at startup. To update, rerun the script on a newer list
+namespace PublicSuffix
+{
+	enum RuleKind : uint8_t
+	{
+		Normal = 1,
+		Wildcard = 2, //"*.ck" stored as "ck"
+		Exception = 4 //"!www.ck" stored as "www.ck"
+	};
+
+	struct Rule
+	{
+		const char* name;
+		uint8_t kind;
+	};
+}
+
+#include "PublicSuffixRules.h"
+
+namespace PublicSuffix
+{
+	constexpr std::size_t RULE_COUNT = sizeof(PUBLIC_SUFFIX_RULES) / sizeof(PUBLIC_SUFFIX_RULES[0]);
+
+	//power of two, >= 2x RULE_COUNT so probe runs stay short, and slots hold rule index + 1 in 16 bits
+	static_assert((TABLE_SIZE & (TABLE_SIZE - 1)) == 0 && TABLE_SIZE >= RULE_COUNT * 2, "rerun tools/gen_public_suffix.py");
+	static_assert(RULE_COUNT < 0xFFFF, "slots are uint16_t");
+
+	constexpr std::size_t constLength(const char* s)
+	{
+		std::size_t n = 0;
+		while (s[n] != '\0')
+			++n;
+		return n;
+	}
+
+	//memcmp is not constexpr
+	constexpr bool sameBytes(const char* a, const char* b, std::size_t length)
+	{
+		for (std::size_t i{ 0 }; i < length; ++i)
+			if (a[i] != b[i])
+				return false;
+
+		return true;
+	}
+
+	//rule kinds for the lowercase label range [begin, end), 0 if no rule
+	constexpr uint8_t lookup(const char* begin, const char* end)
+	{
+		std::size_t length = static_cast<std::size_t>(end - begin);
+		std::size_t i = static_cast<std::size_t>(fnv1a(begin, length)) & (TABLE_SIZE - 1);
+
+		while (TABLE[i] != 0)
+		{
+			const Rule& rule = PUBLIC_SUFFIX_RULES[TABLE[i] - 1];
+
+			if (constLength(rule.name) == length && sameBytes(rule.name, begin, length))
+				return rule.kind;
+
+			i = (i + 1) & (TABLE_SIZE - 1);
+		}
+
+		return 0;
+	}
+
+	constexpr std::size_t MAX_LABELS = 128;
+
+	//label starts of the lowercase host [begin, end) into starts, right to left (starts[0] is the last label), and the count
+	//into labels. Returns how many of those labels are the public suffix
+	constexpr std::size_t suffixLabels(const char* begin, const char* end, const char* (&starts)[MAX_LABELS], std::size_t& labels)
+	{
+		labels = 0;
+
+		for (const char* c = end; c > begin && labels < MAX_LABELS; --c)
+		{
+			if (c[-1] == '.')
+				starts[labels++] = c;
+		}
+
+		if (labels < MAX_LABELS)
+			starts[labels++] = begin;
+
+		//default rule "*": public suffix is the last label
+		std::size_t suffix = 1;
+
+		//longest matching rule wins, walk from the shortest candidate up so the last hit is the longest
+		for (std::size_t n{ 1 }; n <= labels; ++n)
+		{
+			const char* candidate = starts[n - 1];
+			uint8_t kind = lookup(candidate, end);
+
+			if (kind & Exception)
+			{
+				//exception rule: the suffix is the candidate minus its leftmost label
+				suffix = n - 1;
+				break;
+			}
+
+			if (kind & Normal)
+				suffix = n;
+
+			//"*.candidate" makes one more label part of the suffix, unless that label has an exception
+			if ((kind & Wildcard) && n < labels)
+			{
+				if (lookup(starts[n], end) & Exception)
+				{
+					suffix = n;
+					break;
+				}
+
+				suffix = n + 1;
+			}
+		}
+
+		return suffix;
+	}
+
+	//start of the registrable domain (public suffix plus one label) inside the lowercase host [begin, end).
+	//returns begin if the host is itself a public suffix or has a single label
+	constexpr const char* registrableStart(const char* begin, const char* end)
+	{
+		const char* starts[MAX_LABELS] = {};
+		std::size_t labels = 0;
+		std::size_t suffix = suffixLabels(begin, end, starts, labels);
+
+		if (suffix >= labels)
+			return begin;
+
+		return starts[suffix];
+	}
+
+	//true if the lowercase host [begin, end) is a public suffix ("co.uk", or any single label) rather than a name under one
+	constexpr bool isSuffix(const char* begin, const char* end)
+	{
+		const char* starts[MAX_LABELS] = {};
+		std::size_t labels = 0;
+
+		return suffixLabels(begin, end, starts, labels) >= labels;
+	}
+
+	//registrable domain of a lowercase host as an offset into it, for the checks below
+	constexpr std::size_t registrableOffset(const char* host)
+	{
+		return static_cast<std::size_t>(registrableStart(host, host + constLength(host)) - host);
+	}
+
+	//rule checks. They probe the generated table, so they also fail if the script and lookup ever hash differently
+	static_assert(registrableOffset("mail.google.co.uk") == 5, "normal rule");
+	static_assert(registrableOffset("co.uk") == 0, "a suffix has no registrable part");
+	static_assert(registrableOffset("printer.local") == 0, "unlisted last label is the suffix");
+	static_assert(registrableOffset("a.b.c.ck") == 2, "*.ck makes every c.ck a suffix");
+	static_assert(registrableOffset("www.ck") == 0, "!www.ck makes www.ck registrable");
+	static_assert(registrableOffset("foo.www.ck") == 4, "!www.ck makes www.ck registrable");
+	static_assert(registrableOffset("a.b.city.kawasaki.jp") == 4, "!city.kawasaki.jp beats *.kawasaki.jp");
+	static_assert(registrableOffset("x.user.github.io") == 2, "private section");
+	static_assert(registrableOffset("shop.xn--55qx5d.cn") == 0 && registrableOffset("a.shop.xn--55qx5d.cn") == 2, "xn-- form of a unicode rule");
+}
+
+#endif
\ No newline at end of file
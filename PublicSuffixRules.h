@@ -0,0 +1,4140 @@
+#ifndef PUBLICSUFFIXRULES_H
+#define PUBLICSUFFIXRULES_H
+
+//generated by tools/gen_public_suffix.py from public_suffix_list.dat, do not edit.
+//rerun the script on a newer list to update. Included by PublicSuffix.h, which defines Rule and RuleKind
+namespace PublicSuffix
+{
+	constexpr Rule PUBLIC_SUFFIX_RULES[] =
+	{
+		{ "ac", Normal }, { "com.ac", Normal }, { "edu.ac", Normal }, { "gov.ac", Normal }, { "net.ac", Normal },
+		{ "mil.ac", Normal }, { "org.ac", Normal }, { "ad", Normal }, { "nom.ad", Normal }, { "ae", Normal },
+		{ "co.ae", Normal }, { "net.ae", Normal }, { "org.ae", Normal }, { "sch.ae", Normal }, { "ac.ae", Normal },
+		{ "gov.ae", Normal }, { "mil.ae", Normal }, { "aero", Normal }, { "accident-investigation.aero", Normal },
+		{ "accident-prevention.aero", Normal }, { "aerobatic.aero", Normal }, { "aeroclub.aero", Normal },
+		{ "aerodrome.aero", Normal }, { "agents.aero", Normal }, { "aircraft.aero", Normal }, { "airline.aero", Normal },
+		{ "airport.aero", Normal }, { "air-surveillance.aero", Normal }, { "airtraffic.aero", Normal },
+		{ "air-traffic-control.aero", Normal }, { "ambulance.aero", Normal }, { "amusement.aero", Normal },
+		{ "association.aero", Normal }, { "author.aero", Normal }, { "ballooning.aero", Normal }, { "broker.aero", Normal },
+		{ "caa.aero", Normal }, { "cargo.aero", Normal }, { "catering.aero", Normal }, { "certification.aero", Normal },
+		{ "championship.aero", Normal }, { "charter.aero", Normal }, { "civilaviation.aero", Normal },
+		{ "club.aero", Normal }, { "conference.aero", Normal }, { "consultant.aero", Normal },
+		{ "consulting.aero", Normal }, { "control.aero", Normal }, { "council.aero", Normal }, { "crew.aero", Normal },
+		{ "design.aero", Normal }, { "dgca.aero", Normal }, { "educator.aero", Normal }, { "emergency.aero", Normal },
+		{ "engine.aero", Normal }, { "engineer.aero", Normal }, { "entertainment.aero", Normal },
+		{ "equipment.aero", Normal }, { "exchange.aero", Normal }, { "express.aero", Normal },
+		{ "federation.aero", Normal }, { "flight.aero", Normal }, { "fuel.aero", Normal }, { "gliding.aero", Normal },
+		{ "government.aero", Normal }, { "groundhandling.aero", Normal }, { "group.aero", Normal },
+		{ "hanggliding.aero", Normal }, { "homebuilt.aero", Normal }, { "insurance.aero", Normal },
+		{ "journal.aero", Normal }, { "journalist.aero", Normal }, { "leasing.aero", Normal }, { "logistics.aero", Normal },
+		{ "magazine.aero", Normal }, { "maintenance.aero", Normal }, { "media.aero", Normal },
+		{ "microlight.aero", Normal }, { "modelling.aero", Normal }, { "navigation.aero", Normal },
+		{ "parachuting.aero", Normal }, { "paragliding.aero", Normal }, { "passenger-association.aero", Normal },
+		{ "pilot.aero", Normal }, { "press.aero", Normal }, { "production.aero", Normal }, { "recreation.aero", Normal },
+		{ "repbody.aero", Normal }, { "res.aero", Normal }, { "research.aero", Normal }, { "rotorcraft.aero", Normal },
+		{ "safety.aero", Normal }, { "scientist.aero", Normal }, { "services.aero", Normal }, { "show.aero", Normal },
+		{ "skydiving.aero", Normal }, { "software.aero", Normal }, { "student.aero", Normal }, { "trader.aero", Normal },
+		{ "trading.aero", Normal }, { "trainer.aero", Normal }, { "union.aero", Normal }, { "workinggroup.aero", Normal },
+		{ "works.aero", Normal }, { "af", Normal }, { "gov.af", Normal }, { "com.af", Normal }, { "org.af", Normal },
+		{ "net.af", Normal }, { "edu.af", Normal }, { "ag", Normal }, { "com.ag", Normal }, { "org.ag", Normal },
+		{ "net.ag", Normal }, { "co.ag", Normal }, { "nom.ag", Normal }, { "ai", Normal }, { "off.ai", Normal },
+		{ "com.ai", Normal }, { "net.ai", Normal }, { "org.ai", Normal }, { "al", Normal }, { "com.al", Normal },
+		{ "edu.al", Normal }, { "gov.al", Normal }, { "mil.al", Normal }, { "net.al", Normal }, { "org.al", Normal },
+		{ "am", Normal }, { "co.am", Normal }, { "com.am", Normal }, { "commune.am", Normal }, { "net.am", Normal },
+		{ "org.am", Normal }, { "ao", Normal }, { "ed.ao", Normal }, { "gv.ao", Normal }, { "og.ao", Normal },
+		{ "co.ao", Normal }, { "pb.ao", Normal }, { "it.ao", Normal }, { "aq", Normal }, { "ar", Normal },
+		{ "bet.ar", Normal }, { "com.ar", Normal }, { "coop.ar", Normal }, { "edu.ar", Normal }, { "gob.ar", Normal },
+		{ "gov.ar", Normal }, { "int.ar", Normal }, { "mil.ar", Normal }, { "musica.ar", Normal }, { "mutual.ar", Normal },
+		{ "net.ar", Normal }, { "org.ar", Normal }, { "senasa.ar", Normal }, { "tur.ar", Normal }, { "arpa", Normal },
+		{ "e164.arpa", Normal }, { "in-addr.arpa", Normal }, { "ip6.arpa", Normal }, { "iris.arpa", Normal },
+		{ "uri.arpa", Normal }, { "urn.arpa", Normal }, { "as", Normal }, { "gov.as", Normal }, { "asia", Normal },
+		{ "at", Normal }, { "ac.at", Normal }, { "co.at", Normal }, { "gv.at", Normal }, { "or.at", Normal },
+		{ "sth.ac.at", Normal }, { "au", Normal }, { "com.au", Normal }, { "net.au", Normal }, { "org.au", Normal },
+		{ "edu.au", Normal }, { "gov.au", Normal }, { "asn.au", Normal }, { "id.au", Normal }, { "info.au", Normal },
+		{ "conf.au", Normal }, { "oz.au", Normal }, { "act.au", Normal }, { "nsw.au", Normal }, { "nt.au", Normal },
+		{ "qld.au", Normal }, { "sa.au", Normal }, { "tas.au", Normal }, { "vic.au", Normal }, { "wa.au", Normal },
+		{ "act.edu.au", Normal }, { "catholic.edu.au", Normal }, { "nsw.edu.au", Normal }, { "nt.edu.au", Normal },
+		{ "qld.edu.au", Normal }, { "sa.edu.au", Normal }, { "tas.edu.au", Normal }, { "vic.edu.au", Normal },
+		{ "wa.edu.au", Normal }, { "qld.gov.au", Normal }, { "sa.gov.au", Normal }, { "tas.gov.au", Normal },
+		{ "vic.gov.au", Normal }, { "wa.gov.au", Normal }, { "schools.nsw.edu.au", Normal }, { "aw", Normal },
+		{ "com.aw", Normal }, { "ax", Normal }, { "az", Normal }, { "com.az", Normal }, { "net.az", Normal },
+		{ "int.az", Normal }, { "gov.az", Normal }, { "org.az", Normal }, { "edu.az", Normal }, { "info.az", Normal },
+		{ "pp.az", Normal }, { "mil.az", Normal }, { "name.az", Normal }, { "pro.az", Normal }, { "biz.az", Normal },
+		{ "ba", Normal }, { "com.ba", Normal }, { "edu.ba", Normal }, { "gov.ba", Normal }, { "mil.ba", Normal },
+		{ "net.ba", Normal }, { "org.ba", Normal }, { "bb", Normal }, { "biz.bb", Normal }, { "co.bb", Normal },
+		{ "com.bb", Normal }, { "edu.bb", Normal }, { "gov.bb", Normal }, { "info.bb", Normal }, { "net.bb", Normal },
+		{ "org.bb", Normal }, { "store.bb", Normal }, { "tv.bb", Normal }, { "bd", Wildcard }, { "be", Normal },
+		{ "ac.be", Normal }, { "bf", Normal }, { "gov.bf", Normal }, { "bg", Normal }, { "a.bg", Normal },
+		{ "b.bg", Normal }, { "c.bg", Normal }, { "d.bg", Normal }, { "e.bg", Normal }, { "f.bg", Normal },
+		{ "g.bg", Normal }, { "h.bg", Normal }, { "i.bg", Normal }, { "j.bg", Normal }, { "k.bg", Normal },
+		{ "l.bg", Normal }, { "m.bg", Normal }, { "n.bg", Normal }, { "o.bg", Normal }, { "p.bg", Normal },
+		{ "q.bg", Normal }, { "r.bg", Normal }, { "s.bg", Normal }, { "t.bg", Normal }, { "u.bg", Normal },
+		{ "v.bg", Normal }, { "w.bg", Normal }, { "x.bg", Normal }, { "y.bg", Normal }, { "z.bg", Normal },
+		{ "0.bg", Normal }, { "1.bg", Normal }, { "2.bg", Normal }, { "3.bg", Normal }, { "4.bg", Normal },
+		{ "5.bg", Normal }, { "6.bg", Normal }, { "7.bg", Normal }, { "8.bg", Normal }, { "9.bg", Normal },
+		{ "bh", Normal }, { "com.bh", Normal }, { "edu.bh", Normal }, { "net.bh", Normal }, { "org.bh", Normal },
+		{ "gov.bh", Normal }, { "bi", Normal }, { "co.bi", Normal }, { "com.bi", Normal }, { "edu.bi", Normal },
+		{ "or.bi", Normal }, { "org.bi", Normal }, { "biz", Normal }, { "bj", Normal }, { "africa.bj", Normal },
+		{ "agro.bj", Normal }, { "architectes.bj", Normal }, { "assur.bj", Normal }, { "avocats.bj", Normal },
+		{ "co.bj", Normal }, { "com.bj", Normal }, { "eco.bj", Normal }, { "econo.bj", Normal }, { "edu.bj", Normal },
+		{ "info.bj", Normal }, { "loisirs.bj", Normal }, { "money.bj", Normal }, { "net.bj", Normal }, { "org.bj", Normal },
+		{ "ote.bj", Normal }, { "resto.bj", Normal }, { "restaurant.bj", Normal }, { "tourism.bj", Normal },
+		{ "univ.bj", Normal }, { "bm", Normal }, { "com.bm", Normal }, { "edu.bm", Normal }, { "gov.bm", Normal },
+		{ "net.bm", Normal }, { "org.bm", Normal }, { "bn", Normal }, { "com.bn", Normal }, { "edu.bn", Normal },
+		{ "gov.bn", Normal }, { "net.bn", Normal }, { "org.bn", Normal }, { "bo", Normal }, { "com.bo", Normal },
+		{ "edu.bo", Normal }, { "gob.bo", Normal }, { "int.bo", Normal }, { "org.bo", Normal }, { "net.bo", Normal },
+		{ "mil.bo", Normal }, { "tv.bo", Normal }, { "web.bo", Normal }, { "academia.bo", Normal }, { "agro.bo", Normal },
+		{ "arte.bo", Normal }, { "blog.bo", Normal }, { "bolivia.bo", Normal }, { "ciencia.bo", Normal },
+		{ "cooperativa.bo", Normal }, { "democracia.bo", Normal }, { "deporte.bo", Normal }, { "ecologia.bo", Normal },
+		{ "economia.bo", Normal }, { "empresa.bo", Normal }, { "indigena.bo", Normal }, { "industria.bo", Normal },
+		{ "info.bo", Normal }, { "medicina.bo", Normal }, { "movimiento.bo", Normal }, { "musica.bo", Normal },
+		{ "natural.bo", Normal }, { "nombre.bo", Normal }, { "noticias.bo", Normal }, { "patria.bo", Normal },
+		{ "politica.bo", Normal }, { "profesional.bo", Normal }, { "plurinacional.bo", Normal }, { "pueblo.bo", Normal },
+		{ "revista.bo", Normal }, { "salud.bo", Normal }, { "tecnologia.bo", Normal }, { "tksat.bo", Normal },
+		{ "transporte.bo", Normal }, { "wiki.bo", Normal }, { "br", Normal }, { "9guacu.br", Normal }, { "abc.br", Normal },
+		{ "adm.br", Normal }, { "adv.br", Normal }, { "agr.br", Normal }, { "aju.br", Normal }, { "am.br", Normal },
+		{ "anani.br", Normal }, { "aparecida.br", Normal }, { "app.br", Normal }, { "arq.br", Normal },
+		{ "art.br", Normal }, { "ato.br", Normal }, { "b.br", Normal }, { "barueri.br", Normal }, { "belem.br", Normal },
+		{ "bhz.br", Normal }, { "bib.br", Normal }, { "bio.br", Normal }, { "blog.br", Normal }, { "bmd.br", Normal },
+		{ "boavista.br", Normal }, { "bsb.br", Normal }, { "campinagrande.br", Normal }, { "campinas.br", Normal },
+		{ "caxias.br", Normal }, { "cim.br", Normal }, { "cng.br", Normal }, { "cnt.br", Normal }, { "com.br", Normal },
+		{ "contagem.br", Normal }, { "coop.br", Normal }, { "coz.br", Normal }, { "cri.br", Normal },
+		{ "cuiaba.br", Normal }, { "curitiba.br", Normal }, { "def.br", Normal }, { "des.br", Normal },
+		{ "det.br", Normal }, { "dev.br", Normal }, { "ecn.br", Normal }, { "eco.br", Normal }, { "edu.br", Normal },
+		{ "emp.br", Normal }, { "enf.br", Normal }, { "eng.br", Normal }, { "esp.br", Normal }, { "etc.br", Normal },
+		{ "eti.br", Normal }, { "far.br", Normal }, { "feira.br", Normal }, { "flog.br", Normal }, { "floripa.br", Normal },
+		{ "fm.br", Normal }, { "fnd.br", Normal }, { "fortal.br", Normal }, { "fot.br", Normal }, { "foz.br", Normal },
+		{ "fst.br", Normal }, { "g12.br", Normal }, { "geo.br", Normal }, { "ggf.br", Normal }, { "goiania.br", Normal },
+		{ "gov.br", Normal }, { "ac.gov.br", Normal }, { "al.gov.br", Normal }, { "am.gov.br", Normal },
+		{ "ap.gov.br", Normal }, { "ba.gov.br", Normal }, { "ce.gov.br", Normal }, { "df.gov.br", Normal },
+		{ "es.gov.br", Normal }, { "go.gov.br", Normal }, { "ma.gov.br", Normal }, { "mg.gov.br", Normal },
+		{ "ms.gov.br", Normal }, { "mt.gov.br", Normal }, { "pa.gov.br", Normal }, { "pb.gov.br", Normal },
+		{ "pe.gov.br", Normal }, { "pi.gov.br", Normal }, { "pr.gov.br", Normal }, { "rj.gov.br", Normal },
+		{ "rn.gov.br", Normal }, { "ro.gov.br", Normal }, { "rr.gov.br", Normal }, { "rs.gov.br", Normal },
+		{ "sc.gov.br", Normal }, { "se.gov.br", Normal }, { "sp.gov.br", Normal }, { "to.gov.br", Normal },
+		{ "gru.br", Normal }, { "imb.br", Normal }, { "ind.br", Normal }, { "inf.br", Normal }, { "jab.br", Normal },
+		{ "jampa.br", Normal }, { "jdf.br", Normal }, { "joinville.br", Normal }, { "jor.br", Normal },
+		{ "jus.br", Normal }, { "leg.br", Normal }, { "lel.br", Normal }, { "log.br", Normal }, { "londrina.br", Normal },
+		{ "macapa.br", Normal }, { "maceio.br", Normal }, { "manaus.br", Normal }, { "maringa.br", Normal },
+		{ "mat.br", Normal }, { "med.br", Normal }, { "mil.br", Normal }, { "morena.br", Normal }, { "mp.br", Normal },
+		{ "mus.br", Normal }, { "natal.br", Normal }, { "net.br", Normal }, { "niteroi.br", Normal },
+		{ "nom.br", Wildcard }, { "not.br", Normal }, { "ntr.br", Normal }, { "odo.br", Normal }, { "ong.br", Normal },
+		{ "org.br", Normal }, { "osasco.br", Normal }, { "palmas.br", Normal }, { "poa.br", Normal }, { "ppg.br", Normal },
+		{ "pro.br", Normal }, { "psc.br", Normal }, { "psi.br", Normal }, { "pvh.br", Normal }, { "qsl.br", Normal },
+		{ "radio.br", Normal }, { "rec.br", Normal }, { "recife.br", Normal }, { "rep.br", Normal },
+		{ "ribeirao.br", Normal }, { "rio.br", Normal }, { "riobranco.br", Normal }, { "riopreto.br", Normal },
+		{ "salvador.br", Normal }, { "sampa.br", Normal }, { "santamaria.br", Normal }, { "santoandre.br", Normal },
+		{ "saobernardo.br", Normal }, { "saogonca.br", Normal }, { "seg.br", Normal }, { "sjc.br", Normal },
+		{ "slg.br", Normal }, { "slz.br", Normal }, { "sorocaba.br", Normal }, { "srv.br", Normal }, { "taxi.br", Normal },
+		{ "tc.br", Normal }, { "tec.br", Normal }, { "teo.br", Normal }, { "the.br", Normal }, { "tmp.br", Normal },
+		{ "trd.br", Normal }, { "tur.br", Normal }, { "tv.br", Normal }, { "udi.br", Normal }, { "vet.br", Normal },
+		{ "vix.br", Normal }, { "vlog.br", Normal }, { "wiki.br", Normal }, { "zlg.br", Normal }, { "bs", Normal },
+		{ "com.bs", Normal }, { "net.bs", Normal }, { "org.bs", Normal }, { "edu.bs", Normal }, { "gov.bs", Normal },
+		{ "bt", Normal }, { "com.bt", Normal }, { "edu.bt", Normal }, { "gov.bt", Normal }, { "net.bt", Normal },
+		{ "org.bt", Normal }, { "bv", Normal }, { "bw", Normal }, { "co.bw", Normal }, { "org.bw", Normal },
+		{ "by", Normal }, { "gov.by", Normal }, { "mil.by", Normal }, { "com.by", Normal }, { "of.by", Normal },
+		{ "bz", Normal }, { "com.bz", Normal }, { "net.bz", Normal }, { "org.bz", Normal }, { "edu.bz", Normal },
+		{ "gov.bz", Normal }, { "ca", Normal }, { "ab.ca", Normal }, { "bc.ca", Normal }, { "mb.ca", Normal },
+		{ "nb.ca", Normal }, { "nf.ca", Normal }, { "nl.ca", Normal }, { "ns.ca", Normal }, { "nt.ca", Normal },
+		{ "nu.ca", Normal }, { "on.ca", Normal }, { "pe.ca", Normal }, { "qc.ca", Normal }, { "sk.ca", Normal },
+		{ "yk.ca", Normal }, { "gc.ca", Normal }, { "cat", Normal }, { "cc", Normal }, { "cd", Normal },
+		{ "gov.cd", Normal }, { "cf", Normal }, { "cg", Normal }, { "ch", Normal }, { "ci", Normal }, { "org.ci", Normal },
+		{ "or.ci", Normal }, { "com.ci", Normal }, { "co.ci", Normal }, { "edu.ci", Normal }, { "ed.ci", Normal },
+		{ "ac.ci", Normal }, { "net.ci", Normal }, { "go.ci", Normal }, { "asso.ci", Normal },
+		{ "a\303\251roport.ci", Normal }, { "xn--aroport-bya.ci", Normal }, { "int.ci", Normal }, { "presse.ci", Normal },
+		{ "md.ci", Normal }, { "gouv.ci", Normal }, { "ck", Wildcard }, { "www.ck", Exception }, { "cl", Normal },
+		{ "co.cl", Normal }, { "gob.cl", Normal }, { "gov.cl", Normal }, { "mil.cl", Normal }, { "cm", Normal },
+		{ "co.cm", Normal }, { "com.cm", Normal }, { "gov.cm", Normal }, { "net.cm", Normal }, { "cn", Normal },
+		{ "ac.cn", Normal }, { "com.cn", Normal }, { "edu.cn", Normal }, { "gov.cn", Normal }, { "net.cn", Normal },
+		{ "org.cn", Normal }, { "mil.cn", Normal }, { "\345\205\254\345\217\270.cn", Normal }, { "xn--55qx5d.cn", Normal },
+		{ "\347\275\221\347\273\234.cn", Normal }, { "xn--io0a7i.cn", Normal }, { "\347\266\262\347\265\241.cn", Normal },
+		{ "xn--od0alg.cn", Normal }, { "ah.cn", Normal }, { "bj.cn", Normal }, { "cq.cn", Normal }, { "fj.cn", Normal },
+		{ "gd.cn", Normal }, { "gs.cn", Normal }, { "gz.cn", Normal }, { "gx.cn", Normal }, { "ha.cn", Normal },
+		{ "hb.cn", Normal }, { "he.cn", Normal }, { "hi.cn", Normal }, { "hl.cn", Normal }, { "hn.cn", Normal },
+		{ "jl.cn", Normal }, { "js.cn", Normal }, { "jx.cn", Normal }, { "ln.cn", Normal }, { "nm.cn", Normal },
+		{ "nx.cn", Normal }, { "qh.cn", Normal }, { "sc.cn", Normal }, { "sd.cn", Normal }, { "sh.cn", Normal },
+		{ "sn.cn", Normal }, { "sx.cn", Normal }, { "tj.cn", Normal }, { "xj.cn", Normal }, { "xz.cn", Normal },
+		{ "yn.cn", Normal }, { "zj.cn", Normal }, { "hk.cn", Normal }, { "mo.cn", Normal }, { "tw.cn", Normal },
+		{ "co", Normal }, { "arts.co", Normal }, { "com.co", Normal }, { "edu.co", Normal }, { "firm.co", Normal },
+		{ "gov.co", Normal }, { "info.co", Normal }, { "int.co", Normal }, { "mil.co", Normal }, { "net.co", Normal },
+		{ "nom.co", Normal }, { "org.co", Normal }, { "rec.co", Normal }, { "web.co", Normal }, { "com", Normal },
+		{ "coop", Normal }, { "cr", Normal }, { "ac.cr", Normal }, { "co.cr", Normal }, { "ed.cr", Normal },
+		{ "fi.cr", Normal }, { "go.cr", Normal }, { "or.cr", Normal }, { "sa.cr", Normal }, { "cu", Normal },
+		{ "com.cu", Normal }, { "edu.cu", Normal }, { "org.cu", Normal }, { "net.cu", Normal }, { "gov.cu", Normal },
+		{ "inf.cu", Normal }, { "cv", Normal }, { "com.cv", Normal }, { "edu.cv", Normal }, { "int.cv", Normal },
+		{ "nome.cv", Normal }, { "org.cv", Normal }, { "cw", Normal }, { "com.cw", Normal }, { "edu.cw", Normal },
+		{ "net.cw", Normal }, { "org.cw", Normal }, { "cx", Normal }, { "gov.cx", Normal }, { "cy", Normal },
+		{ "ac.cy", Normal }, { "biz.cy", Normal }, { "com.cy", Normal }, { "ekloges.cy", Normal }, { "gov.cy", Normal },
+		{ "ltd.cy", Normal }, { "mil.cy", Normal }, { "net.cy", Normal }, { "org.cy", Normal }, { "press.cy", Normal },
+		{ "pro.cy", Normal }, { "tm.cy", Normal }, { "cz", Normal }, { "de", Normal }, { "dj", Normal }, { "dk", Normal },
+		{ "dm", Normal }, { "com.dm", Normal }, { "net.dm", Normal }, { "org.dm", Normal }, { "edu.dm", Normal },
+		{ "gov.dm", Normal }, { "do", Normal }, { "art.do", Normal }, { "com.do", Normal }, { "edu.do", Normal },
+		{ "gob.do", Normal }, { "gov.do", Normal }, { "mil.do", Normal }, { "net.do", Normal }, { "org.do", Normal },
+		{ "sld.do", Normal }, { "web.do", Normal }, { "dz", Normal }, { "art.dz", Normal }, { "asso.dz", Normal },
+		{ "com.dz", Normal }, { "edu.dz", Normal }, { "gov.dz", Normal }, { "org.dz", Normal }, { "net.dz", Normal },
+		{ "pol.dz", Normal }, { "soc.dz", Normal }, { "tm.dz", Normal }, { "ec", Normal }, { "com.ec", Normal },
+		{ "info.ec", Normal }, { "net.ec", Normal }, { "fin.ec", Normal }, { "k12.ec", Normal }, { "med.ec", Normal },
+		{ "pro.ec", Normal }, { "org.ec", Normal }, { "edu.ec", Normal }, { "gov.ec", Normal }, { "gob.ec", Normal },
+		{ "mil.ec", Normal }, { "edu", Normal }, { "ee", Normal }, { "edu.ee", Normal }, { "gov.ee", Normal },
+		{ "riik.ee", Normal }, { "lib.ee", Normal }, { "med.ee", Normal }, { "com.ee", Normal }, { "pri.ee", Normal },
+		{ "aip.ee", Normal }, { "org.ee", Normal }, { "fie.ee", Normal }, { "eg", Normal }, { "com.eg", Normal },
+		{ "edu.eg", Normal }, { "eun.eg", Normal }, { "gov.eg", Normal }, { "mil.eg", Normal }, { "name.eg", Normal },
+		{ "net.eg", Normal }, { "org.eg", Normal }, { "sci.eg", Normal }, { "er", Wildcard }, { "es", Normal },
+		{ "com.es", Normal }, { "nom.es", Normal }, { "org.es", Normal }, { "gob.es", Normal }, { "edu.es", Normal },
+		{ "et", Normal }, { "com.et", Normal }, { "gov.et", Normal }, { "org.et", Normal }, { "edu.et", Normal },
+		{ "biz.et", Normal }, { "name.et", Normal }, { "info.et", Normal }, { "net.et", Normal }, { "eu", Normal },
+		{ "fi", Normal }, { "aland.fi", Normal }, { "fj", Normal }, { "ac.fj", Normal }, { "biz.fj", Normal },
+		{ "com.fj", Normal }, { "gov.fj", Normal }, { "info.fj", Normal }, { "mil.fj", Normal }, { "name.fj", Normal },
+		{ "net.fj", Normal }, { "org.fj", Normal }, { "pro.fj", Normal }, { "fk", Wildcard }, { "com.fm", Normal },
+		{ "edu.fm", Normal }, { "net.fm", Normal }, { "org.fm", Normal }, { "fm", Normal }, { "fo", Normal },
+		{ "fr", Normal }, { "asso.fr", Normal }, { "com.fr", Normal }, { "gouv.fr", Normal }, { "nom.fr", Normal },
+		{ "prd.fr", Normal }, { "tm.fr", Normal }, { "aeroport.fr", Normal }, { "avocat.fr", Normal },
+		{ "avoues.fr", Normal }, { "cci.fr", Normal }, { "chambagri.fr", Normal }, { "chirurgiens-dentistes.fr", Normal },
+		{ "experts-comptables.fr", Normal }, { "geometre-expert.fr", Normal }, { "greta.fr", Normal },
+		{ "huissier-justice.fr", Normal }, { "medecin.fr", Normal }, { "notaires.fr", Normal }, { "pharmacien.fr", Normal },
+		{ "port.fr", Normal }, { "veterinaire.fr", Normal }, { "ga", Normal }, { "gb", Normal }, { "edu.gd", Normal },
+		{ "gov.gd", Normal }, { "gd", Normal }, { "ge", Normal }, { "com.ge", Normal }, { "edu.ge", Normal },
+		{ "gov.ge", Normal }, { "org.ge", Normal }, { "mil.ge", Normal }, { "net.ge", Normal }, { "pvt.ge", Normal },
+		{ "gf", Normal }, { "gg", Normal }, { "co.gg", Normal }, { "net.gg", Normal }, { "org.gg", Normal },
+		{ "gh", Normal }, { "com.gh", Normal }, { "edu.gh", Normal }, { "gov.gh", Normal }, { "org.gh", Normal },
+		{ "mil.gh", Normal }, { "gi", Normal }, { "com.gi", Normal }, { "ltd.gi", Normal }, { "gov.gi", Normal },
+		{ "mod.gi", Normal }, { "edu.gi", Normal }, { "org.gi", Normal }, { "gl", Normal }, { "co.gl", Normal },
+		{ "com.gl", Normal }, { "edu.gl", Normal }, { "net.gl", Normal }, { "org.gl", Normal }, { "gm", Normal },
+		{ "gn", Normal }, { "ac.gn", Normal }, { "com.gn", Normal }, { "edu.gn", Normal }, { "gov.gn", Normal },
+		{ "org.gn", Normal }, { "net.gn", Normal }, { "gov", Normal }, { "gp", Normal }, { "com.gp", Normal },
+		{ "net.gp", Normal }, { "mobi.gp", Normal }, { "edu.gp", Normal }, { "org.gp", Normal }, { "asso.gp", Normal },
+		{ "gq", Normal }, { "gr", Normal }, { "com.gr", Normal }, { "edu.gr", Normal }, { "net.gr", Normal },
+		{ "org.gr", Normal }, { "gov.gr", Normal }, { "gs", Normal }, { "gt", Normal }, { "com.gt", Normal },
+		{ "edu.gt", Normal }, { "gob.gt", Normal }, { "ind.gt", Normal }, { "mil.gt", Normal }, { "net.gt", Normal },
+		{ "org.gt", Normal }, { "gu", Normal }, { "com.gu", Normal }, { "edu.gu", Normal }, { "gov.gu", Normal },
+		{ "guam.gu", Normal }, { "info.gu", Normal }, { "net.gu", Normal }, { "org.gu", Normal }, { "web.gu", Normal },
+		{ "gw", Normal }, { "gy", Normal }, { "co.gy", Normal }, { "com.gy", Normal }, { "edu.gy", Normal },
+		{ "gov.gy", Normal }, { "net.gy", Normal }, { "org.gy", Normal }, { "hk", Normal }, { "com.hk", Normal },
+		{ "edu.hk", Normal }, { "gov.hk", Normal }, { "idv.hk", Normal }, { "net.hk", Normal }, { "org.hk", Normal },
+		{ "\345\205\254\345\217\270.hk", Normal }, { "xn--55qx5d.hk", Normal }, { "\346\225\231\350\202\262.hk", Normal },
+		{ "xn--wcvs22d.hk", Normal }, { "\346\225\216\350\202\262.hk", Normal }, { "xn--lcvr32d.hk", Normal },
+		{ "\346\224\277\345\272\234.hk", Normal }, { "xn--mxtq1m.hk", Normal }, { "\345\200\213\344\272\272.hk", Normal },
+		{ "xn--gmqw5a.hk", Normal }, { "\344\270\252\344\272\272.hk", Normal }, { "xn--ciqpn.hk", Normal },
+		{ "\347\256\207\344\272\272.hk", Normal }, { "xn--gmq050i.hk", Normal }, { "\347\266\262\347\273\234.hk", Normal },
+		{ "xn--zf0avx.hk", Normal }, { "\347\275\221\347\273\234.hk", Normal }, { "xn--io0a7i.hk", Normal },
+		{ "\347\273\204\347\271\224.hk", Normal }, { "xn--mk0axi.hk", Normal }, { "\347\266\262\347\265\241.hk", Normal },
+		{ "xn--od0alg.hk", Normal }, { "\347\275\221\347\265\241.hk", Normal }, { "xn--od0aq3b.hk", Normal },
+		{ "\347\273\204\347\273\207.hk", Normal }, { "xn--tn0ag.hk", Normal }, { "\347\265\204\347\271\224.hk", Normal },
+		{ "xn--uc0atv.hk", Normal }, { "\347\265\204\347\273\207.hk", Normal }, { "xn--uc0ay4a.hk", Normal },
+		{ "hm", Normal }, { "hn", Normal }, { "com.hn", Normal }, { "edu.hn", Normal }, { "org.hn", Normal },
+		{ "net.hn", Normal }, { "mil.hn", Normal }, { "gob.hn", Normal }, { "hr", Normal }, { "iz.hr", Normal },
+		{ "from.hr", Normal }, { "name.hr", Normal }, { "com.hr", Normal }, { "ht", Normal }, { "com.ht", Normal },
+		{ "shop.ht", Normal }, { "firm.ht", Normal }, { "info.ht", Normal }, { "adult.ht", Normal }, { "net.ht", Normal },
+		{ "pro.ht", Normal }, { "org.ht", Normal }, { "med.ht", Normal }, { "art.ht", Normal }, { "coop.ht", Normal },
+		{ "pol.ht", Normal }, { "asso.ht", Normal }, { "edu.ht", Normal }, { "rel.ht", Normal }, { "gouv.ht", Normal },
+		{ "perso.ht", Normal }, { "hu", Normal }, { "co.hu", Normal }, { "info.hu", Normal }, { "org.hu", Normal },
+		{ "priv.hu", Normal }, { "sport.hu", Normal }, { "tm.hu", Normal }, { "2000.hu", Normal }, { "agrar.hu", Normal },
+		{ "bolt.hu", Normal }, { "casino.hu", Normal }, { "city.hu", Normal }, { "erotica.hu", Normal },
+		{ "erotika.hu", Normal }, { "film.hu", Normal }, { "forum.hu", Normal }, { "games.hu", Normal },
+		{ "hotel.hu", Normal }, { "ingatlan.hu", Normal }, { "jogasz.hu", Normal }, { "konyvelo.hu", Normal },
+		{ "lakas.hu", Normal }, { "media.hu", Normal }, { "news.hu", Normal }, { "reklam.hu", Normal },
+		{ "sex.hu", Normal }, { "shop.hu", Normal }, { "suli.hu", Normal }, { "szex.hu", Normal }, { "tozsde.hu", Normal },
+		{ "utazas.hu", Normal }, { "video.hu", Normal }, { "id", Normal }, { "ac.id", Normal }, { "biz.id", Normal },
+		{ "co.id", Normal }, { "desa.id", Normal }, { "go.id", Normal }, { "mil.id", Normal }, { "my.id", Normal },
+		{ "net.id", Normal }, { "or.id", Normal }, { "ponpes.id", Normal }, { "sch.id", Normal }, { "web.id", Normal },
+		{ "ie", Normal }, { "gov.ie", Normal }, { "il", Normal }, { "ac.il", Normal }, { "co.il", Normal },
+		{ "gov.il", Normal }, { "idf.il", Normal }, { "k12.il", Normal }, { "muni.il", Normal }, { "net.il", Normal },
+		{ "org.il", Normal }, { "\327\231\327\251\327\250\327\220\327\234", Normal }, { "xn--4dbrk0ce", Normal },
+		{ "\327\220\327\247\327\223\327\236\327\231\327\224.\327\231\327\251\327\250\327\220\327\234", Normal },
+		{ "xn--4dbgdty6c.xn--4dbrk0ce", Normal },
+		{ "\327\231\327\251\327\225\327\221.\327\231\327\251\327\250\327\220\327\234", Normal },
+		{ "xn--5dbhl8d.xn--4dbrk0ce", Normal },
+		{ "\327\246\327\224\327\234.\327\231\327\251\327\250\327\220\327\234", Normal },
+		{ "xn--8dbq2a.xn--4dbrk0ce", Normal },
+		{ "\327\236\327\236\327\251\327\234.\327\231\327\251\327\250\327\220\327\234", Normal },
+		{ "xn--hebda8b.xn--4dbrk0ce", Normal }, { "im", Normal }, { "ac.im", Normal }, { "co.im", Normal },
+		{ "com.im", Normal }, { "ltd.co.im", Normal }, { "net.im", Normal }, { "org.im", Normal }, { "plc.co.im", Normal },
+		{ "tt.im", Normal }, { "tv.im", Normal }, { "in", Normal }, { "5g.in", Normal }, { "6g.in", Normal },
+		{ "ac.in", Normal }, { "ai.in", Normal }, { "am.in", Normal }, { "bihar.in", Normal }, { "biz.in", Normal },
+		{ "business.in", Normal }, { "ca.in", Normal }, { "cn.in", Normal }, { "co.in", Normal }, { "com.in", Normal },
+		{ "coop.in", Normal }, { "cs.in", Normal }, { "delhi.in", Normal }, { "dr.in", Normal }, { "edu.in", Normal },
+		{ "er.in", Normal }, { "firm.in", Normal }, { "gen.in", Normal }, { "gov.in", Normal }, { "gujarat.in", Normal },
+		{ "ind.in", Normal }, { "info.in", Normal }, { "int.in", Normal }, { "internet.in", Normal }, { "io.in", Normal },
+		{ "me.in", Normal }, { "mil.in", Normal }, { "net.in", Normal }, { "nic.in", Normal }, { "org.in", Normal },
+		{ "pg.in", Normal }, { "post.in", Normal }, { "pro.in", Normal }, { "res.in", Normal }, { "travel.in", Normal },
+		{ "tv.in", Normal }, { "uk.in", Normal }, { "up.in", Normal }, { "us.in", Normal }, { "info", Normal },
+		{ "int", Normal }, { "eu.int", Normal }, { "io", Normal }, { "com.io", Normal }, { "iq", Normal },
+		{ "gov.iq", Normal }, { "edu.iq", Normal }, { "mil.iq", Normal }, { "com.iq", Normal }, { "org.iq", Normal },
+		{ "net.iq", Normal }, { "ir", Normal }, { "ac.ir", Normal }, { "co.ir", Normal }, { "gov.ir", Normal },
+		{ "id.ir", Normal }, { "net.ir", Normal }, { "org.ir", Normal }, { "sch.ir", Normal },
+		{ "\330\247\333\214\330\261\330\247\331\206.ir", Normal }, { "xn--mgba3a4f16a.ir", Normal },
+		{ "\330\247\331\212\330\261\330\247\331\206.ir", Normal }, { "xn--mgba3a4fra.ir", Normal }, { "is", Normal },
+		{ "net.is", Normal }, { "com.is", Normal }, { "edu.is", Normal }, { "gov.is", Normal }, { "org.is", Normal },
+		{ "int.is", Normal }, { "it", Normal }, { "gov.it", Normal }, { "edu.it", Normal }, { "abr.it", Normal },
+		{ "abruzzo.it", Normal }, { "aosta-valley.it", Normal }, { "aostavalley.it", Normal }, { "bas.it", Normal },
+		{ "basilicata.it", Normal }, { "cal.it", Normal }, { "calabria.it", Normal }, { "cam.it", Normal },
+		{ "campania.it", Normal }, { "emilia-romagna.it", Normal }, { "emiliaromagna.it", Normal }, { "emr.it", Normal },
+		{ "friuli-v-giulia.it", Normal }, { "friuli-ve-giulia.it", Normal }, { "friuli-vegiulia.it", Normal },
+		{ "friuli-venezia-giulia.it", Normal }, { "friuli-veneziagiulia.it", Normal }, { "friuli-vgiulia.it", Normal },
+		{ "friuliv-giulia.it", Normal }, { "friulive-giulia.it", Normal }, { "friulivegiulia.it", Normal },
+		{ "friulivenezia-giulia.it", Normal }, { "friuliveneziagiulia.it", Normal }, { "friulivgiulia.it", Normal },
+		{ "fvg.it", Normal }, { "laz.it", Normal }, { "lazio.it", Normal }, { "lig.it", Normal }, { "liguria.it", Normal },
+		{ "lom.it", Normal }, { "lombardia.it", Normal }, { "lombardy.it", Normal }, { "lucania.it", Normal },
+		{ "mar.it", Normal }, { "marche.it", Normal }, { "mol.it", Normal }, { "molise.it", Normal },
+		{ "piedmont.it", Normal }, { "piemonte.it", Normal }, { "pmn.it", Normal }, { "pug.it", Normal },
+		{ "puglia.it", Normal }, { "sar.it", Normal }, { "sardegna.it", Normal }, { "sardinia.it", Normal },
+		{ "sic.it", Normal }, { "sicilia.it", Normal }, { "sicily.it", Normal }, { "taa.it", Normal }, { "tos.it", Normal },
+		{ "toscana.it", Normal }, { "trentin-sud-tirol.it", Normal }, { "trentin-s\303\274d-tirol.it", Normal },
+		{ "xn--trentin-sd-tirol-rzb.it", Normal }, { "trentin-sudtirol.it", Normal },
+		{ "trentin-s\303\274dtirol.it", Normal }, { "xn--trentin-sdtirol-7vb.it", Normal },
+		{ "trentin-sued-tirol.it", Normal }, { "trentin-suedtirol.it", Normal }, { "trentino-a-adige.it", Normal },
+		{ "trentino-aadige.it", Normal }, { "trentino-alto-adige.it", Normal }, { "trentino-altoadige.it", Normal },
+		{ "trentino-s-tirol.it", Normal }, { "trentino-stirol.it", Normal }, { "trentino-sud-tirol.it", Normal },
+		{ "trentino-s\303\274d-tirol.it", Normal }, { "xn--trentino-sd-tirol-c3b.it", Normal },
+		{ "trentino-sudtirol.it", Normal }, { "trentino-s\303\274dtirol.it", Normal },
+		{ "xn--trentino-sdtirol-szb.it", Normal }, { "trentino-sued-tirol.it", Normal },
+		{ "trentino-suedtirol.it", Normal }, { "trentino.it", Normal }, { "trentinoa-adige.it", Normal },
+		{ "trentinoaadige.it", Normal }, { "trentinoalto-adige.it", Normal }, { "trentinoaltoadige.it", Normal },
+		{ "trentinos-tirol.it", Normal }, { "trentinostirol.it", Normal }, { "trentinosud-tirol.it", Normal },
+		{ "trentinos\303\274d-tirol.it", Normal }, { "xn--trentinosd-tirol-rzb.it", Normal },
+		{ "trentinosudtirol.it", Normal }, { "trentinos\303\274dtirol.it", Normal },
+		{ "xn--trentinosdtirol-7vb.it", Normal }, { "trentinosued-tirol.it", Normal }, { "trentinosuedtirol.it", Normal },
+		{ "trentinsud-tirol.it", Normal }, { "trentins\303\274d-tirol.it", Normal },
+		{ "xn--trentinsd-tirol-6vb.it", Normal }, { "trentinsudtirol.it", Normal }, { "trentins\303\274dtirol.it", Normal },
+		{ "xn--trentinsdtirol-nsb.it", Normal }, { "trentinsued-tirol.it", Normal }, { "trentinsuedtirol.it", Normal },
+		{ "tuscany.it", Normal }, { "umb.it", Normal }, { "umbria.it", Normal }, { "val-d-aosta.it", Normal },
+		{ "val-daosta.it", Normal }, { "vald-aosta.it", Normal }, { "valdaosta.it", Normal }, { "valle-aosta.it", Normal },
+		{ "valle-d-aosta.it", Normal }, { "valle-daosta.it", Normal }, { "valleaosta.it", Normal },
+		{ "valled-aosta.it", Normal }, { "valledaosta.it", Normal }, { "vallee-aoste.it", Normal },
+		{ "vall\303\251e-aoste.it", Normal }, { "xn--valle-aoste-ebb.it", Normal }, { "vallee-d-aoste.it", Normal },
+		{ "vall\303\251e-d-aoste.it", Normal }, { "xn--valle-d-aoste-ehb.it", Normal }, { "valleeaoste.it", Normal },
+		{ "vall\303\251eaoste.it", Normal }, { "xn--valleaoste-e7a.it", Normal }, { "valleedaoste.it", Normal },
+		{ "vall\303\251edaoste.it", Normal }, { "xn--valledaoste-ebb.it", Normal }, { "vao.it", Normal },
+		{ "vda.it", Normal }, { "ven.it", Normal }, { "veneto.it", Normal }, { "ag.it", Normal },
+		{ "agrigento.it", Normal }, { "al.it", Normal }, { "alessandria.it", Normal }, { "alto-adige.it", Normal },
+		{ "altoadige.it", Normal }, { "an.it", Normal }, { "ancona.it", Normal }, { "andria-barletta-trani.it", Normal },
+		{ "andria-trani-barletta.it", Normal }, { "andriabarlettatrani.it", Normal }, { "andriatranibarletta.it", Normal },
+		{ "ao.it", Normal }, { "aosta.it", Normal }, { "aoste.it", Normal }, { "ap.it", Normal }, { "aq.it", Normal },
+		{ "aquila.it", Normal }, { "ar.it", Normal }, { "arezzo.it", Normal }, { "ascoli-piceno.it", Normal },
+		{ "ascolipiceno.it", Normal }, { "asti.it", Normal }, { "at.it", Normal }, { "av.it", Normal },
+		{ "avellino.it", Normal }, { "ba.it", Normal }, { "balsan-sudtirol.it", Normal },
+		{ "balsan-s\303\274dtirol.it", Normal }, { "xn--balsan-sdtirol-nsb.it", Normal }, { "balsan-suedtirol.it", Normal },
+		{ "balsan.it", Normal }, { "bari.it", Normal }, { "barletta-trani-andria.it", Normal },
+		{ "barlettatraniandria.it", Normal }, { "belluno.it", Normal }, { "benevento.it", Normal },
+		{ "bergamo.it", Normal }, { "bg.it", Normal }, { "bi.it", Normal }, { "biella.it", Normal }, { "bl.it", Normal },
+		{ "bn.it", Normal }, { "bo.it", Normal }, { "bologna.it", Normal }, { "bolzano-altoadige.it", Normal },
+		{ "bolzano.it", Normal }, { "bozen-sudtirol.it", Normal }, { "bozen-s\303\274dtirol.it", Normal },
+		{ "xn--bozen-sdtirol-2ob.it", Normal }, { "bozen-suedtirol.it", Normal }, { "bozen.it", Normal },
+		{ "br.it", Normal }, { "brescia.it", Normal }, { "brindisi.it", Normal }, { "bs.it", Normal }, { "bt.it", Normal },
+		{ "bulsan-sudtirol.it", Normal }, { "bulsan-s\303\274dtirol.it", Normal }, { "xn--bulsan-sdtirol-nsb.it", Normal },
+		{ "bulsan-suedtirol.it", Normal }, { "bulsan.it", Normal }, { "bz.it", Normal }, { "ca.it", Normal },
+		{ "cagliari.it", Normal }, { "caltanissetta.it", Normal }, { "campidano-medio.it", Normal },
+		{ "campidanomedio.it", Normal }, { "campobasso.it", Normal }, { "carbonia-iglesias.it", Normal },
+		{ "carboniaiglesias.it", Normal }, { "carrara-massa.it", Normal }, { "carraramassa.it", Normal },
+		{ "caserta.it", Normal }, { "catania.it", Normal }, { "catanzaro.it", Normal }, { "cb.it", Normal },
+		{ "ce.it", Normal }, { "cesena-forli.it", Normal }, { "cesena-forl\303\254.it", Normal },
+		{ "xn--cesena-forl-mcb.it", Normal }, { "cesenaforli.it", Normal }, { "cesenaforl\303\254.it", Normal },
+		{ "xn--cesenaforl-i8a.it", Normal }, { "ch.it", Normal }, { "chieti.it", Normal }, { "ci.it", Normal },
+		{ "cl.it", Normal }, { "cn.it", Normal }, { "co.it", Normal }, { "como.it", Normal }, { "cosenza.it", Normal },
+		{ "cr.it", Normal }, { "cremona.it", Normal }, { "crotone.it", Normal }, { "cs.it", Normal }, { "ct.it", Normal },
+		{ "cuneo.it", Normal }, { "cz.it", Normal }, { "dell-ogliastra.it", Normal }, { "dellogliastra.it", Normal },
+		{ "en.it", Normal }, { "enna.it", Normal }, { "fc.it", Normal }, { "fe.it", Normal }, { "fermo.it", Normal },
+		{ "ferrara.it", Normal }, { "fg.it", Normal }, { "fi.it", Normal }, { "firenze.it", Normal },
+		{ "florence.it", Normal }, { "fm.it", Normal }, { "foggia.it", Normal }, { "forli-cesena.it", Normal },
+		{ "forl\303\254-cesena.it", Normal }, { "xn--forl-cesena-fcb.it", Normal }, { "forlicesena.it", Normal },
+		{ "forl\303\254cesena.it", Normal }, { "xn--forlcesena-c8a.it", Normal }, { "fr.it", Normal },
+		{ "frosinone.it", Normal }, { "ge.it", Normal }, { "genoa.it", Normal }, { "genova.it", Normal },
+		{ "go.it", Normal }, { "gorizia.it", Normal }, { "gr.it", Normal }, { "grosseto.it", Normal },
+		{ "iglesias-carbonia.it", Normal }, { "iglesiascarbonia.it", Normal }, { "im.it", Normal },
+		{ "imperia.it", Normal }, { "is.it", Normal }, { "isernia.it", Normal }, { "kr.it", Normal },
+		{ "la-spezia.it", Normal }, { "laquila.it", Normal }, { "laspezia.it", Normal }, { "latina.it", Normal },
+		{ "lc.it", Normal }, { "le.it", Normal }, { "lecce.it", Normal }, { "lecco.it", Normal }, { "li.it", Normal },
+		{ "livorno.it", Normal }, { "lo.it", Normal }, { "lodi.it", Normal }, { "lt.it", Normal }, { "lu.it", Normal },
+		{ "lucca.it", Normal }, { "macerata.it", Normal }, { "mantova.it", Normal }, { "massa-carrara.it", Normal },
+		{ "massacarrara.it", Normal }, { "matera.it", Normal }, { "mb.it", Normal }, { "mc.it", Normal },
+		{ "me.it", Normal }, { "medio-campidano.it", Normal }, { "mediocampidano.it", Normal }, { "messina.it", Normal },
+		{ "mi.it", Normal }, { "milan.it", Normal }, { "milano.it", Normal }, { "mn.it", Normal }, { "mo.it", Normal },
+		{ "modena.it", Normal }, { "monza-brianza.it", Normal }, { "monza-e-della-brianza.it", Normal },
+		{ "monza.it", Normal }, { "monzabrianza.it", Normal }, { "monzaebrianza.it", Normal },
+		{ "monzaedellabrianza.it", Normal }, { "ms.it", Normal }, { "mt.it", Normal }, { "na.it", Normal },
+		{ "naples.it", Normal }, { "napoli.it", Normal }, { "no.it", Normal }, { "novara.it", Normal }, { "nu.it", Normal },
+		{ "nuoro.it", Normal }, { "og.it", Normal }, { "ogliastra.it", Normal }, { "olbia-tempio.it", Normal },
+		{ "olbiatempio.it", Normal }, { "or.it", Normal }, { "oristano.it", Normal }, { "ot.it", Normal },
+		{ "pa.it", Normal }, { "padova.it", Normal }, { "padua.it", Normal }, { "palermo.it", Normal },
+		{ "parma.it", Normal }, { "pavia.it", Normal }, { "pc.it", Normal }, { "pd.it", Normal }, { "pe.it", Normal },
+		{ "perugia.it", Normal }, { "pesaro-urbino.it", Normal }, { "pesarourbino.it", Normal }, { "pescara.it", Normal },
+		{ "pg.it", Normal }, { "pi.it", Normal }, { "piacenza.it", Normal }, { "pisa.it", Normal },
+		{ "pistoia.it", Normal }, { "pn.it", Normal }, { "po.it", Normal }, { "pordenone.it", Normal },
+		{ "potenza.it", Normal }, { "pr.it", Normal }, { "prato.it", Normal }, { "pt.it", Normal }, { "pu.it", Normal },
+		{ "pv.it", Normal }, { "pz.it", Normal }, { "ra.it", Normal }, { "ragusa.it", Normal }, { "ravenna.it", Normal },
+		{ "rc.it", Normal }, { "re.it", Normal }, { "reggio-calabria.it", Normal }, { "reggio-emilia.it", Normal },
+		{ "reggiocalabria.it", Normal }, { "reggioemilia.it", Normal }, { "rg.it", Normal }, { "ri.it", Normal },
+		{ "rieti.it", Normal }, { "rimini.it", Normal }, { "rm.it", Normal }, { "rn.it", Normal }, { "ro.it", Normal },
+		{ "roma.it", Normal }, { "rome.it", Normal }, { "rovigo.it", Normal }, { "sa.it", Normal },
+		{ "salerno.it", Normal }, { "sassari.it", Normal }, { "savona.it", Normal }, { "si.it", Normal },
+		{ "siena.it", Normal }, { "siracusa.it", Normal }, { "so.it", Normal }, { "sondrio.it", Normal },
+		{ "sp.it", Normal }, { "sr.it", Normal }, { "ss.it", Normal }, { "suedtirol.it", Normal },
+		{ "s\303\274dtirol.it", Normal }, { "xn--sdtirol-n2a.it", Normal }, { "sv.it", Normal }, { "ta.it", Normal },
+		{ "taranto.it", Normal }, { "te.it", Normal }, { "tempio-olbia.it", Normal }, { "tempioolbia.it", Normal },
+		{ "teramo.it", Normal }, { "terni.it", Normal }, { "tn.it", Normal }, { "to.it", Normal }, { "torino.it", Normal },
+		{ "tp.it", Normal }, { "tr.it", Normal }, { "trani-andria-barletta.it", Normal },
+		{ "trani-barletta-andria.it", Normal }, { "traniandriabarletta.it", Normal }, { "tranibarlettaandria.it", Normal },
+		{ "trapani.it", Normal }, { "trento.it", Normal }, { "treviso.it", Normal }, { "trieste.it", Normal },
+		{ "ts.it", Normal }, { "turin.it", Normal }, { "tv.it", Normal }, { "ud.it", Normal }, { "udine.it", Normal },
+		{ "urbino-pesaro.it", Normal }, { "urbinopesaro.it", Normal }, { "va.it", Normal }, { "varese.it", Normal },
+		{ "vb.it", Normal }, { "vc.it", Normal }, { "ve.it", Normal }, { "venezia.it", Normal }, { "venice.it", Normal },
+		{ "verbania.it", Normal }, { "vercelli.it", Normal }, { "verona.it", Normal }, { "vi.it", Normal },
+		{ "vibo-valentia.it", Normal }, { "vibovalentia.it", Normal }, { "vicenza.it", Normal }, { "viterbo.it", Normal },
+		{ "vr.it", Normal }, { "vs.it", Normal }, { "vt.it", Normal }, { "vv.it", Normal }, { "je", Normal },
+		{ "co.je", Normal }, { "net.je", Normal }, { "org.je", Normal }, { "jm", Wildcard }, { "jo", Normal },
+		{ "com.jo", Normal }, { "org.jo", Normal }, { "net.jo", Normal }, { "edu.jo", Normal }, { "sch.jo", Normal },
+		{ "gov.jo", Normal }, { "mil.jo", Normal }, { "name.jo", Normal }, { "jobs", Normal }, { "jp", Normal },
+		{ "ac.jp", Normal }, { "ad.jp", Normal }, { "co.jp", Normal }, { "ed.jp", Normal }, { "go.jp", Normal },
+		{ "gr.jp", Normal }, { "lg.jp", Normal }, { "ne.jp", Normal }, { "or.jp", Normal }, { "aichi.jp", Normal },
+		{ "akita.jp", Normal }, { "aomori.jp", Normal }, { "chiba.jp", Normal }, { "ehime.jp", Normal },
+		{ "fukui.jp", Normal }, { "fukuoka.jp", Normal }, { "fukushima.jp", Normal }, { "gifu.jp", Normal },
+		{ "gunma.jp", Normal }, { "hiroshima.jp", Normal }, { "hokkaido.jp", Normal }, { "hyogo.jp", Normal },
+		{ "ibaraki.jp", Normal }, { "ishikawa.jp", Normal }, { "iwate.jp", Normal }, { "kagawa.jp", Normal },
+		{ "kagoshima.jp", Normal }, { "kanagawa.jp", Normal }, { "kochi.jp", Normal }, { "kumamoto.jp", Normal },
+		{ "kyoto.jp", Normal }, { "mie.jp", Normal }, { "miyagi.jp", Normal }, { "miyazaki.jp", Normal },
+		{ "nagano.jp", Normal }, { "nagasaki.jp", Normal }, { "nara.jp", Normal }, { "niigata.jp", Normal },
+		{ "oita.jp", Normal }, { "okayama.jp", Normal }, { "okinawa.jp", Normal }, { "osaka.jp", Normal },
+		{ "saga.jp", Normal }, { "saitama.jp", Normal }, { "shiga.jp", Normal }, { "shimane.jp", Normal },
+		{ "shizuoka.jp", Normal }, { "tochigi.jp", Normal }, { "tokushima.jp", Normal }, { "tokyo.jp", Normal },
+		{ "tottori.jp", Normal }, { "toyama.jp", Normal }, { "wakayama.jp", Normal }, { "yamagata.jp", Normal },
+		{ "yamaguchi.jp", Normal }, { "yamanashi.jp", Normal }, { "\346\240\203\346\234\250.jp", Normal },
+		{ "xn--4pvxs.jp", Normal }, { "\346\204\233\347\237\245.jp", Normal }, { "xn--vgu402c.jp", Normal },
+		{ "\346\204\233\345\252\233.jp", Normal }, { "xn--c3s14m.jp", Normal }, { "\345\205\265\345\272\253.jp", Normal },
+		{ "xn--f6qx53a.jp", Normal }, { "\347\206\212\346\234\254.jp", Normal }, { "xn--8pvr4u.jp", Normal },
+		{ "\350\214\250\345\237\216.jp", Normal }, { "xn--uist22h.jp", Normal },
+		{ "\345\214\227\346\265\267\351\201\223.jp", Normal }, { "xn--djrs72d6uy.jp", Normal },
+		{ "\345\215\203\350\221\211.jp", Normal }, { "xn--mkru45i.jp", Normal },
+		{ "\345\222\214\346\255\214\345\261\261.jp", Normal }, { "xn--0trq7p7nn.jp", Normal },
+		{ "\351\225\267\345\264\216.jp", Normal }, { "xn--8ltr62k.jp", Normal }, { "\351\225\267\351\207\216.jp", Normal },
+		{ "xn--2m4a15e.jp", Normal }, { "\346\226\260\346\275\237.jp", Normal }, { "xn--efvn9s.jp", Normal },
+		{ "\351\235\222\346\243\256.jp", Normal }, { "xn--32vp30h.jp", Normal }, { "\351\235\231\345\262\241.jp", Normal },
+		{ "xn--4it797k.jp", Normal }, { "\346\235\261\344\272\254.jp", Normal }, { "xn--1lqs71d.jp", Normal },
+		{ "\347\237\263\345\267\235.jp", Normal }, { "xn--5rtp49c.jp", Normal }, { "\345\237\274\347\216\211.jp", Normal },
+		{ "xn--5js045d.jp", Normal }, { "\344\270\211\351\207\215.jp", Normal }, { "xn--ehqz56n.jp", Normal },
+		{ "\344\272\254\351\203\275.jp", Normal }, { "xn--1lqs03n.jp", Normal }, { "\344\275\220\350\263\200.jp", Normal },
+		{ "xn--qqqt11m.jp", Normal }, { "\345\244\247\345\210\206.jp", Normal }, { "xn--kbrq7o.jp", Normal },
+		{ "\345\244\247\351\230\252.jp", Normal }, { "xn--pssu33l.jp", Normal }, { "\345\245\210\350\211\257.jp", Normal },
+		{ "xn--ntsq17g.jp", Normal }, { "\345\256\256\345\237\216.jp", Normal }, { "xn--uisz3g.jp", Normal },
+		{ "\345\256\256\345\264\216.jp", Normal }, { "xn--6btw5a.jp", Normal }, { "\345\257\214\345\261\261.jp", Normal },
+		{ "xn--1ctwo.jp", Normal }, { "\345\261\261\345\217\243.jp", Normal }, { "xn--6orx2r.jp", Normal },
+		{ "\345\261\261\345\275\242.jp", Normal }, { "xn--rht61e.jp", Normal }, { "\345\261\261\346\242\250.jp", Normal },
+		{ "xn--rht27z.jp", Normal }, { "\345\262\251\346\211\213.jp", Normal }, { "xn--djty4k.jp", Normal },
+		{ "\345\262\220\351\230\234.jp", Normal }, { "xn--nit225k.jp", Normal }, { "\345\262\241\345\261\261.jp", Normal },
+		{ "xn--rht3d.jp", Normal }, { "\345\263\266\346\240\271.jp", Normal }, { "xn--klty5x.jp", Normal },
+		{ "\345\272\203\345\263\266.jp", Normal }, { "xn--kltx9a.jp", Normal }, { "\345\276\263\345\263\266.jp", Normal },
+		{ "xn--kltp7d.jp", Normal }, { "\346\262\226\347\270\204.jp", Normal }, { "xn--uuwu58a.jp", Normal },
+		{ "\346\273\213\350\263\200.jp", Normal }, { "xn--zbx025d.jp", Normal },
+		{ "\347\245\236\345\245\210\345\267\235.jp", Normal }, { "xn--ntso0iqx3a.jp", Normal },
+		{ "\347\246\217\344\272\225.jp", Normal }, { "xn--elqq16h.jp", Normal }, { "\347\246\217\345\262\241.jp", Normal },
+		{ "xn--4it168d.jp", Normal }, { "\347\246\217\345\263\266.jp", Normal }, { "xn--klt787d.jp", Normal },
+		{ "\347\247\213\347\224\260.jp", Normal }, { "xn--rny31h.jp", Normal }, { "\347\276\244\351\246\254.jp", Normal },
+		{ "xn--7t0a264c.jp", Normal }, { "\351\246\231\345\267\235.jp", Normal }, { "xn--5rtq34k.jp", Normal },
+		{ "\351\253\230\347\237\245.jp", Normal }, { "xn--k7yn95e.jp", Normal }, { "\351\263\245\345\217\226.jp", Normal },
+		{ "xn--tor131o.jp", Normal }, { "\351\271\277\345\205\220\345\263\266.jp", Normal },
+		{ "xn--d5qv7z876c.jp", Normal }, { "kawasaki.jp", Wildcard }, { "kitakyushu.jp", Wildcard },
+		{ "kobe.jp", Wildcard }, { "nagoya.jp", Wildcard }, { "sapporo.jp", Wildcard }, { "sendai.jp", Wildcard },
+		{ "yokohama.jp", Wildcard }, { "city.kawasaki.jp", Exception }, { "city.kitakyushu.jp", Exception },
+		{ "city.kobe.jp", Exception }, { "city.nagoya.jp", Exception }, { "city.sapporo.jp", Exception },
+		{ "city.sendai.jp", Exception }, { "city.yokohama.jp", Exception }, { "aisai.aichi.jp", Normal },
+		{ "ama.aichi.jp", Normal }, { "anjo.aichi.jp", Normal }, { "asuke.aichi.jp", Normal },
+		{ "chiryu.aichi.jp", Normal }, { "chita.aichi.jp", Normal }, { "fuso.aichi.jp", Normal },
+		{ "gamagori.aichi.jp", Normal }, { "handa.aichi.jp", Normal }, { "hazu.aichi.jp", Normal },
+		{ "hekinan.aichi.jp", Normal }, { "higashiura.aichi.jp", Normal }, { "ichinomiya.aichi.jp", Normal },
+		{ "inazawa.aichi.jp", Normal }, { "inuyama.aichi.jp", Normal }, { "isshiki.aichi.jp", Normal },
+		{ "iwakura.aichi.jp", Normal }, { "kanie.aichi.jp", Normal }, { "kariya.aichi.jp", Normal },
+		{ "kasugai.aichi.jp", Normal }, { "kira.aichi.jp", Normal }, { "kiyosu.aichi.jp", Normal },
+		{ "komaki.aichi.jp", Normal }, { "konan.aichi.jp", Normal }, { "kota.aichi.jp", Normal },
+		{ "mihama.aichi.jp", Normal }, { "miyoshi.aichi.jp", Normal }, { "nishio.aichi.jp", Normal },
+		{ "nisshin.aichi.jp", Normal }, { "obu.aichi.jp", Normal }, { "oguchi.aichi.jp", Normal },
+		{ "oharu.aichi.jp", Normal }, { "okazaki.aichi.jp", Normal }, { "owariasahi.aichi.jp", Normal },
+		{ "seto.aichi.jp", Normal }, { "shikatsu.aichi.jp", Normal }, { "shinshiro.aichi.jp", Normal },
+		{ "shitara.aichi.jp", Normal }, { "tahara.aichi.jp", Normal }, { "takahama.aichi.jp", Normal },
+		{ "tobishima.aichi.jp", Normal }, { "toei.aichi.jp", Normal }, { "togo.aichi.jp", Normal },
+		{ "tokai.aichi.jp", Normal }, { "tokoname.aichi.jp", Normal }, { "toyoake.aichi.jp", Normal },
+		{ "toyohashi.aichi.jp", Normal }, { "toyokawa.aichi.jp", Normal }, { "toyone.aichi.jp", Normal },
+		{ "toyota.aichi.jp", Normal }, { "tsushima.aichi.jp", Normal }, { "yatomi.aichi.jp", Normal },
+		{ "akita.akita.jp", Normal }, { "daisen.akita.jp", Normal }, { "fujisato.akita.jp", Normal },
+		{ "gojome.akita.jp", Normal }, { "hachirogata.akita.jp", Normal }, { "happou.akita.jp", Normal },
+		{ "higashinaruse.akita.jp", Normal }, { "honjo.akita.jp", Normal }, { "honjyo.akita.jp", Normal },
+		{ "ikawa.akita.jp", Normal }, { "kamikoani.akita.jp", Normal }, { "kamioka.akita.jp", Normal },
+		{ "katagami.akita.jp", Normal }, { "kazuno.akita.jp", Normal }, { "kitaakita.akita.jp", Normal },
+		{ "kosaka.akita.jp", Normal }, { "kyowa.akita.jp", Normal }, { "misato.akita.jp", Normal },
+		{ "mitane.akita.jp", Normal }, { "moriyoshi.akita.jp", Normal }, { "nikaho.akita.jp", Normal },
+		{ "noshiro.akita.jp", Normal }, { "odate.akita.jp", Normal }, { "oga.akita.jp", Normal },
+		{ "ogata.akita.jp", Normal }, { "semboku.akita.jp", Normal }, { "yokote.akita.jp", Normal },
+		{ "yurihonjo.akita.jp", Normal }, { "aomori.aomori.jp", Normal }, { "gonohe.aomori.jp", Normal },
+		{ "hachinohe.aomori.jp", Normal }, { "hashikami.aomori.jp", Normal }, { "hiranai.aomori.jp", Normal },
+		{ "hirosaki.aomori.jp", Normal }, { "itayanagi.aomori.jp", Normal }, { "kuroishi.aomori.jp", Normal },
+		{ "misawa.aomori.jp", Normal }, { "mutsu.aomori.jp", Normal }, { "nakadomari.aomori.jp", Normal },
+		{ "noheji.aomori.jp", Normal }, { "oirase.aomori.jp", Normal }, { "owani.aomori.jp", Normal },
+		{ "rokunohe.aomori.jp", Normal }, { "sannohe.aomori.jp", Normal }, { "shichinohe.aomori.jp", Normal },
+		{ "shingo.aomori.jp", Normal }, { "takko.aomori.jp", Normal }, { "towada.aomori.jp", Normal },
+		{ "tsugaru.aomori.jp", Normal }, { "tsuruta.aomori.jp", Normal }, { "abiko.chiba.jp", Normal },
+		{ "asahi.chiba.jp", Normal }, { "chonan.chiba.jp", Normal }, { "chosei.chiba.jp", Normal },
+		{ "choshi.chiba.jp", Normal }, { "chuo.chiba.jp", Normal }, { "funabashi.chiba.jp", Normal },
+		{ "futtsu.chiba.jp", Normal }, { "hanamigawa.chiba.jp", Normal }, { "ichihara.chiba.jp", Normal },
+		{ "ichikawa.chiba.jp", Normal }, { "ichinomiya.chiba.jp", Normal }, { "inzai.chiba.jp", Normal },
+		{ "isumi.chiba.jp", Normal }, { "kamagaya.chiba.jp", Normal }, { "kamogawa.chiba.jp", Normal },
+		{ "kashiwa.chiba.jp", Normal }, { "katori.chiba.jp", Normal }, { "katsuura.chiba.jp", Normal },
+		{ "kimitsu.chiba.jp", Normal }, { "kisarazu.chiba.jp", Normal }, { "kozaki.chiba.jp", Normal },
+		{ "kujukuri.chiba.jp", Normal }, { "kyonan.chiba.jp", Normal }, { "matsudo.chiba.jp", Normal },
+		{ "midori.chiba.jp", Normal }, { "mihama.chiba.jp", Normal }, { "minamiboso.chiba.jp", Normal },
+		{ "mobara.chiba.jp", Normal }, { "mutsuzawa.chiba.jp", Normal }, { "nagara.chiba.jp", Normal },
+		{ "nagareyama.chiba.jp", Normal }, { "narashino.chiba.jp", Normal }, { "narita.chiba.jp", Normal },
+		{ "noda.chiba.jp", Normal }, { "oamishirasato.chiba.jp", Normal }, { "omigawa.chiba.jp", Normal },
+		{ "onjuku.chiba.jp", Normal }, { "otaki.chiba.jp", Normal }, { "sakae.chiba.jp", Normal },
+		{ "sakura.chiba.jp", Normal }, { "shimofusa.chiba.jp", Normal }, { "shirako.chiba.jp", Normal },
+		{ "shiroi.chiba.jp", Normal }, { "shisui.chiba.jp", Normal }, { "sodegaura.chiba.jp", Normal },
+		{ "sosa.chiba.jp", Normal }, { "tako.chiba.jp", Normal }, { "tateyama.chiba.jp", Normal },
+		{ "togane.chiba.jp", Normal }, { "tohnosho.chiba.jp", Normal }, { "tomisato.chiba.jp", Normal },
+		{ "urayasu.chiba.jp", Normal }, { "yachimata.chiba.jp", Normal }, { "yachiyo.chiba.jp", Normal },
+		{ "yokaichiba.chiba.jp", Normal }, { "yokoshibahikari.chiba.jp", Normal }, { "yotsukaido.chiba.jp", Normal },
+		{ "ainan.ehime.jp", Normal }, { "honai.ehime.jp", Normal }, { "ikata.ehime.jp", Normal },
+		{ "imabari.ehime.jp", Normal }, { "iyo.ehime.jp", Normal }, { "kamijima.ehime.jp", Normal },
+		{ "kihoku.ehime.jp", Normal }, { "kumakogen.ehime.jp", Normal }, { "masaki.ehime.jp", Normal },
+		{ "matsuno.ehime.jp", Normal }, { "matsuyama.ehime.jp", Normal }, { "namikata.ehime.jp", Normal },
+		{ "niihama.ehime.jp", Normal }, { "ozu.ehime.jp", Normal }, { "saijo.ehime.jp", Normal },
+		{ "seiyo.ehime.jp", Normal }, { "shikokuchuo.ehime.jp", Normal }, { "tobe.ehime.jp", Normal },
+		{ "toon.ehime.jp", Normal }, { "uchiko.ehime.jp", Normal }, { "uwajima.ehime.jp", Normal },
+		{ "yawatahama.ehime.jp", Normal }, { "echizen.fukui.jp", Normal }, { "eiheiji.fukui.jp", Normal },
+		{ "fukui.fukui.jp", Normal }, { "ikeda.fukui.jp", Normal }, { "katsuyama.fukui.jp", Normal },
+		{ "mihama.fukui.jp", Normal }, { "minamiechizen.fukui.jp", Normal }, { "obama.fukui.jp", Normal },
+		{ "ohi.fukui.jp", Normal }, { "ono.fukui.jp", Normal }, { "sabae.fukui.jp", Normal }, { "sakai.fukui.jp", Normal },
+		{ "takahama.fukui.jp", Normal }, { "tsuruga.fukui.jp", Normal }, { "wakasa.fukui.jp", Normal },
+		{ "ashiya.fukuoka.jp", Normal }, { "buzen.fukuoka.jp", Normal }, { "chikugo.fukuoka.jp", Normal },
+		{ "chikuho.fukuoka.jp", Normal }, { "chikujo.fukuoka.jp", Normal }, { "chikushino.fukuoka.jp", Normal },
+		{ "chikuzen.fukuoka.jp", Normal }, { "chuo.fukuoka.jp", Normal }, { "dazaifu.fukuoka.jp", Normal },
+		{ "fukuchi.fukuoka.jp", Normal }, { "hakata.fukuoka.jp", Normal }, { "higashi.fukuoka.jp", Normal },
+		{ "hirokawa.fukuoka.jp", Normal }, { "hisayama.fukuoka.jp", Normal }, { "iizuka.fukuoka.jp", Normal },
+		{ "inatsuki.fukuoka.jp", Normal }, { "kaho.fukuoka.jp", Normal }, { "kasuga.fukuoka.jp", Normal },
+		{ "kasuya.fukuoka.jp", Normal }, { "kawara.fukuoka.jp", Normal }, { "keisen.fukuoka.jp", Normal },
+		{ "koga.fukuoka.jp", Normal }, { "kurate.fukuoka.jp", Normal }, { "kurogi.fukuoka.jp", Normal },
+		{ "kurume.fukuoka.jp", Normal }, { "minami.fukuoka.jp", Normal }, { "miyako.fukuoka.jp", Normal },
+		{ "miyama.fukuoka.jp", Normal }, { "miyawaka.fukuoka.jp", Normal }, { "mizumaki.fukuoka.jp", Normal },
+		{ "munakata.fukuoka.jp", Normal }, { "nakagawa.fukuoka.jp", Normal }, { "nakama.fukuoka.jp", Normal },
+		{ "nishi.fukuoka.jp", Normal }, { "nogata.fukuoka.jp", Normal }, { "ogori.fukuoka.jp", Normal },
+		{ "okagaki.fukuoka.jp", Normal }, { "okawa.fukuoka.jp", Normal }, { "oki.fukuoka.jp", Normal },
+		{ "omuta.fukuoka.jp", Normal }, { "onga.fukuoka.jp", Normal }, { "onojo.fukuoka.jp", Normal },
+		{ "oto.fukuoka.jp", Normal }, { "saigawa.fukuoka.jp", Normal }, { "sasaguri.fukuoka.jp", Normal },
+		{ "shingu.fukuoka.jp", Normal }, { "shinyoshitomi.fukuoka.jp", Normal }, { "shonai.fukuoka.jp", Normal },
+		{ "soeda.fukuoka.jp", Normal }, { "sue.fukuoka.jp", Normal }, { "tachiarai.fukuoka.jp", Normal },
+		{ "tagawa.fukuoka.jp", Normal }, { "takata.fukuoka.jp", Normal }, { "toho.fukuoka.jp", Normal },
+		{ "toyotsu.fukuoka.jp", Normal }, { "tsuiki.fukuoka.jp", Normal }, { "ukiha.fukuoka.jp", Normal },
+		{ "umi.fukuoka.jp", Normal }, { "usui.fukuoka.jp", Normal }, { "yamada.fukuoka.jp", Normal },
+		{ "yame.fukuoka.jp", Normal }, { "yanagawa.fukuoka.jp", Normal }, { "yukuhashi.fukuoka.jp", Normal },
+		{ "aizubange.fukushima.jp", Normal }, { "aizumisato.fukushima.jp", Normal },
+		{ "aizuwakamatsu.fukushima.jp", Normal }, { "asakawa.fukushima.jp", Normal }, { "bandai.fukushima.jp", Normal },
+		{ "date.fukushima.jp", Normal }, { "fukushima.fukushima.jp", Normal }, { "furudono.fukushima.jp", Normal },
+		{ "futaba.fukushima.jp", Normal }, { "hanawa.fukushima.jp", Normal }, { "higashi.fukushima.jp", Normal },
+		{ "hirata.fukushima.jp", Normal }, { "hirono.fukushima.jp", Normal }, { "iitate.fukushima.jp", Normal },
+		{ "inawashiro.fukushima.jp", Normal }, { "ishikawa.fukushima.jp", Normal }, { "iwaki.fukushima.jp", Normal },
+		{ "izumizaki.fukushima.jp", Normal }, { "kagamiishi.fukushima.jp", Normal }, { "kaneyama.fukushima.jp", Normal },
+		{ "kawamata.fukushima.jp", Normal }, { "kitakata.fukushima.jp", Normal }, { "kitashiobara.fukushima.jp", Normal },
+		{ "koori.fukushima.jp", Normal }, { "koriyama.fukushima.jp", Normal }, { "kunimi.fukushima.jp", Normal },
+		{ "miharu.fukushima.jp", Normal }, { "mishima.fukushima.jp", Normal }, { "namie.fukushima.jp", Normal },
+		{ "nango.fukushima.jp", Normal }, { "nishiaizu.fukushima.jp", Normal }, { "nishigo.fukushima.jp", Normal },
+		{ "okuma.fukushima.jp", Normal }, { "omotego.fukushima.jp", Normal }, { "ono.fukushima.jp", Normal },
+		{ "otama.fukushima.jp", Normal }, { "samegawa.fukushima.jp", Normal }, { "shimogo.fukushima.jp", Normal },
+		{ "shirakawa.fukushima.jp", Normal }, { "showa.fukushima.jp", Normal }, { "soma.fukushima.jp", Normal },
+		{ "sukagawa.fukushima.jp", Normal }, { "taishin.fukushima.jp", Normal }, { "tamakawa.fukushima.jp", Normal },
+		{ "tanagura.fukushima.jp", Normal }, { "tenei.fukushima.jp", Normal }, { "yabuki.fukushima.jp", Normal },
+		{ "yamato.fukushima.jp", Normal }, { "yamatsuri.fukushima.jp", Normal }, { "yanaizu.fukushima.jp", Normal },
+		{ "yugawa.fukushima.jp", Normal }, { "anpachi.gifu.jp", Normal }, { "ena.gifu.jp", Normal },
+		{ "gifu.gifu.jp", Normal }, { "ginan.gifu.jp", Normal }, { "godo.gifu.jp", Normal }, { "gujo.gifu.jp", Normal },
+		{ "hashima.gifu.jp", Normal }, { "hichiso.gifu.jp", Normal }, { "hida.gifu.jp", Normal },
+		{ "higashishirakawa.gifu.jp", Normal }, { "ibigawa.gifu.jp", Normal }, { "ikeda.gifu.jp", Normal },
+		{ "kakamigahara.gifu.jp", Normal }, { "kani.gifu.jp", Normal }, { "kasahara.gifu.jp", Normal },
+		{ "kasamatsu.gifu.jp", Normal }, { "kawaue.gifu.jp", Normal }, { "kitagata.gifu.jp", Normal },
+		{ "mino.gifu.jp", Normal }, { "minokamo.gifu.jp", Normal }, { "mitake.gifu.jp", Normal },
+		{ "mizunami.gifu.jp", Normal }, { "motosu.gifu.jp", Normal }, { "nakatsugawa.gifu.jp", Normal },
+		{ "ogaki.gifu.jp", Normal }, { "sakahogi.gifu.jp", Normal }, { "seki.gifu.jp", Normal },
+		{ "sekigahara.gifu.jp", Normal }, { "shirakawa.gifu.jp", Normal }, { "tajimi.gifu.jp", Normal },
+		{ "takayama.gifu.jp", Normal }, { "tarui.gifu.jp", Normal }, { "toki.gifu.jp", Normal },
+		{ "tomika.gifu.jp", Normal }, { "wanouchi.gifu.jp", Normal }, { "yamagata.gifu.jp", Normal },
+		{ "yaotsu.gifu.jp", Normal }, { "yoro.gifu.jp", Normal }, { "annaka.gunma.jp", Normal },
+		{ "chiyoda.gunma.jp", Normal }, { "fujioka.gunma.jp", Normal }, { "higashiagatsuma.gunma.jp", Normal },
+		{ "isesaki.gunma.jp", Normal }, { "itakura.gunma.jp", Normal }, { "kanna.gunma.jp", Normal },
+		{ "kanra.gunma.jp", Normal }, { "katashina.gunma.jp", Normal }, { "kawaba.gunma.jp", Normal },
+		{ "kiryu.gunma.jp", Normal }, { "kusatsu.gunma.jp", Normal }, { "maebashi.gunma.jp", Normal },
+		{ "meiwa.gunma.jp", Normal }, { "midori.gunma.jp", Normal }, { "minakami.gunma.jp", Normal },
+		{ "naganohara.gunma.jp", Normal }, { "nakanojo.gunma.jp", Normal }, { "nanmoku.gunma.jp", Normal },
+		{ "numata.gunma.jp", Normal }, { "oizumi.gunma.jp", Normal }, { "ora.gunma.jp", Normal },
+		{ "ota.gunma.jp", Normal }, { "shibukawa.gunma.jp", Normal }, { "shimonita.gunma.jp", Normal },
+		{ "shinto.gunma.jp", Normal }, { "showa.gunma.jp", Normal }, { "takasaki.gunma.jp", Normal },
+		{ "takayama.gunma.jp", Normal }, { "tamamura.gunma.jp", Normal }, { "tatebayashi.gunma.jp", Normal },
+		{ "tomioka.gunma.jp", Normal }, { "tsukiyono.gunma.jp", Normal }, { "tsumagoi.gunma.jp", Normal },
+		{ "ueno.gunma.jp", Normal }, { "yoshioka.gunma.jp", Normal }, { "asaminami.hiroshima.jp", Normal },
+		{ "daiwa.hiroshima.jp", Normal }, { "etajima.hiroshima.jp", Normal }, { "fuchu.hiroshima.jp", Normal },
+		{ "fukuyama.hiroshima.jp", Normal }, { "hatsukaichi.hiroshima.jp", Normal },
+		{ "higashihiroshima.hiroshima.jp", Normal }, { "hongo.hiroshima.jp", Normal },
+		{ "jinsekikogen.hiroshima.jp", Normal }, { "kaita.hiroshima.jp", Normal }, { "kui.hiroshima.jp", Normal },
+		{ "kumano.hiroshima.jp", Normal }, { "kure.hiroshima.jp", Normal }, { "mihara.hiroshima.jp", Normal },
+		{ "miyoshi.hiroshima.jp", Normal }, { "naka.hiroshima.jp", Normal }, { "onomichi.hiroshima.jp", Normal },
+		{ "osakikamijima.hiroshima.jp", Normal }, { "otake.hiroshima.jp", Normal }, { "saka.hiroshima.jp", Normal },
+		{ "sera.hiroshima.jp", Normal }, { "seranishi.hiroshima.jp", Normal }, { "shinichi.hiroshima.jp", Normal },
+		{ "shobara.hiroshima.jp", Normal }, { "takehara.hiroshima.jp", Normal }, { "abashiri.hokkaido.jp", Normal },
+		{ "abira.hokkaido.jp", Normal }, { "aibetsu.hokkaido.jp", Normal }, { "akabira.hokkaido.jp", Normal },
+		{ "akkeshi.hokkaido.jp", Normal }, { "asahikawa.hokkaido.jp", Normal }, { "ashibetsu.hokkaido.jp", Normal },
+		{ "ashoro.hokkaido.jp", Normal }, { "assabu.hokkaido.jp", Normal }, { "atsuma.hokkaido.jp", Normal },
+		{ "bibai.hokkaido.jp", Normal }, { "biei.hokkaido.jp", Normal }, { "bifuka.hokkaido.jp", Normal },
+		{ "bihoro.hokkaido.jp", Normal }, { "biratori.hokkaido.jp", Normal }, { "chippubetsu.hokkaido.jp", Normal },
+		{ "chitose.hokkaido.jp", Normal }, { "date.hokkaido.jp", Normal }, { "ebetsu.hokkaido.jp", Normal },
+		{ "embetsu.hokkaido.jp", Normal }, { "eniwa.hokkaido.jp", Normal }, { "erimo.hokkaido.jp", Normal },
+		{ "esan.hokkaido.jp", Normal }, { "esashi.hokkaido.jp", Normal }, { "fukagawa.hokkaido.jp", Normal },
+		{ "fukushima.hokkaido.jp", Normal }, { "furano.hokkaido.jp", Normal }, { "furubira.hokkaido.jp", Normal },
+		{ "haboro.hokkaido.jp", Normal }, { "hakodate.hokkaido.jp", Normal }, { "hamatonbetsu.hokkaido.jp", Normal },
+		{ "hidaka.hokkaido.jp", Normal }, { "higashikagura.hokkaido.jp", Normal }, { "higashikawa.hokkaido.jp", Normal },
+		{ "hiroo.hokkaido.jp", Normal }, { "hokuryu.hokkaido.jp", Normal }, { "hokuto.hokkaido.jp", Normal },
+		{ "honbetsu.hokkaido.jp", Normal }, { "horokanai.hokkaido.jp", Normal }, { "horonobe.hokkaido.jp", Normal },
+		{ "ikeda.hokkaido.jp", Normal }, { "imakane.hokkaido.jp", Normal }, { "ishikari.hokkaido.jp", Normal },
+		{ "iwamizawa.hokkaido.jp", Normal }, { "iwanai.hokkaido.jp", Normal }, { "kamifurano.hokkaido.jp", Normal },
+		{ "kamikawa.hokkaido.jp", Normal }, { "kamishihoro.hokkaido.jp", Normal }, { "kamisunagawa.hokkaido.jp", Normal },
+		{ "kamoenai.hokkaido.jp", Normal }, { "kayabe.hokkaido.jp", Normal }, { "kembuchi.hokkaido.jp", Normal },
+		{ "kikonai.hokkaido.jp", Normal }, { "kimobetsu.hokkaido.jp", Normal }, { "kitahiroshima.hokkaido.jp", Normal },
+		{ "kitami.hokkaido.jp", Normal }, { "kiyosato.hokkaido.jp", Normal }, { "koshimizu.hokkaido.jp", Normal },
+		{ "kunneppu.hokkaido.jp", Normal }, { "kuriyama.hokkaido.jp", Normal }, { "kuromatsunai.hokkaido.jp", Normal },
+		{ "kushiro.hokkaido.jp", Normal }, { "kutchan.hokkaido.jp", Normal }, { "kyowa.hokkaido.jp", Normal },
+		{ "mashike.hokkaido.jp", Normal }, { "matsumae.hokkaido.jp", Normal }, { "mikasa.hokkaido.jp", Normal },
+		{ "minamifurano.hokkaido.jp", Normal }, { "mombetsu.hokkaido.jp", Normal }, { "moseushi.hokkaido.jp", Normal },
+		{ "mukawa.hokkaido.jp", Normal }, { "muroran.hokkaido.jp", Normal }, { "naie.hokkaido.jp", Normal },
+		{ "nakagawa.hokkaido.jp", Normal }, { "nakasatsunai.hokkaido.jp", Normal }, { "nakatombetsu.hokkaido.jp", Normal },
+		{ "nanae.hokkaido.jp", Normal }, { "nanporo.hokkaido.jp", Normal }, { "nayoro.hokkaido.jp", Normal },
+		{ "nemuro.hokkaido.jp", Normal }, { "niikappu.hokkaido.jp", Normal }, { "niki.hokkaido.jp", Normal },
+		{ "nishiokoppe.hokkaido.jp", Normal }, { "noboribetsu.hokkaido.jp", Normal }, { "numata.hokkaido.jp", Normal },
+		{ "obihiro.hokkaido.jp", Normal }, { "obira.hokkaido.jp", Normal }, { "oketo.hokkaido.jp", Normal },
+		{ "okoppe.hokkaido.jp", Normal }, { "otaru.hokkaido.jp", Normal }, { "otobe.hokkaido.jp", Normal },
+		{ "otofuke.hokkaido.jp", Normal }, { "otoineppu.hokkaido.jp", Normal }, { "oumu.hokkaido.jp", Normal },
+		{ "ozora.hokkaido.jp", Normal }, { "pippu.hokkaido.jp", Normal }, { "rankoshi.hokkaido.jp", Normal },
+		{ "rebun.hokkaido.jp", Normal }, { "rikubetsu.hokkaido.jp", Normal }, { "rishiri.hokkaido.jp", Normal },
+		{ "rishirifuji.hokkaido.jp", Normal }, { "saroma.hokkaido.jp", Normal }, { "sarufutsu.hokkaido.jp", Normal },
+		{ "shakotan.hokkaido.jp", Normal }, { "shari.hokkaido.jp", Normal }, { "shibecha.hokkaido.jp", Normal },
+		{ "shibetsu.hokkaido.jp", Normal }, { "shikabe.hokkaido.jp", Normal }, { "shikaoi.hokkaido.jp", Normal },
+		{ "shimamaki.hokkaido.jp", Normal }, { "shimizu.hokkaido.jp", Normal }, { "shimokawa.hokkaido.jp", Normal },
+		{ "shinshinotsu.hokkaido.jp", Normal }, { "shintoku.hokkaido.jp", Normal }, { "shiranuka.hokkaido.jp", Normal },
+		{ "shiraoi.hokkaido.jp", Normal }, { "shiriuchi.hokkaido.jp", Normal }, { "sobetsu.hokkaido.jp", Normal },
+		{ "sunagawa.hokkaido.jp", Normal }, { "taiki.hokkaido.jp", Normal }, { "takasu.hokkaido.jp", Normal },
+		{ "takikawa.hokkaido.jp", Normal }, { "takinoue.hokkaido.jp", Normal }, { "teshikaga.hokkaido.jp", Normal },
+		{ "tobetsu.hokkaido.jp", Normal }, { "tohma.hokkaido.jp", Normal }, { "tomakomai.hokkaido.jp", Normal },
+		{ "tomari.hokkaido.jp", Normal }, { "toya.hokkaido.jp", Normal }, { "toyako.hokkaido.jp", Normal },
+		{ "toyotomi.hokkaido.jp", Normal }, { "toyoura.hokkaido.jp", Normal }, { "tsubetsu.hokkaido.jp", Normal },
+		{ "tsukigata.hokkaido.jp", Normal }, { "urakawa.hokkaido.jp", Normal }, { "urausu.hokkaido.jp", Normal },
+		{ "uryu.hokkaido.jp", Normal }, { "utashinai.hokkaido.jp", Normal }, { "wakkanai.hokkaido.jp", Normal },
+		{ "wassamu.hokkaido.jp", Normal }, { "yakumo.hokkaido.jp", Normal }, { "yoichi.hokkaido.jp", Normal },
+		{ "aioi.hyogo.jp", Normal }, { "akashi.hyogo.jp", Normal }, { "ako.hyogo.jp", Normal },
+		{ "amagasaki.hyogo.jp", Normal }, { "aogaki.hyogo.jp", Normal }, { "asago.hyogo.jp", Normal },
+		{ "ashiya.hyogo.jp", Normal }, { "awaji.hyogo.jp", Normal }, { "fukusaki.hyogo.jp", Normal },
+		{ "goshiki.hyogo.jp", Normal }, { "harima.hyogo.jp", Normal }, { "himeji.hyogo.jp", Normal },
+		{ "ichikawa.hyogo.jp", Normal }, { "inagawa.hyogo.jp", Normal }, { "itami.hyogo.jp", Normal },
+		{ "kakogawa.hyogo.jp", Normal }, { "kamigori.hyogo.jp", Normal }, { "kamikawa.hyogo.jp", Normal },
+		{ "kasai.hyogo.jp", Normal }, { "kasuga.hyogo.jp", Normal }, { "kawanishi.hyogo.jp", Normal },
+		{ "miki.hyogo.jp", Normal }, { "minamiawaji.hyogo.jp", Normal }, { "nishinomiya.hyogo.jp", Normal },
+		{ "nishiwaki.hyogo.jp", Normal }, { "ono.hyogo.jp", Normal }, { "sanda.hyogo.jp", Normal },
+		{ "sannan.hyogo.jp", Normal }, { "sasayama.hyogo.jp", Normal }, { "sayo.hyogo.jp", Normal },
+		{ "shingu.hyogo.jp", Normal }, { "shinonsen.hyogo.jp", Normal }, { "shiso.hyogo.jp", Normal },
+		{ "sumoto.hyogo.jp", Normal }, { "taishi.hyogo.jp", Normal }, { "taka.hyogo.jp", Normal },
+		{ "takarazuka.hyogo.jp", Normal }, { "takasago.hyogo.jp", Normal }, { "takino.hyogo.jp", Normal },
+		{ "tamba.hyogo.jp", Normal }, { "tatsuno.hyogo.jp", Normal }, { "toyooka.hyogo.jp", Normal },
+		{ "yabu.hyogo.jp", Normal }, { "yashiro.hyogo.jp", Normal }, { "yoka.hyogo.jp", Normal },
+		{ "yokawa.hyogo.jp", Normal }, { "ami.ibaraki.jp", Normal }, { "asahi.ibaraki.jp", Normal },
+		{ "bando.ibaraki.jp", Normal }, { "chikusei.ibaraki.jp", Normal }, { "daigo.ibaraki.jp", Normal },
+		{ "fujishiro.ibaraki.jp", Normal }, { "hitachi.ibaraki.jp", Normal }, { "hitachinaka.ibaraki.jp", Normal },
+		{ "hitachiomiya.ibaraki.jp", Normal }, { "hitachiota.ibaraki.jp", Normal }, { "ibaraki.ibaraki.jp", Normal },
+		{ "ina.ibaraki.jp", Normal }, { "inashiki.ibaraki.jp", Normal }, { "itako.ibaraki.jp", Normal },
+		{ "iwama.ibaraki.jp", Normal }, { "joso.ibaraki.jp", Normal }, { "kamisu.ibaraki.jp", Normal },
+		{ "kasama.ibaraki.jp", Normal }, { "kashima.ibaraki.jp", Normal }, { "kasumigaura.ibaraki.jp", Normal },
+		{ "koga.ibaraki.jp", Normal }, { "miho.ibaraki.jp", Normal }, { "mito.ibaraki.jp", Normal },
+		{ "moriya.ibaraki.jp", Normal }, { "naka.ibaraki.jp", Normal }, { "namegata.ibaraki.jp", Normal },
+		{ "oarai.ibaraki.jp", Normal }, { "ogawa.ibaraki.jp", Normal }, { "omitama.ibaraki.jp", Normal },
+		{ "ryugasaki.ibaraki.jp", Normal }, { "sakai.ibaraki.jp", Normal }, { "sakuragawa.ibaraki.jp", Normal },
+		{ "shimodate.ibaraki.jp", Normal }, { "shimotsuma.ibaraki.jp", Normal }, { "shirosato.ibaraki.jp", Normal },
+		{ "sowa.ibaraki.jp", Normal }, { "suifu.ibaraki.jp", Normal }, { "takahagi.ibaraki.jp", Normal },
+		{ "tamatsukuri.ibaraki.jp", Normal }, { "tokai.ibaraki.jp", Normal }, { "tomobe.ibaraki.jp", Normal },
+		{ "tone.ibaraki.jp", Normal }, { "toride.ibaraki.jp", Normal }, { "tsuchiura.ibaraki.jp", Normal },
+		{ "tsukuba.ibaraki.jp", Normal }, { "uchihara.ibaraki.jp", Normal }, { "ushiku.ibaraki.jp", Normal },
+		{ "yachiyo.ibaraki.jp", Normal }, { "yamagata.ibaraki.jp", Normal }, { "yawara.ibaraki.jp", Normal },
+		{ "yuki.ibaraki.jp", Normal }, { "anamizu.ishikawa.jp", Normal }, { "hakui.ishikawa.jp", Normal },
+		{ "hakusan.ishikawa.jp", Normal }, { "kaga.ishikawa.jp", Normal }, { "kahoku.ishikawa.jp", Normal },
+		{ "kanazawa.ishikawa.jp", Normal }, { "kawakita.ishikawa.jp", Normal }, { "komatsu.ishikawa.jp", Normal },
+		{ "nakanoto.ishikawa.jp", Normal }, { "nanao.ishikawa.jp", Normal }, { "nomi.ishikawa.jp", Normal },
+		{ "nonoichi.ishikawa.jp", Normal }, { "noto.ishikawa.jp", Normal }, { "shika.ishikawa.jp", Normal },
+		{ "suzu.ishikawa.jp", Normal }, { "tsubata.ishikawa.jp", Normal }, { "tsurugi.ishikawa.jp", Normal },
+		{ "uchinada.ishikawa.jp", Normal }, { "wajima.ishikawa.jp", Normal }, { "fudai.iwate.jp", Normal },
+		{ "fujisawa.iwate.jp", Normal }, { "hanamaki.iwate.jp", Normal }, { "hiraizumi.iwate.jp", Normal },
+		{ "hirono.iwate.jp", Normal }, { "ichinohe.iwate.jp", Normal }, { "ichinoseki.iwate.jp", Normal },
+		{ "iwaizumi.iwate.jp", Normal }, { "iwate.iwate.jp", Normal }, { "joboji.iwate.jp", Normal },
+		{ "kamaishi.iwate.jp", Normal }, { "kanegasaki.iwate.jp", Normal }, { "karumai.iwate.jp", Normal },
+		{ "kawai.iwate.jp", Normal }, { "kitakami.iwate.jp", Normal }, { "kuji.iwate.jp", Normal },
+		{ "kunohe.iwate.jp", Normal }, { "kuzumaki.iwate.jp", Normal }, { "miyako.iwate.jp", Normal },
+		{ "mizusawa.iwate.jp", Normal }, { "morioka.iwate.jp", Normal }, { "ninohe.iwate.jp", Normal },
+		{ "noda.iwate.jp", Normal }, { "ofunato.iwate.jp", Normal }, { "oshu.iwate.jp", Normal },
+		{ "otsuchi.iwate.jp", Normal }, { "rikuzentakata.iwate.jp", Normal }, { "shiwa.iwate.jp", Normal },
+		{ "shizukuishi.iwate.jp", Normal }, { "sumita.iwate.jp", Normal }, { "tanohata.iwate.jp", Normal },
+		{ "tono.iwate.jp", Normal }, { "yahaba.iwate.jp", Normal }, { "yamada.iwate.jp", Normal },
+		{ "ayagawa.kagawa.jp", Normal }, { "higashikagawa.kagawa.jp", Normal }, { "kanonji.kagawa.jp", Normal },
+		{ "kotohira.kagawa.jp", Normal }, { "manno.kagawa.jp", Normal }, { "marugame.kagawa.jp", Normal },
+		{ "mitoyo.kagawa.jp", Normal }, { "naoshima.kagawa.jp", Normal }, { "sanuki.kagawa.jp", Normal },
+		{ "tadotsu.kagawa.jp", Normal }, { "takamatsu.kagawa.jp", Normal }, { "tonosho.kagawa.jp", Normal },
+		{ "uchinomi.kagawa.jp", Normal }, { "utazu.kagawa.jp", Normal }, { "zentsuji.kagawa.jp", Normal },
+		{ "akune.kagoshima.jp", Normal }, { "amami.kagoshima.jp", Normal }, { "hioki.kagoshima.jp", Normal },
+		{ "isa.kagoshima.jp", Normal }, { "isen.kagoshima.jp", Normal }, { "izumi.kagoshima.jp", Normal },
+		{ "kagoshima.kagoshima.jp", Normal }, { "kanoya.kagoshima.jp", Normal }, { "kawanabe.kagoshima.jp", Normal },
+		{ "kinko.kagoshima.jp", Normal }, { "kouyama.kagoshima.jp", Normal }, { "makurazaki.kagoshima.jp", Normal },
+		{ "matsumoto.kagoshima.jp", Normal }, { "minamitane.kagoshima.jp", Normal }, { "nakatane.kagoshima.jp", Normal },
+		{ "nishinoomote.kagoshima.jp", Normal }, { "satsumasendai.kagoshima.jp", Normal }, { "soo.kagoshima.jp", Normal },
+		{ "tarumizu.kagoshima.jp", Normal }, { "yusui.kagoshima.jp", Normal }, { "aikawa.kanagawa.jp", Normal },
+		{ "atsugi.kanagawa.jp", Normal }, { "ayase.kanagawa.jp", Normal }, { "chigasaki.kanagawa.jp", Normal },
+		{ "ebina.kanagawa.jp", Normal }, { "fujisawa.kanagawa.jp", Normal }, { "hadano.kanagawa.jp", Normal },
+		{ "hakone.kanagawa.jp", Normal }, { "hiratsuka.kanagawa.jp", Normal }, { "isehara.kanagawa.jp", Normal },
+		{ "kaisei.kanagawa.jp", Normal }, { "kamakura.kanagawa.jp", Normal }, { "kiyokawa.kanagawa.jp", Normal },
+		{ "matsuda.kanagawa.jp", Normal }, { "minamiashigara.kanagawa.jp", Normal }, { "miura.kanagawa.jp", Normal },
+		{ "nakai.kanagawa.jp", Normal }, { "ninomiya.kanagawa.jp", Normal }, { "odawara.kanagawa.jp", Normal },
+		{ "oi.kanagawa.jp", Normal }, { "oiso.kanagawa.jp", Normal }, { "sagamihara.kanagawa.jp", Normal },
+		{ "samukawa.kanagawa.jp", Normal }, { "tsukui.kanagawa.jp", Normal }, { "yamakita.kanagawa.jp", Normal },
+		{ "yamato.kanagawa.jp", Normal }, { "yokosuka.kanagawa.jp", Normal }, { "yugawara.kanagawa.jp", Normal },
+		{ "zama.kanagawa.jp", Normal }, { "zushi.kanagawa.jp", Normal }, { "aki.kochi.jp", Normal },
+		{ "geisei.kochi.jp", Normal }, { "hidaka.kochi.jp", Normal }, { "higashitsuno.kochi.jp", Normal },
+		{ "ino.kochi.jp", Normal }, { "kagami.kochi.jp", Normal }, { "kami.kochi.jp", Normal },
+		{ "kitagawa.kochi.jp", Normal }, { "kochi.kochi.jp", Normal }, { "mihara.kochi.jp", Normal },
+		{ "motoyama.kochi.jp", Normal }, { "muroto.kochi.jp", Normal }, { "nahari.kochi.jp", Normal },
+		{ "nakamura.kochi.jp", Normal }, { "nankoku.kochi.jp", Normal }, { "nishitosa.kochi.jp", Normal },
+		{ "niyodogawa.kochi.jp", Normal }, { "ochi.kochi.jp", Normal }, { "okawa.kochi.jp", Normal },
+		{ "otoyo.kochi.jp", Normal }, { "otsuki.kochi.jp", Normal }, { "sakawa.kochi.jp", Normal },
+		{ "sukumo.kochi.jp", Normal }, { "susaki.kochi.jp", Normal }, { "tosa.kochi.jp", Normal },
+		{ "tosashimizu.kochi.jp", Normal }, { "toyo.kochi.jp", Normal }, { "tsuno.kochi.jp", Normal },
+		{ "umaji.kochi.jp", Normal }, { "yasuda.kochi.jp", Normal }, { "yusuhara.kochi.jp", Normal },
+		{ "amakusa.kumamoto.jp", Normal }, { "arao.kumamoto.jp", Normal }, { "aso.kumamoto.jp", Normal },
+		{ "choyo.kumamoto.jp", Normal }, { "gyokuto.kumamoto.jp", Normal }, { "kamiamakusa.kumamoto.jp", Normal },
+		{ "kikuchi.kumamoto.jp", Normal }, { "kumamoto.kumamoto.jp", Normal }, { "mashiki.kumamoto.jp", Normal },
+		{ "mifune.kumamoto.jp", Normal }, { "minamata.kumamoto.jp", Normal }, { "minamioguni.kumamoto.jp", Normal },
+		{ "nagasu.kumamoto.jp", Normal }, { "nishihara.kumamoto.jp", Normal }, { "oguni.kumamoto.jp", Normal },
+		{ "ozu.kumamoto.jp", Normal }, { "sumoto.kumamoto.jp", Normal }, { "takamori.kumamoto.jp", Normal },
+		{ "uki.kumamoto.jp", Normal }, { "uto.kumamoto.jp", Normal }, { "yamaga.kumamoto.jp", Normal },
+		{ "yamato.kumamoto.jp", Normal }, { "yatsushiro.kumamoto.jp", Normal }, { "ayabe.kyoto.jp", Normal },
+		{ "fukuchiyama.kyoto.jp", Normal }, { "higashiyama.kyoto.jp", Normal }, { "ide.kyoto.jp", Normal },
+		{ "ine.kyoto.jp", Normal }, { "joyo.kyoto.jp", Normal }, { "kameoka.kyoto.jp", Normal },
+		{ "kamo.kyoto.jp", Normal }, { "kita.kyoto.jp", Normal }, { "kizu.kyoto.jp", Normal },
+		{ "kumiyama.kyoto.jp", Normal }, { "kyotamba.kyoto.jp", Normal }, { "kyotanabe.kyoto.jp", Normal },
+		{ "kyotango.kyoto.jp", Normal }, { "maizuru.kyoto.jp", Normal }, { "minami.kyoto.jp", Normal },
+		{ "minamiyamashiro.kyoto.jp", Normal }, { "miyazu.kyoto.jp", Normal }, { "muko.kyoto.jp", Normal },
+		{ "nagaokakyo.kyoto.jp", Normal }, { "nakagyo.kyoto.jp", Normal }, { "nantan.kyoto.jp", Normal },
+		{ "oyamazaki.kyoto.jp", Normal }, { "sakyo.kyoto.jp", Normal }, { "seika.kyoto.jp", Normal },
+		{ "tanabe.kyoto.jp", Normal }, { "uji.kyoto.jp", Normal }, { "ujitawara.kyoto.jp", Normal },
+		{ "wazuka.kyoto.jp", Normal }, { "yamashina.kyoto.jp", Normal }, { "yawata.kyoto.jp", Normal },
+		{ "asahi.mie.jp", Normal }, { "inabe.mie.jp", Normal }, { "ise.mie.jp", Normal }, { "kameyama.mie.jp", Normal },
+		{ "kawagoe.mie.jp", Normal }, { "kiho.mie.jp", Normal }, { "kisosaki.mie.jp", Normal }, { "kiwa.mie.jp", Normal },
+		{ "komono.mie.jp", Normal }, { "kumano.mie.jp", Normal }, { "kuwana.mie.jp", Normal },
+		{ "matsusaka.mie.jp", Normal }, { "meiwa.mie.jp", Normal }, { "mihama.mie.jp", Normal },
+		{ "minamiise.mie.jp", Normal }, { "misugi.mie.jp", Normal }, { "miyama.mie.jp", Normal },
+		{ "nabari.mie.jp", Normal }, { "shima.mie.jp", Normal }, { "suzuka.mie.jp", Normal }, { "tado.mie.jp", Normal },
+		{ "taiki.mie.jp", Normal }, { "taki.mie.jp", Normal }, { "tamaki.mie.jp", Normal }, { "toba.mie.jp", Normal },
+		{ "tsu.mie.jp", Normal }, { "udono.mie.jp", Normal }, { "ureshino.mie.jp", Normal }, { "watarai.mie.jp", Normal },
+		{ "yokkaichi.mie.jp", Normal }, { "furukawa.miyagi.jp", Normal }, { "higashimatsushima.miyagi.jp", Normal },
+		{ "ishinomaki.miyagi.jp", Normal }, { "iwanuma.miyagi.jp", Normal }, { "kakuda.miyagi.jp", Normal },
+		{ "kami.miyagi.jp", Normal }, { "kawasaki.miyagi.jp", Normal }, { "marumori.miyagi.jp", Normal },
+		{ "matsushima.miyagi.jp", Normal }, { "minamisanriku.miyagi.jp", Normal }, { "misato.miyagi.jp", Normal },
+		{ "murata.miyagi.jp", Normal }, { "natori.miyagi.jp", Normal }, { "ogawara.miyagi.jp", Normal },
+		{ "ohira.miyagi.jp", Normal }, { "onagawa.miyagi.jp", Normal }, { "osaki.miyagi.jp", Normal },
+		{ "rifu.miyagi.jp", Normal }, { "semine.miyagi.jp", Normal }, { "shibata.miyagi.jp", Normal },
+		{ "shichikashuku.miyagi.jp", Normal }, { "shikama.miyagi.jp", Normal }, { "shiogama.miyagi.jp", Normal },
+		{ "shiroishi.miyagi.jp", Normal }, { "tagajo.miyagi.jp", Normal }, { "taiwa.miyagi.jp", Normal },
+		{ "tome.miyagi.jp", Normal }, { "tomiya.miyagi.jp", Normal }, { "wakuya.miyagi.jp", Normal },
+		{ "watari.miyagi.jp", Normal }, { "yamamoto.miyagi.jp", Normal }, { "zao.miyagi.jp", Normal },
+		{ "aya.miyazaki.jp", Normal }, { "ebino.miyazaki.jp", Normal }, { "gokase.miyazaki.jp", Normal },
+		{ "hyuga.miyazaki.jp", Normal }, { "kadogawa.miyazaki.jp", Normal }, { "kawaminami.miyazaki.jp", Normal },
+		{ "kijo.miyazaki.jp", Normal }, { "kitagawa.miyazaki.jp", Normal }, { "kitakata.miyazaki.jp", Normal },
+		{ "kitaura.miyazaki.jp", Normal }, { "kobayashi.miyazaki.jp", Normal }, { "kunitomi.miyazaki.jp", Normal },
+		{ "kushima.miyazaki.jp", Normal }, { "mimata.miyazaki.jp", Normal }, { "miyakonojo.miyazaki.jp", Normal },
+		{ "miyazaki.miyazaki.jp", Normal }, { "morotsuka.miyazaki.jp", Normal }, { "nichinan.miyazaki.jp", Normal },
+		{ "nishimera.miyazaki.jp", Normal }, { "nobeoka.miyazaki.jp", Normal }, { "saito.miyazaki.jp", Normal },
+		{ "shiiba.miyazaki.jp", Normal }, { "shintomi.miyazaki.jp", Normal }, { "takaharu.miyazaki.jp", Normal },
+		{ "takanabe.miyazaki.jp", Normal }, { "takazaki.miyazaki.jp", Normal }, { "tsuno.miyazaki.jp", Normal },
+		{ "achi.nagano.jp", Normal }, { "agematsu.nagano.jp", Normal }, { "anan.nagano.jp", Normal },
+		{ "aoki.nagano.jp", Normal }, { "asahi.nagano.jp", Normal }, { "azumino.nagano.jp", Normal },
+		{ "chikuhoku.nagano.jp", Normal }, { "chikuma.nagano.jp", Normal }, { "chino.nagano.jp", Normal },
+		{ "fujimi.nagano.jp", Normal }, { "hakuba.nagano.jp", Normal }, { "hara.nagano.jp", Normal },
+		{ "hiraya.nagano.jp", Normal }, { "iida.nagano.jp", Normal }, { "iijima.nagano.jp", Normal },
+		{ "iiyama.nagano.jp", Normal }, { "iizuna.nagano.jp", Normal }, { "ikeda.nagano.jp", Normal },
+		{ "ikusaka.nagano.jp", Normal }, { "ina.nagano.jp", Normal }, { "karuizawa.nagano.jp", Normal },
+		{ "kawakami.nagano.jp", Normal }, { "kiso.nagano.jp", Normal }, { "kisofukushima.nagano.jp", Normal },
+		{ "kitaaiki.nagano.jp", Normal }, { "komagane.nagano.jp", Normal }, { "komoro.nagano.jp", Normal },
+		{ "matsukawa.nagano.jp", Normal }, { "matsumoto.nagano.jp", Normal }, { "miasa.nagano.jp", Normal },
+		{ "minamiaiki.nagano.jp", Normal }, { "minamimaki.nagano.jp", Normal }, { "minamiminowa.nagano.jp", Normal },
+		{ "minowa.nagano.jp", Normal }, { "miyada.nagano.jp", Normal }, { "miyota.nagano.jp", Normal },
+		{ "mochizuki.nagano.jp", Normal }, { "nagano.nagano.jp", Normal }, { "nagawa.nagano.jp", Normal },
+		{ "nagiso.nagano.jp", Normal }, { "nakagawa.nagano.jp", Normal }, { "nakano.nagano.jp", Normal },
+		{ "nozawaonsen.nagano.jp", Normal }, { "obuse.nagano.jp", Normal }, { "ogawa.nagano.jp", Normal },
+		{ "okaya.nagano.jp", Normal }, { "omachi.nagano.jp", Normal }, { "omi.nagano.jp", Normal },
+		{ "ookuwa.nagano.jp", Normal }, { "ooshika.nagano.jp", Normal }, { "otaki.nagano.jp", Normal },
+		{ "otari.nagano.jp", Normal }, { "sakae.nagano.jp", Normal }, { "sakaki.nagano.jp", Normal },
+		{ "saku.nagano.jp", Normal }, { "sakuho.nagano.jp", Normal }, { "shimosuwa.nagano.jp", Normal },
+		{ "shinanomachi.nagano.jp", Normal }, { "shiojiri.nagano.jp", Normal }, { "suwa.nagano.jp", Normal },
+		{ "suzaka.nagano.jp", Normal }, { "takagi.nagano.jp", Normal }, { "takamori.nagano.jp", Normal },
+		{ "takayama.nagano.jp", Normal }, { "tateshina.nagano.jp", Normal }, { "tatsuno.nagano.jp", Normal },
+		{ "togakushi.nagano.jp", Normal }, { "togura.nagano.jp", Normal }, { "tomi.nagano.jp", Normal },
+		{ "ueda.nagano.jp", Normal }, { "wada.nagano.jp", Normal }, { "yamagata.nagano.jp", Normal },
+		{ "yamanouchi.nagano.jp", Normal }, { "yasaka.nagano.jp", Normal }, { "yasuoka.nagano.jp", Normal },
+		{ "chijiwa.nagasaki.jp", Normal }, { "futsu.nagasaki.jp", Normal }, { "goto.nagasaki.jp", Normal },
+		{ "hasami.nagasaki.jp", Normal }, { "hirado.nagasaki.jp", Normal }, { "iki.nagasaki.jp", Normal },
+		{ "isahaya.nagasaki.jp", Normal }, { "kawatana.nagasaki.jp", Normal }, { "kuchinotsu.nagasaki.jp", Normal },
+		{ "matsuura.nagasaki.jp", Normal }, { "nagasaki.nagasaki.jp", Normal }, { "obama.nagasaki.jp", Normal },
+		{ "omura.nagasaki.jp", Normal }, { "oseto.nagasaki.jp", Normal }, { "saikai.nagasaki.jp", Normal },
+		{ "sasebo.nagasaki.jp", Normal }, { "seihi.nagasaki.jp", Normal }, { "shimabara.nagasaki.jp", Normal },
+		{ "shinkamigoto.nagasaki.jp", Normal }, { "togitsu.nagasaki.jp", Normal }, { "tsushima.nagasaki.jp", Normal },
+		{ "unzen.nagasaki.jp", Normal }, { "ando.nara.jp", Normal }, { "gose.nara.jp", Normal },
+		{ "heguri.nara.jp", Normal }, { "higashiyoshino.nara.jp", Normal }, { "ikaruga.nara.jp", Normal },
+		{ "ikoma.nara.jp", Normal }, { "kamikitayama.nara.jp", Normal }, { "kanmaki.nara.jp", Normal },
+		{ "kashiba.nara.jp", Normal }, { "kashihara.nara.jp", Normal }, { "katsuragi.nara.jp", Normal },
+		{ "kawai.nara.jp", Normal }, { "kawakami.nara.jp", Normal }, { "kawanishi.nara.jp", Normal },
+		{ "koryo.nara.jp", Normal }, { "kurotaki.nara.jp", Normal }, { "mitsue.nara.jp", Normal },
+		{ "miyake.nara.jp", Normal }, { "nara.nara.jp", Normal }, { "nosegawa.nara.jp", Normal }, { "oji.nara.jp", Normal },
+		{ "ouda.nara.jp", Normal }, { "oyodo.nara.jp", Normal }, { "sakurai.nara.jp", Normal }, { "sango.nara.jp", Normal },
+		{ "shimoichi.nara.jp", Normal }, { "shimokitayama.nara.jp", Normal }, { "shinjo.nara.jp", Normal },
+		{ "soni.nara.jp", Normal }, { "takatori.nara.jp", Normal }, { "tawaramoto.nara.jp", Normal },
+		{ "tenkawa.nara.jp", Normal }, { "tenri.nara.jp", Normal }, { "uda.nara.jp", Normal },
+		{ "yamatokoriyama.nara.jp", Normal }, { "yamatotakada.nara.jp", Normal }, { "yamazoe.nara.jp", Normal },
+		{ "yoshino.nara.jp", Normal }, { "aga.niigata.jp", Normal }, { "agano.niigata.jp", Normal },
+		{ "gosen.niigata.jp", Normal }, { "itoigawa.niigata.jp", Normal }, { "izumozaki.niigata.jp", Normal },
+		{ "joetsu.niigata.jp", Normal }, { "kamo.niigata.jp", Normal }, { "kariwa.niigata.jp", Normal },
+		{ "kashiwazaki.niigata.jp", Normal }, { "minamiuonuma.niigata.jp", Normal }, { "mitsuke.niigata.jp", Normal },
+		{ "muika.niigata.jp", Normal }, { "murakami.niigata.jp", Normal }, { "myoko.niigata.jp", Normal },
+		{ "nagaoka.niigata.jp", Normal }, { "niigata.niigata.jp", Normal }, { "ojiya.niigata.jp", Normal },
+		{ "omi.niigata.jp", Normal }, { "sado.niigata.jp", Normal }, { "sanjo.niigata.jp", Normal },
+		{ "seiro.niigata.jp", Normal }, { "seirou.niigata.jp", Normal }, { "sekikawa.niigata.jp", Normal },
+		{ "shibata.niigata.jp", Normal }, { "tagami.niigata.jp", Normal }, { "tainai.niigata.jp", Normal },
+		{ "tochio.niigata.jp", Normal }, { "tokamachi.niigata.jp", Normal }, { "tsubame.niigata.jp", Normal },
+		{ "tsunan.niigata.jp", Normal }, { "uonuma.niigata.jp", Normal }, { "yahiko.niigata.jp", Normal },
+		{ "yoita.niigata.jp", Normal }, { "yuzawa.niigata.jp", Normal }, { "beppu.oita.jp", Normal },
+		{ "bungoono.oita.jp", Normal }, { "bungotakada.oita.jp", Normal }, { "hasama.oita.jp", Normal },
+		{ "hiji.oita.jp", Normal }, { "himeshima.oita.jp", Normal }, { "hita.oita.jp", Normal },
+		{ "kamitsue.oita.jp", Normal }, { "kokonoe.oita.jp", Normal }, { "kuju.oita.jp", Normal },
+		{ "kunisaki.oita.jp", Normal }, { "kusu.oita.jp", Normal }, { "oita.oita.jp", Normal }, { "saiki.oita.jp", Normal },
+		{ "taketa.oita.jp", Normal }, { "tsukumi.oita.jp", Normal }, { "usa.oita.jp", Normal }, { "usuki.oita.jp", Normal },
+		{ "yufu.oita.jp", Normal }, { "akaiwa.okayama.jp", Normal }, { "asakuchi.okayama.jp", Normal },
+		{ "bizen.okayama.jp", Normal }, { "hayashima.okayama.jp", Normal }, { "ibara.okayama.jp", Normal },
+		{ "kagamino.okayama.jp", Normal }, { "kasaoka.okayama.jp", Normal }, { "kibichuo.okayama.jp", Normal },
+		{ "kumenan.okayama.jp", Normal }, { "kurashiki.okayama.jp", Normal }, { "maniwa.okayama.jp", Normal },
+		{ "misaki.okayama.jp", Normal }, { "nagi.okayama.jp", Normal }, { "niimi.okayama.jp", Normal },
+		{ "nishiawakura.okayama.jp", Normal }, { "okayama.okayama.jp", Normal }, { "satosho.okayama.jp", Normal },
+		{ "setouchi.okayama.jp", Normal }, { "shinjo.okayama.jp", Normal }, { "shoo.okayama.jp", Normal },
+		{ "soja.okayama.jp", Normal }, { "takahashi.okayama.jp", Normal }, { "tamano.okayama.jp", Normal },
+		{ "tsuyama.okayama.jp", Normal }, { "wake.okayama.jp", Normal }, { "yakage.okayama.jp", Normal },
+		{ "aguni.okinawa.jp", Normal }, { "ginowan.okinawa.jp", Normal }, { "ginoza.okinawa.jp", Normal },
+		{ "gushikami.okinawa.jp", Normal }, { "haebaru.okinawa.jp", Normal }, { "higashi.okinawa.jp", Normal },
+		{ "hirara.okinawa.jp", Normal }, { "iheya.okinawa.jp", Normal }, { "ishigaki.okinawa.jp", Normal },
+		{ "ishikawa.okinawa.jp", Normal }, { "itoman.okinawa.jp", Normal }, { "izena.okinawa.jp", Normal },
+		{ "kadena.okinawa.jp", Normal }, { "kin.okinawa.jp", Normal }, { "kitadaito.okinawa.jp", Normal },
+		{ "kitanakagusuku.okinawa.jp", Normal }, { "kumejima.okinawa.jp", Normal }, { "kunigami.okinawa.jp", Normal },
+		{ "minamidaito.okinawa.jp", Normal }, { "motobu.okinawa.jp", Normal }, { "nago.okinawa.jp", Normal },
+		{ "naha.okinawa.jp", Normal }, { "nakagusuku.okinawa.jp", Normal }, { "nakijin.okinawa.jp", Normal },
+		{ "nanjo.okinawa.jp", Normal }, { "nishihara.okinawa.jp", Normal }, { "ogimi.okinawa.jp", Normal },
+		{ "okinawa.okinawa.jp", Normal }, { "onna.okinawa.jp", Normal }, { "shimoji.okinawa.jp", Normal },
+		{ "taketomi.okinawa.jp", Normal }, { "tarama.okinawa.jp", Normal }, { "tokashiki.okinawa.jp", Normal },
+		{ "tomigusuku.okinawa.jp", Normal }, { "tonaki.okinawa.jp", Normal }, { "urasoe.okinawa.jp", Normal },
+		{ "uruma.okinawa.jp", Normal }, { "yaese.okinawa.jp", Normal }, { "yomitan.okinawa.jp", Normal },
+		{ "yonabaru.okinawa.jp", Normal }, { "yonaguni.okinawa.jp", Normal }, { "zamami.okinawa.jp", Normal },
+		{ "abeno.osaka.jp", Normal }, { "chihayaakasaka.osaka.jp", Normal }, { "chuo.osaka.jp", Normal },
+		{ "daito.osaka.jp", Normal }, { "fujiidera.osaka.jp", Normal }, { "habikino.osaka.jp", Normal },
+		{ "hannan.osaka.jp", Normal }, { "higashiosaka.osaka.jp", Normal }, { "higashisumiyoshi.osaka.jp", Normal },
+		{ "higashiyodogawa.osaka.jp", Normal }, { "hirakata.osaka.jp", Normal }, { "ibaraki.osaka.jp", Normal },
+		{ "ikeda.osaka.jp", Normal }, { "izumi.osaka.jp", Normal }, { "izumiotsu.osaka.jp", Normal },
+		{ "izumisano.osaka.jp", Normal }, { "kadoma.osaka.jp", Normal }, { "kaizuka.osaka.jp", Normal },
+		{ "kanan.osaka.jp", Normal }, { "kashiwara.osaka.jp", Normal }, { "katano.osaka.jp", Normal },
+		{ "kawachinagano.osaka.jp", Normal }, { "kishiwada.osaka.jp", Normal }, { "kita.osaka.jp", Normal },
+		{ "kumatori.osaka.jp", Normal }, { "matsubara.osaka.jp", Normal }, { "minato.osaka.jp", Normal },
+		{ "minoh.osaka.jp", Normal }, { "misaki.osaka.jp", Normal }, { "moriguchi.osaka.jp", Normal },
+		{ "neyagawa.osaka.jp", Normal }, { "nishi.osaka.jp", Normal }, { "nose.osaka.jp", Normal },
+		{ "osakasayama.osaka.jp", Normal }, { "sakai.osaka.jp", Normal }, { "sayama.osaka.jp", Normal },
+		{ "sennan.osaka.jp", Normal }, { "settsu.osaka.jp", Normal }, { "shijonawate.osaka.jp", Normal },
+		{ "shimamoto.osaka.jp", Normal }, { "suita.osaka.jp", Normal }, { "tadaoka.osaka.jp", Normal },
+		{ "taishi.osaka.jp", Normal }, { "tajiri.osaka.jp", Normal }, { "takaishi.osaka.jp", Normal },
+		{ "takatsuki.osaka.jp", Normal }, { "tondabayashi.osaka.jp", Normal }, { "toyonaka.osaka.jp", Normal },
+		{ "toyono.osaka.jp", Normal }, { "yao.osaka.jp", Normal }, { "ariake.saga.jp", Normal },
+		{ "arita.saga.jp", Normal }, { "fukudomi.saga.jp", Normal }, { "genkai.saga.jp", Normal },
+		{ "hamatama.saga.jp", Normal }, { "hizen.saga.jp", Normal }, { "imari.saga.jp", Normal },
+		{ "kamimine.saga.jp", Normal }, { "kanzaki.saga.jp", Normal }, { "karatsu.saga.jp", Normal },
+		{ "kashima.saga.jp", Normal }, { "kitagata.saga.jp", Normal }, { "kitahata.saga.jp", Normal },
+		{ "kiyama.saga.jp", Normal }, { "kouhoku.saga.jp", Normal }, { "kyuragi.saga.jp", Normal },
+		{ "nishiarita.saga.jp", Normal }, { "ogi.saga.jp", Normal }, { "omachi.saga.jp", Normal },
+		{ "ouchi.saga.jp", Normal }, { "saga.saga.jp", Normal }, { "shiroishi.saga.jp", Normal },
+		{ "taku.saga.jp", Normal }, { "tara.saga.jp", Normal }, { "tosu.saga.jp", Normal },
+		{ "yoshinogari.saga.jp", Normal }, { "arakawa.saitama.jp", Normal }, { "asaka.saitama.jp", Normal },
+		{ "chichibu.saitama.jp", Normal }, { "fujimi.saitama.jp", Normal }, { "fujimino.saitama.jp", Normal },
+		{ "fukaya.saitama.jp", Normal }, { "hanno.saitama.jp", Normal }, { "hanyu.saitama.jp", Normal },
+		{ "hasuda.saitama.jp", Normal }, { "hatogaya.saitama.jp", Normal }, { "hatoyama.saitama.jp", Normal },
+		{ "hidaka.saitama.jp", Normal }, { "higashichichibu.saitama.jp", Normal },
+		{ "higashimatsuyama.saitama.jp", Normal }, { "honjo.saitama.jp", Normal }, { "ina.saitama.jp", Normal },
+		{ "iruma.saitama.jp", Normal }, { "iwatsuki.saitama.jp", Normal }, { "kamiizumi.saitama.jp", Normal },
+		{ "kamikawa.saitama.jp", Normal }, { "kamisato.saitama.jp", Normal }, { "kasukabe.saitama.jp", Normal },
+		{ "kawagoe.saitama.jp", Normal }, { "kawaguchi.saitama.jp", Normal }, { "kawajima.saitama.jp", Normal },
+		{ "kazo.saitama.jp", Normal }, { "kitamoto.saitama.jp", Normal }, { "koshigaya.saitama.jp", Normal },
+		{ "kounosu.saitama.jp", Normal }, { "kuki.saitama.jp", Normal }, { "kumagaya.saitama.jp", Normal },
+		{ "matsubushi.saitama.jp", Normal }, { "minano.saitama.jp", Normal }, { "misato.saitama.jp", Normal },
+		{ "miyashiro.saitama.jp", Normal }, { "miyoshi.saitama.jp", Normal }, { "moroyama.saitama.jp", Normal },
+		{ "nagatoro.saitama.jp", Normal }, { "namegawa.saitama.jp", Normal }, { "niiza.saitama.jp", Normal },
+		{ "ogano.saitama.jp", Normal }, { "ogawa.saitama.jp", Normal }, { "ogose.saitama.jp", Normal },
+		{ "okegawa.saitama.jp", Normal }, { "omiya.saitama.jp", Normal }, { "otaki.saitama.jp", Normal },
+		{ "ranzan.saitama.jp", Normal }, { "ryokami.saitama.jp", Normal }, { "saitama.saitama.jp", Normal },
+		{ "sakado.saitama.jp", Normal }, { "satte.saitama.jp", Normal }, { "sayama.saitama.jp", Normal },
+		{ "shiki.saitama.jp", Normal }, { "shiraoka.saitama.jp", Normal }, { "soka.saitama.jp", Normal },
+		{ "sugito.saitama.jp", Normal }, { "toda.saitama.jp", Normal }, { "tokigawa.saitama.jp", Normal },
+		{ "tokorozawa.saitama.jp", Normal }, { "tsurugashima.saitama.jp", Normal }, { "urawa.saitama.jp", Normal },
+		{ "warabi.saitama.jp", Normal }, { "yashio.saitama.jp", Normal }, { "yokoze.saitama.jp", Normal },
+		{ "yono.saitama.jp", Normal }, { "yorii.saitama.jp", Normal }, { "yoshida.saitama.jp", Normal },
+		{ "yoshikawa.saitama.jp", Normal }, { "yoshimi.saitama.jp", Normal }, { "aisho.shiga.jp", Normal },
+		{ "gamo.shiga.jp", Normal }, { "higashiomi.shiga.jp", Normal }, { "hikone.shiga.jp", Normal },
+		{ "koka.shiga.jp", Normal }, { "konan.shiga.jp", Normal }, { "kosei.shiga.jp", Normal },
+		{ "koto.shiga.jp", Normal }, { "kusatsu.shiga.jp", Normal }, { "maibara.shiga.jp", Normal },
+		{ "moriyama.shiga.jp", Normal }, { "nagahama.shiga.jp", Normal }, { "nishiazai.shiga.jp", Normal },
+		{ "notogawa.shiga.jp", Normal }, { "omihachiman.shiga.jp", Normal }, { "otsu.shiga.jp", Normal },
+		{ "ritto.shiga.jp", Normal }, { "ryuoh.shiga.jp", Normal }, { "takashima.shiga.jp", Normal },
+		{ "takatsuki.shiga.jp", Normal }, { "torahime.shiga.jp", Normal }, { "toyosato.shiga.jp", Normal },
+		{ "yasu.shiga.jp", Normal }, { "akagi.shimane.jp", Normal }, { "ama.shimane.jp", Normal },
+		{ "gotsu.shimane.jp", Normal }, { "hamada.shimane.jp", Normal }, { "higashiizumo.shimane.jp", Normal },
+		{ "hikawa.shimane.jp", Normal }, { "hikimi.shimane.jp", Normal }, { "izumo.shimane.jp", Normal },
+		{ "kakinoki.shimane.jp", Normal }, { "masuda.shimane.jp", Normal }, { "matsue.shimane.jp", Normal },
+		{ "misato.shimane.jp", Normal }, { "nishinoshima.shimane.jp", Normal }, { "ohda.shimane.jp", Normal },
+		{ "okinoshima.shimane.jp", Normal }, { "okuizumo.shimane.jp", Normal }, { "shimane.shimane.jp", Normal },
+		{ "tamayu.shimane.jp", Normal }, { "tsuwano.shimane.jp", Normal }, { "unnan.shimane.jp", Normal },
+		{ "yakumo.shimane.jp", Normal }, { "yasugi.shimane.jp", Normal }, { "yatsuka.shimane.jp", Normal },
+		{ "arai.shizuoka.jp", Normal }, { "atami.shizuoka.jp", Normal }, { "fuji.shizuoka.jp", Normal },
+		{ "fujieda.shizuoka.jp", Normal }, { "fujikawa.shizuoka.jp", Normal }, { "fujinomiya.shizuoka.jp", Normal },
+		{ "fukuroi.shizuoka.jp", Normal }, { "gotemba.shizuoka.jp", Normal }, { "haibara.shizuoka.jp", Normal },
+		{ "hamamatsu.shizuoka.jp", Normal }, { "higashiizu.shizuoka.jp", Normal }, { "ito.shizuoka.jp", Normal },
+		{ "iwata.shizuoka.jp", Normal }, { "izu.shizuoka.jp", Normal }, { "izunokuni.shizuoka.jp", Normal },
+		{ "kakegawa.shizuoka.jp", Normal }, { "kannami.shizuoka.jp", Normal }, { "kawanehon.shizuoka.jp", Normal },
+		{ "kawazu.shizuoka.jp", Normal }, { "kikugawa.shizuoka.jp", Normal }, { "kosai.shizuoka.jp", Normal },
+		{ "makinohara.shizuoka.jp", Normal }, { "matsuzaki.shizuoka.jp", Normal }, { "minamiizu.shizuoka.jp", Normal },
+		{ "mishima.shizuoka.jp", Normal }, { "morimachi.shizuoka.jp", Normal }, { "nishiizu.shizuoka.jp", Normal },
+		{ "numazu.shizuoka.jp", Normal }, { "omaezaki.shizuoka.jp", Normal }, { "shimada.shizuoka.jp", Normal },
+		{ "shimizu.shizuoka.jp", Normal }, { "shimoda.shizuoka.jp", Normal }, { "shizuoka.shizuoka.jp", Normal },
+		{ "susono.shizuoka.jp", Normal }, { "yaizu.shizuoka.jp", Normal }, { "yoshida.shizuoka.jp", Normal },
+		{ "ashikaga.tochigi.jp", Normal }, { "bato.tochigi.jp", Normal }, { "haga.tochigi.jp", Normal },
+		{ "ichikai.tochigi.jp", Normal }, { "iwafune.tochigi.jp", Normal }, { "kaminokawa.tochigi.jp", Normal },
+		{ "kanuma.tochigi.jp", Normal }, { "karasuyama.tochigi.jp", Normal }, { "kuroiso.tochigi.jp", Normal },
+		{ "mashiko.tochigi.jp", Normal }, { "mibu.tochigi.jp", Normal }, { "moka.tochigi.jp", Normal },
+		{ "motegi.tochigi.jp", Normal }, { "nasu.tochigi.jp", Normal }, { "nasushiobara.tochigi.jp", Normal },
+		{ "nikko.tochigi.jp", Normal }, { "nishikata.tochigi.jp", Normal }, { "nogi.tochigi.jp", Normal },
+		{ "ohira.tochigi.jp", Normal }, { "ohtawara.tochigi.jp", Normal }, { "oyama.tochigi.jp", Normal },
+		{ "sakura.tochigi.jp", Normal }, { "sano.tochigi.jp", Normal }, { "shimotsuke.tochigi.jp", Normal },
+		{ "shioya.tochigi.jp", Normal }, { "takanezawa.tochigi.jp", Normal }, { "tochigi.tochigi.jp", Normal },
+		{ "tsuga.tochigi.jp", Normal }, { "ujiie.tochigi.jp", Normal }, { "utsunomiya.tochigi.jp", Normal },
+		{ "yaita.tochigi.jp", Normal }, { "aizumi.tokushima.jp", Normal }, { "anan.tokushima.jp", Normal },
+		{ "ichiba.tokushima.jp", Normal }, { "itano.tokushima.jp", Normal }, { "kainan.tokushima.jp", Normal },
+		{ "komatsushima.tokushima.jp", Normal }, { "matsushige.tokushima.jp", Normal }, { "mima.tokushima.jp", Normal },
+		{ "minami.tokushima.jp", Normal }, { "miyoshi.tokushima.jp", Normal }, { "mugi.tokushima.jp", Normal },
+		{ "nakagawa.tokushima.jp", Normal }, { "naruto.tokushima.jp", Normal }, { "sanagochi.tokushima.jp", Normal },
+		{ "shishikui.tokushima.jp", Normal }, { "tokushima.tokushima.jp", Normal }, { "wajiki.tokushima.jp", Normal },
+		{ "adachi.tokyo.jp", Normal }, { "akiruno.tokyo.jp", Normal }, { "akishima.tokyo.jp", Normal },
+		{ "aogashima.tokyo.jp", Normal }, { "arakawa.tokyo.jp", Normal }, { "bunkyo.tokyo.jp", Normal },
+		{ "chiyoda.tokyo.jp", Normal }, { "chofu.tokyo.jp", Normal }, { "chuo.tokyo.jp", Normal },
+		{ "edogawa.tokyo.jp", Normal }, { "fuchu.tokyo.jp", Normal }, { "fussa.tokyo.jp", Normal },
+		{ "hachijo.tokyo.jp", Normal }, { "hachioji.tokyo.jp", Normal }, { "hamura.tokyo.jp", Normal },
+		{ "higashikurume.tokyo.jp", Normal }, { "higashimurayama.tokyo.jp", Normal }, { "higashiyamato.tokyo.jp", Normal },
+		{ "hino.tokyo.jp", Normal }, { "hinode.tokyo.jp", Normal }, { "hinohara.tokyo.jp", Normal },
+		{ "inagi.tokyo.jp", Normal }, { "itabashi.tokyo.jp", Normal }, { "katsushika.tokyo.jp", Normal },
+		{ "kita.tokyo.jp", Normal }, { "kiyose.tokyo.jp", Normal }, { "kodaira.tokyo.jp", Normal },
+		{ "koganei.tokyo.jp", Normal }, { "kokubunji.tokyo.jp", Normal }, { "komae.tokyo.jp", Normal },
+		{ "koto.tokyo.jp", Normal }, { "kouzushima.tokyo.jp", Normal }, { "kunitachi.tokyo.jp", Normal },
+		{ "machida.tokyo.jp", Normal }, { "meguro.tokyo.jp", Normal }, { "minato.tokyo.jp", Normal },
+		{ "mitaka.tokyo.jp", Normal }, { "mizuho.tokyo.jp", Normal }, { "musashimurayama.tokyo.jp", Normal },
+		{ "musashino.tokyo.jp", Normal }, { "nakano.tokyo.jp", Normal }, { "nerima.tokyo.jp", Normal },
+		{ "ogasawara.tokyo.jp", Normal }, { "okutama.tokyo.jp", Normal }, { "ome.tokyo.jp", Normal },
+		{ "oshima.tokyo.jp", Normal }, { "ota.tokyo.jp", Normal }, { "setagaya.tokyo.jp", Normal },
+		{ "shibuya.tokyo.jp", Normal }, { "shinagawa.tokyo.jp", Normal }, { "shinjuku.tokyo.jp", Normal },
+		{ "suginami.tokyo.jp", Normal }, { "sumida.tokyo.jp", Normal }, { "tachikawa.tokyo.jp", Normal },
+		{ "taito.tokyo.jp", Normal }, { "tama.tokyo.jp", Normal }, { "toshima.tokyo.jp", Normal },
+		{ "chizu.tottori.jp", Normal }, { "hino.tottori.jp", Normal }, { "kawahara.tottori.jp", Normal },
+		{ "koge.tottori.jp", Normal }, { "kotoura.tottori.jp", Normal }, { "misasa.tottori.jp", Normal },
+		{ "nanbu.tottori.jp", Normal }, { "nichinan.tottori.jp", Normal }, { "sakaiminato.tottori.jp", Normal },
+		{ "tottori.tottori.jp", Normal }, { "wakasa.tottori.jp", Normal }, { "yazu.tottori.jp", Normal },
+		{ "yonago.tottori.jp", Normal }, { "asahi.toyama.jp", Normal }, { "fuchu.toyama.jp", Normal },
+		{ "fukumitsu.toyama.jp", Normal }, { "funahashi.toyama.jp", Normal }, { "himi.toyama.jp", Normal },
+		{ "imizu.toyama.jp", Normal }, { "inami.toyama.jp", Normal }, { "johana.toyama.jp", Normal },
+		{ "kamiichi.toyama.jp", Normal }, { "kurobe.toyama.jp", Normal }, { "nakaniikawa.toyama.jp", Normal },
+		{ "namerikawa.toyama.jp", Normal }, { "nanto.toyama.jp", Normal }, { "nyuzen.toyama.jp", Normal },
+		{ "oyabe.toyama.jp", Normal }, { "taira.toyama.jp", Normal }, { "takaoka.toyama.jp", Normal },
+		{ "tateyama.toyama.jp", Normal }, { "toga.toyama.jp", Normal }, { "tonami.toyama.jp", Normal },
+		{ "toyama.toyama.jp", Normal }, { "unazuki.toyama.jp", Normal }, { "uozu.toyama.jp", Normal },
+		{ "yamada.toyama.jp", Normal }, { "arida.wakayama.jp", Normal }, { "aridagawa.wakayama.jp", Normal },
+		{ "gobo.wakayama.jp", Normal }, { "hashimoto.wakayama.jp", Normal }, { "hidaka.wakayama.jp", Normal },
+		{ "hirogawa.wakayama.jp", Normal }, { "inami.wakayama.jp", Normal }, { "iwade.wakayama.jp", Normal },
+		{ "kainan.wakayama.jp", Normal }, { "kamitonda.wakayama.jp", Normal }, { "katsuragi.wakayama.jp", Normal },
+		{ "kimino.wakayama.jp", Normal }, { "kinokawa.wakayama.jp", Normal }, { "kitayama.wakayama.jp", Normal },
+		{ "koya.wakayama.jp", Normal }, { "koza.wakayama.jp", Normal }, { "kozagawa.wakayama.jp", Normal },
+		{ "kudoyama.wakayama.jp", Normal }, { "kushimoto.wakayama.jp", Normal }, { "mihama.wakayama.jp", Normal },
+		{ "misato.wakayama.jp", Normal }, { "nachikatsuura.wakayama.jp", Normal }, { "shingu.wakayama.jp", Normal },
+		{ "shirahama.wakayama.jp", Normal }, { "taiji.wakayama.jp", Normal }, { "tanabe.wakayama.jp", Normal },
+		{ "wakayama.wakayama.jp", Normal }, { "yuasa.wakayama.jp", Normal }, { "yura.wakayama.jp", Normal },
+		{ "asahi.yamagata.jp", Normal }, { "funagata.yamagata.jp", Normal }, { "higashine.yamagata.jp", Normal },
+		{ "iide.yamagata.jp", Normal }, { "kahoku.yamagata.jp", Normal }, { "kaminoyama.yamagata.jp", Normal },
+		{ "kaneyama.yamagata.jp", Normal }, { "kawanishi.yamagata.jp", Normal }, { "mamurogawa.yamagata.jp", Normal },
+		{ "mikawa.yamagata.jp", Normal }, { "murayama.yamagata.jp", Normal }, { "nagai.yamagata.jp", Normal },
+		{ "nakayama.yamagata.jp", Normal }, { "nanyo.yamagata.jp", Normal }, { "nishikawa.yamagata.jp", Normal },
+		{ "obanazawa.yamagata.jp", Normal }, { "oe.yamagata.jp", Normal }, { "oguni.yamagata.jp", Normal },
+		{ "ohkura.yamagata.jp", Normal }, { "oishida.yamagata.jp", Normal }, { "sagae.yamagata.jp", Normal },
+		{ "sakata.yamagata.jp", Normal }, { "sakegawa.yamagata.jp", Normal }, { "shinjo.yamagata.jp", Normal },
+		{ "shirataka.yamagata.jp", Normal }, { "shonai.yamagata.jp", Normal }, { "takahata.yamagata.jp", Normal },
+		{ "tendo.yamagata.jp", Normal }, { "tozawa.yamagata.jp", Normal }, { "tsuruoka.yamagata.jp", Normal },
+		{ "yamagata.yamagata.jp", Normal }, { "yamanobe.yamagata.jp", Normal }, { "yonezawa.yamagata.jp", Normal },
+		{ "yuza.yamagata.jp", Normal }, { "abu.yamaguchi.jp", Normal }, { "hagi.yamaguchi.jp", Normal },
+		{ "hikari.yamaguchi.jp", Normal }, { "hofu.yamaguchi.jp", Normal }, { "iwakuni.yamaguchi.jp", Normal },
+		{ "kudamatsu.yamaguchi.jp", Normal }, { "mitou.yamaguchi.jp", Normal }, { "nagato.yamaguchi.jp", Normal },
+		{ "oshima.yamaguchi.jp", Normal }, { "shimonoseki.yamaguchi.jp", Normal }, { "shunan.yamaguchi.jp", Normal },
+		{ "tabuse.yamaguchi.jp", Normal }, { "tokuyama.yamaguchi.jp", Normal }, { "toyota.yamaguchi.jp", Normal },
+		{ "ube.yamaguchi.jp", Normal }, { "yuu.yamaguchi.jp", Normal }, { "chuo.yamanashi.jp", Normal },
+		{ "doshi.yamanashi.jp", Normal }, { "fuefuki.yamanashi.jp", Normal }, { "fujikawa.yamanashi.jp", Normal },
+		{ "fujikawaguchiko.yamanashi.jp", Normal }, { "fujiyoshida.yamanashi.jp", Normal },
+		{ "hayakawa.yamanashi.jp", Normal }, { "hokuto.yamanashi.jp", Normal }, { "ichikawamisato.yamanashi.jp", Normal },
+		{ "kai.yamanashi.jp", Normal }, { "kofu.yamanashi.jp", Normal }, { "koshu.yamanashi.jp", Normal },
+		{ "kosuge.yamanashi.jp", Normal }, { "minami-alps.yamanashi.jp", Normal }, { "minobu.yamanashi.jp", Normal },
+		{ "nakamichi.yamanashi.jp", Normal }, { "nanbu.yamanashi.jp", Normal }, { "narusawa.yamanashi.jp", Normal },
+		{ "nirasaki.yamanashi.jp", Normal }, { "nishikatsura.yamanashi.jp", Normal }, { "oshino.yamanashi.jp", Normal },
+		{ "otsuki.yamanashi.jp", Normal }, { "showa.yamanashi.jp", Normal }, { "tabayama.yamanashi.jp", Normal },
+		{ "tsuru.yamanashi.jp", Normal }, { "uenohara.yamanashi.jp", Normal }, { "yamanakako.yamanashi.jp", Normal },
+		{ "yamanashi.yamanashi.jp", Normal }, { "ke", Normal }, { "ac.ke", Normal }, { "co.ke", Normal },
+		{ "go.ke", Normal }, { "info.ke", Normal }, { "me.ke", Normal }, { "mobi.ke", Normal }, { "ne.ke", Normal },
+		{ "or.ke", Normal }, { "sc.ke", Normal }, { "kg", Normal }, { "org.kg", Normal }, { "net.kg", Normal },
+		{ "com.kg", Normal }, { "edu.kg", Normal }, { "gov.kg", Normal }, { "mil.kg", Normal }, { "kh", Wildcard },
+		{ "ki", Normal }, { "edu.ki", Normal }, { "biz.ki", Normal }, { "net.ki", Normal }, { "org.ki", Normal },
+		{ "gov.ki", Normal }, { "info.ki", Normal }, { "com.ki", Normal }, { "km", Normal }, { "org.km", Normal },
+		{ "nom.km", Normal }, { "gov.km", Normal }, { "prd.km", Normal }, { "tm.km", Normal }, { "edu.km", Normal },
+		{ "mil.km", Normal }, { "ass.km", Normal }, { "com.km", Normal }, { "coop.km", Normal }, { "asso.km", Normal },
+		{ "presse.km", Normal }, { "medecin.km", Normal }, { "notaires.km", Normal }, { "pharmaciens.km", Normal },
+		{ "veterinaire.km", Normal }, { "gouv.km", Normal }, { "kn", Normal }, { "net.kn", Normal }, { "org.kn", Normal },
+		{ "edu.kn", Normal }, { "gov.kn", Normal }, { "kp", Normal }, { "com.kp", Normal }, { "edu.kp", Normal },
+		{ "gov.kp", Normal }, { "org.kp", Normal }, { "rep.kp", Normal }, { "tra.kp", Normal }, { "kr", Normal },
+		{ "ac.kr", Normal }, { "co.kr", Normal }, { "es.kr", Normal }, { "go.kr", Normal }, { "hs.kr", Normal },
+		{ "kg.kr", Normal }, { "mil.kr", Normal }, { "ms.kr", Normal }, { "ne.kr", Normal }, { "or.kr", Normal },
+		{ "pe.kr", Normal }, { "re.kr", Normal }, { "sc.kr", Normal }, { "busan.kr", Normal }, { "chungbuk.kr", Normal },
+		{ "chungnam.kr", Normal }, { "daegu.kr", Normal }, { "daejeon.kr", Normal }, { "gangwon.kr", Normal },
+		{ "gwangju.kr", Normal }, { "gyeongbuk.kr", Normal }, { "gyeonggi.kr", Normal }, { "gyeongnam.kr", Normal },
+		{ "incheon.kr", Normal }, { "jeju.kr", Normal }, { "jeonbuk.kr", Normal }, { "jeonnam.kr", Normal },
+		{ "seoul.kr", Normal }, { "ulsan.kr", Normal }, { "kw", Normal }, { "com.kw", Normal }, { "edu.kw", Normal },
+		{ "emb.kw", Normal }, { "gov.kw", Normal }, { "ind.kw", Normal }, { "net.kw", Normal }, { "org.kw", Normal },
+		{ "ky", Normal }, { "com.ky", Normal }, { "edu.ky", Normal }, { "net.ky", Normal }, { "org.ky", Normal },
+		{ "kz", Normal }, { "org.kz", Normal }, { "edu.kz", Normal }, { "net.kz", Normal }, { "gov.kz", Normal },
+		{ "mil.kz", Normal }, { "com.kz", Normal }, { "la", Normal }, { "int.la", Normal }, { "net.la", Normal },
+		{ "info.la", Normal }, { "edu.la", Normal }, { "gov.la", Normal }, { "per.la", Normal }, { "com.la", Normal },
+		{ "org.la", Normal }, { "lb", Normal }, { "com.lb", Normal }, { "edu.lb", Normal }, { "gov.lb", Normal },
+		{ "net.lb", Normal }, { "org.lb", Normal }, { "lc", Normal }, { "com.lc", Normal }, { "net.lc", Normal },
+		{ "co.lc", Normal }, { "org.lc", Normal }, { "edu.lc", Normal }, { "gov.lc", Normal }, { "li", Normal },
+		{ "lk", Normal }, { "gov.lk", Normal }, { "sch.lk", Normal }, { "net.lk", Normal }, { "int.lk", Normal },
+		{ "com.lk", Normal }, { "org.lk", Normal }, { "edu.lk", Normal }, { "ngo.lk", Normal }, { "soc.lk", Normal },
+		{ "web.lk", Normal }, { "ltd.lk", Normal }, { "assn.lk", Normal }, { "grp.lk", Normal }, { "hotel.lk", Normal },
+		{ "ac.lk", Normal }, { "lr", Normal }, { "com.lr", Normal }, { "edu.lr", Normal }, { "gov.lr", Normal },
+		{ "org.lr", Normal }, { "net.lr", Normal }, { "ls", Normal }, { "ac.ls", Normal }, { "biz.ls", Normal },
+		{ "co.ls", Normal }, { "edu.ls", Normal }, { "gov.ls", Normal }, { "info.ls", Normal }, { "net.ls", Normal },
+		{ "org.ls", Normal }, { "sc.ls", Normal }, { "lt", Normal }, { "gov.lt", Normal }, { "lu", Normal },
+		{ "lv", Normal }, { "com.lv", Normal }, { "edu.lv", Normal }, { "gov.lv", Normal }, { "org.lv", Normal },
+		{ "mil.lv", Normal }, { "id.lv", Normal }, { "net.lv", Normal }, { "asn.lv", Normal }, { "conf.lv", Normal },
+		{ "ly", Normal }, { "com.ly", Normal }, { "net.ly", Normal }, { "gov.ly", Normal }, { "plc.ly", Normal },
+		{ "edu.ly", Normal }, { "sch.ly", Normal }, { "med.ly", Normal }, { "org.ly", Normal }, { "id.ly", Normal },
+		{ "ma", Normal }, { "co.ma", Normal }, { "net.ma", Normal }, { "gov.ma", Normal }, { "org.ma", Normal },
+		{ "ac.ma", Normal }, { "press.ma", Normal }, { "mc", Normal }, { "tm.mc", Normal }, { "asso.mc", Normal },
+		{ "md", Normal }, { "me", Normal }, { "co.me", Normal }, { "net.me", Normal }, { "org.me", Normal },
+		{ "edu.me", Normal }, { "ac.me", Normal }, { "gov.me", Normal }, { "its.me", Normal }, { "priv.me", Normal },
+		{ "mg", Normal }, { "org.mg", Normal }, { "nom.mg", Normal }, { "gov.mg", Normal }, { "prd.mg", Normal },
+		{ "tm.mg", Normal }, { "edu.mg", Normal }, { "mil.mg", Normal }, { "com.mg", Normal }, { "co.mg", Normal },
+		{ "mh", Normal }, { "mil", Normal }, { "mk", Normal }, { "com.mk", Normal }, { "org.mk", Normal },
+		{ "net.mk", Normal }, { "edu.mk", Normal }, { "gov.mk", Normal }, { "inf.mk", Normal }, { "name.mk", Normal },
+		{ "ml", Normal }, { "com.ml", Normal }, { "edu.ml", Normal }, { "gouv.ml", Normal }, { "gov.ml", Normal },
+		{ "net.ml", Normal }, { "org.ml", Normal }, { "presse.ml", Normal }, { "mm", Wildcard }, { "mn", Normal },
+		{ "gov.mn", Normal }, { "edu.mn", Normal }, { "org.mn", Normal }, { "mo", Normal }, { "com.mo", Normal },
+		{ "net.mo", Normal }, { "org.mo", Normal }, { "edu.mo", Normal }, { "gov.mo", Normal }, { "mobi", Normal },
+		{ "mp", Normal }, { "mq", Normal }, { "mr", Normal }, { "gov.mr", Normal }, { "ms", Normal }, { "com.ms", Normal },
+		{ "edu.ms", Normal }, { "gov.ms", Normal }, { "net.ms", Normal }, { "org.ms", Normal }, { "mt", Normal },
+		{ "com.mt", Normal }, { "edu.mt", Normal }, { "net.mt", Normal }, { "org.mt", Normal }, { "mu", Normal },
+		{ "com.mu", Normal }, { "net.mu", Normal }, { "org.mu", Normal }, { "gov.mu", Normal }, { "ac.mu", Normal },
+		{ "co.mu", Normal }, { "or.mu", Normal }, { "museum", Normal }, { "academy.museum", Normal },
+		{ "agriculture.museum", Normal }, { "air.museum", Normal }, { "airguard.museum", Normal },
+		{ "alabama.museum", Normal }, { "alaska.museum", Normal }, { "amber.museum", Normal },
+		{ "ambulance.museum", Normal }, { "american.museum", Normal }, { "americana.museum", Normal },
+		{ "americanantiques.museum", Normal }, { "americanart.museum", Normal }, { "amsterdam.museum", Normal },
+		{ "and.museum", Normal }, { "annefrank.museum", Normal }, { "anthro.museum", Normal },
+		{ "anthropology.museum", Normal }, { "antiques.museum", Normal }, { "aquarium.museum", Normal },
+		{ "arboretum.museum", Normal }, { "archaeological.museum", Normal }, { "archaeology.museum", Normal },
+		{ "architecture.museum", Normal }, { "art.museum", Normal }, { "artanddesign.museum", Normal },
+		{ "artcenter.museum", Normal }, { "artdeco.museum", Normal }, { "arteducation.museum", Normal },
+		{ "artgallery.museum", Normal }, { "arts.museum", Normal }, { "artsandcrafts.museum", Normal },
+		{ "asmatart.museum", Normal }, { "assassination.museum", Normal }, { "assisi.museum", Normal },
+		{ "association.museum", Normal }, { "astronomy.museum", Normal }, { "atlanta.museum", Normal },
+		{ "austin.museum", Normal }, { "australia.museum", Normal }, { "automotive.museum", Normal },
+		{ "aviation.museum", Normal }, { "axis.museum", Normal }, { "badajoz.museum", Normal },
+		{ "baghdad.museum", Normal }, { "bahn.museum", Normal }, { "bale.museum", Normal }, { "baltimore.museum", Normal },
+		{ "barcelona.museum", Normal }, { "baseball.museum", Normal }, { "basel.museum", Normal },
+		{ "baths.museum", Normal }, { "bauern.museum", Normal }, { "beauxarts.museum", Normal },
+		{ "beeldengeluid.museum", Normal }, { "bellevue.museum", Normal }, { "bergbau.museum", Normal },
+		{ "berkeley.museum", Normal }, { "berlin.museum", Normal }, { "bern.museum", Normal }, { "bible.museum", Normal },
+		{ "bilbao.museum", Normal }, { "bill.museum", Normal }, { "birdart.museum", Normal },
+		{ "birthplace.museum", Normal }, { "bonn.museum", Normal }, { "boston.museum", Normal },
+		{ "botanical.museum", Normal }, { "botanicalgarden.museum", Normal }, { "botanicgarden.museum", Normal },
+		{ "botany.museum", Normal }, { "brandywinevalley.museum", Normal }, { "brasil.museum", Normal },
+		{ "bristol.museum", Normal }, { "british.museum", Normal }, { "britishcolumbia.museum", Normal },
+		{ "broadcast.museum", Normal }, { "brunel.museum", Normal }, { "brussel.museum", Normal },
+		{ "brussels.museum", Normal }, { "bruxelles.museum", Normal }, { "building.museum", Normal },
+		{ "burghof.museum", Normal }, { "bus.museum", Normal }, { "bushey.museum", Normal }, { "cadaques.museum", Normal },
+		{ "california.museum", Normal }, { "cambridge.museum", Normal }, { "can.museum", Normal },
+		{ "canada.museum", Normal }, { "capebreton.museum", Normal }, { "carrier.museum", Normal },
+		{ "cartoonart.museum", Normal }, { "casadelamoneda.museum", Normal }, { "castle.museum", Normal },
+		{ "castres.museum", Normal }, { "celtic.museum", Normal }, { "center.museum", Normal },
+		{ "chattanooga.museum", Normal }, { "cheltenham.museum", Normal }, { "chesapeakebay.museum", Normal },
+		{ "chicago.museum", Normal }, { "children.museum", Normal }, { "childrens.museum", Normal },
+		{ "childrensgarden.museum", Normal }, { "chiropractic.museum", Normal }, { "chocolate.museum", Normal },
+		{ "christiansburg.museum", Normal }, { "cincinnati.museum", Normal }, { "cinema.museum", Normal },
+		{ "circus.museum", Normal }, { "civilisation.museum", Normal }, { "civilization.museum", Normal },
+		{ "civilwar.museum", Normal }, { "clinton.museum", Normal }, { "clock.museum", Normal }, { "coal.museum", Normal },
+		{ "coastaldefence.museum", Normal }, { "cody.museum", Normal }, { "coldwar.museum", Normal },
+		{ "collection.museum", Normal }, { "colonialwilliamsburg.museum", Normal }, { "coloradoplateau.museum", Normal },
+		{ "columbia.museum", Normal }, { "columbus.museum", Normal }, { "communication.museum", Normal },
+		{ "communications.museum", Normal }, { "community.museum", Normal }, { "computer.museum", Normal },
+		{ "computerhistory.museum", Normal }, { "comunica\303\247\303\265es.museum", Normal },
+		{ "xn--comunicaes-v6a2o.museum", Normal }, { "contemporary.museum", Normal }, { "contemporaryart.museum", Normal },
+		{ "convent.museum", Normal }, { "copenhagen.museum", Normal }, { "corporation.museum", Normal },
+		{ "correios-e-telecomunica\303\247\303\265es.museum", Normal },
+		{ "xn--correios-e-telecomunicaes-ghc29a.museum", Normal }, { "corvette.museum", Normal },
+		{ "costume.museum", Normal }, { "countryestate.museum", Normal }, { "county.museum", Normal },
+		{ "crafts.museum", Normal }, { "cranbrook.museum", Normal }, { "creation.museum", Normal },
+		{ "cultural.museum", Normal }, { "culturalcenter.museum", Normal }, { "culture.museum", Normal },
+		{ "cyber.museum", Normal }, { "cymru.museum", Normal }, { "dali.museum", Normal }, { "dallas.museum", Normal },
+		{ "database.museum", Normal }, { "ddr.museum", Normal }, { "decorativearts.museum", Normal },
+		{ "delaware.museum", Normal }, { "delmenhorst.museum", Normal }, { "denmark.museum", Normal },
+		{ "depot.museum", Normal }, { "design.museum", Normal }, { "detroit.museum", Normal },
+		{ "dinosaur.museum", Normal }, { "discovery.museum", Normal }, { "dolls.museum", Normal },
+		{ "donostia.museum", Normal }, { "durham.museum", Normal }, { "eastafrica.museum", Normal },
+		{ "eastcoast.museum", Normal }, { "education.museum", Normal }, { "educational.museum", Normal },
+		{ "egyptian.museum", Normal }, { "eisenbahn.museum", Normal }, { "elburg.museum", Normal },
+		{ "elvendrell.museum", Normal }, { "embroidery.museum", Normal }, { "encyclopedic.museum", Normal },
+		{ "england.museum", Normal }, { "entomology.museum", Normal }, { "environment.museum", Normal },
+		{ "environmentalconservation.museum", Normal }, { "epilepsy.museum", Normal }, { "essex.museum", Normal },
+		{ "estate.museum", Normal }, { "ethnology.museum", Normal }, { "exeter.museum", Normal },
+		{ "exhibition.museum", Normal }, { "family.museum", Normal }, { "farm.museum", Normal },
+		{ "farmequipment.museum", Normal }, { "farmers.museum", Normal }, { "farmstead.museum", Normal },
+		{ "field.museum", Normal }, { "figueres.museum", Normal }, { "filatelia.museum", Normal },
+		{ "film.museum", Normal }, { "fineart.museum", Normal }, { "finearts.museum", Normal },
+		{ "finland.museum", Normal }, { "flanders.museum", Normal }, { "florida.museum", Normal },
+		{ "force.museum", Normal }, { "fortmissoula.museum", Normal }, { "fortworth.museum", Normal },
+		{ "foundation.museum", Normal }, { "francaise.museum", Normal }, { "frankfurt.museum", Normal },
+		{ "franziskaner.museum", Normal }, { "freemasonry.museum", Normal }, { "freiburg.museum", Normal },
+		{ "fribourg.museum", Normal }, { "frog.museum", Normal }, { "fundacio.museum", Normal },
+		{ "furniture.museum", Normal }, { "gallery.museum", Normal }, { "garden.museum", Normal },
+		{ "gateway.museum", Normal }, { "geelvinck.museum", Normal }, { "gemological.museum", Normal },
+		{ "geology.museum", Normal }, { "georgia.museum", Normal }, { "giessen.museum", Normal }, { "glas.museum", Normal },
+		{ "glass.museum", Normal }, { "gorge.museum", Normal }, { "grandrapids.museum", Normal }, { "graz.museum", Normal },
+		{ "guernsey.museum", Normal }, { "halloffame.museum", Normal }, { "hamburg.museum", Normal },
+		{ "handson.museum", Normal }, { "harvestcelebration.museum", Normal }, { "hawaii.museum", Normal },
+		{ "health.museum", Normal }, { "heimatunduhren.museum", Normal }, { "hellas.museum", Normal },
+		{ "helsinki.museum", Normal }, { "hembygdsforbund.museum", Normal }, { "heritage.museum", Normal },
+		{ "histoire.museum", Normal }, { "historical.museum", Normal }, { "historicalsociety.museum", Normal },
+		{ "historichouses.museum", Normal }, { "historisch.museum", Normal }, { "historisches.museum", Normal },
+		{ "history.museum", Normal }, { "historyofscience.museum", Normal }, { "horology.museum", Normal },
+		{ "house.museum", Normal }, { "humanities.museum", Normal }, { "illustration.museum", Normal },
+		{ "imageandsound.museum", Normal }, { "indian.museum", Normal }, { "indiana.museum", Normal },
+		{ "indianapolis.museum", Normal }, { "indianmarket.museum", Normal }, { "intelligence.museum", Normal },
+		{ "interactive.museum", Normal }, { "iraq.museum", Normal }, { "iron.museum", Normal },
+		{ "isleofman.museum", Normal }, { "jamison.museum", Normal }, { "jefferson.museum", Normal },
+		{ "jerusalem.museum", Normal }, { "jewelry.museum", Normal }, { "jewish.museum", Normal },
+		{ "jewishart.museum", Normal }, { "jfk.museum", Normal }, { "journalism.museum", Normal },
+		{ "judaica.museum", Normal }, { "judygarland.museum", Normal }, { "juedisches.museum", Normal },
+		{ "juif.museum", Normal }, { "karate.museum", Normal }, { "karikatur.museum", Normal }, { "kids.museum", Normal },
+		{ "koebenhavn.museum", Normal }, { "koeln.museum", Normal }, { "kunst.museum", Normal },
+		{ "kunstsammlung.museum", Normal }, { "kunstunddesign.museum", Normal }, { "labor.museum", Normal },
+		{ "labour.museum", Normal }, { "lajolla.museum", Normal }, { "lancashire.museum", Normal },
+		{ "landes.museum", Normal }, { "lans.museum", Normal }, { "l\303\244ns.museum", Normal },
+		{ "xn--lns-qla.museum", Normal }, { "larsson.museum", Normal }, { "lewismiller.museum", Normal },
+		{ "lincoln.museum", Normal }, { "linz.museum", Normal }, { "living.museum", Normal },
+		{ "livinghistory.museum", Normal }, { "localhistory.museum", Normal }, { "london.museum", Normal },
+		{ "losangeles.museum", Normal }, { "louvre.museum", Normal }, { "loyalist.museum", Normal },
+		{ "lucerne.museum", Normal }, { "luxembourg.museum", Normal }, { "luzern.museum", Normal },
+		{ "mad.museum", Normal }, { "madrid.museum", Normal }, { "mallorca.museum", Normal },
+		{ "manchester.museum", Normal }, { "mansion.museum", Normal }, { "mansions.museum", Normal },
+		{ "manx.museum", Normal }, { "marburg.museum", Normal }, { "maritime.museum", Normal },
+		{ "maritimo.museum", Normal }, { "maryland.museum", Normal }, { "marylhurst.museum", Normal },
+		{ "media.museum", Normal }, { "medical.museum", Normal }, { "medizinhistorisches.museum", Normal },
+		{ "meeres.museum", Normal }, { "memorial.museum", Normal }, { "mesaverde.museum", Normal },
+		{ "michigan.museum", Normal }, { "midatlantic.museum", Normal }, { "military.museum", Normal },
+		{ "mill.museum", Normal }, { "miners.museum", Normal }, { "mining.museum", Normal }, { "minnesota.museum", Normal },
+		{ "missile.museum", Normal }, { "missoula.museum", Normal }, { "modern.museum", Normal }, { "moma.museum", Normal },
+		{ "money.museum", Normal }, { "monmouth.museum", Normal }, { "monticello.museum", Normal },
+		{ "montreal.museum", Normal }, { "moscow.museum", Normal }, { "motorcycle.museum", Normal },
+		{ "muenchen.museum", Normal }, { "muenster.museum", Normal }, { "mulhouse.museum", Normal },
+		{ "muncie.museum", Normal }, { "museet.museum", Normal }, { "museumcenter.museum", Normal },
+		{ "museumvereniging.museum", Normal }, { "music.museum", Normal }, { "national.museum", Normal },
+		{ "nationalfirearms.museum", Normal }, { "nationalheritage.museum", Normal }, { "nativeamerican.museum", Normal },
+		{ "naturalhistory.museum", Normal }, { "naturalhistorymuseum.museum", Normal },
+		{ "naturalsciences.museum", Normal }, { "nature.museum", Normal }, { "naturhistorisches.museum", Normal },
+		{ "natuurwetenschappen.museum", Normal }, { "naumburg.museum", Normal }, { "naval.museum", Normal },
+		{ "nebraska.museum", Normal }, { "neues.museum", Normal }, { "newhampshire.museum", Normal },
+		{ "newjersey.museum", Normal }, { "newmexico.museum", Normal }, { "newport.museum", Normal },
+		{ "newspaper.museum", Normal }, { "newyork.museum", Normal }, { "niepce.museum", Normal },
+		{ "norfolk.museum", Normal }, { "north.museum", Normal }, { "nrw.museum", Normal }, { "nyc.museum", Normal },
+		{ "nyny.museum", Normal }, { "oceanographic.museum", Normal }, { "oceanographique.museum", Normal },
+		{ "omaha.museum", Normal }, { "online.museum", Normal }, { "ontario.museum", Normal }, { "openair.museum", Normal },
+		{ "oregon.museum", Normal }, { "oregontrail.museum", Normal }, { "otago.museum", Normal },
+		{ "oxford.museum", Normal }, { "pacific.museum", Normal }, { "paderborn.museum", Normal },
+		{ "palace.museum", Normal }, { "paleo.museum", Normal }, { "palmsprings.museum", Normal },
+		{ "panama.museum", Normal }, { "paris.museum", Normal }, { "pasadena.museum", Normal },
+		{ "pharmacy.museum", Normal }, { "philadelphia.museum", Normal }, { "philadelphiaarea.museum", Normal },
+		{ "philately.museum", Normal }, { "phoenix.museum", Normal }, { "photography.museum", Normal },
+		{ "pilots.museum", Normal }, { "pittsburgh.museum", Normal }, { "planetarium.museum", Normal },
+		{ "plantation.museum", Normal }, { "plants.museum", Normal }, { "plaza.museum", Normal },
+		{ "portal.museum", Normal }, { "portland.museum", Normal }, { "portlligat.museum", Normal },
+		{ "posts-and-telecommunications.museum", Normal }, { "preservation.museum", Normal }, { "presidio.museum", Normal },
+		{ "press.museum", Normal }, { "project.museum", Normal }, { "public.museum", Normal }, { "pubol.museum", Normal },
+		{ "quebec.museum", Normal }, { "railroad.museum", Normal }, { "railway.museum", Normal },
+		{ "research.museum", Normal }, { "resistance.museum", Normal }, { "riodejaneiro.museum", Normal },
+		{ "rochester.museum", Normal }, { "rockart.museum", Normal }, { "roma.museum", Normal },
+		{ "russia.museum", Normal }, { "saintlouis.museum", Normal }, { "salem.museum", Normal },
+		{ "salvadordali.museum", Normal }, { "salzburg.museum", Normal }, { "sandiego.museum", Normal },
+		{ "sanfrancisco.museum", Normal }, { "santabarbara.museum", Normal }, { "santacruz.museum", Normal },
+		{ "santafe.museum", Normal }, { "saskatchewan.museum", Normal }, { "satx.museum", Normal },
+		{ "savannahga.museum", Normal }, { "schlesisches.museum", Normal }, { "schoenbrunn.museum", Normal },
+		{ "schokoladen.museum", Normal }, { "school.museum", Normal }, { "schweiz.museum", Normal },
+		{ "science.museum", Normal }, { "scienceandhistory.museum", Normal }, { "scienceandindustry.museum", Normal },
+		{ "sciencecenter.museum", Normal }, { "sciencecenters.museum", Normal }, { "science-fiction.museum", Normal },
+		{ "sciencehistory.museum", Normal }, { "sciences.museum", Normal }, { "sciencesnaturelles.museum", Normal },
+		{ "scotland.museum", Normal }, { "seaport.museum", Normal }, { "settlement.museum", Normal },
+		{ "settlers.museum", Normal }, { "shell.museum", Normal }, { "sherbrooke.museum", Normal },
+		{ "sibenik.museum", Normal }, { "silk.museum", Normal }, { "ski.museum", Normal }, { "skole.museum", Normal },
+		{ "society.museum", Normal }, { "sologne.museum", Normal }, { "soundandvision.museum", Normal },
+		{ "southcarolina.museum", Normal }, { "southwest.museum", Normal }, { "space.museum", Normal },
+		{ "spy.museum", Normal }, { "square.museum", Normal }, { "stadt.museum", Normal }, { "stalbans.museum", Normal },
+		{ "starnberg.museum", Normal }, { "state.museum", Normal }, { "stateofdelaware.museum", Normal },
+		{ "station.museum", Normal }, { "steam.museum", Normal }, { "steiermark.museum", Normal },
+		{ "stjohn.museum", Normal }, { "stockholm.museum", Normal }, { "stpetersburg.museum", Normal },
+		{ "stuttgart.museum", Normal }, { "suisse.museum", Normal }, { "surgeonshall.museum", Normal },
+		{ "surrey.museum", Normal }, { "svizzera.museum", Normal }, { "sweden.museum", Normal },
+		{ "sydney.museum", Normal }, { "tank.museum", Normal }, { "tcm.museum", Normal }, { "technology.museum", Normal },
+		{ "telekommunikation.museum", Normal }, { "television.museum", Normal }, { "texas.museum", Normal },
+		{ "textile.museum", Normal }, { "theater.museum", Normal }, { "time.museum", Normal },
+		{ "timekeeping.museum", Normal }, { "topology.museum", Normal }, { "torino.museum", Normal },
+		{ "touch.museum", Normal }, { "town.museum", Normal }, { "transport.museum", Normal }, { "tree.museum", Normal },
+		{ "trolley.museum", Normal }, { "trust.museum", Normal }, { "trustee.museum", Normal }, { "uhren.museum", Normal },
+		{ "ulm.museum", Normal }, { "undersea.museum", Normal }, { "university.museum", Normal }, { "usa.museum", Normal },
+		{ "usantiques.museum", Normal }, { "usarts.museum", Normal }, { "uscountryestate.museum", Normal },
+		{ "usculture.museum", Normal }, { "usdecorativearts.museum", Normal }, { "usgarden.museum", Normal },
+		{ "ushistory.museum", Normal }, { "ushuaia.museum", Normal }, { "uslivinghistory.museum", Normal },
+		{ "utah.museum", Normal }, { "uvic.museum", Normal }, { "valley.museum", Normal }, { "vantaa.museum", Normal },
+		{ "versailles.museum", Normal }, { "viking.museum", Normal }, { "village.museum", Normal },
+		{ "virginia.museum", Normal }, { "virtual.museum", Normal }, { "virtuel.museum", Normal },
+		{ "vlaanderen.museum", Normal }, { "volkenkunde.museum", Normal }, { "wales.museum", Normal },
+		{ "wallonie.museum", Normal }, { "war.museum", Normal }, { "washingtondc.museum", Normal },
+		{ "watchandclock.museum", Normal }, { "watch-and-clock.museum", Normal }, { "western.museum", Normal },
+		{ "westfalen.museum", Normal }, { "whaling.museum", Normal }, { "wildlife.museum", Normal },
+		{ "williamsburg.museum", Normal }, { "windmill.museum", Normal }, { "workshop.museum", Normal },
+		{ "york.museum", Normal }, { "yorkshire.museum", Normal }, { "yosemite.museum", Normal },
+		{ "youth.museum", Normal }, { "zoological.museum", Normal }, { "zoology.museum", Normal },
+		{ "\327\231\327\250\327\225\327\251\327\234\327\231\327\235.museum", Normal }, { "xn--9dbhblg6di.museum", Normal },
+		{ "\320\270\320\272\320\276\320\274.museum", Normal }, { "xn--h1aegh.museum", Normal }, { "mv", Normal },
+		{ "aero.mv", Normal }, { "biz.mv", Normal }, { "com.mv", Normal }, { "coop.mv", Normal }, { "edu.mv", Normal },
+		{ "gov.mv", Normal }, { "info.mv", Normal }, { "int.mv", Normal }, { "mil.mv", Normal }, { "museum.mv", Normal },
+		{ "name.mv", Normal }, { "net.mv", Normal }, { "org.mv", Normal }, { "pro.mv", Normal }, { "mw", Normal },
+		{ "ac.mw", Normal }, { "biz.mw", Normal }, { "co.mw", Normal }, { "com.mw", Normal }, { "coop.mw", Normal },
+		{ "edu.mw", Normal }, { "gov.mw", Normal }, { "int.mw", Normal }, { "museum.mw", Normal }, { "net.mw", Normal },
+		{ "org.mw", Normal }, { "mx", Normal }, { "com.mx", Normal }, { "org.mx", Normal }, { "gob.mx", Normal },
+		{ "edu.mx", Normal }, { "net.mx", Normal }, { "my", Normal }, { "biz.my", Normal }, { "com.my", Normal },
+		{ "edu.my", Normal }, { "gov.my", Normal }, { "mil.my", Normal }, { "name.my", Normal }, { "net.my", Normal },
+		{ "org.my", Normal }, { "mz", Normal }, { "ac.mz", Normal }, { "adv.mz", Normal }, { "co.mz", Normal },
+		{ "edu.mz", Normal }, { "gov.mz", Normal }, { "mil.mz", Normal }, { "net.mz", Normal }, { "org.mz", Normal },
+		{ "na", Normal }, { "info.na", Normal }, { "pro.na", Normal }, { "name.na", Normal }, { "school.na", Normal },
+		{ "or.na", Normal }, { "dr.na", Normal }, { "us.na", Normal }, { "mx.na", Normal }, { "ca.na", Normal },
+		{ "in.na", Normal }, { "cc.na", Normal }, { "tv.na", Normal }, { "ws.na", Normal }, { "mobi.na", Normal },
+		{ "co.na", Normal }, { "com.na", Normal }, { "org.na", Normal }, { "name", Normal }, { "nc", Normal },
+		{ "asso.nc", Normal }, { "nom.nc", Normal }, { "ne", Normal }, { "net", Normal }, { "nf", Normal },
+		{ "com.nf", Normal }, { "net.nf", Normal }, { "per.nf", Normal }, { "rec.nf", Normal }, { "web.nf", Normal },
+		{ "arts.nf", Normal }, { "firm.nf", Normal }, { "info.nf", Normal }, { "other.nf", Normal }, { "store.nf", Normal },
+		{ "ng", Normal }, { "com.ng", Normal }, { "edu.ng", Normal }, { "gov.ng", Normal }, { "i.ng", Normal },
+		{ "mil.ng", Normal }, { "mobi.ng", Normal }, { "name.ng", Normal }, { "net.ng", Normal }, { "org.ng", Normal },
+		{ "sch.ng", Normal }, { "ni", Normal }, { "ac.ni", Normal }, { "biz.ni", Normal }, { "co.ni", Normal },
+		{ "com.ni", Normal }, { "edu.ni", Normal }, { "gob.ni", Normal }, { "in.ni", Normal }, { "info.ni", Normal },
+		{ "int.ni", Normal }, { "mil.ni", Normal }, { "net.ni", Normal }, { "nom.ni", Normal }, { "org.ni", Normal },
+		{ "web.ni", Normal }, { "nl", Normal }, { "no", Normal }, { "fhs.no", Normal }, { "vgs.no", Normal },
+		{ "fylkesbibl.no", Normal }, { "folkebibl.no", Normal }, { "museum.no", Normal }, { "idrett.no", Normal },
+		{ "priv.no", Normal }, { "mil.no", Normal }, { "stat.no", Normal }, { "dep.no", Normal }, { "kommune.no", Normal },
+		{ "herad.no", Normal }, { "aa.no", Normal }, { "ah.no", Normal }, { "bu.no", Normal }, { "fm.no", Normal },
+		{ "hl.no", Normal }, { "hm.no", Normal }, { "jan-mayen.no", Normal }, { "mr.no", Normal }, { "nl.no", Normal },
+		{ "nt.no", Normal }, { "of.no", Normal }, { "ol.no", Normal }, { "oslo.no", Normal }, { "rl.no", Normal },
+		{ "sf.no", Normal }, { "st.no", Normal }, { "svalbard.no", Normal }, { "tm.no", Normal }, { "tr.no", Normal },
+		{ "va.no", Normal }, { "vf.no", Normal }, { "gs.aa.no", Normal }, { "gs.ah.no", Normal }, { "gs.bu.no", Normal },
+		{ "gs.fm.no", Normal }, { "gs.hl.no", Normal }, { "gs.hm.no", Normal }, { "gs.jan-mayen.no", Normal },
+		{ "gs.mr.no", Normal }, { "gs.nl.no", Normal }, { "gs.nt.no", Normal }, { "gs.of.no", Normal },
+		{ "gs.ol.no", Normal }, { "gs.oslo.no", Normal }, { "gs.rl.no", Normal }, { "gs.sf.no", Normal },
+		{ "gs.st.no", Normal }, { "gs.svalbard.no", Normal }, { "gs.tm.no", Normal }, { "gs.tr.no", Normal },
+		{ "gs.va.no", Normal }, { "gs.vf.no", Normal }, { "akrehamn.no", Normal }, { "\303\245krehamn.no", Normal },
+		{ "xn--krehamn-dxa.no", Normal }, { "algard.no", Normal }, { "\303\245lg\303\245rd.no", Normal },
+		{ "xn--lgrd-poac.no", Normal }, { "arna.no", Normal }, { "brumunddal.no", Normal }, { "bryne.no", Normal },
+		{ "bronnoysund.no", Normal }, { "br\303\270nn\303\270ysund.no", Normal }, { "xn--brnnysund-m8ac.no", Normal },
+		{ "drobak.no", Normal }, { "dr\303\270bak.no", Normal }, { "xn--drbak-wua.no", Normal }, { "egersund.no", Normal },
+		{ "fetsund.no", Normal }, { "floro.no", Normal }, { "flor\303\270.no", Normal }, { "xn--flor-jra.no", Normal },
+		{ "fredrikstad.no", Normal }, { "hokksund.no", Normal }, { "honefoss.no", Normal },
+		{ "h\303\270nefoss.no", Normal }, { "xn--hnefoss-q1a.no", Normal }, { "jessheim.no", Normal },
+		{ "jorpeland.no", Normal }, { "j\303\270rpeland.no", Normal }, { "xn--jrpeland-54a.no", Normal },
+		{ "kirkenes.no", Normal }, { "kopervik.no", Normal }, { "krokstadelva.no", Normal }, { "langevag.no", Normal },
+		{ "langev\303\245g.no", Normal }, { "xn--langevg-jxa.no", Normal }, { "leirvik.no", Normal },
+		{ "mjondalen.no", Normal }, { "mj\303\270ndalen.no", Normal }, { "xn--mjndalen-64a.no", Normal },
+		{ "mo-i-rana.no", Normal }, { "mosjoen.no", Normal }, { "mosj\303\270en.no", Normal },
+		{ "xn--mosjen-eya.no", Normal }, { "nesoddtangen.no", Normal }, { "orkanger.no", Normal }, { "osoyro.no", Normal },
+		{ "os\303\270yro.no", Normal }, { "xn--osyro-wua.no", Normal }, { "raholt.no", Normal },
+		{ "r\303\245holt.no", Normal }, { "xn--rholt-mra.no", Normal }, { "sandnessjoen.no", Normal },
+		{ "sandnessj\303\270en.no", Normal }, { "xn--sandnessjen-ogb.no", Normal }, { "skedsmokorset.no", Normal },
+		{ "slattum.no", Normal }, { "spjelkavik.no", Normal }, { "stathelle.no", Normal }, { "stavern.no", Normal },
+		{ "stjordalshalsen.no", Normal }, { "stj\303\270rdalshalsen.no", Normal }, { "xn--stjrdalshalsen-sqb.no", Normal },
+		{ "tananger.no", Normal }, { "tranby.no", Normal }, { "vossevangen.no", Normal }, { "afjord.no", Normal },
+		{ "\303\245fjord.no", Normal }, { "xn--fjord-lra.no", Normal }, { "agdenes.no", Normal }, { "al.no", Normal },
+		{ "\303\245l.no", Normal }, { "xn--l-1fa.no", Normal }, { "alesund.no", Normal }, { "\303\245lesund.no", Normal },
+		{ "xn--lesund-hua.no", Normal }, { "alstahaug.no", Normal }, { "alta.no", Normal },
+		{ "\303\241lt\303\241.no", Normal }, { "xn--lt-liac.no", Normal }, { "alaheadju.no", Normal },
+		{ "\303\241laheadju.no", Normal }, { "xn--laheadju-7ya.no", Normal }, { "alvdal.no", Normal },
+		{ "amli.no", Normal }, { "\303\245mli.no", Normal }, { "xn--mli-tla.no", Normal }, { "amot.no", Normal },
+		{ "\303\245mot.no", Normal }, { "xn--mot-tla.no", Normal }, { "andebu.no", Normal }, { "andoy.no", Normal },
+		{ "and\303\270y.no", Normal }, { "xn--andy-ira.no", Normal }, { "andasuolo.no", Normal }, { "ardal.no", Normal },
+		{ "\303\245rdal.no", Normal }, { "xn--rdal-poa.no", Normal }, { "aremark.no", Normal }, { "arendal.no", Normal },
+		{ "\303\245s.no", Normal }, { "xn--s-1fa.no", Normal }, { "aseral.no", Normal }, { "\303\245seral.no", Normal },
+		{ "xn--seral-lra.no", Normal }, { "asker.no", Normal }, { "askim.no", Normal }, { "askvoll.no", Normal },
+		{ "askoy.no", Normal }, { "ask\303\270y.no", Normal }, { "xn--asky-ira.no", Normal }, { "asnes.no", Normal },
+		{ "\303\245snes.no", Normal }, { "xn--snes-poa.no", Normal }, { "audnedaln.no", Normal }, { "aukra.no", Normal },
+		{ "aure.no", Normal }, { "aurland.no", Normal }, { "aurskog-holand.no", Normal },
+		{ "aurskog-h\303\270land.no", Normal }, { "xn--aurskog-hland-jnb.no", Normal }, { "austevoll.no", Normal },
+		{ "austrheim.no", Normal }, { "averoy.no", Normal }, { "aver\303\270y.no", Normal }, { "xn--avery-yua.no", Normal },
+		{ "balestrand.no", Normal }, { "ballangen.no", Normal }, { "balat.no", Normal },
+		{ "b\303\241l\303\241t.no", Normal }, { "xn--blt-elab.no", Normal }, { "balsfjord.no", Normal },
+		{ "bahccavuotna.no", Normal }, { "b\303\241hccavuotna.no", Normal }, { "xn--bhccavuotna-k7a.no", Normal },
+		{ "bamble.no", Normal }, { "bardu.no", Normal }, { "beardu.no", Normal }, { "beiarn.no", Normal },
+		{ "bajddar.no", Normal }, { "b\303\241jddar.no", Normal }, { "xn--bjddar-pta.no", Normal }, { "baidar.no", Normal },
+		{ "b\303\241id\303\241r.no", Normal }, { "xn--bidr-5nac.no", Normal }, { "berg.no", Normal },
+		{ "bergen.no", Normal }, { "berlevag.no", Normal }, { "berlev\303\245g.no", Normal },
+		{ "xn--berlevg-jxa.no", Normal }, { "bearalvahki.no", Normal }, { "bearalv\303\241hki.no", Normal },
+		{ "xn--bearalvhki-y4a.no", Normal }, { "bindal.no", Normal }, { "birkenes.no", Normal }, { "bjarkoy.no", Normal },
+		{ "bjark\303\270y.no", Normal }, { "xn--bjarky-fya.no", Normal }, { "bjerkreim.no", Normal },
+		{ "bjugn.no", Normal }, { "bodo.no", Normal }, { "bod\303\270.no", Normal }, { "xn--bod-2na.no", Normal },
+		{ "badaddja.no", Normal }, { "b\303\245d\303\245ddj\303\245.no", Normal }, { "xn--bdddj-mrabd.no", Normal },
+		{ "budejju.no", Normal }, { "bokn.no", Normal }, { "bremanger.no", Normal }, { "bronnoy.no", Normal },
+		{ "br\303\270nn\303\270y.no", Normal }, { "xn--brnny-wuac.no", Normal }, { "bygland.no", Normal },
+		{ "bykle.no", Normal }, { "barum.no", Normal }, { "b\303\246rum.no", Normal }, { "xn--brum-voa.no", Normal },
+		{ "bo.telemark.no", Normal }, { "b\303\270.telemark.no", Normal }, { "xn--b-5ga.telemark.no", Normal },
+		{ "bo.nordland.no", Normal }, { "b\303\270.nordland.no", Normal }, { "xn--b-5ga.nordland.no", Normal },
+		{ "bievat.no", Normal }, { "biev\303\241t.no", Normal }, { "xn--bievt-0qa.no", Normal }, { "bomlo.no", Normal },
+		{ "b\303\270mlo.no", Normal }, { "xn--bmlo-gra.no", Normal }, { "batsfjord.no", Normal },
+		{ "b\303\245tsfjord.no", Normal }, { "xn--btsfjord-9za.no", Normal }, { "bahcavuotna.no", Normal },
+		{ "b\303\241hcavuotna.no", Normal }, { "xn--bhcavuotna-s4a.no", Normal }, { "dovre.no", Normal },
+		{ "drammen.no", Normal }, { "drangedal.no", Normal }, { "dyroy.no", Normal }, { "dyr\303\270y.no", Normal },
+		{ "xn--dyry-ira.no", Normal }, { "donna.no", Normal }, { "d\303\270nna.no", Normal }, { "xn--dnna-gra.no", Normal },
+		{ "eid.no", Normal }, { "eidfjord.no", Normal }, { "eidsberg.no", Normal }, { "eidskog.no", Normal },
+		{ "eidsvoll.no", Normal }, { "eigersund.no", Normal }, { "elverum.no", Normal }, { "enebakk.no", Normal },
+		{ "engerdal.no", Normal }, { "etne.no", Normal }, { "etnedal.no", Normal }, { "evenes.no", Normal },
+		{ "evenassi.no", Normal }, { "even\303\241\305\241\305\241i.no", Normal }, { "xn--eveni-0qa01ga.no", Normal },
+		{ "evje-og-hornnes.no", Normal }, { "farsund.no", Normal }, { "fauske.no", Normal }, { "fuossko.no", Normal },
+		{ "fuoisku.no", Normal }, { "fedje.no", Normal }, { "fet.no", Normal }, { "finnoy.no", Normal },
+		{ "finn\303\270y.no", Normal }, { "xn--finny-yua.no", Normal }, { "fitjar.no", Normal }, { "fjaler.no", Normal },
+		{ "fjell.no", Normal }, { "flakstad.no", Normal }, { "flatanger.no", Normal }, { "flekkefjord.no", Normal },
+		{ "flesberg.no", Normal }, { "flora.no", Normal }, { "fla.no", Normal }, { "fl\303\245.no", Normal },
+		{ "xn--fl-zia.no", Normal }, { "folldal.no", Normal }, { "forsand.no", Normal }, { "fosnes.no", Normal },
+		{ "frei.no", Normal }, { "frogn.no", Normal }, { "froland.no", Normal }, { "frosta.no", Normal },
+		{ "frana.no", Normal }, { "fr\303\246na.no", Normal }, { "xn--frna-woa.no", Normal }, { "froya.no", Normal },
+		{ "fr\303\270ya.no", Normal }, { "xn--frya-hra.no", Normal }, { "fusa.no", Normal }, { "fyresdal.no", Normal },
+		{ "forde.no", Normal }, { "f\303\270rde.no", Normal }, { "xn--frde-gra.no", Normal }, { "gamvik.no", Normal },
+		{ "gangaviika.no", Normal }, { "g\303\241\305\213gaviika.no", Normal }, { "xn--ggaviika-8ya47h.no", Normal },
+		{ "gaular.no", Normal }, { "gausdal.no", Normal }, { "gildeskal.no", Normal }, { "gildesk\303\245l.no", Normal },
+		{ "xn--gildeskl-g0a.no", Normal }, { "giske.no", Normal }, { "gjemnes.no", Normal }, { "gjerdrum.no", Normal },
+		{ "gjerstad.no", Normal }, { "gjesdal.no", Normal }, { "gjovik.no", Normal }, { "gj\303\270vik.no", Normal },
+		{ "xn--gjvik-wua.no", Normal }, { "gloppen.no", Normal }, { "gol.no", Normal }, { "gran.no", Normal },
+		{ "grane.no", Normal }, { "granvin.no", Normal }, { "gratangen.no", Normal }, { "grimstad.no", Normal },
+		{ "grong.no", Normal }, { "kraanghke.no", Normal }, { "kr\303\245anghke.no", Normal },
+		{ "xn--kranghke-b0a.no", Normal }, { "grue.no", Normal }, { "gulen.no", Normal }, { "hadsel.no", Normal },
+		{ "halden.no", Normal }, { "halsa.no", Normal }, { "hamar.no", Normal }, { "hamaroy.no", Normal },
+		{ "habmer.no", Normal }, { "h\303\241bmer.no", Normal }, { "xn--hbmer-xqa.no", Normal }, { "hapmir.no", Normal },
+		{ "h\303\241pmir.no", Normal }, { "xn--hpmir-xqa.no", Normal }, { "hammerfest.no", Normal },
+		{ "hammarfeasta.no", Normal }, { "h\303\241mm\303\241rfeasta.no", Normal }, { "xn--hmmrfeasta-s4ac.no", Normal },
+		{ "haram.no", Normal }, { "hareid.no", Normal }, { "harstad.no", Normal }, { "hasvik.no", Normal },
+		{ "aknoluokta.no", Normal }, { "\303\241k\305\213oluokta.no", Normal }, { "xn--koluokta-7ya57h.no", Normal },
+		{ "hattfjelldal.no", Normal }, { "aarborte.no", Normal }, { "haugesund.no", Normal }, { "hemne.no", Normal },
+		{ "hemnes.no", Normal }, { "hemsedal.no", Normal }, { "heroy.more-og-romsdal.no", Normal },
+		{ "her\303\270y.m\303\270re-og-romsdal.no", Normal }, { "xn--hery-ira.xn--mre-og-romsdal-qqb.no", Normal },
+		{ "heroy.nordland.no", Normal }, { "her\303\270y.nordland.no", Normal }, { "xn--hery-ira.nordland.no", Normal },
+		{ "hitra.no", Normal }, { "hjartdal.no", Normal }, { "hjelmeland.no", Normal }, { "hobol.no", Normal },
+		{ "hob\303\270l.no", Normal }, { "xn--hobl-ira.no", Normal }, { "hof.no", Normal }, { "hol.no", Normal },
+		{ "hole.no", Normal }, { "holmestrand.no", Normal }, { "holtalen.no", Normal }, { "holt\303\245len.no", Normal },
+		{ "xn--holtlen-hxa.no", Normal }, { "hornindal.no", Normal }, { "horten.no", Normal }, { "hurdal.no", Normal },
+		{ "hurum.no", Normal }, { "hvaler.no", Normal }, { "hyllestad.no", Normal }, { "hagebostad.no", Normal },
+		{ "h\303\246gebostad.no", Normal }, { "xn--hgebostad-g3a.no", Normal }, { "hoyanger.no", Normal },
+		{ "h\303\270yanger.no", Normal }, { "xn--hyanger-q1a.no", Normal }, { "hoylandet.no", Normal },
+		{ "h\303\270ylandet.no", Normal }, { "xn--hylandet-54a.no", Normal }, { "ha.no", Normal },
+		{ "h\303\245.no", Normal }, { "xn--h-2fa.no", Normal }, { "ibestad.no", Normal }, { "inderoy.no", Normal },
+		{ "inder\303\270y.no", Normal }, { "xn--indery-fya.no", Normal }, { "iveland.no", Normal },
+		{ "jevnaker.no", Normal }, { "jondal.no", Normal }, { "jolster.no", Normal }, { "j\303\270lster.no", Normal },
+		{ "xn--jlster-bya.no", Normal }, { "karasjok.no", Normal }, { "karasjohka.no", Normal },
+		{ "k\303\241r\303\241\305\241johka.no", Normal }, { "xn--krjohka-hwab49j.no", Normal }, { "karlsoy.no", Normal },
+		{ "galsa.no", Normal }, { "g\303\241ls\303\241.no", Normal }, { "xn--gls-elac.no", Normal },
+		{ "karmoy.no", Normal }, { "karm\303\270y.no", Normal }, { "xn--karmy-yua.no", Normal },
+		{ "kautokeino.no", Normal }, { "guovdageaidnu.no", Normal }, { "klepp.no", Normal }, { "klabu.no", Normal },
+		{ "kl\303\246bu.no", Normal }, { "xn--klbu-woa.no", Normal }, { "kongsberg.no", Normal },
+		{ "kongsvinger.no", Normal }, { "kragero.no", Normal }, { "krager\303\270.no", Normal },
+		{ "xn--krager-gya.no", Normal }, { "kristiansand.no", Normal }, { "kristiansund.no", Normal },
+		{ "krodsherad.no", Normal }, { "kr\303\270dsherad.no", Normal }, { "xn--krdsherad-m8a.no", Normal },
+		{ "kvalsund.no", Normal }, { "rahkkeravju.no", Normal }, { "r\303\241hkker\303\241vju.no", Normal },
+		{ "xn--rhkkervju-01af.no", Normal }, { "kvam.no", Normal }, { "kvinesdal.no", Normal }, { "kvinnherad.no", Normal },
+		{ "kviteseid.no", Normal }, { "kvitsoy.no", Normal }, { "kvits\303\270y.no", Normal },
+		{ "xn--kvitsy-fya.no", Normal }, { "kvafjord.no", Normal }, { "kv\303\246fjord.no", Normal },
+		{ "xn--kvfjord-nxa.no", Normal }, { "giehtavuoatna.no", Normal }, { "kvanangen.no", Normal },
+		{ "kv\303\246nangen.no", Normal }, { "xn--kvnangen-k0a.no", Normal }, { "navuotna.no", Normal },
+		{ "n\303\241vuotna.no", Normal }, { "xn--nvuotna-hwa.no", Normal }, { "kafjord.no", Normal },
+		{ "k\303\245fjord.no", Normal }, { "xn--kfjord-iua.no", Normal }, { "gaivuotna.no", Normal },
+		{ "g\303\241ivuotna.no", Normal }, { "xn--givuotna-8ya.no", Normal }, { "larvik.no", Normal },
+		{ "lavangen.no", Normal }, { "lavagis.no", Normal }, { "loabat.no", Normal }, { "loab\303\241t.no", Normal },
+		{ "xn--loabt-0qa.no", Normal }, { "lebesby.no", Normal }, { "davvesiida.no", Normal }, { "leikanger.no", Normal },
+		{ "leirfjord.no", Normal }, { "leka.no", Normal }, { "leksvik.no", Normal }, { "lenvik.no", Normal },
+		{ "leangaviika.no", Normal }, { "lea\305\213gaviika.no", Normal }, { "xn--leagaviika-52b.no", Normal },
+		{ "lesja.no", Normal }, { "levanger.no", Normal }, { "lier.no", Normal }, { "lierne.no", Normal },
+		{ "lillehammer.no", Normal }, { "lillesand.no", Normal }, { "lindesnes.no", Normal }, { "lindas.no", Normal },
+		{ "lind\303\245s.no", Normal }, { "xn--linds-pra.no", Normal }, { "lom.no", Normal }, { "loppa.no", Normal },
+		{ "lahppi.no", Normal }, { "l\303\241hppi.no", Normal }, { "xn--lhppi-xqa.no", Normal }, { "lund.no", Normal },
+		{ "lunner.no", Normal }, { "luroy.no", Normal }, { "lur\303\270y.no", Normal }, { "xn--lury-ira.no", Normal },
+		{ "luster.no", Normal }, { "lyngdal.no", Normal }, { "lyngen.no", Normal }, { "ivgu.no", Normal },
+		{ "lardal.no", Normal }, { "lerdal.no", Normal }, { "l\303\246rdal.no", Normal }, { "xn--lrdal-sra.no", Normal },
+		{ "lodingen.no", Normal }, { "l\303\270dingen.no", Normal }, { "xn--ldingen-q1a.no", Normal },
+		{ "lorenskog.no", Normal }, { "l\303\270renskog.no", Normal }, { "xn--lrenskog-54a.no", Normal },
+		{ "loten.no", Normal }, { "l\303\270ten.no", Normal }, { "xn--lten-gra.no", Normal }, { "malvik.no", Normal },
+		{ "masoy.no", Normal }, { "m\303\245s\303\270y.no", Normal }, { "xn--msy-ula0h.no", Normal },
+		{ "muosat.no", Normal }, { "muos\303\241t.no", Normal }, { "xn--muost-0qa.no", Normal }, { "mandal.no", Normal },
+		{ "marker.no", Normal }, { "marnardal.no", Normal }, { "masfjorden.no", Normal }, { "meland.no", Normal },
+		{ "meldal.no", Normal }, { "melhus.no", Normal }, { "meloy.no", Normal }, { "mel\303\270y.no", Normal },
+		{ "xn--mely-ira.no", Normal }, { "meraker.no", Normal }, { "mer\303\245ker.no", Normal },
+		{ "xn--merker-kua.no", Normal }, { "moareke.no", Normal }, { "mo\303\245reke.no", Normal },
+		{ "xn--moreke-jua.no", Normal }, { "midsund.no", Normal }, { "midtre-gauldal.no", Normal },
+		{ "modalen.no", Normal }, { "modum.no", Normal }, { "molde.no", Normal }, { "moskenes.no", Normal },
+		{ "moss.no", Normal }, { "mosvik.no", Normal }, { "malselv.no", Normal }, { "m\303\245lselv.no", Normal },
+		{ "xn--mlselv-iua.no", Normal }, { "malatvuopmi.no", Normal }, { "m\303\241latvuopmi.no", Normal },
+		{ "xn--mlatvuopmi-s4a.no", Normal }, { "namdalseid.no", Normal }, { "aejrie.no", Normal }, { "namsos.no", Normal },
+		{ "namsskogan.no", Normal }, { "naamesjevuemie.no", Normal }, { "n\303\245\303\245mesjevuemie.no", Normal },
+		{ "xn--nmesjevuemie-tcba.no", Normal }, { "laakesvuemie.no", Normal }, { "nannestad.no", Normal },
+		{ "narvik.no", Normal }, { "narviika.no", Normal }, { "naustdal.no", Normal }, { "nedre-eiker.no", Normal },
+		{ "nes.akershus.no", Normal }, { "nes.buskerud.no", Normal }, { "nesna.no", Normal }, { "nesodden.no", Normal },
+		{ "nesseby.no", Normal }, { "unjarga.no", Normal }, { "unj\303\241rga.no", Normal },
+		{ "xn--unjrga-rta.no", Normal }, { "nesset.no", Normal }, { "nissedal.no", Normal }, { "nittedal.no", Normal },
+		{ "nord-aurdal.no", Normal }, { "nord-fron.no", Normal }, { "nord-odal.no", Normal }, { "norddal.no", Normal },
+		{ "nordkapp.no", Normal }, { "davvenjarga.no", Normal }, { "davvenj\303\241rga.no", Normal },
+		{ "xn--davvenjrga-y4a.no", Normal }, { "nordre-land.no", Normal }, { "nordreisa.no", Normal },
+		{ "raisa.no", Normal }, { "r\303\241isa.no", Normal }, { "xn--risa-5na.no", Normal },
+		{ "nore-og-uvdal.no", Normal }, { "notodden.no", Normal }, { "naroy.no", Normal },
+		{ "n\303\246r\303\270y.no", Normal }, { "xn--nry-yla5g.no", Normal }, { "notteroy.no", Normal },
+		{ "n\303\270tter\303\270y.no", Normal }, { "xn--nttery-byae.no", Normal }, { "odda.no", Normal },
+		{ "oksnes.no", Normal }, { "\303\270ksnes.no", Normal }, { "xn--ksnes-uua.no", Normal }, { "oppdal.no", Normal },
+		{ "oppegard.no", Normal }, { "oppeg\303\245rd.no", Normal }, { "xn--oppegrd-ixa.no", Normal },
+		{ "orkdal.no", Normal }, { "orland.no", Normal }, { "\303\270rland.no", Normal }, { "xn--rland-uua.no", Normal },
+		{ "orskog.no", Normal }, { "\303\270rskog.no", Normal }, { "xn--rskog-uua.no", Normal }, { "orsta.no", Normal },
+		{ "\303\270rsta.no", Normal }, { "xn--rsta-fra.no", Normal }, { "os.hedmark.no", Normal },
+		{ "os.hordaland.no", Normal }, { "osen.no", Normal }, { "osteroy.no", Normal }, { "oster\303\270y.no", Normal },
+		{ "xn--ostery-fya.no", Normal }, { "ostre-toten.no", Normal }, { "\303\270stre-toten.no", Normal },
+		{ "xn--stre-toten-zcb.no", Normal }, { "overhalla.no", Normal }, { "ovre-eiker.no", Normal },
+		{ "\303\270vre-eiker.no", Normal }, { "xn--vre-eiker-k8a.no", Normal }, { "oyer.no", Normal },
+		{ "\303\270yer.no", Normal }, { "xn--yer-zna.no", Normal }, { "oygarden.no", Normal },
+		{ "\303\270ygarden.no", Normal }, { "xn--ygarden-p1a.no", Normal }, { "oystre-slidre.no", Normal },
+		{ "\303\270ystre-slidre.no", Normal }, { "xn--ystre-slidre-ujb.no", Normal }, { "porsanger.no", Normal },
+		{ "porsangu.no", Normal }, { "pors\303\241\305\213gu.no", Normal }, { "xn--porsgu-sta26f.no", Normal },
+		{ "porsgrunn.no", Normal }, { "radoy.no", Normal }, { "rad\303\270y.no", Normal }, { "xn--rady-ira.no", Normal },
+		{ "rakkestad.no", Normal }, { "rana.no", Normal }, { "ruovat.no", Normal }, { "randaberg.no", Normal },
+		{ "rauma.no", Normal }, { "rendalen.no", Normal }, { "rennebu.no", Normal }, { "rennesoy.no", Normal },
+		{ "rennes\303\270y.no", Normal }, { "xn--rennesy-v1a.no", Normal }, { "rindal.no", Normal },
+		{ "ringebu.no", Normal }, { "ringerike.no", Normal }, { "ringsaker.no", Normal }, { "rissa.no", Normal },
+		{ "risor.no", Normal }, { "ris\303\270r.no", Normal }, { "xn--risr-ira.no", Normal }, { "roan.no", Normal },
+		{ "rollag.no", Normal }, { "rygge.no", Normal }, { "ralingen.no", Normal }, { "r\303\246lingen.no", Normal },
+		{ "xn--rlingen-mxa.no", Normal }, { "rodoy.no", Normal }, { "r\303\270d\303\270y.no", Normal },
+		{ "xn--rdy-0nab.no", Normal }, { "romskog.no", Normal }, { "r\303\270mskog.no", Normal },
+		{ "xn--rmskog-bya.no", Normal }, { "roros.no", Normal }, { "r\303\270ros.no", Normal },
+		{ "xn--rros-gra.no", Normal }, { "rost.no", Normal }, { "r\303\270st.no", Normal }, { "xn--rst-0na.no", Normal },
+		{ "royken.no", Normal }, { "r\303\270yken.no", Normal }, { "xn--ryken-vua.no", Normal }, { "royrvik.no", Normal },
+		{ "r\303\270yrvik.no", Normal }, { "xn--ryrvik-bya.no", Normal }, { "rade.no", Normal },
+		{ "r\303\245de.no", Normal }, { "xn--rde-ula.no", Normal }, { "salangen.no", Normal }, { "siellak.no", Normal },
+		{ "saltdal.no", Normal }, { "salat.no", Normal }, { "s\303\241l\303\241t.no", Normal },
+		{ "xn--slt-elab.no", Normal }, { "s\303\241lat.no", Normal }, { "xn--slat-5na.no", Normal },
+		{ "samnanger.no", Normal }, { "sande.more-og-romsdal.no", Normal }, { "sande.m\303\270re-og-romsdal.no", Normal },
+		{ "sande.xn--mre-og-romsdal-qqb.no", Normal }, { "sande.vestfold.no", Normal }, { "sandefjord.no", Normal },
+		{ "sandnes.no", Normal }, { "sandoy.no", Normal }, { "sand\303\270y.no", Normal }, { "xn--sandy-yua.no", Normal },
+		{ "sarpsborg.no", Normal }, { "sauda.no", Normal }, { "sauherad.no", Normal }, { "sel.no", Normal },
+		{ "selbu.no", Normal }, { "selje.no", Normal }, { "seljord.no", Normal }, { "sigdal.no", Normal },
+		{ "siljan.no", Normal }, { "sirdal.no", Normal }, { "skaun.no", Normal }, { "skedsmo.no", Normal },
+		{ "ski.no", Normal }, { "skien.no", Normal }, { "skiptvet.no", Normal }, { "skjervoy.no", Normal },
+		{ "skjerv\303\270y.no", Normal }, { "xn--skjervy-v1a.no", Normal }, { "skierva.no", Normal },
+		{ "skierv\303\241.no", Normal }, { "xn--skierv-uta.no", Normal }, { "skjak.no", Normal },
+		{ "skj\303\245k.no", Normal }, { "xn--skjk-soa.no", Normal }, { "skodje.no", Normal }, { "skanland.no", Normal },
+		{ "sk\303\245nland.no", Normal }, { "xn--sknland-fxa.no", Normal }, { "skanit.no", Normal },
+		{ "sk\303\241nit.no", Normal }, { "xn--sknit-yqa.no", Normal }, { "smola.no", Normal },
+		{ "sm\303\270la.no", Normal }, { "xn--smla-hra.no", Normal }, { "snillfjord.no", Normal }, { "snasa.no", Normal },
+		{ "sn\303\245sa.no", Normal }, { "xn--snsa-roa.no", Normal }, { "snoasa.no", Normal }, { "snaase.no", Normal },
+		{ "sn\303\245ase.no", Normal }, { "xn--snase-nra.no", Normal }, { "sogndal.no", Normal }, { "sokndal.no", Normal },
+		{ "sola.no", Normal }, { "solund.no", Normal }, { "songdalen.no", Normal }, { "sortland.no", Normal },
+		{ "spydeberg.no", Normal }, { "stange.no", Normal }, { "stavanger.no", Normal }, { "steigen.no", Normal },
+		{ "steinkjer.no", Normal }, { "stjordal.no", Normal }, { "stj\303\270rdal.no", Normal },
+		{ "xn--stjrdal-s1a.no", Normal }, { "stokke.no", Normal }, { "stor-elvdal.no", Normal }, { "stord.no", Normal },
+		{ "stordal.no", Normal }, { "storfjord.no", Normal }, { "omasvuotna.no", Normal }, { "strand.no", Normal },
+		{ "stranda.no", Normal }, { "stryn.no", Normal }, { "sula.no", Normal }, { "suldal.no", Normal },
+		{ "sund.no", Normal }, { "sunndal.no", Normal }, { "surnadal.no", Normal }, { "sveio.no", Normal },
+		{ "svelvik.no", Normal }, { "sykkylven.no", Normal }, { "sogne.no", Normal }, { "s\303\270gne.no", Normal },
+		{ "xn--sgne-gra.no", Normal }, { "somna.no", Normal }, { "s\303\270mna.no", Normal }, { "xn--smna-gra.no", Normal },
+		{ "sondre-land.no", Normal }, { "s\303\270ndre-land.no", Normal }, { "xn--sndre-land-0cb.no", Normal },
+		{ "sor-aurdal.no", Normal }, { "s\303\270r-aurdal.no", Normal }, { "xn--sr-aurdal-l8a.no", Normal },
+		{ "sor-fron.no", Normal }, { "s\303\270r-fron.no", Normal }, { "xn--sr-fron-q1a.no", Normal },
+		{ "sor-odal.no", Normal }, { "s\303\270r-odal.no", Normal }, { "xn--sr-odal-q1a.no", Normal },
+		{ "sor-varanger.no", Normal }, { "s\303\270r-varanger.no", Normal }, { "xn--sr-varanger-ggb.no", Normal },
+		{ "matta-varjjat.no", Normal }, { "m\303\241tta-v\303\241rjjat.no", Normal }, { "xn--mtta-vrjjat-k7af.no", Normal },
+		{ "sorfold.no", Normal }, { "s\303\270rfold.no", Normal }, { "xn--srfold-bya.no", Normal },
+		{ "sorreisa.no", Normal }, { "s\303\270rreisa.no", Normal }, { "xn--srreisa-q1a.no", Normal },
+		{ "sorum.no", Normal }, { "s\303\270rum.no", Normal }, { "xn--srum-gra.no", Normal }, { "tana.no", Normal },
+		{ "deatnu.no", Normal }, { "time.no", Normal }, { "tingvoll.no", Normal }, { "tinn.no", Normal },
+		{ "tjeldsund.no", Normal }, { "dielddanuorri.no", Normal }, { "tjome.no", Normal }, { "tj\303\270me.no", Normal },
+		{ "xn--tjme-hra.no", Normal }, { "tokke.no", Normal }, { "tolga.no", Normal }, { "torsken.no", Normal },
+		{ "tranoy.no", Normal }, { "tran\303\270y.no", Normal }, { "xn--trany-yua.no", Normal }, { "tromso.no", Normal },
+		{ "troms\303\270.no", Normal }, { "xn--troms-zua.no", Normal }, { "tromsa.no", Normal }, { "romsa.no", Normal },
+		{ "trondheim.no", Normal }, { "troandin.no", Normal }, { "trysil.no", Normal }, { "trana.no", Normal },
+		{ "tr\303\246na.no", Normal }, { "xn--trna-woa.no", Normal }, { "trogstad.no", Normal },
+		{ "tr\303\270gstad.no", Normal }, { "xn--trgstad-r1a.no", Normal }, { "tvedestrand.no", Normal },
+		{ "tydal.no", Normal }, { "tynset.no", Normal }, { "tysfjord.no", Normal }, { "divtasvuodna.no", Normal },
+		{ "divttasvuotna.no", Normal }, { "tysnes.no", Normal }, { "tysvar.no", Normal }, { "tysv\303\246r.no", Normal },
+		{ "xn--tysvr-vra.no", Normal }, { "tonsberg.no", Normal }, { "t\303\270nsberg.no", Normal },
+		{ "xn--tnsberg-q1a.no", Normal }, { "ullensaker.no", Normal }, { "ullensvang.no", Normal }, { "ulvik.no", Normal },
+		{ "utsira.no", Normal }, { "vadso.no", Normal }, { "vads\303\270.no", Normal }, { "xn--vads-jra.no", Normal },
+		{ "cahcesuolo.no", Normal }, { "\304\215\303\241hcesuolo.no", Normal }, { "xn--hcesuolo-7ya35b.no", Normal },
+		{ "vaksdal.no", Normal }, { "valle.no", Normal }, { "vang.no", Normal }, { "vanylven.no", Normal },
+		{ "vardo.no", Normal }, { "vard\303\270.no", Normal }, { "xn--vard-jra.no", Normal }, { "varggat.no", Normal },
+		{ "v\303\241rgg\303\241t.no", Normal }, { "xn--vrggt-xqad.no", Normal }, { "vefsn.no", Normal },
+		{ "vaapste.no", Normal }, { "vega.no", Normal }, { "vegarshei.no", Normal }, { "veg\303\245rshei.no", Normal },
+		{ "xn--vegrshei-c0a.no", Normal }, { "vennesla.no", Normal }, { "verdal.no", Normal }, { "verran.no", Normal },
+		{ "vestby.no", Normal }, { "vestnes.no", Normal }, { "vestre-slidre.no", Normal }, { "vestre-toten.no", Normal },
+		{ "vestvagoy.no", Normal }, { "vestv\303\245g\303\270y.no", Normal }, { "xn--vestvgy-ixa6o.no", Normal },
+		{ "vevelstad.no", Normal }, { "vik.no", Normal }, { "vikna.no", Normal }, { "vindafjord.no", Normal },
+		{ "volda.no", Normal }, { "voss.no", Normal }, { "varoy.no", Normal }, { "v\303\246r\303\270y.no", Normal },
+		{ "xn--vry-yla5g.no", Normal }, { "vagan.no", Normal }, { "v\303\245gan.no", Normal },
+		{ "xn--vgan-qoa.no", Normal }, { "voagat.no", Normal }, { "vagsoy.no", Normal },
+		{ "v\303\245gs\303\270y.no", Normal }, { "xn--vgsy-qoa0j.no", Normal }, { "vaga.no", Normal },
+		{ "v\303\245g\303\245.no", Normal }, { "xn--vg-yiab.no", Normal }, { "valer.ostfold.no", Normal },
+		{ "v\303\245ler.\303\270stfold.no", Normal }, { "xn--vler-qoa.xn--stfold-9xa.no", Normal },
+		{ "valer.hedmark.no", Normal }, { "v\303\245ler.hedmark.no", Normal }, { "xn--vler-qoa.hedmark.no", Normal },
+		{ "np", Wildcard }, { "nr", Normal }, { "biz.nr", Normal }, { "info.nr", Normal }, { "gov.nr", Normal },
+		{ "edu.nr", Normal }, { "org.nr", Normal }, { "net.nr", Normal }, { "com.nr", Normal }, { "nu", Normal },
+		{ "nz", Normal }, { "ac.nz", Normal }, { "co.nz", Normal }, { "cri.nz", Normal }, { "geek.nz", Normal },
+		{ "gen.nz", Normal }, { "govt.nz", Normal }, { "health.nz", Normal }, { "iwi.nz", Normal }, { "kiwi.nz", Normal },
+		{ "maori.nz", Normal }, { "mil.nz", Normal }, { "m\304\201ori.nz", Normal }, { "xn--mori-qsa.nz", Normal },
+		{ "net.nz", Normal }, { "org.nz", Normal }, { "parliament.nz", Normal }, { "school.nz", Normal }, { "om", Normal },
+		{ "co.om", Normal }, { "com.om", Normal }, { "edu.om", Normal }, { "gov.om", Normal }, { "med.om", Normal },
+		{ "museum.om", Normal }, { "net.om", Normal }, { "org.om", Normal }, { "pro.om", Normal }, { "onion", Normal },
+		{ "org", Normal }, { "pa", Normal }, { "ac.pa", Normal }, { "gob.pa", Normal }, { "com.pa", Normal },
+		{ "org.pa", Normal }, { "sld.pa", Normal }, { "edu.pa", Normal }, { "net.pa", Normal }, { "ing.pa", Normal },
+		{ "abo.pa", Normal }, { "med.pa", Normal }, { "nom.pa", Normal }, { "pe", Normal }, { "edu.pe", Normal },
+		{ "gob.pe", Normal }, { "nom.pe", Normal }, { "mil.pe", Normal }, { "org.pe", Normal }, { "com.pe", Normal },
+		{ "net.pe", Normal }, { "pf", Normal }, { "com.pf", Normal }, { "org.pf", Normal }, { "edu.pf", Normal },
+		{ "pg", Wildcard }, { "ph", Normal }, { "com.ph", Normal }, { "net.ph", Normal }, { "org.ph", Normal },
+		{ "gov.ph", Normal }, { "edu.ph", Normal }, { "ngo.ph", Normal }, { "mil.ph", Normal }, { "i.ph", Normal },
+		{ "pk", Normal }, { "com.pk", Normal }, { "net.pk", Normal }, { "edu.pk", Normal }, { "org.pk", Normal },
+		{ "fam.pk", Normal }, { "biz.pk", Normal }, { "web.pk", Normal }, { "gov.pk", Normal }, { "gob.pk", Normal },
+		{ "gok.pk", Normal }, { "gon.pk", Normal }, { "gop.pk", Normal }, { "gos.pk", Normal }, { "info.pk", Normal },
+		{ "pl", Normal }, { "com.pl", Normal }, { "net.pl", Normal }, { "org.pl", Normal }, { "aid.pl", Normal },
+		{ "agro.pl", Normal }, { "atm.pl", Normal }, { "auto.pl", Normal }, { "biz.pl", Normal }, { "edu.pl", Normal },
+		{ "gmina.pl", Normal }, { "gsm.pl", Normal }, { "info.pl", Normal }, { "mail.pl", Normal }, { "miasta.pl", Normal },
+		{ "media.pl", Normal }, { "mil.pl", Normal }, { "nieruchomosci.pl", Normal }, { "nom.pl", Normal },
+		{ "pc.pl", Normal }, { "powiat.pl", Normal }, { "priv.pl", Normal }, { "realestate.pl", Normal },
+		{ "rel.pl", Normal }, { "sex.pl", Normal }, { "shop.pl", Normal }, { "sklep.pl", Normal }, { "sos.pl", Normal },
+		{ "szkola.pl", Normal }, { "targi.pl", Normal }, { "tm.pl", Normal }, { "tourism.pl", Normal },
+		{ "travel.pl", Normal }, { "turystyka.pl", Normal }, { "gov.pl", Normal }, { "ap.gov.pl", Normal },
+		{ "ic.gov.pl", Normal }, { "is.gov.pl", Normal }, { "us.gov.pl", Normal }, { "kmpsp.gov.pl", Normal },
+		{ "kppsp.gov.pl", Normal }, { "kwpsp.gov.pl", Normal }, { "psp.gov.pl", Normal }, { "wskr.gov.pl", Normal },
+		{ "kwp.gov.pl", Normal }, { "mw.gov.pl", Normal }, { "ug.gov.pl", Normal }, { "um.gov.pl", Normal },
+		{ "umig.gov.pl", Normal }, { "ugim.gov.pl", Normal }, { "upow.gov.pl", Normal }, { "uw.gov.pl", Normal },
+		{ "starostwo.gov.pl", Normal }, { "pa.gov.pl", Normal }, { "po.gov.pl", Normal }, { "psse.gov.pl", Normal },
+		{ "pup.gov.pl", Normal }, { "rzgw.gov.pl", Normal }, { "sa.gov.pl", Normal }, { "so.gov.pl", Normal },
+		{ "sr.gov.pl", Normal }, { "wsa.gov.pl", Normal }, { "sko.gov.pl", Normal }, { "uzs.gov.pl", Normal },
+		{ "wiih.gov.pl", Normal }, { "winb.gov.pl", Normal }, { "pinb.gov.pl", Normal }, { "wios.gov.pl", Normal },
+		{ "witd.gov.pl", Normal }, { "wzmiuw.gov.pl", Normal }, { "piw.gov.pl", Normal }, { "wiw.gov.pl", Normal },
+		{ "griw.gov.pl", Normal }, { "wif.gov.pl", Normal }, { "oum.gov.pl", Normal }, { "sdn.gov.pl", Normal },
+		{ "zp.gov.pl", Normal }, { "uppo.gov.pl", Normal }, { "mup.gov.pl", Normal }, { "wuoz.gov.pl", Normal },
+		{ "konsulat.gov.pl", Normal }, { "oirm.gov.pl", Normal }, { "augustow.pl", Normal }, { "babia-gora.pl", Normal },
+		{ "bedzin.pl", Normal }, { "beskidy.pl", Normal }, { "bialowieza.pl", Normal }, { "bialystok.pl", Normal },
+		{ "bielawa.pl", Normal }, { "bieszczady.pl", Normal }, { "boleslawiec.pl", Normal }, { "bydgoszcz.pl", Normal },
+		{ "bytom.pl", Normal }, { "cieszyn.pl", Normal }, { "czeladz.pl", Normal }, { "czest.pl", Normal },
+		{ "dlugoleka.pl", Normal }, { "elblag.pl", Normal }, { "elk.pl", Normal }, { "glogow.pl", Normal },
+		{ "gniezno.pl", Normal }, { "gorlice.pl", Normal }, { "grajewo.pl", Normal }, { "ilawa.pl", Normal },
+		{ "jaworzno.pl", Normal }, { "jelenia-gora.pl", Normal }, { "jgora.pl", Normal }, { "kalisz.pl", Normal },
+		{ "kazimierz-dolny.pl", Normal }, { "karpacz.pl", Normal }, { "kartuzy.pl", Normal }, { "kaszuby.pl", Normal },
+		{ "katowice.pl", Normal }, { "kepno.pl", Normal }, { "ketrzyn.pl", Normal }, { "klodzko.pl", Normal },
+		{ "kobierzyce.pl", Normal }, { "kolobrzeg.pl", Normal }, { "konin.pl", Normal }, { "konskowola.pl", Normal },
+		{ "kutno.pl", Normal }, { "lapy.pl", Normal }, { "lebork.pl", Normal }, { "legnica.pl", Normal },
+		{ "lezajsk.pl", Normal }, { "limanowa.pl", Normal }, { "lomza.pl", Normal }, { "lowicz.pl", Normal },
+		{ "lubin.pl", Normal }, { "lukow.pl", Normal }, { "malbork.pl", Normal }, { "malopolska.pl", Normal },
+		{ "mazowsze.pl", Normal }, { "mazury.pl", Normal }, { "mielec.pl", Normal }, { "mielno.pl", Normal },
+		{ "mragowo.pl", Normal }, { "naklo.pl", Normal }, { "nowaruda.pl", Normal }, { "nysa.pl", Normal },
+		{ "olawa.pl", Normal }, { "olecko.pl", Normal }, { "olkusz.pl", Normal }, { "olsztyn.pl", Normal },
+		{ "opoczno.pl", Normal }, { "opole.pl", Normal }, { "ostroda.pl", Normal }, { "ostroleka.pl", Normal },
+		{ "ostrowiec.pl", Normal }, { "ostrowwlkp.pl", Normal }, { "pila.pl", Normal }, { "pisz.pl", Normal },
+		{ "podhale.pl", Normal }, { "podlasie.pl", Normal }, { "polkowice.pl", Normal }, { "pomorze.pl", Normal },
+		{ "pomorskie.pl", Normal }, { "prochowice.pl", Normal }, { "pruszkow.pl", Normal }, { "przeworsk.pl", Normal },
+		{ "pulawy.pl", Normal }, { "radom.pl", Normal }, { "rawa-maz.pl", Normal }, { "rybnik.pl", Normal },
+		{ "rzeszow.pl", Normal }, { "sanok.pl", Normal }, { "sejny.pl", Normal }, { "slask.pl", Normal },
+		{ "slupsk.pl", Normal }, { "sosnowiec.pl", Normal }, { "stalowa-wola.pl", Normal }, { "skoczow.pl", Normal },
+		{ "starachowice.pl", Normal }, { "stargard.pl", Normal }, { "suwalki.pl", Normal }, { "swidnica.pl", Normal },
+		{ "swiebodzin.pl", Normal }, { "swinoujscie.pl", Normal }, { "szczecin.pl", Normal }, { "szczytno.pl", Normal },
+		{ "tarnobrzeg.pl", Normal }, { "tgory.pl", Normal }, { "turek.pl", Normal }, { "tychy.pl", Normal },
+		{ "ustka.pl", Normal }, { "walbrzych.pl", Normal }, { "warmia.pl", Normal }, { "warszawa.pl", Normal },
+		{ "waw.pl", Normal }, { "wegrow.pl", Normal }, { "wielun.pl", Normal }, { "wlocl.pl", Normal },
+		{ "wloclawek.pl", Normal }, { "wodzislaw.pl", Normal }, { "wolomin.pl", Normal }, { "wroclaw.pl", Normal },
+		{ "zachpomor.pl", Normal }, { "zagan.pl", Normal }, { "zarow.pl", Normal }, { "zgora.pl", Normal },
+		{ "zgorzelec.pl", Normal }, { "pm", Normal }, { "pn", Normal }, { "gov.pn", Normal }, { "co.pn", Normal },
+		{ "org.pn", Normal }, { "edu.pn", Normal }, { "net.pn", Normal }, { "post", Normal }, { "pr", Normal },
+		{ "com.pr", Normal }, { "net.pr", Normal }, { "org.pr", Normal }, { "gov.pr", Normal }, { "edu.pr", Normal },
+		{ "isla.pr", Normal }, { "pro.pr", Normal }, { "biz.pr", Normal }, { "info.pr", Normal }, { "name.pr", Normal },
+		{ "est.pr", Normal }, { "prof.pr", Normal }, { "ac.pr", Normal }, { "pro", Normal }, { "aaa.pro", Normal },
+		{ "aca.pro", Normal }, { "acct.pro", Normal }, { "avocat.pro", Normal }, { "bar.pro", Normal },
+		{ "cpa.pro", Normal }, { "eng.pro", Normal }, { "jur.pro", Normal }, { "law.pro", Normal }, { "med.pro", Normal },
+		{ "recht.pro", Normal }, { "ps", Normal }, { "edu.ps", Normal }, { "gov.ps", Normal }, { "sec.ps", Normal },
+		{ "plo.ps", Normal }, { "com.ps", Normal }, { "org.ps", Normal }, { "net.ps", Normal }, { "pt", Normal },
+		{ "net.pt", Normal }, { "gov.pt", Normal }, { "org.pt", Normal }, { "edu.pt", Normal }, { "int.pt", Normal },
+		{ "publ.pt", Normal }, { "com.pt", Normal }, { "nome.pt", Normal }, { "pw", Normal }, { "co.pw", Normal },
+		{ "ne.pw", Normal }, { "or.pw", Normal }, { "ed.pw", Normal }, { "go.pw", Normal }, { "belau.pw", Normal },
+		{ "py", Normal }, { "com.py", Normal }, { "coop.py", Normal }, { "edu.py", Normal }, { "gov.py", Normal },
+		{ "mil.py", Normal }, { "net.py", Normal }, { "org.py", Normal }, { "qa", Normal }, { "com.qa", Normal },
+		{ "edu.qa", Normal }, { "gov.qa", Normal }, { "mil.qa", Normal }, { "name.qa", Normal }, { "net.qa", Normal },
+		{ "org.qa", Normal }, { "sch.qa", Normal }, { "re", Normal }, { "asso.re", Normal }, { "com.re", Normal },
+		{ "nom.re", Normal }, { "ro", Normal }, { "arts.ro", Normal }, { "com.ro", Normal }, { "firm.ro", Normal },
+		{ "info.ro", Normal }, { "nom.ro", Normal }, { "nt.ro", Normal }, { "org.ro", Normal }, { "rec.ro", Normal },
+		{ "store.ro", Normal }, { "tm.ro", Normal }, { "www.ro", Normal }, { "rs", Normal }, { "ac.rs", Normal },
+		{ "co.rs", Normal }, { "edu.rs", Normal }, { "gov.rs", Normal }, { "in.rs", Normal }, { "org.rs", Normal },
+		{ "ru", Normal }, { "rw", Normal }, { "ac.rw", Normal }, { "co.rw", Normal }, { "coop.rw", Normal },
+		{ "gov.rw", Normal }, { "mil.rw", Normal }, { "net.rw", Normal }, { "org.rw", Normal }, { "sa", Normal },
+		{ "com.sa", Normal }, { "net.sa", Normal }, { "org.sa", Normal }, { "gov.sa", Normal }, { "med.sa", Normal },
+		{ "pub.sa", Normal }, { "edu.sa", Normal }, { "sch.sa", Normal }, { "sb", Normal }, { "com.sb", Normal },
+		{ "edu.sb", Normal }, { "gov.sb", Normal }, { "net.sb", Normal }, { "org.sb", Normal }, { "sc", Normal },
+		{ "com.sc", Normal }, { "gov.sc", Normal }, { "net.sc", Normal }, { "org.sc", Normal }, { "edu.sc", Normal },
+		{ "sd", Normal }, { "com.sd", Normal }, { "net.sd", Normal }, { "org.sd", Normal }, { "edu.sd", Normal },
+		{ "med.sd", Normal }, { "tv.sd", Normal }, { "gov.sd", Normal }, { "info.sd", Normal }, { "se", Normal },
+		{ "a.se", Normal }, { "ac.se", Normal }, { "b.se", Normal }, { "bd.se", Normal }, { "brand.se", Normal },
+		{ "c.se", Normal }, { "d.se", Normal }, { "e.se", Normal }, { "f.se", Normal }, { "fh.se", Normal },
+		{ "fhsk.se", Normal }, { "fhv.se", Normal }, { "g.se", Normal }, { "h.se", Normal }, { "i.se", Normal },
+		{ "k.se", Normal }, { "komforb.se", Normal }, { "kommunalforbund.se", Normal }, { "komvux.se", Normal },
+		{ "l.se", Normal }, { "lanbib.se", Normal }, { "m.se", Normal }, { "n.se", Normal },
+		{ "naturbruksgymn.se", Normal }, { "o.se", Normal }, { "org.se", Normal }, { "p.se", Normal },
+		{ "parti.se", Normal }, { "pp.se", Normal }, { "press.se", Normal }, { "r.se", Normal }, { "s.se", Normal },
+		{ "t.se", Normal }, { "tm.se", Normal }, { "u.se", Normal }, { "w.se", Normal }, { "x.se", Normal },
+		{ "y.se", Normal }, { "z.se", Normal }, { "sg", Normal }, { "com.sg", Normal }, { "net.sg", Normal },
+		{ "org.sg", Normal }, { "gov.sg", Normal }, { "edu.sg", Normal }, { "per.sg", Normal }, { "sh", Normal },
+		{ "com.sh", Normal }, { "net.sh", Normal }, { "gov.sh", Normal }, { "org.sh", Normal }, { "mil.sh", Normal },
+		{ "si", Normal }, { "sj", Normal }, { "sk", Normal }, { "sl", Normal }, { "com.sl", Normal }, { "net.sl", Normal },
+		{ "edu.sl", Normal }, { "gov.sl", Normal }, { "org.sl", Normal }, { "sm", Normal }, { "sn", Normal },
+		{ "art.sn", Normal }, { "com.sn", Normal }, { "edu.sn", Normal }, { "gouv.sn", Normal }, { "org.sn", Normal },
+		{ "perso.sn", Normal }, { "univ.sn", Normal }, { "so", Normal }, { "com.so", Normal }, { "edu.so", Normal },
+		{ "gov.so", Normal }, { "me.so", Normal }, { "net.so", Normal }, { "org.so", Normal }, { "sr", Normal },
+		{ "ss", Normal }, { "biz.ss", Normal }, { "com.ss", Normal }, { "edu.ss", Normal }, { "gov.ss", Normal },
+		{ "me.ss", Normal }, { "net.ss", Normal }, { "org.ss", Normal }, { "sch.ss", Normal }, { "st", Normal },
+		{ "co.st", Normal }, { "com.st", Normal }, { "consulado.st", Normal }, { "edu.st", Normal },
+		{ "embaixada.st", Normal }, { "mil.st", Normal }, { "net.st", Normal }, { "org.st", Normal },
+		{ "principe.st", Normal }, { "saotome.st", Normal }, { "store.st", Normal }, { "su", Normal }, { "sv", Normal },
+		{ "com.sv", Normal }, { "edu.sv", Normal }, { "gob.sv", Normal }, { "org.sv", Normal }, { "red.sv", Normal },
+		{ "sx", Normal }, { "gov.sx", Normal }, { "sy", Normal }, { "edu.sy", Normal }, { "gov.sy", Normal },
+		{ "net.sy", Normal }, { "mil.sy", Normal }, { "com.sy", Normal }, { "org.sy", Normal }, { "sz", Normal },
+		{ "co.sz", Normal }, { "ac.sz", Normal }, { "org.sz", Normal }, { "tc", Normal }, { "td", Normal },
+		{ "tel", Normal }, { "tf", Normal }, { "tg", Normal }, { "th", Normal }, { "ac.th", Normal }, { "co.th", Normal },
+		{ "go.th", Normal }, { "in.th", Normal }, { "mi.th", Normal }, { "net.th", Normal }, { "or.th", Normal },
+		{ "tj", Normal }, { "ac.tj", Normal }, { "biz.tj", Normal }, { "co.tj", Normal }, { "com.tj", Normal },
+		{ "edu.tj", Normal }, { "go.tj", Normal }, { "gov.tj", Normal }, { "int.tj", Normal }, { "mil.tj", Normal },
+		{ "name.tj", Normal }, { "net.tj", Normal }, { "nic.tj", Normal }, { "org.tj", Normal }, { "test.tj", Normal },
+		{ "web.tj", Normal }, { "tk", Normal }, { "tl", Normal }, { "gov.tl", Normal }, { "tm", Normal },
+		{ "com.tm", Normal }, { "co.tm", Normal }, { "org.tm", Normal }, { "net.tm", Normal }, { "nom.tm", Normal },
+		{ "gov.tm", Normal }, { "mil.tm", Normal }, { "edu.tm", Normal }, { "tn", Normal }, { "com.tn", Normal },
+		{ "ens.tn", Normal }, { "fin.tn", Normal }, { "gov.tn", Normal }, { "ind.tn", Normal }, { "info.tn", Normal },
+		{ "intl.tn", Normal }, { "mincom.tn", Normal }, { "nat.tn", Normal }, { "net.tn", Normal }, { "org.tn", Normal },
+		{ "perso.tn", Normal }, { "tourism.tn", Normal }, { "to", Normal }, { "com.to", Normal }, { "gov.to", Normal },
+		{ "net.to", Normal }, { "org.to", Normal }, { "edu.to", Normal }, { "mil.to", Normal }, { "tr", Normal },
+		{ "av.tr", Normal }, { "bbs.tr", Normal }, { "bel.tr", Normal }, { "biz.tr", Normal }, { "com.tr", Normal },
+		{ "dr.tr", Normal }, { "edu.tr", Normal }, { "gen.tr", Normal }, { "gov.tr", Normal }, { "info.tr", Normal },
+		{ "mil.tr", Normal }, { "k12.tr", Normal }, { "kep.tr", Normal }, { "name.tr", Normal }, { "net.tr", Normal },
+		{ "org.tr", Normal }, { "pol.tr", Normal }, { "tel.tr", Normal }, { "tsk.tr", Normal }, { "tv.tr", Normal },
+		{ "web.tr", Normal }, { "nc.tr", Normal }, { "gov.nc.tr", Normal }, { "tt", Normal }, { "co.tt", Normal },
+		{ "com.tt", Normal }, { "org.tt", Normal }, { "net.tt", Normal }, { "biz.tt", Normal }, { "info.tt", Normal },
+		{ "pro.tt", Normal }, { "int.tt", Normal }, { "coop.tt", Normal }, { "jobs.tt", Normal }, { "mobi.tt", Normal },
+		{ "travel.tt", Normal }, { "museum.tt", Normal }, { "aero.tt", Normal }, { "name.tt", Normal },
+		{ "gov.tt", Normal }, { "edu.tt", Normal }, { "tv", Normal }, { "tw", Normal }, { "edu.tw", Normal },
+		{ "gov.tw", Normal }, { "mil.tw", Normal }, { "com.tw", Normal }, { "net.tw", Normal }, { "org.tw", Normal },
+		{ "idv.tw", Normal }, { "game.tw", Normal }, { "ebiz.tw", Normal }, { "club.tw", Normal },
+		{ "\347\266\262\350\267\257.tw", Normal }, { "xn--zf0ao64a.tw", Normal }, { "\347\265\204\347\271\224.tw", Normal },
+		{ "xn--uc0atv.tw", Normal }, { "\345\225\206\346\245\255.tw", Normal }, { "xn--czrw28b.tw", Normal },
+		{ "tz", Normal }, { "ac.tz", Normal }, { "co.tz", Normal }, { "go.tz", Normal }, { "hotel.tz", Normal },
+		{ "info.tz", Normal }, { "me.tz", Normal }, { "mil.tz", Normal }, { "mobi.tz", Normal }, { "ne.tz", Normal },
+		{ "or.tz", Normal }, { "sc.tz", Normal }, { "tv.tz", Normal }, { "ua", Normal }, { "com.ua", Normal },
+		{ "edu.ua", Normal }, { "gov.ua", Normal }, { "in.ua", Normal }, { "net.ua", Normal }, { "org.ua", Normal },
+		{ "cherkassy.ua", Normal }, { "cherkasy.ua", Normal }, { "chernigov.ua", Normal }, { "chernihiv.ua", Normal },
+		{ "chernivtsi.ua", Normal }, { "chernovtsy.ua", Normal }, { "ck.ua", Normal }, { "cn.ua", Normal },
+		{ "cr.ua", Normal }, { "crimea.ua", Normal }, { "cv.ua", Normal }, { "dn.ua", Normal },
+		{ "dnepropetrovsk.ua", Normal }, { "dnipropetrovsk.ua", Normal }, { "donetsk.ua", Normal }, { "dp.ua", Normal },
+		{ "if.ua", Normal }, { "ivano-frankivsk.ua", Normal }, { "kh.ua", Normal }, { "kharkiv.ua", Normal },
+		{ "kharkov.ua", Normal }, { "kherson.ua", Normal }, { "khmelnitskiy.ua", Normal }, { "khmelnytskyi.ua", Normal },
+		{ "kiev.ua", Normal }, { "kirovograd.ua", Normal }, { "km.ua", Normal }, { "kr.ua", Normal }, { "krym.ua", Normal },
+		{ "ks.ua", Normal }, { "kv.ua", Normal }, { "kyiv.ua", Normal }, { "lg.ua", Normal }, { "lt.ua", Normal },
+		{ "lugansk.ua", Normal }, { "lutsk.ua", Normal }, { "lv.ua", Normal }, { "lviv.ua", Normal }, { "mk.ua", Normal },
+		{ "mykolaiv.ua", Normal }, { "nikolaev.ua", Normal }, { "od.ua", Normal }, { "odesa.ua", Normal },
+		{ "odessa.ua", Normal }, { "pl.ua", Normal }, { "poltava.ua", Normal }, { "rivne.ua", Normal },
+		{ "rovno.ua", Normal }, { "rv.ua", Normal }, { "sb.ua", Normal }, { "sebastopol.ua", Normal },
+		{ "sevastopol.ua", Normal }, { "sm.ua", Normal }, { "sumy.ua", Normal }, { "te.ua", Normal },
+		{ "ternopil.ua", Normal }, { "uz.ua", Normal }, { "uzhgorod.ua", Normal }, { "vinnica.ua", Normal },
+		{ "vinnytsia.ua", Normal }, { "vn.ua", Normal }, { "volyn.ua", Normal }, { "yalta.ua", Normal },
+		{ "zaporizhzhe.ua", Normal }, { "zaporizhzhia.ua", Normal }, { "zhitomir.ua", Normal }, { "zhytomyr.ua", Normal },
+		{ "zp.ua", Normal }, { "zt.ua", Normal }, { "ug", Normal }, { "co.ug", Normal }, { "or.ug", Normal },
+		{ "ac.ug", Normal }, { "sc.ug", Normal }, { "go.ug", Normal }, { "ne.ug", Normal }, { "com.ug", Normal },
+		{ "org.ug", Normal }, { "uk", Normal }, { "ac.uk", Normal }, { "co.uk", Normal }, { "gov.uk", Normal },
+		{ "ltd.uk", Normal }, { "me.uk", Normal }, { "net.uk", Normal }, { "nhs.uk", Normal }, { "org.uk", Normal },
+		{ "plc.uk", Normal }, { "police.uk", Normal }, { "sch.uk", Wildcard }, { "us", Normal }, { "dni.us", Normal },
+		{ "fed.us", Normal }, { "isa.us", Normal }, { "kids.us", Normal }, { "nsn.us", Normal }, { "ak.us", Normal },
+		{ "al.us", Normal }, { "ar.us", Normal }, { "as.us", Normal }, { "az.us", Normal }, { "ca.us", Normal },
+		{ "co.us", Normal }, { "ct.us", Normal }, { "dc.us", Normal }, { "de.us", Normal }, { "fl.us", Normal },
+		{ "ga.us", Normal }, { "gu.us", Normal }, { "hi.us", Normal }, { "ia.us", Normal }, { "id.us", Normal },
+		{ "il.us", Normal }, { "in.us", Normal }, { "ks.us", Normal }, { "ky.us", Normal }, { "la.us", Normal },
+		{ "ma.us", Normal }, { "md.us", Normal }, { "me.us", Normal }, { "mi.us", Normal }, { "mn.us", Normal },
+		{ "mo.us", Normal }, { "ms.us", Normal }, { "mt.us", Normal }, { "nc.us", Normal }, { "nd.us", Normal },
+		{ "ne.us", Normal }, { "nh.us", Normal }, { "nj.us", Normal }, { "nm.us", Normal }, { "nv.us", Normal },
+		{ "ny.us", Normal }, { "oh.us", Normal }, { "ok.us", Normal }, { "or.us", Normal }, { "pa.us", Normal },
+		{ "pr.us", Normal }, { "ri.us", Normal }, { "sc.us", Normal }, { "sd.us", Normal }, { "tn.us", Normal },
+		{ "tx.us", Normal }, { "ut.us", Normal }, { "vi.us", Normal }, { "vt.us", Normal }, { "va.us", Normal },
+		{ "wa.us", Normal }, { "wi.us", Normal }, { "wv.us", Normal }, { "wy.us", Normal }, { "k12.ak.us", Normal },
+		{ "k12.al.us", Normal }, { "k12.ar.us", Normal }, { "k12.as.us", Normal }, { "k12.az.us", Normal },
+		{ "k12.ca.us", Normal }, { "k12.co.us", Normal }, { "k12.ct.us", Normal }, { "k12.dc.us", Normal },
+		{ "k12.de.us", Normal }, { "k12.fl.us", Normal }, { "k12.ga.us", Normal }, { "k12.gu.us", Normal },
+		{ "k12.ia.us", Normal }, { "k12.id.us", Normal }, { "k12.il.us", Normal }, { "k12.in.us", Normal },
+		{ "k12.ks.us", Normal }, { "k12.ky.us", Normal }, { "k12.la.us", Normal }, { "k12.ma.us", Normal },
+		{ "k12.md.us", Normal }, { "k12.me.us", Normal }, { "k12.mi.us", Normal }, { "k12.mn.us", Normal },
+		{ "k12.mo.us", Normal }, { "k12.ms.us", Normal }, { "k12.mt.us", Normal }, { "k12.nc.us", Normal },
+		{ "k12.ne.us", Normal }, { "k12.nh.us", Normal }, { "k12.nj.us", Normal }, { "k12.nm.us", Normal },
+		{ "k12.nv.us", Normal }, { "k12.ny.us", Normal }, { "k12.oh.us", Normal }, { "k12.ok.us", Normal },
+		{ "k12.or.us", Normal }, { "k12.pa.us", Normal }, { "k12.pr.us", Normal }, { "k12.sc.us", Normal },
+		{ "k12.tn.us", Normal }, { "k12.tx.us", Normal }, { "k12.ut.us", Normal }, { "k12.vi.us", Normal },
+		{ "k12.vt.us", Normal }, { "k12.va.us", Normal }, { "k12.wa.us", Normal }, { "k12.wi.us", Normal },
+		{ "k12.wy.us", Normal }, { "cc.ak.us", Normal }, { "cc.al.us", Normal }, { "cc.ar.us", Normal },
+		{ "cc.as.us", Normal }, { "cc.az.us", Normal }, { "cc.ca.us", Normal }, { "cc.co.us", Normal },
+		{ "cc.ct.us", Normal }, { "cc.dc.us", Normal }, { "cc.de.us", Normal }, { "cc.fl.us", Normal },
+		{ "cc.ga.us", Normal }, { "cc.gu.us", Normal }, { "cc.hi.us", Normal }, { "cc.ia.us", Normal },
+		{ "cc.id.us", Normal }, { "cc.il.us", Normal }, { "cc.in.us", Normal }, { "cc.ks.us", Normal },
+		{ "cc.ky.us", Normal }, { "cc.la.us", Normal }, { "cc.ma.us", Normal }, { "cc.md.us", Normal },
+		{ "cc.me.us", Normal }, { "cc.mi.us", Normal }, { "cc.mn.us", Normal }, { "cc.mo.us", Normal },
+		{ "cc.ms.us", Normal }, { "cc.mt.us", Normal }, { "cc.nc.us", Normal }, { "cc.nd.us", Normal },
+		{ "cc.ne.us", Normal }, { "cc.nh.us", Normal }, { "cc.nj.us", Normal }, { "cc.nm.us", Normal },
+		{ "cc.nv.us", Normal }, { "cc.ny.us", Normal }, { "cc.oh.us", Normal }, { "cc.ok.us", Normal },
+		{ "cc.or.us", Normal }, { "cc.pa.us", Normal }, { "cc.pr.us", Normal }, { "cc.ri.us", Normal },
+		{ "cc.sc.us", Normal }, { "cc.sd.us", Normal }, { "cc.tn.us", Normal }, { "cc.tx.us", Normal },
+		{ "cc.ut.us", Normal }, { "cc.vi.us", Normal }, { "cc.vt.us", Normal }, { "cc.va.us", Normal },
+		{ "cc.wa.us", Normal }, { "cc.wi.us", Normal }, { "cc.wv.us", Normal }, { "cc.wy.us", Normal },
+		{ "lib.ak.us", Normal }, { "lib.al.us", Normal }, { "lib.ar.us", Normal }, { "lib.as.us", Normal },
+		{ "lib.az.us", Normal }, { "lib.ca.us", Normal }, { "lib.co.us", Normal }, { "lib.ct.us", Normal },
+		{ "lib.dc.us", Normal }, { "lib.fl.us", Normal }, { "lib.ga.us", Normal }, { "lib.gu.us", Normal },
+		{ "lib.hi.us", Normal }, { "lib.ia.us", Normal }, { "lib.id.us", Normal }, { "lib.il.us", Normal },
+		{ "lib.in.us", Normal }, { "lib.ks.us", Normal }, { "lib.ky.us", Normal }, { "lib.la.us", Normal },
+		{ "lib.ma.us", Normal }, { "lib.md.us", Normal }, { "lib.me.us", Normal }, { "lib.mi.us", Normal },
+		{ "lib.mn.us", Normal }, { "lib.mo.us", Normal }, { "lib.ms.us", Normal }, { "lib.mt.us", Normal },
+		{ "lib.nc.us", Normal }, { "lib.nd.us", Normal }, { "lib.ne.us", Normal }, { "lib.nh.us", Normal },
+		{ "lib.nj.us", Normal }, { "lib.nm.us", Normal }, { "lib.nv.us", Normal }, { "lib.ny.us", Normal },
+		{ "lib.oh.us", Normal }, { "lib.ok.us", Normal }, { "lib.or.us", Normal }, { "lib.pa.us", Normal },
+		{ "lib.pr.us", Normal }, { "lib.ri.us", Normal }, { "lib.sc.us", Normal }, { "lib.sd.us", Normal },
+		{ "lib.tn.us", Normal }, { "lib.tx.us", Normal }, { "lib.ut.us", Normal }, { "lib.vi.us", Normal },
+		{ "lib.vt.us", Normal }, { "lib.va.us", Normal }, { "lib.wa.us", Normal }, { "lib.wi.us", Normal },
+		{ "lib.wy.us", Normal }, { "pvt.k12.ma.us", Normal }, { "chtr.k12.ma.us", Normal }, { "paroch.k12.ma.us", Normal },
+		{ "ann-arbor.mi.us", Normal }, { "cog.mi.us", Normal }, { "dst.mi.us", Normal }, { "eaton.mi.us", Normal },
+		{ "gen.mi.us", Normal }, { "mus.mi.us", Normal }, { "tec.mi.us", Normal }, { "washtenaw.mi.us", Normal },
+		{ "uy", Normal }, { "com.uy", Normal }, { "edu.uy", Normal }, { "gub.uy", Normal }, { "mil.uy", Normal },
+		{ "net.uy", Normal }, { "org.uy", Normal }, { "uz", Normal }, { "co.uz", Normal }, { "com.uz", Normal },
+		{ "net.uz", Normal }, { "org.uz", Normal }, { "va", Normal }, { "vc", Normal }, { "com.vc", Normal },
+		{ "net.vc", Normal }, { "org.vc", Normal }, { "gov.vc", Normal }, { "mil.vc", Normal }, { "edu.vc", Normal },
+		{ "ve", Normal }, { "arts.ve", Normal }, { "bib.ve", Normal }, { "co.ve", Normal }, { "com.ve", Normal },
+		{ "e12.ve", Normal }, { "edu.ve", Normal }, { "firm.ve", Normal }, { "gob.ve", Normal }, { "gov.ve", Normal },
+		{ "info.ve", Normal }, { "int.ve", Normal }, { "mil.ve", Normal }, { "net.ve", Normal }, { "nom.ve", Normal },
+		{ "org.ve", Normal }, { "rar.ve", Normal }, { "rec.ve", Normal }, { "store.ve", Normal }, { "tec.ve", Normal },
+		{ "web.ve", Normal }, { "vg", Normal }, { "vi", Normal }, { "co.vi", Normal }, { "com.vi", Normal },
+		{ "k12.vi", Normal }, { "net.vi", Normal }, { "org.vi", Normal }, { "vn", Normal }, { "com.vn", Normal },
+		{ "net.vn", Normal }, { "org.vn", Normal }, { "edu.vn", Normal }, { "gov.vn", Normal }, { "int.vn", Normal },
+		{ "ac.vn", Normal }, { "biz.vn", Normal }, { "info.vn", Normal }, { "name.vn", Normal }, { "pro.vn", Normal },
+		{ "health.vn", Normal }, { "vu", Normal }, { "com.vu", Normal }, { "edu.vu", Normal }, { "net.vu", Normal },
+		{ "org.vu", Normal }, { "wf", Normal }, { "ws", Normal }, { "com.ws", Normal }, { "net.ws", Normal },
+		{ "org.ws", Normal }, { "gov.ws", Normal }, { "edu.ws", Normal }, { "yt", Normal },
+		{ "\330\247\331\205\330\247\330\261\330\247\330\252", Normal }, { "xn--mgbaam7a8h", Normal },
+		{ "\325\260\325\241\325\265", Normal }, { "xn--y9a3aq", Normal },
+		{ "\340\246\254\340\246\276\340\246\202\340\246\262\340\246\276", Normal }, { "xn--54b7fta0cc", Normal },
+		{ "\320\261\320\263", Normal }, { "xn--90ae", Normal },
+		{ "\330\247\331\204\330\250\330\255\330\261\331\212\331\206", Normal }, { "xn--mgbcpq6gpa1a", Normal },
+		{ "\320\261\320\265\320\273", Normal }, { "xn--90ais", Normal }, { "\344\270\255\345\233\275", Normal },
+		{ "xn--fiqs8s", Normal }, { "\344\270\255\345\234\213", Normal }, { "xn--fiqz9s", Normal },
+		{ "\330\247\331\204\330\254\330\262\330\247\330\246\330\261", Normal }, { "xn--lgbbat1ad8j", Normal },
+		{ "\331\205\330\265\330\261", Normal }, { "xn--wgbh1c", Normal }, { "\320\265\321\216", Normal },
+		{ "xn--e1a4c", Normal }, { "\316\265\317\205", Normal }, { "xn--qxa6a", Normal },
+		{ "\331\205\331\210\330\261\331\212\330\252\330\247\331\206\331\212\330\247", Normal },
+		{ "xn--mgbah1a3hjkrd", Normal }, { "\341\203\222\341\203\224", Normal }, { "xn--node", Normal },
+		{ "\316\265\316\273", Normal }, { "xn--qxam", Normal }, { "\351\246\231\346\270\257", Normal },
+		{ "xn--j6w193g", Normal }, { "\345\205\254\345\217\270.\351\246\231\346\270\257", Normal },
+		{ "xn--55qx5d.xn--j6w193g", Normal }, { "\346\225\231\350\202\262.\351\246\231\346\270\257", Normal },
+		{ "xn--wcvs22d.xn--j6w193g", Normal }, { "\346\224\277\345\272\234.\351\246\231\346\270\257", Normal },
+		{ "xn--mxtq1m.xn--j6w193g", Normal }, { "\345\200\213\344\272\272.\351\246\231\346\270\257", Normal },
+		{ "xn--gmqw5a.xn--j6w193g", Normal }, { "\347\266\262\347\265\241.\351\246\231\346\270\257", Normal },
+		{ "xn--od0alg.xn--j6w193g", Normal }, { "\347\265\204\347\271\224.\351\246\231\346\270\257", Normal },
+		{ "xn--uc0atv.xn--j6w193g", Normal }, { "\340\262\255\340\262\276\340\262\260\340\262\244", Normal },
+		{ "xn--2scrj9c", Normal }, { "\340\254\255\340\254\276\340\254\260\340\254\244", Normal },
+		{ "xn--3hcrj9c", Normal }, { "\340\246\255\340\246\276\340\247\260\340\246\244", Normal },
+		{ "xn--45br5cyl", Normal }, { "\340\244\255\340\244\276\340\244\260\340\244\244\340\244\256\340\245\215", Normal },
+		{ "xn--h2breg3eve", Normal }, { "\340\244\255\340\244\276\340\244\260\340\245\213\340\244\244", Normal },
+		{ "xn--h2brj9c8c", Normal }, { "\332\200\330\247\330\261\330\252", Normal }, { "xn--mgbgu82a", Normal },
+		{ "\340\264\255\340\264\276\340\264\260\340\264\244\340\264\202", Normal }, { "xn--rvc1e0am3e", Normal },
+		{ "\340\244\255\340\244\276\340\244\260\340\244\244", Normal }, { "xn--h2brj9c", Normal },
+		{ "\330\250\330\247\330\261\330\252", Normal }, { "xn--mgbbh1a", Normal },
+		{ "\330\250\332\276\330\247\330\261\330\252", Normal }, { "xn--mgbbh1a71e", Normal },
+		{ "\340\260\255\340\260\276\340\260\260\340\260\244\340\261\215", Normal }, { "xn--fpcrj9c3d", Normal },
+		{ "\340\252\255\340\252\276\340\252\260\340\252\244", Normal }, { "xn--gecrj9c", Normal },
+		{ "\340\250\255\340\250\276\340\250\260\340\250\244", Normal }, { "xn--s9brj9c", Normal },
+		{ "\340\246\255\340\246\276\340\246\260\340\246\244", Normal }, { "xn--45brj9c", Normal },
+		{ "\340\256\207\340\256\250\340\257\215\340\256\244\340\256\277\340\256\257\340\256\276", Normal },
+		{ "xn--xkc2dl3a5ee0h", Normal }, { "\330\247\333\214\330\261\330\247\331\206", Normal },
+		{ "xn--mgba3a4f16a", Normal }, { "\330\247\331\212\330\261\330\247\331\206", Normal }, { "xn--mgba3a4fra", Normal },
+		{ "\330\271\330\261\330\247\331\202", Normal }, { "xn--mgbtx2b", Normal },
+		{ "\330\247\331\204\330\247\330\261\330\257\331\206", Normal }, { "xn--mgbayh7gpa", Normal },
+		{ "\355\225\234\352\265\255", Normal }, { "xn--3e0b707e", Normal }, { "\322\233\320\260\320\267", Normal },
+		{ "xn--80ao21a", Normal }, { "\340\272\245\340\272\262\340\272\247", Normal }, { "xn--q7ce6a", Normal },
+		{ "\340\266\275\340\266\202\340\266\232\340\267\217", Normal }, { "xn--fzc2c9e2c", Normal },
+		{ "\340\256\207\340\256\262\340\256\231\340\257\215\340\256\225\340\257\210", Normal },
+		{ "xn--xkc2al3hye2a", Normal }, { "\330\247\331\204\331\205\330\272\330\261\330\250", Normal },
+		{ "xn--mgbc0a9azcg", Normal }, { "\320\274\320\272\320\264", Normal }, { "xn--d1alf", Normal },
+		{ "\320\274\320\276\320\275", Normal }, { "xn--l1acc", Normal }, { "\346\276\263\351\226\200", Normal },
+		{ "xn--mix891f", Normal }, { "\346\276\263\351\227\250", Normal }, { "xn--mix082f", Normal },
+		{ "\331\205\331\204\331\212\330\263\331\212\330\247", Normal }, { "xn--mgbx4cd0ab", Normal },
+		{ "\330\271\331\205\330\247\331\206", Normal }, { "xn--mgb9awbf", Normal },
+		{ "\331\276\330\247\332\251\330\263\330\252\330\247\331\206", Normal }, { "xn--mgbai9azgqp6j", Normal },
+		{ "\331\276\330\247\331\203\330\263\330\252\330\247\331\206", Normal }, { "xn--mgbai9a5eva00b", Normal },
+		{ "\331\201\331\204\330\263\330\267\331\212\331\206", Normal }, { "xn--ygbi2ammx", Normal },
+		{ "\321\201\321\200\320\261", Normal }, { "xn--90a3ac", Normal },
+		{ "\320\277\321\200.\321\201\321\200\320\261", Normal }, { "xn--o1ac.xn--90a3ac", Normal },
+		{ "\320\276\321\200\320\263.\321\201\321\200\320\261", Normal }, { "xn--c1avg.xn--90a3ac", Normal },
+		{ "\320\276\320\261\321\200.\321\201\321\200\320\261", Normal }, { "xn--90azh.xn--90a3ac", Normal },
+		{ "\320\276\320\264.\321\201\321\200\320\261", Normal }, { "xn--d1at.xn--90a3ac", Normal },
+		{ "\321\203\320\277\321\200.\321\201\321\200\320\261", Normal }, { "xn--o1ach.xn--90a3ac", Normal },
+		{ "\320\260\320\272.\321\201\321\200\320\261", Normal }, { "xn--80au.xn--90a3ac", Normal },
+		{ "\321\200\321\204", Normal }, { "xn--p1ai", Normal }, { "\331\202\330\267\330\261", Normal },
+		{ "xn--wgbl6a", Normal }, { "\330\247\331\204\330\263\330\271\331\210\330\257\331\212\330\251", Normal },
+		{ "xn--mgberp4a5d4ar", Normal }, { "\330\247\331\204\330\263\330\271\331\210\330\257\333\214\330\251", Normal },
+		{ "xn--mgberp4a5d4a87g", Normal }, { "\330\247\331\204\330\263\330\271\331\210\330\257\333\214\333\203", Normal },
+		{ "xn--mgbqly7c0a67fbc", Normal }, { "\330\247\331\204\330\263\330\271\331\210\330\257\331\212\331\207", Normal },
+		{ "xn--mgbqly7cvafr", Normal }, { "\330\263\331\210\330\257\330\247\331\206", Normal }, { "xn--mgbpl2fh", Normal },
+		{ "\346\226\260\345\212\240\345\235\241", Normal }, { "xn--yfro4i67o", Normal },
+		{ "\340\256\232\340\256\277\340\256\231\340\257\215\340\256\225\340\256\252\340\257\215\340\256\252\340\257\202\340\256\260\340\257\215", Normal },
+		{ "xn--clchc0ea0b2g2a9gcd", Normal }, { "\330\263\331\210\330\261\331\212\330\251", Normal },
+		{ "xn--ogbpf8fl", Normal }, { "\330\263\331\210\330\261\331\212\330\247", Normal }, { "xn--mgbtf8fl", Normal },
+		{ "\340\271\204\340\270\227\340\270\242", Normal }, { "xn--o3cw4h", Normal },
+		{ "\340\270\250\340\270\266\340\270\201\340\270\251\340\270\262.\340\271\204\340\270\227\340\270\242", Normal },
+		{ "xn--12c1fe0br.xn--o3cw4h", Normal },
+		{ "\340\270\230\340\270\270\340\270\243\340\270\201\340\270\264\340\270\210.\340\271\204\340\270\227\340\270\242", Normal },
+		{ "xn--12co0c3b4eva.xn--o3cw4h", Normal },
+		{ "\340\270\243\340\270\261\340\270\220\340\270\232\340\270\262\340\270\245.\340\271\204\340\270\227\340\270\242", Normal },
+		{ "xn--h3cuzk1di.xn--o3cw4h", Normal },
+		{ "\340\270\227\340\270\253\340\270\262\340\270\243.\340\271\204\340\270\227\340\270\242", Normal },
+		{ "xn--o3cyx2a.xn--o3cw4h", Normal },
+		{ "\340\271\200\340\270\231\340\271\207\340\270\225.\340\271\204\340\270\227\340\270\242", Normal },
+		{ "xn--m3ch0j3a.xn--o3cw4h", Normal },
+		{ "\340\270\255\340\270\207\340\270\204\340\271\214\340\270\201\340\270\243.\340\271\204\340\270\227\340\270\242", Normal },
+		{ "xn--12cfi8ixb8l.xn--o3cw4h", Normal }, { "\330\252\331\210\331\206\330\263", Normal }, { "xn--pgbs0dh", Normal },
+		{ "\345\217\260\347\201\243", Normal }, { "xn--kpry57d", Normal }, { "\345\217\260\346\271\276", Normal },
+		{ "xn--kprw13d", Normal }, { "\350\207\272\347\201\243", Normal }, { "xn--nnx388a", Normal },
+		{ "\321\203\320\272\321\200", Normal }, { "xn--j1amh", Normal },
+		{ "\330\247\331\204\331\212\331\205\331\206", Normal }, { "xn--mgb2ddes", Normal }, { "xxx", Normal },
+		{ "ye", Normal }, { "com.ye", Normal }, { "edu.ye", Normal }, { "gov.ye", Normal }, { "net.ye", Normal },
+		{ "mil.ye", Normal }, { "org.ye", Normal }, { "ac.za", Normal }, { "agric.za", Normal }, { "alt.za", Normal },
+		{ "co.za", Normal }, { "edu.za", Normal }, { "gov.za", Normal }, { "grondar.za", Normal }, { "law.za", Normal },
+		{ "mil.za", Normal }, { "net.za", Normal }, { "ngo.za", Normal }, { "nic.za", Normal }, { "nis.za", Normal },
+		{ "nom.za", Normal }, { "org.za", Normal }, { "school.za", Normal }, { "tm.za", Normal }, { "web.za", Normal },
+		{ "zm", Normal }, { "ac.zm", Normal }, { "biz.zm", Normal }, { "co.zm", Normal }, { "com.zm", Normal },
+		{ "edu.zm", Normal }, { "gov.zm", Normal }, { "info.zm", Normal }, { "mil.zm", Normal }, { "net.zm", Normal },
+		{ "org.zm", Normal }, { "sch.zm", Normal }, { "zw", Normal }, { "ac.zw", Normal }, { "co.zw", Normal },
+		{ "gov.zw", Normal }, { "mil.zw", Normal }, { "org.zw", Normal }, { "aaa", Normal }, { "aarp", Normal },
+		{ "abarth", Normal }, { "abb", Normal }, { "abbott", Normal }, { "abbvie", Normal }, { "abc", Normal },
+		{ "able", Normal }, { "abogado", Normal }, { "abudhabi", Normal }, { "academy", Normal }, { "accenture", Normal },
+		{ "accountant", Normal }, { "accountants", Normal }, { "aco", Normal }, { "actor", Normal }, { "ads", Normal },
+		{ "adult", Normal }, { "aeg", Normal }, { "aetna", Normal }, { "afl", Normal }, { "africa", Normal },
+		{ "agakhan", Normal }, { "agency", Normal }, { "aig", Normal }, { "airbus", Normal }, { "airforce", Normal },
+		{ "airtel", Normal }, { "akdn", Normal }, { "alfaromeo", Normal }, { "alibaba", Normal }, { "alipay", Normal },
+		{ "allfinanz", Normal }, { "allstate", Normal }, { "ally", Normal }, { "alsace", Normal }, { "alstom", Normal },
+		{ "amazon", Normal }, { "americanexpress", Normal }, { "americanfamily", Normal }, { "amex", Normal },
+		{ "amfam", Normal }, { "amica", Normal }, { "amsterdam", Normal }, { "analytics", Normal }, { "android", Normal },
+		{ "anquan", Normal }, { "anz", Normal }, { "aol", Normal }, { "apartments", Normal }, { "app", Normal },
+		{ "apple", Normal }, { "aquarelle", Normal }, { "arab", Normal }, { "aramco", Normal }, { "archi", Normal },
+		{ "army", Normal }, { "art", Normal }, { "arte", Normal }, { "asda", Normal }, { "associates", Normal },
+		{ "athleta", Normal }, { "attorney", Normal }, { "auction", Normal }, { "audi", Normal }, { "audible", Normal },
+		{ "audio", Normal }, { "auspost", Normal }, { "author", Normal }, { "auto", Normal }, { "autos", Normal },
+		{ "avianca", Normal }, { "aws", Normal }, { "axa", Normal }, { "azure", Normal }, { "baby", Normal },
+		{ "baidu", Normal }, { "banamex", Normal }, { "bananarepublic", Normal }, { "band", Normal }, { "bank", Normal },
+		{ "bar", Normal }, { "barcelona", Normal }, { "barclaycard", Normal }, { "barclays", Normal },
+		{ "barefoot", Normal }, { "bargains", Normal }, { "baseball", Normal }, { "basketball", Normal },
+		{ "bauhaus", Normal }, { "bayern", Normal }, { "bbc", Normal }, { "bbt", Normal }, { "bbva", Normal },
+		{ "bcg", Normal }, { "bcn", Normal }, { "beats", Normal }, { "beauty", Normal }, { "beer", Normal },
+		{ "bentley", Normal }, { "berlin", Normal }, { "best", Normal }, { "bestbuy", Normal }, { "bet", Normal },
+		{ "bharti", Normal }, { "bible", Normal }, { "bid", Normal }, { "bike", Normal }, { "bing", Normal },
+		{ "bingo", Normal }, { "bio", Normal }, { "black", Normal }, { "blackfriday", Normal }, { "blockbuster", Normal },
+		{ "blog", Normal }, { "bloomberg", Normal }, { "blue", Normal }, { "bms", Normal }, { "bmw", Normal },
+		{ "bnpparibas", Normal }, { "boats", Normal }, { "boehringer", Normal }, { "bofa", Normal }, { "bom", Normal },
+		{ "bond", Normal }, { "boo", Normal }, { "book", Normal }, { "booking", Normal }, { "bosch", Normal },
+		{ "bostik", Normal }, { "boston", Normal }, { "bot", Normal }, { "boutique", Normal }, { "box", Normal },
+		{ "bradesco", Normal }, { "bridgestone", Normal }, { "broadway", Normal }, { "broker", Normal },
+		{ "brother", Normal }, { "brussels", Normal }, { "build", Normal }, { "builders", Normal }, { "business", Normal },
+		{ "buy", Normal }, { "buzz", Normal }, { "bzh", Normal }, { "cab", Normal }, { "cafe", Normal }, { "cal", Normal },
+		{ "call", Normal }, { "calvinklein", Normal }, { "cam", Normal }, { "camera", Normal }, { "camp", Normal },
+		{ "canon", Normal }, { "capetown", Normal }, { "capital", Normal }, { "capitalone", Normal }, { "car", Normal },
+		{ "caravan", Normal }, { "cards", Normal }, { "care", Normal }, { "career", Normal }, { "careers", Normal },
+		{ "cars", Normal }, { "casa", Normal }, { "case", Normal }, { "cash", Normal }, { "casino", Normal },
+		{ "catering", Normal }, { "catholic", Normal }, { "cba", Normal }, { "cbn", Normal }, { "cbre", Normal },
+		{ "cbs", Normal }, { "center", Normal }, { "ceo", Normal }, { "cern", Normal }, { "cfa", Normal },
+		{ "cfd", Normal }, { "chanel", Normal }, { "channel", Normal }, { "charity", Normal }, { "chase", Normal },
+		{ "chat", Normal }, { "cheap", Normal }, { "chintai", Normal }, { "christmas", Normal }, { "chrome", Normal },
+		{ "church", Normal }, { "cipriani", Normal }, { "circle", Normal }, { "cisco", Normal }, { "citadel", Normal },
+		{ "citi", Normal }, { "citic", Normal }, { "city", Normal }, { "cityeats", Normal }, { "claims", Normal },
+		{ "cleaning", Normal }, { "click", Normal }, { "clinic", Normal }, { "clinique", Normal }, { "clothing", Normal },
+		{ "cloud", Normal }, { "club", Normal }, { "clubmed", Normal }, { "coach", Normal }, { "codes", Normal },
+		{ "coffee", Normal }, { "college", Normal }, { "cologne", Normal }, { "comcast", Normal }, { "commbank", Normal },
+		{ "community", Normal }, { "company", Normal }, { "compare", Normal }, { "computer", Normal }, { "comsec", Normal },
+		{ "condos", Normal }, { "construction", Normal }, { "consulting", Normal }, { "contact", Normal },
+		{ "contractors", Normal }, { "cooking", Normal }, { "cookingchannel", Normal }, { "cool", Normal },
+		{ "corsica", Normal }, { "country", Normal }, { "coupon", Normal }, { "coupons", Normal }, { "courses", Normal },
+		{ "cpa", Normal }, { "credit", Normal }, { "creditcard", Normal }, { "creditunion", Normal }, { "cricket", Normal },
+		{ "crown", Normal }, { "crs", Normal }, { "cruise", Normal }, { "cruises", Normal }, { "cuisinella", Normal },
+		{ "cymru", Normal }, { "cyou", Normal }, { "dabur", Normal }, { "dad", Normal }, { "dance", Normal },
+		{ "data", Normal }, { "date", Normal }, { "dating", Normal }, { "datsun", Normal }, { "day", Normal },
+		{ "dclk", Normal }, { "dds", Normal }, { "deal", Normal }, { "dealer", Normal }, { "deals", Normal },
+		{ "degree", Normal }, { "delivery", Normal }, { "dell", Normal }, { "deloitte", Normal }, { "delta", Normal },
+		{ "democrat", Normal }, { "dental", Normal }, { "dentist", Normal }, { "desi", Normal }, { "design", Normal },
+		{ "dev", Normal }, { "dhl", Normal }, { "diamonds", Normal }, { "diet", Normal }, { "digital", Normal },
+		{ "direct", Normal }, { "directory", Normal }, { "discount", Normal }, { "discover", Normal }, { "dish", Normal },
+		{ "diy", Normal }, { "dnp", Normal }, { "docs", Normal }, { "doctor", Normal }, { "dog", Normal },
+		{ "domains", Normal }, { "dot", Normal }, { "download", Normal }, { "drive", Normal }, { "dtv", Normal },
+		{ "dubai", Normal }, { "dunlop", Normal }, { "dupont", Normal }, { "durban", Normal }, { "dvag", Normal },
+		{ "dvr", Normal }, { "earth", Normal }, { "eat", Normal }, { "eco", Normal }, { "edeka", Normal },
+		{ "education", Normal }, { "email", Normal }, { "emerck", Normal }, { "energy", Normal }, { "engineer", Normal },
+		{ "engineering", Normal }, { "enterprises", Normal }, { "epson", Normal }, { "equipment", Normal },
+		{ "ericsson", Normal }, { "erni", Normal }, { "esq", Normal }, { "estate", Normal }, { "etisalat", Normal },
+		{ "eurovision", Normal }, { "eus", Normal }, { "events", Normal }, { "exchange", Normal }, { "expert", Normal },
+		{ "exposed", Normal }, { "express", Normal }, { "extraspace", Normal }, { "fage", Normal }, { "fail", Normal },
+		{ "fairwinds", Normal }, { "faith", Normal }, { "family", Normal }, { "fan", Normal }, { "fans", Normal },
+		{ "farm", Normal }, { "farmers", Normal }, { "fashion", Normal }, { "fast", Normal }, { "fedex", Normal },
+		{ "feedback", Normal }, { "ferrari", Normal }, { "ferrero", Normal }, { "fiat", Normal }, { "fidelity", Normal },
+		{ "fido", Normal }, { "film", Normal }, { "final", Normal }, { "finance", Normal }, { "financial", Normal },
+		{ "fire", Normal }, { "firestone", Normal }, { "firmdale", Normal }, { "fish", Normal }, { "fishing", Normal },
+		{ "fit", Normal }, { "fitness", Normal }, { "flickr", Normal }, { "flights", Normal }, { "flir", Normal },
+		{ "florist", Normal }, { "flowers", Normal }, { "fly", Normal }, { "foo", Normal }, { "food", Normal },
+		{ "foodnetwork", Normal }, { "football", Normal }, { "ford", Normal }, { "forex", Normal }, { "forsale", Normal },
+		{ "forum", Normal }, { "foundation", Normal }, { "fox", Normal }, { "free", Normal }, { "fresenius", Normal },
+		{ "frl", Normal }, { "frogans", Normal }, { "frontdoor", Normal }, { "frontier", Normal }, { "ftr", Normal },
+		{ "fujitsu", Normal }, { "fun", Normal }, { "fund", Normal }, { "furniture", Normal }, { "futbol", Normal },
+		{ "fyi", Normal }, { "gal", Normal }, { "gallery", Normal }, { "gallo", Normal }, { "gallup", Normal },
+		{ "game", Normal }, { "games", Normal }, { "gap", Normal }, { "garden", Normal }, { "gay", Normal },
+		{ "gbiz", Normal }, { "gdn", Normal }, { "gea", Normal }, { "gent", Normal }, { "genting", Normal },
+		{ "george", Normal }, { "ggee", Normal }, { "gift", Normal }, { "gifts", Normal }, { "gives", Normal },
+		{ "giving", Normal }, { "glass", Normal }, { "gle", Normal }, { "global", Normal }, { "globo", Normal },
+		{ "gmail", Normal }, { "gmbh", Normal }, { "gmo", Normal }, { "gmx", Normal }, { "godaddy", Normal },
+		{ "gold", Normal }, { "goldpoint", Normal }, { "golf", Normal }, { "goo", Normal }, { "goodyear", Normal },
+		{ "goog", Normal }, { "google", Normal }, { "gop", Normal }, { "got", Normal }, { "grainger", Normal },
+		{ "graphics", Normal }, { "gratis", Normal }, { "green", Normal }, { "gripe", Normal }, { "grocery", Normal },
+		{ "group", Normal }, { "guardian", Normal }, { "gucci", Normal }, { "guge", Normal }, { "guide", Normal },
+		{ "guitars", Normal }, { "guru", Normal }, { "hair", Normal }, { "hamburg", Normal }, { "hangout", Normal },
+		{ "haus", Normal }, { "hbo", Normal }, { "hdfc", Normal }, { "hdfcbank", Normal }, { "health", Normal },
+		{ "healthcare", Normal }, { "help", Normal }, { "helsinki", Normal }, { "here", Normal }, { "hermes", Normal },
+		{ "hgtv", Normal }, { "hiphop", Normal }, { "hisamitsu", Normal }, { "hitachi", Normal }, { "hiv", Normal },
+		{ "hkt", Normal }, { "hockey", Normal }, { "holdings", Normal }, { "holiday", Normal }, { "homedepot", Normal },
+		{ "homegoods", Normal }, { "homes", Normal }, { "homesense", Normal }, { "honda", Normal }, { "horse", Normal },
+		{ "hospital", Normal }, { "host", Normal }, { "hosting", Normal }, { "hot", Normal }, { "hoteles", Normal },
+		{ "hotels", Normal }, { "hotmail", Normal }, { "house", Normal }, { "how", Normal }, { "hsbc", Normal },
+		{ "hughes", Normal }, { "hyatt", Normal }, { "hyundai", Normal }, { "ibm", Normal }, { "icbc", Normal },
+		{ "ice", Normal }, { "icu", Normal }, { "ieee", Normal }, { "ifm", Normal }, { "ikano", Normal },
+		{ "imamat", Normal }, { "imdb", Normal }, { "immo", Normal }, { "immobilien", Normal }, { "inc", Normal },
+		{ "industries", Normal }, { "infiniti", Normal }, { "ing", Normal }, { "ink", Normal }, { "institute", Normal },
+		{ "insurance", Normal }, { "insure", Normal }, { "international", Normal }, { "intuit", Normal },
+		{ "investments", Normal }, { "ipiranga", Normal }, { "irish", Normal }, { "ismaili", Normal }, { "ist", Normal },
+		{ "istanbul", Normal }, { "itau", Normal }, { "itv", Normal }, { "jaguar", Normal }, { "java", Normal },
+		{ "jcb", Normal }, { "jeep", Normal }, { "jetzt", Normal }, { "jewelry", Normal }, { "jio", Normal },
+		{ "jll", Normal }, { "jmp", Normal }, { "jnj", Normal }, { "joburg", Normal }, { "jot", Normal }, { "joy", Normal },
+		{ "jpmorgan", Normal }, { "jprs", Normal }, { "juegos", Normal }, { "juniper", Normal }, { "kaufen", Normal },
+		{ "kddi", Normal }, { "kerryhotels", Normal }, { "kerrylogistics", Normal }, { "kerryproperties", Normal },
+		{ "kfh", Normal }, { "kia", Normal }, { "kids", Normal }, { "kim", Normal }, { "kinder", Normal },
+		{ "kindle", Normal }, { "kitchen", Normal }, { "kiwi", Normal }, { "koeln", Normal }, { "komatsu", Normal },
+		{ "kosher", Normal }, { "kpmg", Normal }, { "kpn", Normal }, { "krd", Normal }, { "kred", Normal },
+		{ "kuokgroup", Normal }, { "kyoto", Normal }, { "lacaixa", Normal }, { "lamborghini", Normal }, { "lamer", Normal },
+		{ "lancaster", Normal }, { "lancia", Normal }, { "land", Normal }, { "landrover", Normal }, { "lanxess", Normal },
+		{ "lasalle", Normal }, { "lat", Normal }, { "latino", Normal }, { "latrobe", Normal }, { "law", Normal },
+		{ "lawyer", Normal }, { "lds", Normal }, { "lease", Normal }, { "leclerc", Normal }, { "lefrak", Normal },
+		{ "legal", Normal }, { "lego", Normal }, { "lexus", Normal }, { "lgbt", Normal }, { "lidl", Normal },
+		{ "life", Normal }, { "lifeinsurance", Normal }, { "lifestyle", Normal }, { "lighting", Normal },
+		{ "like", Normal }, { "lilly", Normal }, { "limited", Normal }, { "limo", Normal }, { "lincoln", Normal },
+		{ "linde", Normal }, { "link", Normal }, { "lipsy", Normal }, { "live", Normal }, { "living", Normal },
+		{ "llc", Normal }, { "llp", Normal }, { "loan", Normal }, { "loans", Normal }, { "locker", Normal },
+		{ "locus", Normal }, { "lol", Normal }, { "london", Normal }, { "lotte", Normal }, { "lotto", Normal },
+		{ "love", Normal }, { "lpl", Normal }, { "lplfinancial", Normal }, { "ltd", Normal }, { "ltda", Normal },
+		{ "lundbeck", Normal }, { "luxe", Normal }, { "luxury", Normal }, { "macys", Normal }, { "madrid", Normal },
+		{ "maif", Normal }, { "maison", Normal }, { "makeup", Normal }, { "man", Normal }, { "management", Normal },
+		{ "mango", Normal }, { "map", Normal }, { "market", Normal }, { "marketing", Normal }, { "markets", Normal },
+		{ "marriott", Normal }, { "marshalls", Normal }, { "maserati", Normal }, { "mattel", Normal }, { "mba", Normal },
+		{ "mckinsey", Normal }, { "med", Normal }, { "media", Normal }, { "meet", Normal }, { "melbourne", Normal },
+		{ "meme", Normal }, { "memorial", Normal }, { "men", Normal }, { "menu", Normal }, { "merckmsd", Normal },
+		{ "miami", Normal }, { "microsoft", Normal }, { "mini", Normal }, { "mint", Normal }, { "mit", Normal },
+		{ "mitsubishi", Normal }, { "mlb", Normal }, { "mls", Normal }, { "mma", Normal }, { "mobile", Normal },
+		{ "moda", Normal }, { "moe", Normal }, { "moi", Normal }, { "mom", Normal }, { "monash", Normal },
+		{ "money", Normal }, { "monster", Normal }, { "mormon", Normal }, { "mortgage", Normal }, { "moscow", Normal },
+		{ "moto", Normal }, { "motorcycles", Normal }, { "mov", Normal }, { "movie", Normal }, { "msd", Normal },
+		{ "mtn", Normal }, { "mtr", Normal }, { "music", Normal }, { "mutual", Normal }, { "nab", Normal },
+		{ "nagoya", Normal }, { "natura", Normal }, { "navy", Normal }, { "nba", Normal }, { "nec", Normal },
+		{ "netbank", Normal }, { "netflix", Normal }, { "network", Normal }, { "neustar", Normal }, { "new", Normal },
+		{ "news", Normal }, { "next", Normal }, { "nextdirect", Normal }, { "nexus", Normal }, { "nfl", Normal },
+		{ "ngo", Normal }, { "nhk", Normal }, { "nico", Normal }, { "nike", Normal }, { "nikon", Normal },
+		{ "ninja", Normal }, { "nissan", Normal }, { "nissay", Normal }, { "nokia", Normal },
+		{ "northwesternmutual", Normal }, { "norton", Normal }, { "now", Normal }, { "nowruz", Normal },
+		{ "nowtv", Normal }, { "nra", Normal }, { "nrw", Normal }, { "ntt", Normal }, { "nyc", Normal }, { "obi", Normal },
+		{ "observer", Normal }, { "office", Normal }, { "okinawa", Normal }, { "olayan", Normal },
+		{ "olayangroup", Normal }, { "oldnavy", Normal }, { "ollo", Normal }, { "omega", Normal }, { "one", Normal },
+		{ "ong", Normal }, { "onl", Normal }, { "online", Normal }, { "ooo", Normal }, { "open", Normal },
+		{ "oracle", Normal }, { "orange", Normal }, { "organic", Normal }, { "origins", Normal }, { "osaka", Normal },
+		{ "otsuka", Normal }, { "ott", Normal }, { "ovh", Normal }, { "page", Normal }, { "panasonic", Normal },
+		{ "paris", Normal }, { "pars", Normal }, { "partners", Normal }, { "parts", Normal }, { "party", Normal },
+		{ "passagens", Normal }, { "pay", Normal }, { "pccw", Normal }, { "pet", Normal }, { "pfizer", Normal },
+		{ "pharmacy", Normal }, { "phd", Normal }, { "philips", Normal }, { "phone", Normal }, { "photo", Normal },
+		{ "photography", Normal }, { "photos", Normal }, { "physio", Normal }, { "pics", Normal }, { "pictet", Normal },
+		{ "pictures", Normal }, { "pid", Normal }, { "pin", Normal }, { "ping", Normal }, { "pink", Normal },
+		{ "pioneer", Normal }, { "pizza", Normal }, { "place", Normal }, { "play", Normal }, { "playstation", Normal },
+		{ "plumbing", Normal }, { "plus", Normal }, { "pnc", Normal }, { "pohl", Normal }, { "poker", Normal },
+		{ "politie", Normal }, { "porn", Normal }, { "pramerica", Normal }, { "praxi", Normal }, { "press", Normal },
+		{ "prime", Normal }, { "prod", Normal }, { "productions", Normal }, { "prof", Normal }, { "progressive", Normal },
+		{ "promo", Normal }, { "properties", Normal }, { "property", Normal }, { "protection", Normal }, { "pru", Normal },
+		{ "prudential", Normal }, { "pub", Normal }, { "pwc", Normal }, { "qpon", Normal }, { "quebec", Normal },
+		{ "quest", Normal }, { "racing", Normal }, { "radio", Normal }, { "read", Normal }, { "realestate", Normal },
+		{ "realtor", Normal }, { "realty", Normal }, { "recipes", Normal }, { "red", Normal }, { "redstone", Normal },
+		{ "redumbrella", Normal }, { "rehab", Normal }, { "reise", Normal }, { "reisen", Normal }, { "reit", Normal },
+		{ "reliance", Normal }, { "ren", Normal }, { "rent", Normal }, { "rentals", Normal }, { "repair", Normal },
+		{ "report", Normal }, { "republican", Normal }, { "rest", Normal }, { "restaurant", Normal }, { "review", Normal },
+		{ "reviews", Normal }, { "rexroth", Normal }, { "rich", Normal }, { "richardli", Normal }, { "ricoh", Normal },
+		{ "ril", Normal }, { "rio", Normal }, { "rip", Normal }, { "rocher", Normal }, { "rocks", Normal },
+		{ "rodeo", Normal }, { "rogers", Normal }, { "room", Normal }, { "rsvp", Normal }, { "rugby", Normal },
+		{ "ruhr", Normal }, { "run", Normal }, { "rwe", Normal }, { "ryukyu", Normal }, { "saarland", Normal },
+		{ "safe", Normal }, { "safety", Normal }, { "sakura", Normal }, { "sale", Normal }, { "salon", Normal },
+		{ "samsclub", Normal }, { "samsung", Normal }, { "sandvik", Normal }, { "sandvikcoromant", Normal },
+		{ "sanofi", Normal }, { "sap", Normal }, { "sarl", Normal }, { "sas", Normal }, { "save", Normal },
+		{ "saxo", Normal }, { "sbi", Normal }, { "sbs", Normal }, { "sca", Normal }, { "scb", Normal },
+		{ "schaeffler", Normal }, { "schmidt", Normal }, { "scholarships", Normal }, { "school", Normal },
+		{ "schule", Normal }, { "schwarz", Normal }, { "science", Normal }, { "scot", Normal }, { "search", Normal },
+		{ "seat", Normal }, { "secure", Normal }, { "security", Normal }, { "seek", Normal }, { "select", Normal },
+		{ "sener", Normal }, { "services", Normal }, { "seven", Normal }, { "sew", Normal }, { "sex", Normal },
+		{ "sexy", Normal }, { "sfr", Normal }, { "shangrila", Normal }, { "sharp", Normal }, { "shaw", Normal },
+		{ "shell", Normal }, { "shia", Normal }, { "shiksha", Normal }, { "shoes", Normal }, { "shop", Normal },
+		{ "shopping", Normal }, { "shouji", Normal }, { "show", Normal }, { "showtime", Normal }, { "silk", Normal },
+		{ "sina", Normal }, { "singles", Normal }, { "site", Normal }, { "ski", Normal }, { "skin", Normal },
+		{ "sky", Normal }, { "skype", Normal }, { "sling", Normal }, { "smart", Normal }, { "smile", Normal },
+		{ "sncf", Normal }, { "soccer", Normal }, { "social", Normal }, { "softbank", Normal }, { "software", Normal },
+		{ "sohu", Normal }, { "solar", Normal }, { "solutions", Normal }, { "song", Normal }, { "sony", Normal },
+		{ "soy", Normal }, { "spa", Normal }, { "space", Normal }, { "sport", Normal }, { "spot", Normal },
+		{ "srl", Normal }, { "stada", Normal }, { "staples", Normal }, { "star", Normal }, { "statebank", Normal },
+		{ "statefarm", Normal }, { "stc", Normal }, { "stcgroup", Normal }, { "stockholm", Normal }, { "storage", Normal },
+		{ "store", Normal }, { "stream", Normal }, { "studio", Normal }, { "study", Normal }, { "style", Normal },
+		{ "sucks", Normal }, { "supplies", Normal }, { "supply", Normal }, { "support", Normal }, { "surf", Normal },
+		{ "surgery", Normal }, { "suzuki", Normal }, { "swatch", Normal }, { "swiss", Normal }, { "sydney", Normal },
+		{ "systems", Normal }, { "tab", Normal }, { "taipei", Normal }, { "talk", Normal }, { "taobao", Normal },
+		{ "target", Normal }, { "tatamotors", Normal }, { "tatar", Normal }, { "tattoo", Normal }, { "tax", Normal },
+		{ "taxi", Normal }, { "tci", Normal }, { "tdk", Normal }, { "team", Normal }, { "tech", Normal },
+		{ "technology", Normal }, { "temasek", Normal }, { "tennis", Normal }, { "teva", Normal }, { "thd", Normal },
+		{ "theater", Normal }, { "theatre", Normal }, { "tiaa", Normal }, { "tickets", Normal }, { "tienda", Normal },
+		{ "tiffany", Normal }, { "tips", Normal }, { "tires", Normal }, { "tirol", Normal }, { "tjmaxx", Normal },
+		{ "tjx", Normal }, { "tkmaxx", Normal }, { "tmall", Normal }, { "today", Normal }, { "tokyo", Normal },
+		{ "tools", Normal }, { "top", Normal }, { "toray", Normal }, { "toshiba", Normal }, { "total", Normal },
+		{ "tours", Normal }, { "town", Normal }, { "toyota", Normal }, { "toys", Normal }, { "trade", Normal },
+		{ "trading", Normal }, { "training", Normal }, { "travel", Normal }, { "travelchannel", Normal },
+		{ "travelers", Normal }, { "travelersinsurance", Normal }, { "trust", Normal }, { "trv", Normal },
+		{ "tube", Normal }, { "tui", Normal }, { "tunes", Normal }, { "tushu", Normal }, { "tvs", Normal },
+		{ "ubank", Normal }, { "ubs", Normal }, { "unicom", Normal }, { "university", Normal }, { "uno", Normal },
+		{ "uol", Normal }, { "ups", Normal }, { "vacations", Normal }, { "vana", Normal }, { "vanguard", Normal },
+		{ "vegas", Normal }, { "ventures", Normal }, { "verisign", Normal }, { "versicherung", Normal }, { "vet", Normal },
+		{ "viajes", Normal }, { "video", Normal }, { "vig", Normal }, { "viking", Normal }, { "villas", Normal },
+		{ "vin", Normal }, { "vip", Normal }, { "virgin", Normal }, { "visa", Normal }, { "vision", Normal },
+		{ "viva", Normal }, { "vivo", Normal }, { "vlaanderen", Normal }, { "vodka", Normal }, { "volkswagen", Normal },
+		{ "volvo", Normal }, { "vote", Normal }, { "voting", Normal }, { "voto", Normal }, { "voyage", Normal },
+		{ "vuelos", Normal }, { "wales", Normal }, { "walmart", Normal }, { "walter", Normal }, { "wang", Normal },
+		{ "wanggou", Normal }, { "watch", Normal }, { "watches", Normal }, { "weather", Normal },
+		{ "weatherchannel", Normal }, { "webcam", Normal }, { "weber", Normal }, { "website", Normal },
+		{ "wedding", Normal }, { "weibo", Normal }, { "weir", Normal }, { "whoswho", Normal }, { "wien", Normal },
+		{ "wiki", Normal }, { "williamhill", Normal }, { "win", Normal }, { "windows", Normal }, { "wine", Normal },
+		{ "winners", Normal }, { "wme", Normal }, { "wolterskluwer", Normal }, { "woodside", Normal }, { "work", Normal },
+		{ "works", Normal }, { "world", Normal }, { "wow", Normal }, { "wtc", Normal }, { "wtf", Normal },
+		{ "xbox", Normal }, { "xerox", Normal }, { "xfinity", Normal }, { "xihuan", Normal }, { "xin", Normal },
+		{ "\340\244\225\340\245\211\340\244\256", Normal }, { "xn--11b4c3d", Normal },
+		{ "\343\202\273\343\203\274\343\203\253", Normal }, { "xn--1ck2e1b", Normal },
+		{ "\344\275\233\345\261\261", Normal }, { "xn--1qqw23a", Normal }, { "\346\205\210\345\226\204", Normal },
+		{ "xn--30rr7y", Normal }, { "\351\233\206\345\233\242", Normal }, { "xn--3bst00m", Normal },
+		{ "\345\234\250\347\272\277", Normal }, { "xn--3ds443g", Normal }, { "\347\202\271\347\234\213", Normal },
+		{ "xn--3pxu8k", Normal }, { "\340\270\204\340\270\255\340\270\241", Normal }, { "xn--42c2d9a", Normal },
+		{ "\345\205\253\345\215\246", Normal }, { "xn--45q11c", Normal }, { "\331\205\331\210\331\202\330\271", Normal },
+		{ "xn--4gbrim", Normal }, { "\345\205\254\347\233\212", Normal }, { "xn--55qw42g", Normal },
+		{ "\345\205\254\345\217\270", Normal }, { "xn--55qx5d", Normal },
+		{ "\351\246\231\346\240\274\351\207\214\346\213\211", Normal }, { "xn--5su34j936bgsg", Normal },
+		{ "\347\275\221\347\253\231", Normal }, { "xn--5tzm5g", Normal }, { "\347\247\273\345\212\250", Normal },
+		{ "xn--6frz82g", Normal }, { "\346\210\221\347\210\261\344\275\240", Normal }, { "xn--6qq986b3xl", Normal },
+		{ "\320\274\320\276\321\201\320\272\320\262\320\260", Normal }, { "xn--80adxhks", Normal },
+		{ "\320\272\320\260\321\202\320\276\320\273\320\270\320\272", Normal }, { "xn--80aqecdr1a", Normal },
+		{ "\320\276\320\275\320\273\320\260\320\271\320\275", Normal }, { "xn--80asehdb", Normal },
+		{ "\321\201\320\260\320\271\321\202", Normal }, { "xn--80aswg", Normal }, { "\350\201\224\351\200\232", Normal },
+		{ "xn--8y0a063a", Normal }, { "\327\247\327\225\327\235", Normal }, { "xn--9dbq2a", Normal },
+		{ "\346\227\266\345\260\232", Normal }, { "xn--9et52u", Normal }, { "\345\276\256\345\215\232", Normal },
+		{ "xn--9krt00a", Normal }, { "\346\267\241\351\251\254\351\224\241", Normal }, { "xn--b4w605ferd", Normal },
+		{ "\343\203\225\343\202\241\343\203\203\343\202\267\343\203\247\343\203\263", Normal },
+		{ "xn--bck1b9a5dre4c", Normal }, { "\320\276\321\200\320\263", Normal }, { "xn--c1avg", Normal },
+		{ "\340\244\250\340\245\207\340\244\237", Normal }, { "xn--c2br7g", Normal },
+		{ "\343\202\271\343\203\210\343\202\242", Normal }, { "xn--cck2b3b", Normal },
+		{ "\343\202\242\343\203\236\343\202\276\343\203\263", Normal }, { "xn--cckwcxetd", Normal },
+		{ "\354\202\274\354\204\261", Normal }, { "xn--cg4bki", Normal }, { "\345\225\206\346\240\207", Normal },
+		{ "xn--czr694b", Normal }, { "\345\225\206\345\272\227", Normal }, { "xn--czrs0t", Normal },
+		{ "\345\225\206\345\237\216", Normal }, { "xn--czru2d", Normal }, { "\320\264\320\265\321\202\320\270", Normal },
+		{ "xn--d1acj3b", Normal }, { "\343\203\235\343\202\244\343\203\263\343\203\210", Normal },
+		{ "xn--eckvdtc9d", Normal }, { "\346\226\260\351\227\273", Normal }, { "xn--efvy88h", Normal },
+		{ "\345\256\266\351\233\273", Normal }, { "xn--fct429k", Normal }, { "\331\203\331\210\331\205", Normal },
+		{ "xn--fhbei", Normal }, { "\344\270\255\346\226\207\347\275\221", Normal }, { "xn--fiq228c5hs", Normal },
+		{ "\344\270\255\344\277\241", Normal }, { "xn--fiq64b", Normal }, { "\345\250\261\344\271\220", Normal },
+		{ "xn--fjq720a", Normal }, { "\350\260\267\346\255\214", Normal }, { "xn--flw351e", Normal },
+		{ "\351\233\273\350\250\212\347\233\210\347\247\221", Normal }, { "xn--fzys8d69uvgm", Normal },
+		{ "\350\264\255\347\211\251", Normal }, { "xn--g2xx48c", Normal },
+		{ "\343\202\257\343\203\251\343\202\246\343\203\211", Normal }, { "xn--gckr3f0f", Normal },
+		{ "\351\200\232\350\262\251", Normal }, { "xn--gk3at1e", Normal }, { "\347\275\221\345\272\227", Normal },
+		{ "xn--hxt814e", Normal }, { "\340\244\270\340\244\202\340\244\227\340\244\240\340\244\250", Normal },
+		{ "xn--i1b6b1a6a2e", Normal }, { "\351\244\220\345\216\205", Normal }, { "xn--imr513n", Normal },
+		{ "\347\275\221\347\273\234", Normal }, { "xn--io0a7i", Normal }, { "\320\272\320\276\320\274", Normal },
+		{ "xn--j1aef", Normal }, { "\344\272\232\351\251\254\351\200\212", Normal }, { "xn--jlq480n2rg", Normal },
+		{ "\351\243\237\345\223\201", Normal }, { "xn--jvr189m", Normal },
+		{ "\351\243\236\345\210\251\346\265\246", Normal }, { "xn--kcrx77d1x4a", Normal },
+		{ "\346\211\213\346\234\272", Normal }, { "xn--kput3i", Normal },
+		{ "\330\247\330\261\330\247\331\205\331\203\331\210", Normal }, { "xn--mgba3a3ejt", Normal },
+		{ "\330\247\331\204\330\271\331\204\331\212\330\247\331\206", Normal }, { "xn--mgba7c0bbn0a", Normal },
+		{ "\330\247\330\252\330\265\330\247\331\204\330\247\330\252", Normal }, { "xn--mgbaakc7dvf", Normal },
+		{ "\330\250\330\247\330\262\330\247\330\261", Normal }, { "xn--mgbab2bd", Normal },
+		{ "\330\247\330\250\331\210\330\270\330\250\331\212", Normal }, { "xn--mgbca7dzdo", Normal },
+		{ "\331\203\330\247\330\253\331\210\331\204\331\212\331\203", Normal }, { "xn--mgbi4ecexp", Normal },
+		{ "\331\207\331\205\330\261\330\247\331\207", Normal }, { "xn--mgbt3dhd", Normal },
+		{ "\353\213\267\354\273\264", Normal }, { "xn--mk1bu44c", Normal }, { "\346\224\277\345\272\234", Normal },
+		{ "xn--mxtq1m", Normal }, { "\330\264\330\250\331\203\330\251", Normal }, { "xn--ngbc5azd", Normal },
+		{ "\330\250\331\212\330\252\331\203", Normal }, { "xn--ngbe9e0a", Normal }, { "\330\271\330\261\330\250", Normal },
+		{ "xn--ngbrx", Normal }, { "\346\234\272\346\236\204", Normal }, { "xn--nqv7f", Normal },
+		{ "\347\273\204\347\273\207\346\234\272\346\236\204", Normal }, { "xn--nqv7fs00ema", Normal },
+		{ "\345\201\245\345\272\267", Normal }, { "xn--nyqy26a", Normal }, { "\346\213\233\350\201\230", Normal },
+		{ "xn--otu796d", Normal }, { "\321\200\321\203\321\201", Normal }, { "xn--p1acf", Normal },
+		{ "\345\244\247\346\213\277", Normal }, { "xn--pssy2u", Normal },
+		{ "\343\201\277\343\202\223\343\201\252", Normal }, { "xn--q9jyb4c", Normal },
+		{ "\343\202\260\343\203\274\343\202\260\343\203\253", Normal }, { "xn--qcka1pmc", Normal },
+		{ "\344\270\226\347\225\214", Normal }, { "xn--rhqv96g", Normal }, { "\346\233\270\347\261\215", Normal },
+		{ "xn--rovu88b", Normal }, { "\347\275\221\345\235\200", Normal }, { "xn--ses554g", Normal },
+		{ "\353\213\267\353\204\267", Normal }, { "xn--t60b56a", Normal }, { "\343\202\263\343\203\240", Normal },
+		{ "xn--tckwe", Normal }, { "\345\244\251\344\270\273\346\225\231", Normal }, { "xn--tiq49xqyj", Normal },
+		{ "\346\270\270\346\210\217", Normal }, { "xn--unup4y", Normal }, { "verm\303\266gensberater", Normal },
+		{ "xn--vermgensberater-ctb", Normal }, { "verm\303\266gensberatung", Normal },
+		{ "xn--vermgensberatung-pwb", Normal }, { "\344\274\201\344\270\232", Normal }, { "xn--vhquv", Normal },
+		{ "\344\277\241\346\201\257", Normal }, { "xn--vuq861b", Normal },
+		{ "\345\230\211\351\207\214\345\244\247\351\205\222\345\272\227", Normal }, { "xn--w4r85el8fhu5dnra", Normal },
+		{ "\345\230\211\351\207\214", Normal }, { "xn--w4rs40l", Normal }, { "\345\271\277\344\270\234", Normal },
+		{ "xn--xhq521b", Normal }, { "\346\224\277\345\212\241", Normal }, { "xn--zfr164b", Normal }, { "xyz", Normal },
+		{ "yachts", Normal }, { "yahoo", Normal }, { "yamaxun", Normal }, { "yandex", Normal }, { "yodobashi", Normal },
+		{ "yoga", Normal }, { "yokohama", Normal }, { "you", Normal }, { "youtube", Normal }, { "yun", Normal },
+		{ "zappos", Normal }, { "zara", Normal }, { "zero", Normal }, { "zip", Normal }, { "zone", Normal },
+		{ "zuerich", Normal }, { "cc.ua", Normal }, { "inf.ua", Normal }, { "ltd.ua", Normal }, { "611.to", Normal },
+		{ "graphox.us", Normal }, { "devcdnaccesso.com", Wildcard }, { "on-acorn.io", Wildcard },
+		{ "activetrail.biz", Normal }, { "adobeaemcloud.com", Normal }, { "dev.adobeaemcloud.com", Wildcard },
+		{ "hlx.live", Normal }, { "adobeaemcloud.net", Normal }, { "hlx.page", Normal }, { "hlx3.page", Normal },
+		{ "adobeio-static.net", Normal }, { "adobeioruntime.net", Normal }, { "beep.pl", Normal },
+		{ "airkitapps.com", Normal }, { "airkitapps-au.com", Normal }, { "airkitapps.eu", Normal },
+		{ "aivencloud.com", Normal }, { "akadns.net", Normal }, { "akamai.net", Normal }, { "akamai-staging.net", Normal },
+		{ "akamaiedge.net", Normal }, { "akamaiedge-staging.net", Normal }, { "akamaihd.net", Normal },
+		{ "akamaihd-staging.net", Normal }, { "akamaiorigin.net", Normal }, { "akamaiorigin-staging.net", Normal },
+		{ "akamaized.net", Normal }, { "akamaized-staging.net", Normal }, { "edgekey.net", Normal },
+		{ "edgekey-staging.net", Normal }, { "edgesuite.net", Normal }, { "edgesuite-staging.net", Normal },
+		{ "barsy.ca", Normal }, { "compute.estate", Wildcard }, { "alces.network", Wildcard }, { "kasserver.com", Normal },
+		{ "altervista.org", Normal }, { "alwaysdata.net", Normal }, { "myamaze.net", Normal }, { "cloudfront.net", Normal },
+		{ "compute.amazonaws.com", Wildcard }, { "compute-1.amazonaws.com", Wildcard },
+		{ "compute.amazonaws.com.cn", Wildcard }, { "us-east-1.amazonaws.com", Normal },
+		{ "s3.cn-north-1.amazonaws.com.cn", Normal }, { "s3.dualstack.ap-northeast-1.amazonaws.com", Normal },
+		{ "s3.dualstack.ap-northeast-2.amazonaws.com", Normal }, { "s3.ap-northeast-2.amazonaws.com", Normal },
+		{ "s3-website.ap-northeast-2.amazonaws.com", Normal }, { "s3.dualstack.ap-south-1.amazonaws.com", Normal },
+		{ "s3.ap-south-1.amazonaws.com", Normal }, { "s3-website.ap-south-1.amazonaws.com", Normal },
+		{ "s3.dualstack.ap-southeast-1.amazonaws.com", Normal }, { "s3.dualstack.ap-southeast-2.amazonaws.com", Normal },
+		{ "s3.dualstack.ca-central-1.amazonaws.com", Normal }, { "s3.ca-central-1.amazonaws.com", Normal },
+		{ "s3-website.ca-central-1.amazonaws.com", Normal }, { "s3.dualstack.eu-central-1.amazonaws.com", Normal },
+		{ "s3.eu-central-1.amazonaws.com", Normal }, { "s3-website.eu-central-1.amazonaws.com", Normal },
+		{ "s3.dualstack.eu-west-1.amazonaws.com", Normal }, { "s3.dualstack.eu-west-2.amazonaws.com", Normal },
+		{ "s3.eu-west-2.amazonaws.com", Normal }, { "s3-website.eu-west-2.amazonaws.com", Normal },
+		{ "s3.dualstack.eu-west-3.amazonaws.com", Normal }, { "s3.eu-west-3.amazonaws.com", Normal },
+		{ "s3-website.eu-west-3.amazonaws.com", Normal }, { "s3.amazonaws.com", Normal },
+		{ "s3-ap-northeast-1.amazonaws.com", Normal }, { "s3-ap-northeast-2.amazonaws.com", Normal },
+		{ "s3-ap-south-1.amazonaws.com", Normal }, { "s3-ap-southeast-1.amazonaws.com", Normal },
+		{ "s3-ap-southeast-2.amazonaws.com", Normal }, { "s3-ca-central-1.amazonaws.com", Normal },
+		{ "s3-eu-central-1.amazonaws.com", Normal }, { "s3-eu-west-1.amazonaws.com", Normal },
+		{ "s3-eu-west-2.amazonaws.com", Normal }, { "s3-eu-west-3.amazonaws.com", Normal },
+		{ "s3-external-1.amazonaws.com", Normal }, { "s3-fips-us-gov-west-1.amazonaws.com", Normal },
+		{ "s3-sa-east-1.amazonaws.com", Normal }, { "s3-us-east-2.amazonaws.com", Normal },
+		{ "s3-us-gov-west-1.amazonaws.com", Normal }, { "s3-us-west-1.amazonaws.com", Normal },
+		{ "s3-us-west-2.amazonaws.com", Normal }, { "s3-website-ap-northeast-1.amazonaws.com", Normal },
+		{ "s3-website-ap-southeast-1.amazonaws.com", Normal }, { "s3-website-ap-southeast-2.amazonaws.com", Normal },
+		{ "s3-website-eu-west-1.amazonaws.com", Normal }, { "s3-website-sa-east-1.amazonaws.com", Normal },
+		{ "s3-website-us-east-1.amazonaws.com", Normal }, { "s3-website-us-west-1.amazonaws.com", Normal },
+		{ "s3-website-us-west-2.amazonaws.com", Normal }, { "s3.dualstack.sa-east-1.amazonaws.com", Normal },
+		{ "s3.dualstack.us-east-1.amazonaws.com", Normal }, { "s3.dualstack.us-east-2.amazonaws.com", Normal },
+		{ "s3.us-east-2.amazonaws.com", Normal }, { "s3-website.us-east-2.amazonaws.com", Normal },
+		{ "vfs.cloud9.af-south-1.amazonaws.com", Normal }, { "webview-assets.cloud9.af-south-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.ap-east-1.amazonaws.com", Normal }, { "webview-assets.cloud9.ap-east-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.ap-northeast-1.amazonaws.com", Normal },
+		{ "webview-assets.cloud9.ap-northeast-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.ap-northeast-2.amazonaws.com", Normal },
+		{ "webview-assets.cloud9.ap-northeast-2.amazonaws.com", Normal },
+		{ "vfs.cloud9.ap-northeast-3.amazonaws.com", Normal },
+		{ "webview-assets.cloud9.ap-northeast-3.amazonaws.com", Normal }, { "vfs.cloud9.ap-south-1.amazonaws.com", Normal },
+		{ "webview-assets.cloud9.ap-south-1.amazonaws.com", Normal }, { "vfs.cloud9.ap-southeast-1.amazonaws.com", Normal },
+		{ "webview-assets.cloud9.ap-southeast-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.ap-southeast-2.amazonaws.com", Normal },
+		{ "webview-assets.cloud9.ap-southeast-2.amazonaws.com", Normal },
+		{ "vfs.cloud9.ca-central-1.amazonaws.com", Normal }, { "webview-assets.cloud9.ca-central-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.eu-central-1.amazonaws.com", Normal }, { "webview-assets.cloud9.eu-central-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.eu-north-1.amazonaws.com", Normal }, { "webview-assets.cloud9.eu-north-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.eu-south-1.amazonaws.com", Normal }, { "webview-assets.cloud9.eu-south-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.eu-west-1.amazonaws.com", Normal }, { "webview-assets.cloud9.eu-west-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.eu-west-2.amazonaws.com", Normal }, { "webview-assets.cloud9.eu-west-2.amazonaws.com", Normal },
+		{ "vfs.cloud9.eu-west-3.amazonaws.com", Normal }, { "webview-assets.cloud9.eu-west-3.amazonaws.com", Normal },
+		{ "vfs.cloud9.me-south-1.amazonaws.com", Normal }, { "webview-assets.cloud9.me-south-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.sa-east-1.amazonaws.com", Normal }, { "webview-assets.cloud9.sa-east-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.us-east-1.amazonaws.com", Normal }, { "webview-assets.cloud9.us-east-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.us-east-2.amazonaws.com", Normal }, { "webview-assets.cloud9.us-east-2.amazonaws.com", Normal },
+		{ "vfs.cloud9.us-west-1.amazonaws.com", Normal }, { "webview-assets.cloud9.us-west-1.amazonaws.com", Normal },
+		{ "vfs.cloud9.us-west-2.amazonaws.com", Normal }, { "webview-assets.cloud9.us-west-2.amazonaws.com", Normal },
+		{ "cn-north-1.eb.amazonaws.com.cn", Normal }, { "cn-northwest-1.eb.amazonaws.com.cn", Normal },
+		{ "elasticbeanstalk.com", Normal }, { "ap-northeast-1.elasticbeanstalk.com", Normal },
+		{ "ap-northeast-2.elasticbeanstalk.com", Normal }, { "ap-northeast-3.elasticbeanstalk.com", Normal },
+		{ "ap-south-1.elasticbeanstalk.com", Normal }, { "ap-southeast-1.elasticbeanstalk.com", Normal },
+		{ "ap-southeast-2.elasticbeanstalk.com", Normal }, { "ca-central-1.elasticbeanstalk.com", Normal },
+		{ "eu-central-1.elasticbeanstalk.com", Normal }, { "eu-west-1.elasticbeanstalk.com", Normal },
+		{ "eu-west-2.elasticbeanstalk.com", Normal }, { "eu-west-3.elasticbeanstalk.com", Normal },
+		{ "sa-east-1.elasticbeanstalk.com", Normal }, { "us-east-1.elasticbeanstalk.com", Normal },
+		{ "us-east-2.elasticbeanstalk.com", Normal }, { "us-gov-west-1.elasticbeanstalk.com", Normal },
+		{ "us-west-1.elasticbeanstalk.com", Normal }, { "us-west-2.elasticbeanstalk.com", Normal },
+		{ "elb.amazonaws.com.cn", Wildcard }, { "elb.amazonaws.com", Wildcard }, { "awsglobalaccelerator.com", Normal },
+		{ "eero.online", Normal }, { "eero-stage.online", Normal }, { "t3l3p0rt.net", Normal },
+		{ "tele.amune.org", Normal }, { "apigee.io", Normal }, { "siiites.com", Normal }, { "appspacehosted.com", Normal },
+		{ "appspaceusercontent.com", Normal }, { "appudo.net", Normal }, { "on-aptible.com", Normal },
+		{ "user.aseinet.ne.jp", Normal }, { "gv.vc", Normal }, { "d.gv.vc", Normal }, { "user.party.eus", Normal },
+		{ "pimienta.org", Normal }, { "poivron.org", Normal }, { "potager.org", Normal }, { "sweetpepper.org", Normal },
+		{ "myasustor.com", Normal }, { "cdn.prod.atlassian-dev.net", Normal }, { "translated.page", Normal },
+		{ "autocode.dev", Normal }, { "myfritz.net", Normal }, { "onavstack.net", Normal }, { "awdev.ca", Wildcard },
+		{ "advisor.ws", Wildcard }, { "ecommerce-shop.pl", Normal }, { "b-data.io", Normal }, { "backplaneapp.io", Normal },
+		{ "balena-devices.com", Normal }, { "rs.ba", Normal }, { "banzai.cloud", Wildcard },
+		{ "app.banzaicloud.io", Normal }, { "backyards.banzaicloud.io", Wildcard }, { "base.ec", Normal },
+		{ "official.ec", Normal }, { "buyshop.jp", Normal }, { "fashionstore.jp", Normal }, { "handcrafted.jp", Normal },
+		{ "kawaiishop.jp", Normal }, { "supersale.jp", Normal }, { "theshop.jp", Normal }, { "shopselect.net", Normal },
+		{ "base.shop", Normal }, { "beagleboard.io", Normal }, { "beget.app", Wildcard }, { "betainabox.com", Normal },
+		{ "bnr.la", Normal }, { "bitbucket.io", Normal }, { "blackbaudcdn.net", Normal }, { "of.je", Normal },
+		{ "bluebite.io", Normal }, { "boomla.net", Normal }, { "boutir.com", Normal }, { "boxfuse.io", Normal },
+		{ "square7.ch", Normal }, { "bplaced.com", Normal }, { "bplaced.de", Normal }, { "square7.de", Normal },
+		{ "bplaced.net", Normal }, { "square7.net", Normal }, { "shop.brendly.rs", Normal },
+		{ "browsersafetymark.io", Normal }, { "uk0.bigv.io", Normal }, { "dh.bytemark.co.uk", Normal },
+		{ "vm.bytemark.co.uk", Normal }, { "cafjs.com", Normal }, { "mycd.eu", Normal }, { "canva-apps.cn", Normal },
+		{ "canva-apps.com", Normal }, { "drr.ac", Normal }, { "uwu.ai", Normal }, { "carrd.co", Normal },
+		{ "crd.co", Normal }, { "ju.mp", Normal }, { "ae.org", Normal }, { "br.com", Normal }, { "cn.com", Normal },
+		{ "com.de", Normal }, { "com.se", Normal }, { "de.com", Normal }, { "eu.com", Normal }, { "gb.net", Normal },
+		{ "hu.net", Normal }, { "jp.net", Normal }, { "jpn.com", Normal }, { "mex.com", Normal }, { "ru.com", Normal },
+		{ "sa.com", Normal }, { "se.net", Normal }, { "uk.com", Normal }, { "uk.net", Normal }, { "us.com", Normal },
+		{ "za.bz", Normal }, { "za.com", Normal }, { "ar.com", Normal }, { "hu.com", Normal }, { "kr.com", Normal },
+		{ "no.com", Normal }, { "qc.com", Normal }, { "uy.com", Normal }, { "africa.com", Normal }, { "gr.com", Normal },
+		{ "in.net", Normal }, { "web.in", Normal }, { "us.org", Normal }, { "co.com", Normal },
+		{ "aus.basketball", Normal }, { "nz.basketball", Normal }, { "radio.am", Normal }, { "radio.fm", Normal },
+		{ "c.la", Normal }, { "certmgr.org", Normal }, { "cx.ua", Normal }, { "discourse.group", Normal },
+		{ "discourse.team", Normal }, { "cleverapps.io", Normal }, { "clerk.app", Normal }, { "clerkstage.app", Normal },
+		{ "lcl.dev", Wildcard }, { "lclstage.dev", Wildcard }, { "stg.dev", Wildcard }, { "stgstage.dev", Wildcard },
+		{ "clickrising.net", Normal }, { "c66.me", Normal }, { "cloud66.ws", Normal }, { "cloud66.zone", Normal },
+		{ "jdevcloud.com", Normal }, { "wpdevcloud.com", Normal }, { "cloudaccess.host", Normal },
+		{ "freesite.host", Normal }, { "cloudaccess.net", Normal }, { "cloudcontrolled.com", Normal },
+		{ "cloudcontrolapp.com", Normal }, { "cloudera.site", Wildcard }, { "cf-ipfs.com", Normal },
+		{ "cloudflare-ipfs.com", Normal }, { "trycloudflare.com", Normal }, { "pages.dev", Normal }, { "r2.dev", Normal },
+		{ "workers.dev", Normal }, { "wnext.app", Normal }, { "co.ca", Normal }, { "otap.co", Wildcard },
+		{ "co.cz", Normal }, { "c.cdn77.org", Normal }, { "cdn77-ssl.net", Normal }, { "r.cdn77.net", Normal },
+		{ "rsc.cdn77.org", Normal }, { "ssl.origin.cdn77-secure.org", Normal }, { "cloudns.asia", Normal },
+		{ "cloudns.biz", Normal }, { "cloudns.club", Normal }, { "cloudns.cc", Normal }, { "cloudns.eu", Normal },
+		{ "cloudns.in", Normal }, { "cloudns.info", Normal }, { "cloudns.org", Normal }, { "cloudns.pro", Normal },
+		{ "cloudns.pw", Normal }, { "cloudns.us", Normal }, { "cnpy.gdn", Normal }, { "codeberg.page", Normal },
+		{ "co.nl", Normal }, { "co.no", Normal }, { "webhosting.be", Normal }, { "hosting-cluster.nl", Normal },
+		{ "ac.ru", Normal }, { "edu.ru", Normal }, { "gov.ru", Normal }, { "int.ru", Normal }, { "mil.ru", Normal },
+		{ "test.ru", Normal }, { "dyn.cosidns.de", Normal }, { "dynamisches-dns.de", Normal }, { "dnsupdater.de", Normal },
+		{ "internet-dns.de", Normal }, { "l-o-g-i-n.de", Normal }, { "dynamic-dns.info", Normal },
+		{ "feste-ip.net", Normal }, { "knx-server.net", Normal }, { "static-access.net", Normal }, { "realm.cz", Normal },
+		{ "cryptonomic.net", Wildcard }, { "cupcake.is", Normal }, { "curv.dev", Normal }, { "customer-oci.com", Wildcard },
+		{ "oci.customer-oci.com", Wildcard }, { "ocp.customer-oci.com", Wildcard }, { "ocs.customer-oci.com", Wildcard },
+		{ "cyon.link", Normal }, { "cyon.site", Normal }, { "fnwk.site", Normal }, { "folionetwork.site", Normal },
+		{ "platform0.app", Normal }, { "daplie.me", Normal }, { "localhost.daplie.me", Normal },
+		{ "dattolocal.com", Normal }, { "dattorelay.com", Normal }, { "dattoweb.com", Normal }, { "mydatto.com", Normal },
+		{ "dattolocal.net", Normal }, { "mydatto.net", Normal }, { "biz.dk", Normal }, { "co.dk", Normal },
+		{ "firm.dk", Normal }, { "reg.dk", Normal }, { "store.dk", Normal }, { "dyndns.dappnode.io", Normal },
+		{ "dapps.earth", Wildcard }, { "bzz.dapps.earth", Wildcard }, { "builtwithdark.com", Normal },
+		{ "demo.datadetect.com", Normal }, { "instance.datadetect.com", Normal }, { "edgestack.me", Normal },
+		{ "ddns5.com", Normal }, { "debian.net", Normal }, { "deno.dev", Normal }, { "deno-staging.dev", Normal },
+		{ "dedyn.io", Normal }, { "deta.app", Normal }, { "deta.dev", Normal }, { "rss.my.id", Wildcard },
+		{ "diher.solutions", Wildcard }, { "discordsays.com", Normal }, { "discordsez.com", Normal },
+		{ "jozi.biz", Normal }, { "dnshome.de", Normal }, { "online.th", Normal }, { "shop.th", Normal },
+		{ "drayddns.com", Normal }, { "shoparena.pl", Normal }, { "dreamhosters.com", Normal }, { "mydrobo.com", Normal },
+		{ "drud.io", Normal }, { "drud.us", Normal }, { "duckdns.org", Normal }, { "bip.sh", Normal },
+		{ "bitbridge.net", Normal }, { "dy.fi", Normal }, { "tunk.org", Normal }, { "dyndns-at-home.com", Normal },
+		{ "dyndns-at-work.com", Normal }, { "dyndns-blog.com", Normal }, { "dyndns-free.com", Normal },
+		{ "dyndns-home.com", Normal }, { "dyndns-ip.com", Normal }, { "dyndns-mail.com", Normal },
+		{ "dyndns-office.com", Normal }, { "dyndns-pics.com", Normal }, { "dyndns-remote.com", Normal },
+		{ "dyndns-server.com", Normal }, { "dyndns-web.com", Normal }, { "dyndns-wiki.com", Normal },
+		{ "dyndns-work.com", Normal }, { "dyndns.biz", Normal }, { "dyndns.info", Normal }, { "dyndns.org", Normal },
+		{ "dyndns.tv", Normal }, { "at-band-camp.net", Normal }, { "ath.cx", Normal },
+		{ "barrel-of-knowledge.info", Normal }, { "barrell-of-knowledge.info", Normal }, { "better-than.tv", Normal },
+		{ "blogdns.com", Normal }, { "blogdns.net", Normal }, { "blogdns.org", Normal }, { "blogsite.org", Normal },
+		{ "boldlygoingnowhere.org", Normal }, { "broke-it.net", Normal }, { "buyshouses.net", Normal },
+		{ "cechire.com", Normal }, { "dnsalias.com", Normal }, { "dnsalias.net", Normal }, { "dnsalias.org", Normal },
+		{ "dnsdojo.com", Normal }, { "dnsdojo.net", Normal }, { "dnsdojo.org", Normal }, { "does-it.net", Normal },
+		{ "doesntexist.com", Normal }, { "doesntexist.org", Normal }, { "dontexist.com", Normal },
+		{ "dontexist.net", Normal }, { "dontexist.org", Normal }, { "doomdns.com", Normal }, { "doomdns.org", Normal },
+		{ "dvrdns.org", Normal }, { "dyn-o-saur.com", Normal }, { "dynalias.com", Normal }, { "dynalias.net", Normal },
+		{ "dynalias.org", Normal }, { "dynathome.net", Normal }, { "dyndns.ws", Normal }, { "endofinternet.net", Normal },
+		{ "endofinternet.org", Normal }, { "endoftheinternet.org", Normal }, { "est-a-la-maison.com", Normal },
+		{ "est-a-la-masion.com", Normal }, { "est-le-patron.com", Normal }, { "est-mon-blogueur.com", Normal },
+		{ "for-better.biz", Normal }, { "for-more.biz", Normal }, { "for-our.info", Normal }, { "for-some.biz", Normal },
+		{ "for-the.biz", Normal }, { "forgot.her.name", Normal }, { "forgot.his.name", Normal }, { "from-ak.com", Normal },
+		{ "from-al.com", Normal }, { "from-ar.com", Normal }, { "from-az.net", Normal }, { "from-ca.com", Normal },
+		{ "from-co.net", Normal }, { "from-ct.com", Normal }, { "from-dc.com", Normal }, { "from-de.com", Normal },
+		{ "from-fl.com", Normal }, { "from-ga.com", Normal }, { "from-hi.com", Normal }, { "from-ia.com", Normal },
+		{ "from-id.com", Normal }, { "from-il.com", Normal }, { "from-in.com", Normal }, { "from-ks.com", Normal },
+		{ "from-ky.com", Normal }, { "from-la.net", Normal }, { "from-ma.com", Normal }, { "from-md.com", Normal },
+		{ "from-me.org", Normal }, { "from-mi.com", Normal }, { "from-mn.com", Normal }, { "from-mo.com", Normal },
+		{ "from-ms.com", Normal }, { "from-mt.com", Normal }, { "from-nc.com", Normal }, { "from-nd.com", Normal },
+		{ "from-ne.com", Normal }, { "from-nh.com", Normal }, { "from-nj.com", Normal }, { "from-nm.com", Normal },
+		{ "from-nv.com", Normal }, { "from-ny.net", Normal }, { "from-oh.com", Normal }, { "from-ok.com", Normal },
+		{ "from-or.com", Normal }, { "from-pa.com", Normal }, { "from-pr.com", Normal }, { "from-ri.com", Normal },
+		{ "from-sc.com", Normal }, { "from-sd.com", Normal }, { "from-tn.com", Normal }, { "from-tx.com", Normal },
+		{ "from-ut.com", Normal }, { "from-va.com", Normal }, { "from-vt.com", Normal }, { "from-wa.com", Normal },
+		{ "from-wi.com", Normal }, { "from-wv.com", Normal }, { "from-wy.com", Normal }, { "ftpaccess.cc", Normal },
+		{ "fuettertdasnetz.de", Normal }, { "game-host.org", Normal }, { "game-server.cc", Normal },
+		{ "getmyip.com", Normal }, { "gets-it.net", Normal }, { "go.dyndns.org", Normal }, { "gotdns.com", Normal },
+		{ "gotdns.org", Normal }, { "groks-the.info", Normal }, { "groks-this.info", Normal },
+		{ "ham-radio-op.net", Normal }, { "here-for-more.info", Normal }, { "hobby-site.com", Normal },
+		{ "hobby-site.org", Normal }, { "home.dyndns.org", Normal }, { "homedns.org", Normal }, { "homeftp.net", Normal },
+		{ "homeftp.org", Normal }, { "homeip.net", Normal }, { "homelinux.com", Normal }, { "homelinux.net", Normal },
+		{ "homelinux.org", Normal }, { "homeunix.com", Normal }, { "homeunix.net", Normal }, { "homeunix.org", Normal },
+		{ "iamallama.com", Normal }, { "in-the-band.net", Normal }, { "is-a-anarchist.com", Normal },
+		{ "is-a-blogger.com", Normal }, { "is-a-bookkeeper.com", Normal }, { "is-a-bruinsfan.org", Normal },
+		{ "is-a-bulls-fan.com", Normal }, { "is-a-candidate.org", Normal }, { "is-a-caterer.com", Normal },
+		{ "is-a-celticsfan.org", Normal }, { "is-a-chef.com", Normal }, { "is-a-chef.net", Normal },
+		{ "is-a-chef.org", Normal }, { "is-a-conservative.com", Normal }, { "is-a-cpa.com", Normal },
+		{ "is-a-cubicle-slave.com", Normal }, { "is-a-democrat.com", Normal }, { "is-a-designer.com", Normal },
+		{ "is-a-doctor.com", Normal }, { "is-a-financialadvisor.com", Normal }, { "is-a-geek.com", Normal },
+		{ "is-a-geek.net", Normal }, { "is-a-geek.org", Normal }, { "is-a-green.com", Normal }, { "is-a-guru.com", Normal },
+		{ "is-a-hard-worker.com", Normal }, { "is-a-hunter.com", Normal }, { "is-a-knight.org", Normal },
+		{ "is-a-landscaper.com", Normal }, { "is-a-lawyer.com", Normal }, { "is-a-liberal.com", Normal },
+		{ "is-a-libertarian.com", Normal }, { "is-a-linux-user.org", Normal }, { "is-a-llama.com", Normal },
+		{ "is-a-musician.com", Normal }, { "is-a-nascarfan.com", Normal }, { "is-a-nurse.com", Normal },
+		{ "is-a-painter.com", Normal }, { "is-a-patsfan.org", Normal }, { "is-a-personaltrainer.com", Normal },
+		{ "is-a-photographer.com", Normal }, { "is-a-player.com", Normal }, { "is-a-republican.com", Normal },
+		{ "is-a-rockstar.com", Normal }, { "is-a-socialist.com", Normal }, { "is-a-soxfan.org", Normal },
+		{ "is-a-student.com", Normal }, { "is-a-teacher.com", Normal }, { "is-a-techie.com", Normal },
+		{ "is-a-therapist.com", Normal }, { "is-an-accountant.com", Normal }, { "is-an-actor.com", Normal },
+		{ "is-an-actress.com", Normal }, { "is-an-anarchist.com", Normal }, { "is-an-artist.com", Normal },
+		{ "is-an-engineer.com", Normal }, { "is-an-entertainer.com", Normal }, { "is-by.us", Normal },
+		{ "is-certified.com", Normal }, { "is-found.org", Normal }, { "is-gone.com", Normal },
+		{ "is-into-anime.com", Normal }, { "is-into-cars.com", Normal }, { "is-into-cartoons.com", Normal },
+		{ "is-into-games.com", Normal }, { "is-leet.com", Normal }, { "is-lost.org", Normal },
+		{ "is-not-certified.com", Normal }, { "is-saved.org", Normal }, { "is-slick.com", Normal },
+		{ "is-uberleet.com", Normal }, { "is-very-bad.org", Normal }, { "is-very-evil.org", Normal },
+		{ "is-very-good.org", Normal }, { "is-very-nice.org", Normal }, { "is-very-sweet.org", Normal },
+		{ "is-with-theband.com", Normal }, { "isa-geek.com", Normal }, { "isa-geek.net", Normal },
+		{ "isa-geek.org", Normal }, { "isa-hockeynut.com", Normal }, { "issmarterthanyou.com", Normal },
+		{ "isteingeek.de", Normal }, { "istmein.de", Normal }, { "kicks-ass.net", Normal }, { "kicks-ass.org", Normal },
+		{ "knowsitall.info", Normal }, { "land-4-sale.us", Normal }, { "lebtimnetz.de", Normal },
+		{ "leitungsen.de", Normal }, { "likes-pie.com", Normal }, { "likescandy.com", Normal }, { "merseine.nu", Normal },
+		{ "mine.nu", Normal }, { "misconfused.org", Normal }, { "mypets.ws", Normal }, { "myphotos.cc", Normal },
+		{ "neat-url.com", Normal }, { "office-on-the.net", Normal }, { "on-the-web.tv", Normal }, { "podzone.net", Normal },
+		{ "podzone.org", Normal }, { "readmyblog.org", Normal }, { "saves-the-whales.com", Normal },
+		{ "scrapper-site.net", Normal }, { "scrapping.cc", Normal }, { "selfip.biz", Normal }, { "selfip.com", Normal },
+		{ "selfip.info", Normal }, { "selfip.net", Normal }, { "selfip.org", Normal }, { "sells-for-less.com", Normal },
+		{ "sells-for-u.com", Normal }, { "sells-it.net", Normal }, { "sellsyourhome.org", Normal },
+		{ "servebbs.com", Normal }, { "servebbs.net", Normal }, { "servebbs.org", Normal }, { "serveftp.net", Normal },
+		{ "serveftp.org", Normal }, { "servegame.org", Normal }, { "shacknet.nu", Normal }, { "simple-url.com", Normal },
+		{ "space-to-rent.com", Normal }, { "stuff-4-sale.org", Normal }, { "stuff-4-sale.us", Normal },
+		{ "teaches-yoga.com", Normal }, { "thruhere.net", Normal }, { "traeumtgerade.de", Normal },
+		{ "webhop.biz", Normal }, { "webhop.info", Normal }, { "webhop.net", Normal }, { "webhop.org", Normal },
+		{ "worse-than.tv", Normal }, { "writesthisblog.com", Normal }, { "ddnss.de", Normal }, { "dyn.ddnss.de", Normal },
+		{ "dyndns.ddnss.de", Normal }, { "dyndns1.de", Normal }, { "dyn-ip24.de", Normal }, { "home-webserver.de", Normal },
+		{ "dyn.home-webserver.de", Normal }, { "myhome-server.de", Normal }, { "ddnss.org", Normal },
+		{ "definima.net", Normal }, { "definima.io", Normal }, { "ondigitalocean.app", Normal },
+		{ "digitaloceanspaces.com", Wildcard }, { "bci.dnstrace.pro", Normal }, { "ddnsfree.com", Normal },
+		{ "ddnsgeek.com", Normal }, { "giize.com", Normal }, { "gleeze.com", Normal }, { "kozow.com", Normal },
+		{ "loseyourip.com", Normal }, { "ooguy.com", Normal }, { "theworkpc.com", Normal }, { "casacam.net", Normal },
+		{ "dynu.net", Normal }, { "accesscam.org", Normal }, { "camdvr.org", Normal }, { "freeddns.org", Normal },
+		{ "mywire.org", Normal }, { "webredirect.org", Normal }, { "myddns.rocks", Normal }, { "blogsite.xyz", Normal },
+		{ "dynv6.net", Normal }, { "e4.cz", Normal }, { "easypanel.app", Normal }, { "easypanel.host", Normal },
+		{ "elementor.cloud", Normal }, { "elementor.cool", Normal }, { "en-root.fr", Normal }, { "mytuleap.com", Normal },
+		{ "tuleap-partners.com", Normal }, { "encr.app", Normal }, { "encoreapi.com", Normal }, { "onred.one", Normal },
+		{ "staging.onred.one", Normal }, { "eu.encoway.cloud", Normal }, { "eu.org", Normal }, { "al.eu.org", Normal },
+		{ "asso.eu.org", Normal }, { "at.eu.org", Normal }, { "au.eu.org", Normal }, { "be.eu.org", Normal },
+		{ "bg.eu.org", Normal }, { "ca.eu.org", Normal }, { "cd.eu.org", Normal }, { "ch.eu.org", Normal },
+		{ "cn.eu.org", Normal }, { "cy.eu.org", Normal }, { "cz.eu.org", Normal }, { "de.eu.org", Normal },
+		{ "dk.eu.org", Normal }, { "edu.eu.org", Normal }, { "ee.eu.org", Normal }, { "es.eu.org", Normal },
+		{ "fi.eu.org", Normal }, { "fr.eu.org", Normal }, { "gr.eu.org", Normal }, { "hr.eu.org", Normal },
+		{ "hu.eu.org", Normal }, { "ie.eu.org", Normal }, { "il.eu.org", Normal }, { "in.eu.org", Normal },
+		{ "int.eu.org", Normal }, { "is.eu.org", Normal }, { "it.eu.org", Normal }, { "jp.eu.org", Normal },
+		{ "kr.eu.org", Normal }, { "lt.eu.org", Normal }, { "lu.eu.org", Normal }, { "lv.eu.org", Normal },
+		{ "mc.eu.org", Normal }, { "me.eu.org", Normal }, { "mk.eu.org", Normal }, { "mt.eu.org", Normal },
+		{ "my.eu.org", Normal }, { "net.eu.org", Normal }, { "ng.eu.org", Normal }, { "nl.eu.org", Normal },
+		{ "no.eu.org", Normal }, { "nz.eu.org", Normal }, { "paris.eu.org", Normal }, { "pl.eu.org", Normal },
+		{ "pt.eu.org", Normal }, { "q-a.eu.org", Normal }, { "ro.eu.org", Normal }, { "ru.eu.org", Normal },
+		{ "se.eu.org", Normal }, { "si.eu.org", Normal }, { "sk.eu.org", Normal }, { "tr.eu.org", Normal },
+		{ "uk.eu.org", Normal }, { "us.eu.org", Normal }, { "eurodir.ru", Normal }, { "eu-1.evennode.com", Normal },
+		{ "eu-2.evennode.com", Normal }, { "eu-3.evennode.com", Normal }, { "eu-4.evennode.com", Normal },
+		{ "us-1.evennode.com", Normal }, { "us-2.evennode.com", Normal }, { "us-3.evennode.com", Normal },
+		{ "us-4.evennode.com", Normal }, { "twmail.cc", Normal }, { "twmail.net", Normal }, { "twmail.org", Normal },
+		{ "mymailer.com.tw", Normal }, { "url.tw", Normal }, { "onfabrica.com", Normal }, { "apps.fbsbx.com", Normal },
+		{ "ru.net", Normal }, { "adygeya.ru", Normal }, { "bashkiria.ru", Normal }, { "bir.ru", Normal },
+		{ "cbg.ru", Normal }, { "com.ru", Normal }, { "dagestan.ru", Normal }, { "grozny.ru", Normal },
+		{ "kalmykia.ru", Normal }, { "kustanai.ru", Normal }, { "marine.ru", Normal }, { "mordovia.ru", Normal },
+		{ "msk.ru", Normal }, { "mytis.ru", Normal }, { "nalchik.ru", Normal }, { "nov.ru", Normal },
+		{ "pyatigorsk.ru", Normal }, { "spb.ru", Normal }, { "vladikavkaz.ru", Normal }, { "vladimir.ru", Normal },
+		{ "abkhazia.su", Normal }, { "adygeya.su", Normal }, { "aktyubinsk.su", Normal }, { "arkhangelsk.su", Normal },
+		{ "armenia.su", Normal }, { "ashgabad.su", Normal }, { "azerbaijan.su", Normal }, { "balashov.su", Normal },
+		{ "bashkiria.su", Normal }, { "bryansk.su", Normal }, { "bukhara.su", Normal }, { "chimkent.su", Normal },
+		{ "dagestan.su", Normal }, { "east-kazakhstan.su", Normal }, { "exnet.su", Normal }, { "georgia.su", Normal },
+		{ "grozny.su", Normal }, { "ivanovo.su", Normal }, { "jambyl.su", Normal }, { "kalmykia.su", Normal },
+		{ "kaluga.su", Normal }, { "karacol.su", Normal }, { "karaganda.su", Normal }, { "karelia.su", Normal },
+		{ "khakassia.su", Normal }, { "krasnodar.su", Normal }, { "kurgan.su", Normal }, { "kustanai.su", Normal },
+		{ "lenug.su", Normal }, { "mangyshlak.su", Normal }, { "mordovia.su", Normal }, { "msk.su", Normal },
+		{ "murmansk.su", Normal }, { "nalchik.su", Normal }, { "navoi.su", Normal }, { "north-kazakhstan.su", Normal },
+		{ "nov.su", Normal }, { "obninsk.su", Normal }, { "penza.su", Normal }, { "pokrovsk.su", Normal },
+		{ "sochi.su", Normal }, { "spb.su", Normal }, { "tashkent.su", Normal }, { "termez.su", Normal },
+		{ "togliatti.su", Normal }, { "troitsk.su", Normal }, { "tselinograd.su", Normal }, { "tula.su", Normal },
+		{ "tuva.su", Normal }, { "vladikavkaz.su", Normal }, { "vladimir.su", Normal }, { "vologda.su", Normal },
+		{ "channelsdvr.net", Normal }, { "u.channelsdvr.net", Normal }, { "edgecompute.app", Normal },
+		{ "fastly-edge.com", Normal }, { "fastly-terrarium.com", Normal }, { "fastlylb.net", Normal },
+		{ "map.fastlylb.net", Normal }, { "freetls.fastly.net", Normal }, { "map.fastly.net", Normal },
+		{ "a.prod.fastly.net", Normal }, { "global.prod.fastly.net", Normal }, { "a.ssl.fastly.net", Normal },
+		{ "b.ssl.fastly.net", Normal }, { "global.ssl.fastly.net", Normal }, { "user.fm", Wildcard },
+		{ "fastvps-server.com", Normal }, { "fastvps.host", Normal }, { "myfast.host", Normal }, { "fastvps.site", Normal },
+		{ "myfast.space", Normal }, { "fedorainfracloud.org", Normal }, { "fedorapeople.org", Normal },
+		{ "cloud.fedoraproject.org", Normal }, { "app.os.fedoraproject.org", Normal },
+		{ "app.os.stg.fedoraproject.org", Normal }, { "conn.uk", Normal }, { "copro.uk", Normal }, { "hosp.uk", Normal },
+		{ "mydobiss.com", Normal }, { "fh-muenster.io", Normal }, { "filegear.me", Normal }, { "filegear-au.me", Normal },
+		{ "filegear-de.me", Normal }, { "filegear-gb.me", Normal }, { "filegear-ie.me", Normal },
+		{ "filegear-jp.me", Normal }, { "filegear-sg.me", Normal }, { "firebaseapp.com", Normal },
+		{ "fireweb.app", Normal }, { "flap.id", Normal }, { "onflashdrive.app", Normal }, { "fldrv.com", Normal },
+		{ "fly.dev", Normal }, { "edgeapp.net", Normal }, { "shw.io", Normal }, { "flynnhosting.net", Normal },
+		{ "forgeblocks.com", Normal }, { "id.forgerock.io", Normal }, { "framer.app", Normal },
+		{ "framercanvas.com", Normal }, { "framer.media", Normal }, { "framer.photos", Normal },
+		{ "framer.website", Normal }, { "framer.wiki", Normal }, { "frusky.de", Wildcard }, { "ravpage.co.il", Normal },
+		{ "0e.vc", Normal }, { "freebox-os.com", Normal }, { "freeboxos.com", Normal }, { "fbx-os.fr", Normal },
+		{ "fbxos.fr", Normal }, { "freebox-os.fr", Normal }, { "freeboxos.fr", Normal }, { "freedesktop.org", Normal },
+		{ "freemyip.com", Normal }, { "wien.funkfeuer.at", Normal }, { "futurecms.at", Wildcard },
+		{ "ex.futurecms.at", Wildcard }, { "in.futurecms.at", Wildcard }, { "futurehosting.at", Normal },
+		{ "futuremailing.at", Normal }, { "ex.ortsinfo.at", Wildcard }, { "kunden.ortsinfo.at", Wildcard },
+		{ "statics.cloud", Wildcard }, { "independent-commission.uk", Normal }, { "independent-inquest.uk", Normal },
+		{ "independent-inquiry.uk", Normal }, { "independent-panel.uk", Normal }, { "independent-review.uk", Normal },
+		{ "public-inquiry.uk", Normal }, { "royal-commission.uk", Normal }, { "campaign.gov.uk", Normal },
+		{ "service.gov.uk", Normal }, { "api.gov.uk", Normal }, { "gehirn.ne.jp", Normal }, { "usercontent.jp", Normal },
+		{ "gentapps.com", Normal }, { "gentlentapis.com", Normal }, { "lab.ms", Normal }, { "cdn-edges.net", Normal },
+		{ "ghost.io", Normal }, { "gsj.bz", Normal }, { "githubusercontent.com", Normal }, { "githubpreview.dev", Normal },
+		{ "github.io", Normal }, { "gitlab.io", Normal }, { "gitapp.si", Normal }, { "gitpage.si", Normal },
+		{ "glitch.me", Normal }, { "nog.community", Normal }, { "co.ro", Normal }, { "shop.ro", Normal },
+		{ "lolipop.io", Normal }, { "angry.jp", Normal }, { "babyblue.jp", Normal }, { "babymilk.jp", Normal },
+		{ "backdrop.jp", Normal }, { "bambina.jp", Normal }, { "bitter.jp", Normal }, { "blush.jp", Normal },
+		{ "boo.jp", Normal }, { "boy.jp", Normal }, { "boyfriend.jp", Normal }, { "but.jp", Normal },
+		{ "candypop.jp", Normal }, { "capoo.jp", Normal }, { "catfood.jp", Normal }, { "cheap.jp", Normal },
+		{ "chicappa.jp", Normal }, { "chillout.jp", Normal }, { "chips.jp", Normal }, { "chowder.jp", Normal },
+		{ "chu.jp", Normal }, { "ciao.jp", Normal }, { "cocotte.jp", Normal }, { "coolblog.jp", Normal },
+		{ "cranky.jp", Normal }, { "cutegirl.jp", Normal }, { "daa.jp", Normal }, { "deca.jp", Normal },
+		{ "deci.jp", Normal }, { "digick.jp", Normal }, { "egoism.jp", Normal }, { "fakefur.jp", Normal },
+		{ "fem.jp", Normal }, { "flier.jp", Normal }, { "floppy.jp", Normal }, { "fool.jp", Normal },
+		{ "frenchkiss.jp", Normal }, { "girlfriend.jp", Normal }, { "girly.jp", Normal }, { "gloomy.jp", Normal },
+		{ "gonna.jp", Normal }, { "greater.jp", Normal }, { "hacca.jp", Normal }, { "heavy.jp", Normal },
+		{ "her.jp", Normal }, { "hiho.jp", Normal }, { "hippy.jp", Normal }, { "holy.jp", Normal }, { "hungry.jp", Normal },
+		{ "icurus.jp", Normal }, { "itigo.jp", Normal }, { "jellybean.jp", Normal }, { "kikirara.jp", Normal },
+		{ "kill.jp", Normal }, { "kilo.jp", Normal }, { "kuron.jp", Normal }, { "littlestar.jp", Normal },
+		{ "lolipopmc.jp", Normal }, { "lolitapunk.jp", Normal }, { "lomo.jp", Normal }, { "lovepop.jp", Normal },
+		{ "lovesick.jp", Normal }, { "main.jp", Normal }, { "mods.jp", Normal }, { "mond.jp", Normal },
+		{ "mongolian.jp", Normal }, { "moo.jp", Normal }, { "namaste.jp", Normal }, { "nikita.jp", Normal },
+		{ "nobushi.jp", Normal }, { "noor.jp", Normal }, { "oops.jp", Normal }, { "parallel.jp", Normal },
+		{ "parasite.jp", Normal }, { "pecori.jp", Normal }, { "peewee.jp", Normal }, { "penne.jp", Normal },
+		{ "pepper.jp", Normal }, { "perma.jp", Normal }, { "pigboat.jp", Normal }, { "pinoko.jp", Normal },
+		{ "punyu.jp", Normal }, { "pupu.jp", Normal }, { "pussycat.jp", Normal }, { "pya.jp", Normal },
+		{ "raindrop.jp", Normal }, { "readymade.jp", Normal }, { "sadist.jp", Normal }, { "schoolbus.jp", Normal },
+		{ "secret.jp", Normal }, { "staba.jp", Normal }, { "stripper.jp", Normal }, { "sub.jp", Normal },
+		{ "sunnyday.jp", Normal }, { "thick.jp", Normal }, { "tonkotsu.jp", Normal }, { "under.jp", Normal },
+		{ "upper.jp", Normal }, { "velvet.jp", Normal }, { "verse.jp", Normal }, { "versus.jp", Normal },
+		{ "vivian.jp", Normal }, { "watson.jp", Normal }, { "weblike.jp", Normal }, { "whitesnow.jp", Normal },
+		{ "zombie.jp", Normal }, { "heteml.net", Normal }, { "cloudapps.digital", Normal },
+		{ "london.cloudapps.digital", Normal }, { "pymnt.uk", Normal }, { "homeoffice.gov.uk", Normal },
+		{ "ro.im", Normal }, { "goip.de", Normal }, { "run.app", Normal }, { "a.run.app", Normal }, { "web.app", Normal },
+		{ "0emm.com", Wildcard }, { "appspot.com", Normal }, { "r.appspot.com", Wildcard }, { "codespot.com", Normal },
+		{ "googleapis.com", Normal }, { "googlecode.com", Normal }, { "pagespeedmobilizer.com", Normal },
+		{ "publishproxy.com", Normal }, { "withgoogle.com", Normal }, { "withyoutube.com", Normal },
+		{ "gateway.dev", Wildcard }, { "cloud.goog", Normal }, { "translate.goog", Normal },
+		{ "usercontent.goog", Wildcard }, { "cloudfunctions.net", Normal }, { "blogspot.ae", Normal },
+		{ "blogspot.al", Normal }, { "blogspot.am", Normal }, { "blogspot.ba", Normal }, { "blogspot.be", Normal },
+		{ "blogspot.bg", Normal }, { "blogspot.bj", Normal }, { "blogspot.ca", Normal }, { "blogspot.cf", Normal },
+		{ "blogspot.ch", Normal }, { "blogspot.cl", Normal }, { "blogspot.co.at", Normal }, { "blogspot.co.id", Normal },
+		{ "blogspot.co.il", Normal }, { "blogspot.co.ke", Normal }, { "blogspot.co.nz", Normal },
+		{ "blogspot.co.uk", Normal }, { "blogspot.co.za", Normal }, { "blogspot.com", Normal },
+		{ "blogspot.com.ar", Normal }, { "blogspot.com.au", Normal }, { "blogspot.com.br", Normal },
+		{ "blogspot.com.by", Normal }, { "blogspot.com.co", Normal }, { "blogspot.com.cy", Normal },
+		{ "blogspot.com.ee", Normal }, { "blogspot.com.eg", Normal }, { "blogspot.com.es", Normal },
+		{ "blogspot.com.mt", Normal }, { "blogspot.com.ng", Normal }, { "blogspot.com.tr", Normal },
+		{ "blogspot.com.uy", Normal }, { "blogspot.cv", Normal }, { "blogspot.cz", Normal }, { "blogspot.de", Normal },
+		{ "blogspot.dk", Normal }, { "blogspot.fi", Normal }, { "blogspot.fr", Normal }, { "blogspot.gr", Normal },
+		{ "blogspot.hk", Normal }, { "blogspot.hr", Normal }, { "blogspot.hu", Normal }, { "blogspot.ie", Normal },
+		{ "blogspot.in", Normal }, { "blogspot.is", Normal }, { "blogspot.it", Normal }, { "blogspot.jp", Normal },
+		{ "blogspot.kr", Normal }, { "blogspot.li", Normal }, { "blogspot.lt", Normal }, { "blogspot.lu", Normal },
+		{ "blogspot.md", Normal }, { "blogspot.mk", Normal }, { "blogspot.mr", Normal }, { "blogspot.mx", Normal },
+		{ "blogspot.my", Normal }, { "blogspot.nl", Normal }, { "blogspot.no", Normal }, { "blogspot.pe", Normal },
+		{ "blogspot.pt", Normal }, { "blogspot.qa", Normal }, { "blogspot.re", Normal }, { "blogspot.ro", Normal },
+		{ "blogspot.rs", Normal }, { "blogspot.ru", Normal }, { "blogspot.se", Normal }, { "blogspot.sg", Normal },
+		{ "blogspot.si", Normal }, { "blogspot.sk", Normal }, { "blogspot.sn", Normal }, { "blogspot.td", Normal },
+		{ "blogspot.tw", Normal }, { "blogspot.ug", Normal }, { "blogspot.vn", Normal }, { "goupile.fr", Normal },
+		{ "gov.nl", Normal }, { "awsmppl.com", Normal }, { "g\303\274nstigbestellen.de", Normal },
+		{ "xn--gnstigbestellen-zvb.de", Normal }, { "g\303\274nstigliefern.de", Normal },
+		{ "xn--gnstigliefern-wob.de", Normal }, { "fin.ci", Normal }, { "free.hr", Normal }, { "caa.li", Normal },
+		{ "ua.rs", Normal }, { "conf.se", Normal }, { "hs.zone", Normal }, { "hs.run", Normal }, { "hashbang.sh", Normal },
+		{ "hasura.app", Normal }, { "hasura-app.io", Normal }, { "pages.it.hs-heilbronn.de", Normal },
+		{ "hepforge.org", Normal }, { "herokuapp.com", Normal }, { "herokussl.com", Normal }, { "ravendb.cloud", Normal },
+		{ "ravendb.community", Normal }, { "ravendb.me", Normal }, { "development.run", Normal }, { "ravendb.run", Normal },
+		{ "homesklep.pl", Normal }, { "secaas.hk", Normal }, { "hoplix.shop", Normal }, { "orx.biz", Normal },
+		{ "biz.gl", Normal }, { "col.ng", Normal }, { "firm.ng", Normal }, { "gen.ng", Normal }, { "ltd.ng", Normal },
+		{ "ngo.ng", Normal }, { "edu.scot", Normal }, { "sch.so", Normal }, { "hostyhosting.io", Normal },
+		{ "h\303\244kkinen.fi", Normal }, { "xn--hkkinen-5wa.fi", Normal }, { "moonscale.io", Wildcard },
+		{ "moonscale.net", Normal }, { "iki.fi", Normal }, { "ibxos.it", Normal }, { "iliadboxos.it", Normal },
+		{ "impertrixcdn.com", Normal }, { "impertrix.com", Normal }, { "smushcdn.com", Normal },
+		{ "wphostedmail.com", Normal }, { "wpmucdn.com", Normal }, { "tempurl.host", Normal }, { "wpmudev.host", Normal },
+		{ "dyn-berlin.de", Normal }, { "in-berlin.de", Normal }, { "in-brb.de", Normal }, { "in-butter.de", Normal },
+		{ "in-dsl.de", Normal }, { "in-dsl.net", Normal }, { "in-dsl.org", Normal }, { "in-vpn.de", Normal },
+		{ "in-vpn.net", Normal }, { "in-vpn.org", Normal }, { "biz.at", Normal }, { "info.at", Normal },
+		{ "info.cx", Normal }, { "ac.leg.br", Normal }, { "al.leg.br", Normal }, { "am.leg.br", Normal },
+		{ "ap.leg.br", Normal }, { "ba.leg.br", Normal }, { "ce.leg.br", Normal }, { "df.leg.br", Normal },
+		{ "es.leg.br", Normal }, { "go.leg.br", Normal }, { "ma.leg.br", Normal }, { "mg.leg.br", Normal },
+		{ "ms.leg.br", Normal }, { "mt.leg.br", Normal }, { "pa.leg.br", Normal }, { "pb.leg.br", Normal },
+		{ "pe.leg.br", Normal }, { "pi.leg.br", Normal }, { "pr.leg.br", Normal }, { "rj.leg.br", Normal },
+		{ "rn.leg.br", Normal }, { "ro.leg.br", Normal }, { "rr.leg.br", Normal }, { "rs.leg.br", Normal },
+		{ "sc.leg.br", Normal }, { "se.leg.br", Normal }, { "sp.leg.br", Normal }, { "to.leg.br", Normal },
+		{ "pixolino.com", Normal }, { "na4u.ru", Normal }, { "iopsys.se", Normal }, { "ipifony.net", Normal },
+		{ "iservschule.de", Normal }, { "mein-iserv.de", Normal }, { "schulplattform.de", Normal },
+		{ "schulserver.de", Normal }, { "test-iserv.de", Normal }, { "iserv.dev", Normal }, { "iobb.net", Normal },
+		{ "mel.cloudlets.com.au", Normal }, { "cloud.interhostsolutions.be", Normal },
+		{ "users.scale.virtualcloud.com.br", Normal }, { "mycloud.by", Normal }, { "alp1.ae.flow.ch", Normal },
+		{ "appengine.flow.ch", Normal }, { "es-1.axarnet.cloud", Normal }, { "diadem.cloud", Normal },
+		{ "vip.jelastic.cloud", Normal }, { "jele.cloud", Normal }, { "it1.eur.aruba.jenv-aruba.cloud", Normal },
+		{ "it1.jenv-aruba.cloud", Normal }, { "keliweb.cloud", Normal }, { "cs.keliweb.cloud", Normal },
+		{ "oxa.cloud", Normal }, { "tn.oxa.cloud", Normal }, { "uk.oxa.cloud", Normal }, { "primetel.cloud", Normal },
+		{ "uk.primetel.cloud", Normal }, { "ca.reclaim.cloud", Normal }, { "uk.reclaim.cloud", Normal },
+		{ "us.reclaim.cloud", Normal }, { "ch.trendhosting.cloud", Normal }, { "de.trendhosting.cloud", Normal },
+		{ "jele.club", Normal }, { "amscompute.com", Normal }, { "clicketcloud.com", Normal }, { "dopaas.com", Normal },
+		{ "hidora.com", Normal }, { "paas.hosted-by-previder.com", Normal }, { "rag-cloud.hosteur.com", Normal },
+		{ "rag-cloud-ch.hosteur.com", Normal }, { "jcloud.ik-server.com", Normal },
+		{ "jcloud-ver-jpc.ik-server.com", Normal }, { "demo.jelastic.com", Normal }, { "kilatiron.com", Normal },
+		{ "paas.massivegrid.com", Normal }, { "jed.wafaicloud.com", Normal }, { "lon.wafaicloud.com", Normal },
+		{ "ryd.wafaicloud.com", Normal }, { "j.scaleforce.com.cy", Normal }, { "jelastic.dogado.eu", Normal },
+		{ "fi.cloudplatform.fi", Normal }, { "demo.datacenter.fi", Normal }, { "paas.datacenter.fi", Normal },
+		{ "jele.host", Normal }, { "mircloud.host", Normal }, { "paas.beebyte.io", Normal },
+		{ "sekd1.beebyteapp.io", Normal }, { "jele.io", Normal }, { "cloud-fr1.unispace.io", Normal },
+		{ "jc.neen.it", Normal }, { "cloud.jelastic.open.tim.it", Normal }, { "jcloud.kz", Normal },
+		{ "upaas.kazteleport.kz", Normal }, { "cloudjiffy.net", Normal }, { "fra1-de.cloudjiffy.net", Normal },
+		{ "west1-us.cloudjiffy.net", Normal }, { "jls-sto1.elastx.net", Normal }, { "jls-sto2.elastx.net", Normal },
+		{ "jls-sto3.elastx.net", Normal }, { "faststacks.net", Normal }, { "fr-1.paas.massivegrid.net", Normal },
+		{ "lon-1.paas.massivegrid.net", Normal }, { "lon-2.paas.massivegrid.net", Normal },
+		{ "ny-1.paas.massivegrid.net", Normal }, { "ny-2.paas.massivegrid.net", Normal },
+		{ "sg-1.paas.massivegrid.net", Normal }, { "jelastic.saveincloud.net", Normal },
+		{ "nordeste-idc.saveincloud.net", Normal }, { "j.scaleforce.net", Normal }, { "jelastic.tsukaeru.net", Normal },
+		{ "sdscloud.pl", Normal }, { "unicloud.pl", Normal }, { "mircloud.ru", Normal },
+		{ "jelastic.regruhosting.ru", Normal }, { "enscaled.sg", Normal }, { "jele.site", Normal },
+		{ "jelastic.team", Normal }, { "orangecloud.tn", Normal }, { "j.layershift.co.uk", Normal },
+		{ "phx.enscaled.us", Normal }, { "mircloud.us", Normal }, { "myjino.ru", Normal },
+		{ "hosting.myjino.ru", Wildcard }, { "landing.myjino.ru", Wildcard }, { "spectrum.myjino.ru", Wildcard },
+		{ "vps.myjino.ru", Wildcard }, { "jotelulu.cloud", Normal }, { "triton.zone", Wildcard },
+		{ "cns.joyent.com", Wildcard }, { "js.org", Normal }, { "kaas.gg", Normal }, { "khplay.nl", Normal },
+		{ "ktistory.com", Normal }, { "kapsi.fi", Normal }, { "keymachine.de", Normal }, { "kinghost.net", Normal },
+		{ "uni5.net", Normal }, { "knightpoint.systems", Normal }, { "koobin.events", Normal }, { "oya.to", Normal },
+		{ "kuleuven.cloud", Normal }, { "ezproxy.kuleuven.be", Normal }, { "co.krd", Normal }, { "edu.krd", Normal },
+		{ "krellian.net", Normal }, { "webthings.io", Normal }, { "git-repos.de", Normal }, { "lcube-server.de", Normal },
+		{ "svn-repos.de", Normal }, { "leadpages.co", Normal }, { "lpages.co", Normal }, { "lpusercontent.com", Normal },
+		{ "lelux.site", Normal }, { "co.business", Normal }, { "co.education", Normal }, { "co.events", Normal },
+		{ "co.financial", Normal }, { "co.network", Normal }, { "co.place", Normal }, { "co.technology", Normal },
+		{ "app.lmpm.com", Normal }, { "linkyard.cloud", Normal }, { "linkyard-cloud.ch", Normal },
+		{ "members.linode.com", Normal }, { "nodebalancer.linode.com", Wildcard }, { "linodeobjects.com", Wildcard },
+		{ "ip.linodeusercontent.com", Normal }, { "we.bs", Normal }, { "user.localcert.dev", Wildcard },
+		{ "localzone.xyz", Normal }, { "loginline.app", Normal }, { "loginline.dev", Normal }, { "loginline.io", Normal },
+		{ "loginline.services", Normal }, { "loginline.site", Normal }, { "servers.run", Normal }, { "lohmus.me", Normal },
+		{ "krasnik.pl", Normal }, { "leczna.pl", Normal }, { "lubartow.pl", Normal }, { "lublin.pl", Normal },
+		{ "poniatowa.pl", Normal }, { "swidnik.pl", Normal }, { "glug.org.uk", Normal }, { "lug.org.uk", Normal },
+		{ "lugs.org.uk", Normal }, { "barsy.bg", Normal }, { "barsy.co.uk", Normal }, { "barsyonline.co.uk", Normal },
+		{ "barsycenter.com", Normal }, { "barsyonline.com", Normal }, { "barsy.club", Normal }, { "barsy.de", Normal },
+		{ "barsy.eu", Normal }, { "barsy.in", Normal }, { "barsy.info", Normal }, { "barsy.io", Normal },
+		{ "barsy.me", Normal }, { "barsy.menu", Normal }, { "barsy.mobi", Normal }, { "barsy.net", Normal },
+		{ "barsy.online", Normal }, { "barsy.org", Normal }, { "barsy.pro", Normal }, { "barsy.pub", Normal },
+		{ "barsy.ro", Normal }, { "barsy.shop", Normal }, { "barsy.site", Normal }, { "barsy.support", Normal },
+		{ "barsy.uk", Normal }, { "magentosite.cloud", Wildcard }, { "mayfirst.info", Normal }, { "mayfirst.org", Normal },
+		{ "hb.cldmail.ru", Normal }, { "cn.vu", Normal }, { "mazeplay.com", Normal }, { "mcpe.me", Normal },
+		{ "mcdir.me", Normal }, { "mcdir.ru", Normal }, { "mcpre.ru", Normal }, { "vps.mcdir.ru", Normal },
+		{ "mediatech.by", Normal }, { "mediatech.dev", Normal }, { "hra.health", Normal }, { "miniserver.com", Normal },
+		{ "memset.net", Normal }, { "messerli.app", Normal }, { "cloud.metacentrum.cz", Wildcard },
+		{ "custom.metacentrum.cz", Normal }, { "flt.cloud.muni.cz", Normal }, { "usr.cloud.muni.cz", Normal },
+		{ "meteorapp.com", Normal }, { "eu.meteorapp.com", Normal }, { "co.pl", Normal }, { "azurecontainer.io", Wildcard },
+		{ "azurewebsites.net", Normal }, { "azure-mobile.net", Normal }, { "cloudapp.net", Normal },
+		{ "azurestaticapps.net", Normal }, { "1.azurestaticapps.net", Normal }, { "2.azurestaticapps.net", Normal },
+		{ "centralus.azurestaticapps.net", Normal }, { "eastasia.azurestaticapps.net", Normal },
+		{ "eastus2.azurestaticapps.net", Normal }, { "westeurope.azurestaticapps.net", Normal },
+		{ "westus2.azurestaticapps.net", Normal }, { "csx.cc", Normal }, { "mintere.site", Normal }, { "forte.id", Normal },
+		{ "mozilla-iot.org", Normal }, { "bmoattachments.org", Normal }, { "net.ru", Normal }, { "org.ru", Normal },
+		{ "pp.ru", Normal }, { "hostedpi.com", Normal }, { "customer.mythic-beasts.com", Normal },
+		{ "caracal.mythic-beasts.com", Normal }, { "fentiger.mythic-beasts.com", Normal },
+		{ "lynx.mythic-beasts.com", Normal }, { "ocelot.mythic-beasts.com", Normal },
+		{ "oncilla.mythic-beasts.com", Normal }, { "onza.mythic-beasts.com", Normal },
+		{ "sphinx.mythic-beasts.com", Normal }, { "vs.mythic-beasts.com", Normal }, { "x.mythic-beasts.com", Normal },
+		{ "yali.mythic-beasts.com", Normal }, { "cust.retrosnub.co.uk", Normal }, { "ui.nabu.casa", Normal },
+		{ "cloud.nospamproxy.com", Normal }, { "netlify.app", Normal }, { "4u.com", Normal }, { "ngrok.io", Normal },
+		{ "nh-serv.co.uk", Normal }, { "nfshost.com", Normal }, { "developer.app", Wildcard }, { "noop.app", Normal },
+		{ "northflank.app", Wildcard }, { "build.run", Wildcard }, { "code.run", Wildcard }, { "database.run", Wildcard },
+		{ "migration.run", Wildcard }, { "noticeable.news", Normal }, { "dnsking.ch", Normal }, { "mypi.co", Normal },
+		{ "n4t.co", Normal }, { "001www.com", Normal }, { "ddnslive.com", Normal }, { "myiphost.com", Normal },
+		{ "forumz.info", Normal }, { "16-b.it", Normal }, { "32-b.it", Normal }, { "64-b.it", Normal },
+		{ "soundcast.me", Normal }, { "tcp4.me", Normal }, { "dnsup.net", Normal }, { "hicam.net", Normal },
+		{ "now-dns.net", Normal }, { "ownip.net", Normal }, { "vpndns.net", Normal }, { "dynserv.org", Normal },
+		{ "now-dns.org", Normal }, { "x443.pw", Normal }, { "now-dns.top", Normal }, { "ntdll.top", Normal },
+		{ "freeddns.us", Normal }, { "crafting.xyz", Normal }, { "zapto.xyz", Normal }, { "nsupdate.info", Normal },
+		{ "nerdpol.ovh", Normal }, { "blogsyte.com", Normal }, { "brasilia.me", Normal }, { "cable-modem.org", Normal },
+		{ "ciscofreak.com", Normal }, { "collegefan.org", Normal }, { "couchpotatofries.org", Normal },
+		{ "damnserver.com", Normal }, { "ddns.me", Normal }, { "ditchyourip.com", Normal }, { "dnsfor.me", Normal },
+		{ "dnsiskinky.com", Normal }, { "dvrcam.info", Normal }, { "dynns.com", Normal }, { "eating-organic.net", Normal },
+		{ "fantasyleague.cc", Normal }, { "geekgalaxy.com", Normal }, { "golffan.us", Normal },
+		{ "health-carereform.com", Normal }, { "homesecuritymac.com", Normal }, { "homesecuritypc.com", Normal },
+		{ "hopto.me", Normal }, { "ilovecollege.info", Normal }, { "loginto.me", Normal }, { "mlbfan.org", Normal },
+		{ "mmafan.biz", Normal }, { "myactivedirectory.com", Normal }, { "mydissent.net", Normal },
+		{ "myeffect.net", Normal }, { "mymediapc.net", Normal }, { "mypsx.net", Normal },
+		{ "mysecuritycamera.com", Normal }, { "mysecuritycamera.net", Normal }, { "mysecuritycamera.org", Normal },
+		{ "net-freaks.com", Normal }, { "nflfan.org", Normal }, { "nhlfan.net", Normal }, { "no-ip.ca", Normal },
+		{ "no-ip.co.uk", Normal }, { "no-ip.net", Normal }, { "noip.us", Normal }, { "onthewifi.com", Normal },
+		{ "pgafan.net", Normal }, { "point2this.com", Normal }, { "pointto.us", Normal },
+		{ "privatizehealthinsurance.net", Normal }, { "quicksytes.com", Normal }, { "read-books.org", Normal },
+		{ "securitytactics.com", Normal }, { "serveexchange.com", Normal }, { "servehumour.com", Normal },
+		{ "servep2p.com", Normal }, { "servesarcasm.com", Normal }, { "stufftoread.com", Normal }, { "ufcfan.org", Normal },
+		{ "unusualperson.com", Normal }, { "workisboring.com", Normal }, { "3utilities.com", Normal },
+		{ "bounceme.net", Normal }, { "ddns.net", Normal }, { "ddnsking.com", Normal }, { "gotdns.ch", Normal },
+		{ "hopto.org", Normal }, { "myftp.biz", Normal }, { "myftp.org", Normal }, { "myvnc.com", Normal },
+		{ "no-ip.biz", Normal }, { "no-ip.info", Normal }, { "no-ip.org", Normal }, { "noip.me", Normal },
+		{ "redirectme.net", Normal }, { "servebeer.com", Normal }, { "serveblog.net", Normal },
+		{ "servecounterstrike.com", Normal }, { "serveftp.com", Normal }, { "servegame.com", Normal },
+		{ "servehalflife.com", Normal }, { "servehttp.com", Normal }, { "serveirc.com", Normal },
+		{ "serveminecraft.net", Normal }, { "servemp3.com", Normal }, { "servepics.com", Normal },
+		{ "servequake.com", Normal }, { "sytes.net", Normal }, { "webhop.me", Normal }, { "zapto.org", Normal },
+		{ "stage.nodeart.io", Normal }, { "pcloud.host", Normal }, { "nyc.mn", Normal },
+		{ "static.observableusercontent.com", Normal }, { "cya.gg", Normal }, { "omg.lol", Normal },
+		{ "cloudycluster.net", Normal }, { "omniwe.site", Normal }, { "123hjemmeside.dk", Normal },
+		{ "123hjemmeside.no", Normal }, { "123homepage.it", Normal }, { "123kotisivu.fi", Normal },
+		{ "123minsida.se", Normal }, { "123miweb.es", Normal }, { "123paginaweb.pt", Normal }, { "123sait.ru", Normal },
+		{ "123siteweb.fr", Normal }, { "123webseite.at", Normal }, { "123webseite.de", Normal },
+		{ "123website.be", Normal }, { "123website.ch", Normal }, { "123website.lu", Normal }, { "123website.nl", Normal },
+		{ "service.one", Normal }, { "simplesite.com", Normal }, { "simplesite.com.br", Normal },
+		{ "simplesite.gr", Normal }, { "simplesite.pl", Normal }, { "nid.io", Normal }, { "opensocial.site", Normal },
+		{ "opencraft.hosting", Normal }, { "orsites.com", Normal }, { "operaunite.com", Normal }, { "tech.orange", Normal },
+		{ "authgear-staging.com", Normal }, { "authgearapps.com", Normal }, { "skygearapp.com", Normal },
+		{ "outsystemscloud.com", Normal }, { "webpaas.ovh.net", Wildcard }, { "hosting.ovh.net", Wildcard },
+		{ "ownprovider.com", Normal }, { "own.pm", Normal }, { "owo.codes", Wildcard }, { "ox.rs", Normal },
+		{ "oy.lc", Normal }, { "pgfog.com", Normal }, { "pagefrontapp.com", Normal }, { "pagexl.com", Normal },
+		{ "paywhirl.com", Wildcard }, { "bar0.net", Normal }, { "bar1.net", Normal }, { "bar2.net", Normal },
+		{ "rdv.to", Normal }, { "art.pl", Normal }, { "gliwice.pl", Normal }, { "krakow.pl", Normal },
+		{ "poznan.pl", Normal }, { "wroc.pl", Normal }, { "zakopane.pl", Normal }, { "pantheonsite.io", Normal },
+		{ "gotpantheon.com", Normal }, { "mypep.link", Normal }, { "perspecta.cloud", Normal }, { "lk3.ru", Normal },
+		{ "on-web.fr", Normal }, { "bc.platform.sh", Normal }, { "ent.platform.sh", Normal }, { "eu.platform.sh", Normal },
+		{ "us.platform.sh", Normal }, { "platformsh.site", Wildcard }, { "tst.site", Wildcard },
+		{ "platter-app.com", Normal }, { "platter-app.dev", Normal }, { "platterp.us", Normal }, { "pdns.page", Normal },
+		{ "plesk.page", Normal }, { "pleskns.com", Normal }, { "dyn53.io", Normal }, { "onporter.run", Normal },
+		{ "co.bn", Normal }, { "postman-echo.com", Normal }, { "pstmn.io", Normal }, { "mock.pstmn.io", Normal },
+		{ "httpbin.org", Normal }, { "prequalifyme.today", Normal }, { "xen.prgmr.com", Normal }, { "priv.at", Normal },
+		{ "prvcy.page", Normal }, { "dweb.link", Wildcard }, { "protonet.io", Normal },
+		{ "chirurgiens-dentistes-en-france.fr", Normal }, { "byen.site", Normal }, { "pubtls.org", Normal },
+		{ "pythonanywhere.com", Normal }, { "eu.pythonanywhere.com", Normal }, { "qoto.io", Normal },
+		{ "qualifioapp.com", Normal }, { "qbuser.com", Normal }, { "cloudsite.builders", Normal },
+		{ "instances.spawn.cc", Normal }, { "instantcloud.cn", Normal }, { "ras.ru", Normal }, { "qa2.com", Normal },
+		{ "qcx.io", Normal }, { "sys.qcx.io", Wildcard }, { "dev-myqnapcloud.com", Normal },
+		{ "alpha-myqnapcloud.com", Normal }, { "myqnapcloud.com", Normal }, { "quipelements.com", Wildcard },
+		{ "vapor.cloud", Normal }, { "vaporcloud.io", Normal }, { "rackmaze.com", Normal }, { "rackmaze.net", Normal },
+		{ "g.vbrplsbx.io", Normal }, { "on-k3s.io", Wildcard }, { "on-rancher.cloud", Wildcard }, { "on-rio.io", Wildcard },
+		{ "readthedocs.io", Normal }, { "rhcloud.com", Normal }, { "app.render.com", Normal }, { "onrender.com", Normal },
+		{ "firewalledreplit.co", Normal }, { "id.firewalledreplit.co", Normal }, { "repl.co", Normal },
+		{ "id.repl.co", Normal }, { "repl.run", Normal }, { "resindevice.io", Normal },
+		{ "devices.resinstaging.io", Normal }, { "hzc.io", Normal }, { "wellbeingzone.eu", Normal },
+		{ "wellbeingzone.co.uk", Normal }, { "adimo.co.uk", Normal }, { "itcouldbewor.se", Normal },
+		{ "git-pages.rit.edu", Normal }, { "rocky.page", Normal },
+		{ "\320\261\320\270\320\267.\321\200\321\203\321\201", Normal }, { "xn--90amc.xn--p1acf", Normal },
+		{ "\320\272\320\276\320\274.\321\200\321\203\321\201", Normal }, { "xn--j1aef.xn--p1acf", Normal },
+		{ "\320\272\321\200\321\213\320\274.\321\200\321\203\321\201", Normal }, { "xn--j1ael8b.xn--p1acf", Normal },
+		{ "\320\274\320\270\321\200.\321\200\321\203\321\201", Normal }, { "xn--h1ahn.xn--p1acf", Normal },
+		{ "\320\274\321\201\320\272.\321\200\321\203\321\201", Normal }, { "xn--j1adp.xn--p1acf", Normal },
+		{ "\320\276\321\200\320\263.\321\200\321\203\321\201", Normal }, { "xn--c1avg.xn--p1acf", Normal },
+		{ "\321\201\320\260\320\274\320\260\321\200\320\260.\321\200\321\203\321\201", Normal },
+		{ "xn--80aaa0cvac.xn--p1acf", Normal }, { "\321\201\320\276\321\207\320\270.\321\200\321\203\321\201", Normal },
+		{ "xn--h1aliz.xn--p1acf", Normal }, { "\321\201\320\277\320\261.\321\200\321\203\321\201", Normal },
+		{ "xn--90a1af.xn--p1acf", Normal }, { "\321\217.\321\200\321\203\321\201", Normal },
+		{ "xn--41a.xn--p1acf", Normal }, { "builder.code.com", Wildcard }, { "dev-builder.code.com", Wildcard },
+		{ "stg-builder.code.com", Wildcard }, { "sandcats.io", Normal }, { "logoip.de", Normal }, { "logoip.com", Normal },
+		{ "fr-par-1.baremetal.scw.cloud", Normal }, { "fr-par-2.baremetal.scw.cloud", Normal },
+		{ "nl-ams-1.baremetal.scw.cloud", Normal }, { "fnc.fr-par.scw.cloud", Normal },
+		{ "functions.fnc.fr-par.scw.cloud", Normal }, { "k8s.fr-par.scw.cloud", Normal },
+		{ "nodes.k8s.fr-par.scw.cloud", Normal }, { "s3.fr-par.scw.cloud", Normal },
+		{ "s3-website.fr-par.scw.cloud", Normal }, { "whm.fr-par.scw.cloud", Normal },
+		{ "priv.instances.scw.cloud", Normal }, { "pub.instances.scw.cloud", Normal }, { "k8s.scw.cloud", Normal },
+		{ "k8s.nl-ams.scw.cloud", Normal }, { "nodes.k8s.nl-ams.scw.cloud", Normal }, { "s3.nl-ams.scw.cloud", Normal },
+		{ "s3-website.nl-ams.scw.cloud", Normal }, { "whm.nl-ams.scw.cloud", Normal }, { "k8s.pl-waw.scw.cloud", Normal },
+		{ "nodes.k8s.pl-waw.scw.cloud", Normal }, { "s3.pl-waw.scw.cloud", Normal },
+		{ "s3-website.pl-waw.scw.cloud", Normal }, { "scalebook.scw.cloud", Normal }, { "smartlabeling.scw.cloud", Normal },
+		{ "dedibox.fr", Normal }, { "schokokeks.net", Normal }, { "gov.scot", Normal }, { "service.gov.scot", Normal },
+		{ "scrysec.com", Normal }, { "firewall-gateway.com", Normal }, { "firewall-gateway.de", Normal },
+		{ "my-gateway.de", Normal }, { "my-router.de", Normal }, { "spdns.de", Normal }, { "spdns.eu", Normal },
+		{ "firewall-gateway.net", Normal }, { "my-firewall.org", Normal }, { "myfirewall.org", Normal },
+		{ "spdns.org", Normal }, { "seidat.net", Normal }, { "sellfy.store", Normal }, { "senseering.net", Normal },
+		{ "minisite.ms", Normal }, { "magnet.page", Normal }, { "biz.ua", Normal }, { "co.ua", Normal },
+		{ "pp.ua", Normal }, { "shiftcrypto.dev", Normal }, { "shiftcrypto.io", Normal }, { "shiftedit.io", Normal },
+		{ "myshopblocks.com", Normal }, { "myshopify.com", Normal }, { "shopitsite.com", Normal },
+		{ "shopware.store", Normal }, { "mo-siemens.io", Normal }, { "1kapp.com", Normal }, { "appchizi.com", Normal },
+		{ "applinzi.com", Normal }, { "sinaapp.com", Normal }, { "vipsinaapp.com", Normal }, { "siteleaf.net", Normal },
+		{ "bounty-full.com", Normal }, { "alpha.bounty-full.com", Normal }, { "beta.bounty-full.com", Normal },
+		{ "small-web.org", Normal }, { "vp4.me", Normal }, { "snowflake.app", Normal },
+		{ "privatelink.snowflake.app", Normal }, { "streamlit.app", Normal }, { "streamlitapp.com", Normal },
+		{ "try-snowplow.com", Normal }, { "srht.site", Normal }, { "stackhero-network.com", Normal },
+		{ "musician.io", Normal }, { "novecore.site", Normal }, { "static.land", Normal }, { "dev.static.land", Normal },
+		{ "sites.static.land", Normal }, { "storebase.store", Normal }, { "vps-host.net", Normal },
+		{ "atl.jelastic.vps-host.net", Normal }, { "njs.jelastic.vps-host.net", Normal },
+		{ "ric.jelastic.vps-host.net", Normal }, { "playstation-cloud.com", Normal }, { "apps.lair.io", Normal },
+		{ "stolos.io", Wildcard }, { "spacekit.io", Normal }, { "customer.speedpartner.de", Normal },
+		{ "myspreadshop.at", Normal }, { "myspreadshop.com.au", Normal }, { "myspreadshop.be", Normal },
+		{ "myspreadshop.ca", Normal }, { "myspreadshop.ch", Normal }, { "myspreadshop.com", Normal },
+		{ "myspreadshop.de", Normal }, { "myspreadshop.dk", Normal }, { "myspreadshop.es", Normal },
+		{ "myspreadshop.fi", Normal }, { "myspreadshop.fr", Normal }, { "myspreadshop.ie", Normal },
+		{ "myspreadshop.it", Normal }, { "myspreadshop.net", Normal }, { "myspreadshop.nl", Normal },
+		{ "myspreadshop.no", Normal }, { "myspreadshop.pl", Normal }, { "myspreadshop.se", Normal },
+		{ "myspreadshop.co.uk", Normal }, { "api.stdlib.com", Normal }, { "storj.farm", Normal }, { "utwente.io", Normal },
+		{ "soc.srcf.net", Normal }, { "user.srcf.net", Normal }, { "temp-dns.com", Normal }, { "supabase.co", Normal },
+		{ "supabase.in", Normal }, { "supabase.net", Normal }, { "su.paba.se", Normal }, { "s5y.io", Wildcard },
+		{ "sensiosite.cloud", Wildcard }, { "syncloud.it", Normal }, { "dscloud.biz", Normal },
+		{ "direct.quickconnect.cn", Normal }, { "dsmynas.com", Normal }, { "familyds.com", Normal },
+		{ "diskstation.me", Normal }, { "dscloud.me", Normal }, { "i234.me", Normal }, { "myds.me", Normal },
+		{ "synology.me", Normal }, { "dscloud.mobi", Normal }, { "dsmynas.net", Normal }, { "familyds.net", Normal },
+		{ "dsmynas.org", Normal }, { "familyds.org", Normal }, { "vpnplus.to", Normal },
+		{ "direct.quickconnect.to", Normal }, { "tabitorder.co.il", Normal }, { "mytabit.co.il", Normal },
+		{ "mytabit.com", Normal }, { "taifun-dns.de", Normal }, { "beta.tailscale.net", Normal }, { "ts.net", Normal },
+		{ "gda.pl", Normal }, { "gdansk.pl", Normal }, { "gdynia.pl", Normal }, { "med.pl", Normal },
+		{ "sopot.pl", Normal }, { "site.tb-hosting.com", Normal }, { "edugit.io", Normal }, { "s3.teckids.org", Normal },
+		{ "telebit.app", Normal }, { "telebit.io", Normal }, { "telebit.xyz", Wildcard }, { "firenet.ch", Wildcard },
+		{ "svc.firenet.ch", Wildcard }, { "reservd.com", Normal }, { "thingdustdata.com", Normal },
+		{ "cust.dev.thingdust.io", Normal }, { "cust.disrec.thingdust.io", Normal }, { "cust.prod.thingdust.io", Normal },
+		{ "cust.testing.thingdust.io", Normal }, { "reservd.dev.thingdust.io", Normal },
+		{ "reservd.disrec.thingdust.io", Normal }, { "reservd.testing.thingdust.io", Normal }, { "tickets.io", Normal },
+		{ "arvo.network", Normal }, { "azimuth.network", Normal }, { "tlon.network", Normal }, { "torproject.net", Normal },
+		{ "pages.torproject.net", Normal }, { "bloxcms.com", Normal }, { "townnews-staging.com", Normal },
+		{ "12hp.at", Normal }, { "2ix.at", Normal }, { "4lima.at", Normal }, { "lima-city.at", Normal },
+		{ "12hp.ch", Normal }, { "2ix.ch", Normal }, { "4lima.ch", Normal }, { "lima-city.ch", Normal },
+		{ "trafficplex.cloud", Normal }, { "de.cool", Normal }, { "12hp.de", Normal }, { "2ix.de", Normal },
+		{ "4lima.de", Normal }, { "lima-city.de", Normal }, { "1337.pictures", Normal }, { "clan.rip", Normal },
+		{ "lima-city.rocks", Normal }, { "webspace.rocks", Normal }, { "lima.zone", Normal }, { "transurl.be", Wildcard },
+		{ "transurl.eu", Wildcard }, { "transurl.nl", Wildcard }, { "site.transip.me", Normal },
+		{ "tuxfamily.org", Normal }, { "dd-dns.de", Normal }, { "diskstation.eu", Normal }, { "diskstation.org", Normal },
+		{ "dray-dns.de", Normal }, { "draydns.de", Normal }, { "dyn-vpn.de", Normal }, { "dynvpn.de", Normal },
+		{ "mein-vigor.de", Normal }, { "my-vigor.de", Normal }, { "my-wan.de", Normal }, { "syno-ds.de", Normal },
+		{ "synology-diskstation.de", Normal }, { "synology-ds.de", Normal }, { "typedream.app", Normal },
+		{ "pro.typeform.com", Normal }, { "uber.space", Normal }, { "uberspace.de", Wildcard }, { "hk.com", Normal },
+		{ "hk.org", Normal }, { "ltd.hk", Normal }, { "inc.hk", Normal }, { "it.com", Normal }, { "name.pm", Normal },
+		{ "sch.tf", Normal }, { "biz.wf", Normal }, { "sch.wf", Normal }, { "org.yt", Normal },
+		{ "virtualuser.de", Normal }, { "virtual-user.de", Normal }, { "upli.io", Normal }, { "urown.cloud", Normal },
+		{ "dnsupdate.info", Normal }, { "lib.de.us", Normal }, { "2038.io", Normal }, { "vercel.app", Normal },
+		{ "vercel.dev", Normal }, { "now.sh", Normal }, { "router.management", Normal }, { "v-info.info", Normal },
+		{ "voorloper.cloud", Normal }, { "neko.am", Normal }, { "nyaa.am", Normal }, { "be.ax", Normal },
+		{ "cat.ax", Normal }, { "es.ax", Normal }, { "eu.ax", Normal }, { "gg.ax", Normal }, { "mc.ax", Normal },
+		{ "us.ax", Normal }, { "xy.ax", Normal }, { "nl.ci", Normal }, { "xx.gl", Normal }, { "app.gp", Normal },
+		{ "blog.gt", Normal }, { "de.gt", Normal }, { "to.gt", Normal }, { "be.gy", Normal }, { "cc.hn", Normal },
+		{ "blog.kg", Normal }, { "io.kg", Normal }, { "jp.kg", Normal }, { "tv.kg", Normal }, { "uk.kg", Normal },
+		{ "us.kg", Normal }, { "de.ls", Normal }, { "at.md", Normal }, { "de.md", Normal }, { "jp.md", Normal },
+		{ "to.md", Normal }, { "indie.porn", Normal }, { "vxl.sh", Normal }, { "ch.tc", Normal }, { "me.tc", Normal },
+		{ "we.tc", Normal }, { "nyan.to", Normal }, { "at.vg", Normal }, { "blog.vu", Normal }, { "dev.vu", Normal },
+		{ "me.vu", Normal }, { "v.ua", Normal }, { "vultrobjects.com", Wildcard }, { "wafflecell.com", Normal },
+		{ "webhare.dev", Wildcard }, { "reserve-online.net", Normal }, { "reserve-online.com", Normal },
+		{ "bookonline.app", Normal }, { "hotelwithflight.com", Normal }, { "wedeploy.io", Normal },
+		{ "wedeploy.me", Normal }, { "wedeploy.sh", Normal }, { "remotewd.com", Normal }, { "pages.wiardweb.com", Normal },
+		{ "wmflabs.org", Normal }, { "toolforge.org", Normal }, { "wmcloud.org", Normal }, { "panel.gg", Normal },
+		{ "daemon.panel.gg", Normal }, { "messwithdns.com", Normal }, { "woltlab-demo.com", Normal },
+		{ "myforum.community", Normal }, { "community-pro.de", Normal }, { "diskussionsbereich.de", Normal },
+		{ "community-pro.net", Normal }, { "meinforum.net", Normal }, { "affinitylottery.org.uk", Normal },
+		{ "raffleentry.org.uk", Normal }, { "weeklylottery.org.uk", Normal }, { "wpenginepowered.com", Normal },
+		{ "js.wpenginepowered.com", Normal }, { "wixsite.com", Normal }, { "editorx.io", Normal }, { "half.host", Normal },
+		{ "xnbay.com", Normal }, { "u2.xnbay.com", Normal }, { "u2-local.xnbay.com", Normal }, { "cistron.nl", Normal },
+		{ "demon.nl", Normal }, { "xs4all.space", Normal }, { "yandexcloud.net", Normal },
+		{ "storage.yandexcloud.net", Normal }, { "website.yandexcloud.net", Normal }, { "official.academy", Normal },
+		{ "yolasite.com", Normal }, { "ybo.faith", Normal }, { "yombo.me", Normal }, { "homelink.one", Normal },
+		{ "ybo.party", Normal }, { "ybo.review", Normal }, { "ybo.science", Normal }, { "ybo.trade", Normal },
+		{ "ynh.fr", Normal }, { "nohost.me", Normal }, { "noho.st", Normal }, { "za.net", Normal }, { "za.org", Normal },
+		{ "bss.design", Normal }, { "basicserver.io", Normal }, { "virtualserver.io", Normal },
+		{ "enterprisecloud.nu", Normal }
+	};
+
+	constexpr std::size_t TABLE_SIZE = 32768;
+
+	//slot -> rule index + 1, 0 is empty. FNV-1a of the rule name, linear probing
+	constexpr uint16_t TABLE[TABLE_SIZE] =
+	{
+		0, 0, 0, 4593, 4780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 667, 0, 5729, 6154, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5666, 8177, 0, 0, 0, 0, 4486, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 5165, 6222, 0, 9170, 438, 6558, 296, 453, 9143, 6180, 1812, 1639, 7341, 9033, 2748, 2770, 0, 0, 0, 4209,
+		0, 0, 0, 5397, 0, 2603, 0, 0, 0, 5741, 0, 9520, 0, 6937, 0, 0, 0, 0, 0, 8943, 885, 9878, 0, 0,
+		5279, 0, 7633, 0, 0, 6826, 0, 0, 0, 996, 0, 0, 0, 9803, 0, 2775, 0, 0, 0, 0, 0, 1121, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5178, 6317, 0, 8004,
+		0, 0, 902, 4227, 4711, 4332, 2230, 6051, 0, 0, 0, 0, 1874, 0, 0, 9746, 122, 1657, 5998, 0, 0, 0, 0, 0,
+		0, 0, 7335, 0, 112, 1333, 0, 1788, 8805, 0, 0, 0, 0, 0, 0, 0, 1514, 7184, 0, 3103, 3974, 0, 0, 0,
+		4379, 981, 5300, 0, 0, 0, 2004, 0, 0, 0, 0, 0, 4919, 0, 0, 0, 0, 8451, 0, 7000, 0, 0, 0, 5748,
+		0, 0, 0, 0, 1632, 1951, 2303, 0, 0, 0, 0, 0, 0, 0, 1040, 0, 8692, 4561, 2732, 6389, 0, 0, 6676, 0,
+		621, 0, 0, 0, 0, 0, 0, 0, 0, 272, 0, 0, 0, 0, 3234, 7407, 0, 0, 0, 0, 0, 0, 0, 3612,
+		0, 2085, 4690, 6528, 9167, 0, 0, 0, 0, 8644, 0, 0, 5379, 0, 0, 0, 0, 6920, 0, 0, 0, 0, 0, 0,
+		0, 6498, 7322, 0, 0, 0, 0, 307, 0, 0, 1824, 0, 3418, 0, 0, 0, 0, 0, 0, 0, 7415, 0, 8661, 0,
+		0, 0, 5907, 0, 1437, 0, 0, 0, 0, 7938, 0, 8294, 0, 0, 0, 0, 2590, 7889, 0, 0, 0, 0, 0, 1151,
+		0, 0, 0, 4758, 0, 8274, 8607, 8984, 6334, 2074, 5024, 9111, 0, 565, 9135, 0, 8797, 6105, 0, 0, 5339, 0, 103, 2466,
+		0, 1985, 0, 3549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1667, 6936, 388, 0, 114, 0, 1405, 8175, 2156, 199,
+		0, 0, 0, 0, 1891, 0, 8893, 0, 0, 6851, 8037, 0, 0, 0, 0, 0, 0, 5309, 935, 0, 0, 0, 8960, 0,
+		6415, 0, 0, 0, 0, 0, 0, 3094, 0, 0, 0, 0, 0, 365, 1168, 1704, 0, 0, 0, 1309, 2136, 8047, 3100, 9483,
+		9868, 146, 3078, 8240, 8834, 9770, 9904, 0, 0, 2330, 4432, 0, 0, 7099, 0, 0, 5120, 9266, 7527, 0, 0, 0, 0, 0,
+		0, 0, 0, 3202, 8801, 0, 0, 7147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 8864, 0, 0, 0, 0, 0, 0, 0, 8602, 0, 4694, 0, 2835, 0, 0, 0, 0,
+		2395, 0, 0, 0, 0, 0, 0, 4114, 0, 4494, 5059, 9010, 0, 0, 0, 0, 0, 0, 0, 0, 7512, 0, 0, 6794,
+		2629, 0, 0, 8121, 1362, 9582, 0, 0, 0, 0, 0, 0, 0, 0, 1255, 5906, 0, 0, 0, 358, 0, 0, 5239, 5819,
+		1060, 6378, 0, 2572, 0, 7266, 0, 0, 5080, 6358, 4890, 7203, 6906, 0, 0, 0, 0, 2645, 9722, 0, 0, 0, 0, 0,
+		3534, 0, 3521, 6551, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 0, 0, 0, 129, 1641, 4819, 0, 0,
+		0, 0, 0, 0, 4362, 356, 0, 107, 8828, 7144, 0, 4215, 2370, 692, 2483, 3937, 6146, 0, 0, 0, 0, 0, 832, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8058, 0, 0,
+		5280, 1952, 0, 0, 0, 0, 0, 0, 8437, 0, 0, 0, 0, 8549, 0, 0, 9681, 8849, 0, 9522, 6161, 2832, 9183, 0,
+		0, 9420, 5603, 0, 0, 0, 6170, 0, 3352, 0, 3706, 0, 5255, 0, 6869, 0, 7014, 7713, 1749, 8596, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 385, 1916, 4644, 8921, 0, 0, 0, 2496, 0, 0, 1165, 0, 8631, 8591, 3921,
+		7576, 0, 0, 1322, 0, 0, 0, 0, 7785, 0, 293, 0, 0, 0, 8085, 0, 8697, 0, 9756, 0, 0, 1395, 0, 0,
+		7272, 0, 0, 0, 5571, 0, 0, 4473, 0, 0, 7064, 6279, 9702, 0, 0, 0, 0, 0, 285, 0, 4934, 1232, 0, 0,
+		0, 0, 0, 0, 0, 6364, 0, 9390, 0, 0, 0, 0, 5389, 0, 0, 0, 7403, 0, 749, 0, 0, 0, 0, 0,
+		0, 8458, 0, 0, 4828, 0, 3540, 4516, 5009, 0, 1582, 0, 0, 0, 2882, 0, 3631, 0, 0, 0, 4259, 109, 0, 0,
+		4304, 0, 0, 0, 5493, 1416, 0, 0, 0, 0, 7779, 1489, 0, 4128, 4754, 0, 4321, 6467, 0, 6195, 0, 144, 0, 7111,
+		0, 0, 8142, 0, 2653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5655, 0, 0, 0, 0, 0, 0, 0,
+		6908, 0, 0, 0, 0, 1814, 0, 9781, 0, 0, 0, 0, 0, 0, 0, 2268, 691, 3040, 0, 0, 0, 0, 0, 0,
+		398, 0, 409, 0, 7529, 0, 2945, 7660, 7559, 0, 0, 0, 0, 0, 0, 0, 9530, 0, 0, 0, 6644, 0, 0, 1970,
+		1664, 0, 0, 0, 0, 9829, 3201, 3992, 0, 3192, 0, 0, 8021, 0, 0, 0, 2026, 1320, 9259, 0, 0, 0, 6443, 0,
+		2251, 0, 4722, 0, 0, 4939, 0, 0, 0, 0, 9845, 0, 8255, 9012, 0, 0, 0, 0, 8340, 8055, 0, 0, 0, 0,
+		0, 0, 841, 892, 1475, 0, 4531, 1364, 6538, 9357, 0, 4564, 9679, 0, 0, 0, 7430, 0, 1033, 0, 0, 0, 0, 7277,
+		0, 2449, 0, 1077, 3755, 5621, 3196, 0, 0, 0, 0, 0, 0, 0, 7966, 0, 0, 3528, 8436, 0, 0, 0, 0, 2884,
+		0, 0, 0, 0, 0, 0, 0, 5324, 0, 0, 0, 0, 9274, 0, 0, 0, 0, 0, 0, 7920, 5905, 0, 0, 0,
+		0, 0, 0, 7376, 0, 0, 0, 0, 979, 0, 0, 0, 0, 0, 7362, 0, 725, 0, 0, 2617, 0, 0, 0, 0,
+		0, 9730, 0, 0, 1415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2489, 8613, 0,
+		0, 7002, 6420, 0, 0, 0, 0, 6001, 0, 0, 5935, 0, 0, 0, 0, 0, 0, 2097, 0, 0, 0, 0, 8592, 0,
+		0, 0, 0, 0, 0, 7747, 4656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7735, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 7746, 0, 0, 0, 0, 0, 0, 7495, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		7638, 6028, 8307, 0, 903, 0, 3167, 0, 6321, 0, 0, 0, 0, 286, 3334, 0, 0, 6740, 0, 102, 0, 0, 4400, 2011,
+		0, 4481, 0, 0, 0, 0, 0, 0, 8082, 5137, 0, 0, 0, 0, 0, 8364, 0, 0, 0, 0, 3083, 292, 3848, 6176,
+		6194, 6219, 7663, 0, 6363, 1129, 0, 0, 0, 9026, 9328, 0, 9525, 0, 0, 2899, 0, 0, 8404, 0, 0, 6795, 0, 0,
+		0, 0, 0, 0, 0, 0, 599, 0, 0, 0, 0, 0, 2659, 0, 0, 0, 9425, 0, 0, 5002, 2392, 823, 2623, 4275,
+		9005, 0, 7642, 8205, 0, 5929, 0, 0, 0, 0, 1339, 5229, 0, 0, 0, 0, 0, 0, 0, 0, 1901, 4582, 7139, 0,
+		0, 0, 0, 0, 6230, 0, 0, 5305, 5260, 5351, 0, 0, 0, 0, 0, 0, 0, 4641, 0, 189, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1840, 840, 3218, 9500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 8336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 5475, 0, 0, 9897, 4614, 0, 8062, 0, 0, 0, 0, 0, 0, 0, 0, 3066, 8654, 0, 0, 0,
+		0, 9021, 0, 0, 0, 0, 7968, 0, 0, 2334, 0, 0, 0, 5938, 9169, 0, 4342, 8425, 5124, 6023, 0, 0, 0, 2110,
+		7333, 0, 0, 0, 0, 0, 0, 0, 0, 845, 5145, 0, 8932, 0, 0, 0, 411, 0, 0, 3124, 5931, 0, 0, 0,
+		0, 0, 0, 0, 0, 1719, 1113, 2763, 7166, 1056, 0, 0, 0, 0, 2892, 0, 0, 9524, 7260, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 8994, 0, 0, 0, 3529, 0, 0, 0, 0, 0, 9688, 0, 5704, 9019, 0, 0, 0, 0, 0, 4956,
+		4108, 135, 0, 444, 7328, 0, 9238, 0, 3646, 0, 0, 0, 0, 781, 0, 0, 0, 0, 0, 0, 1580, 5538, 0, 5233,
+		0, 0, 0, 0, 6447, 2652, 5994, 0, 1549, 73, 0, 0, 8410, 0, 0, 2185, 0, 0, 0, 5196, 4948, 3807, 0, 4987,
+		0, 0, 0, 7292, 0, 0, 6448, 0, 951, 4963, 5667, 3566, 7901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6411,
+		0, 0, 0, 0, 9585, 0, 0, 0, 0, 0, 739, 5499, 0, 0, 1118, 2107, 0, 0, 8905, 7758, 9182, 0, 0, 6916,
+		1297, 0, 3068, 0, 0, 0, 9613, 0, 0, 0, 9472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4818,
+		7974, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5054, 0, 0, 0, 0, 3411, 0, 0, 0, 0, 0, 0, 0, 373,
+		0, 0, 983, 2611, 0, 0, 0, 0, 0, 0, 3420, 3829, 0, 0, 55, 0, 0, 0, 0, 0, 0, 3600, 6228, 0,
+		0, 0, 0, 0, 1755, 8927, 0, 46, 0, 7794, 9464, 0, 0, 0, 0, 3861, 8983, 6825, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2825, 0, 8500, 0, 4031, 4001, 0, 0, 0, 0, 0, 6611,
+		831, 0, 0, 0, 0, 0, 4323, 8913, 0, 0, 8942, 0, 0, 0, 7129, 5377, 0, 0, 0, 0, 0, 0, 3846, 3074,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5354, 0, 0, 0, 0, 0, 1146, 0, 0, 0, 0, 0, 0, 0,
+		5874, 8967, 0, 807, 0, 0, 0, 2342, 4568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7919, 5188, 4412, 0, 3838,
+		1570, 0, 472, 0, 0, 0, 9744, 0, 0, 0, 0, 0, 3158, 2311, 4924, 5963, 7067, 0, 0, 8057, 8331, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8545, 0, 0, 0, 0, 0, 1921, 0, 0, 0, 0, 0, 0, 8515,
+		0, 0, 7837, 5983, 0, 9442, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1787, 0, 0, 0, 5098, 126, 7202, 0, 0,
+		0, 0, 0, 0, 8723, 0, 5986, 204, 4680, 518, 7446, 0, 0, 0, 0, 0, 0, 0, 5554, 1623, 0, 0, 0, 0,
+		0, 0, 0, 0, 3762, 0, 7562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5559, 0, 0, 0, 0, 6089, 0, 0,
+		0, 0, 0, 6910, 0, 0, 0, 0, 0, 2416, 3532, 0, 0, 9020, 0, 0, 0, 1286, 6060, 5709, 0, 2906, 0, 9439,
+		0, 8472, 9103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7379, 0, 0, 0, 0, 7001, 0, 0, 710, 0,
+		8679, 0, 0, 0, 0, 0, 0, 9088, 7714, 7098, 0, 3305, 0, 0, 0, 7120, 0, 2920, 7999, 9219, 0, 0, 0, 0,
+		0, 2421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1953, 0, 0, 1758, 0, 0, 7324, 722, 0, 0, 1036, 0, 7566,
+		9300, 0, 0, 0, 9326, 0, 0, 0, 6386, 7880, 0, 5399, 0, 0, 7295, 0, 1295, 0, 0, 5575, 7032, 0, 0, 0,
+		7603, 0, 0, 522, 0, 0, 0, 0, 2111, 0, 0, 0, 0, 0, 0, 0, 7992, 0, 0, 0, 7539, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1414, 6698, 0, 6547, 8242, 0, 9157, 5719, 3043, 0, 4381, 0, 0, 0, 8181, 1250, 0,
+		0, 0, 0, 0, 0, 1167, 6181, 4312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3862, 349, 6678, 0, 0, 223,
+		4971, 8323, 0, 0, 5242, 0, 1492, 0, 0, 0, 0, 8637, 677, 0, 2224, 0, 7401, 0, 5186, 0, 0, 1980, 2418, 0,
+		2628, 0, 0, 0, 0, 3697, 467, 8208, 7729, 0, 0, 0, 2197, 7360, 0, 2369, 0, 642, 0, 0, 0, 0, 0, 0,
+		3565, 641, 4767, 0, 9391, 0, 926, 0, 0, 4165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2113, 0, 7769, 0, 3294,
+		0, 0, 1854, 0, 0, 0, 0, 0, 1577, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3468, 0, 6278, 7655, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2432, 0, 0, 0, 2523, 0, 5489, 0, 631, 7426, 9728,
+		0, 0, 0, 0, 3586, 0, 0, 0, 0, 0, 0, 1273, 0, 4238, 2612, 7761, 8658, 0, 9123, 2218, 0, 0, 0, 0,
+		8395, 0, 0, 0, 0, 5883, 0, 9195, 9666, 6005, 0, 2751, 0, 0, 0, 0, 0, 2561, 0, 0, 0, 4352, 0, 6253,
+		0, 6359, 0, 0, 0, 0, 8453, 0, 6720, 5723, 2703, 0, 0, 0, 0, 0, 0, 0, 8139, 0, 0, 0, 4833, 0,
+		0, 4594, 0, 0, 3337, 9727, 0, 0, 0, 0, 0, 0, 0, 0, 7350, 0, 0, 6324, 2471, 0, 7874, 0, 0, 0,
+		4132, 0, 0, 0, 2661, 4416, 7070, 8865, 9418, 0, 24, 0, 0, 0, 0, 0, 0, 4609, 0, 0, 3395, 3723, 4713, 7299,
+		0, 0, 2877, 8629, 0, 0, 686, 117, 0, 0, 0, 9482, 1630, 3382, 0, 0, 0, 0, 0, 0, 0, 0, 1676, 0,
+		0, 712, 3770, 0, 0, 0, 0, 0, 0, 0, 4878, 8780, 0, 0, 0, 59, 0, 0, 0, 0, 1603, 3822, 7016, 3061,
+		2433, 3116, 2488, 6086, 0, 2992, 0, 0, 0, 0, 4597, 8852, 0, 0, 0, 0, 0, 0, 0, 0, 2396, 0, 0, 0,
+		9120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3507, 0, 0, 3228, 0, 0, 0, 0, 8683, 0, 0, 0,
+		1353, 0, 3149, 0, 0, 955, 0, 0, 0, 0, 0, 0, 0, 0, 7961, 0, 0, 0, 0, 1183, 2847, 0, 0, 2526,
+		0, 0, 0, 0, 0, 0, 9162, 0, 0, 0, 4832, 0, 0, 0, 0, 0, 9579, 0, 6636, 2460, 4252, 0, 0, 0,
+		0, 0, 0, 7515, 1654, 0, 0, 0, 0, 0, 3293, 0, 2232, 9013, 0, 0, 0, 0, 0, 0, 0, 5072, 0, 0,
+		0, 1481, 4320, 5106, 6754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2341,
+		0, 3366, 0, 0, 230, 0, 0, 0, 0, 0, 6620, 5427, 0, 0, 0, 625, 0, 0, 8764, 0, 3516, 0, 0, 0,
+		0, 0, 0, 2718, 3620, 6393, 7659, 0, 4300, 0, 0, 0, 4326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 918, 0, 0, 0, 9650, 7030, 0, 5359, 0, 0, 4683, 0, 0, 0, 1381,
+		0, 0, 9796, 6453, 0, 0, 0, 0, 0, 0, 2927, 0, 0, 0, 0, 0, 0, 1376, 0, 0, 0, 0, 0, 2990,
+		0, 7121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2749, 0, 9487, 0, 0, 0, 1122, 3728,
+		0, 0, 0, 8649, 0, 0, 0, 2207, 1937, 973, 2475, 0, 0, 0, 0, 0, 7541, 0, 0, 6816, 9631, 0, 0, 0,
+		0, 8376, 0, 0, 0, 0, 0, 3499, 0, 0, 4059, 4923, 0, 0, 0, 0, 0, 0, 0, 0, 5393, 0, 9239, 0,
+		0, 0, 5269, 0, 8639, 0, 0, 3430, 3343, 3354, 6048, 9353, 0, 0, 0, 0, 0, 0, 1042, 0, 0, 0, 0, 0,
+		0, 0, 0, 1558, 0, 0, 0, 0, 0, 0, 8598, 0, 0, 0, 0, 0, 0, 0, 0, 9036, 2776, 8582, 0, 0,
+		0, 0, 0, 0, 0, 0, 1709, 5656, 7167, 6647, 0, 0, 0, 0, 623, 0, 0, 3539, 0, 0, 6769, 4161, 0, 2175,
+		0, 5693, 0, 0, 0, 0, 0, 0, 6896, 3253, 0, 0, 0, 0, 9055, 0, 0, 3325, 0, 0, 0, 0, 119, 2183,
+		6369, 0, 0, 139, 9477, 159, 655, 1245, 5230, 5267, 629, 3042, 0, 0, 0, 0, 0, 0, 0, 7626, 7240, 0, 5837, 0,
+		5576, 0, 0, 0, 5446, 0, 0, 0, 0, 1896, 9548, 6734, 0, 0, 0, 0, 0, 0, 9312, 0, 4674, 0, 0, 690,
+		2937, 0, 0, 0, 0, 0, 0, 9107, 1092, 0, 0, 4659, 0, 0, 0, 0, 0, 0, 0, 434, 0, 0, 0, 0,
+		0, 0, 9707, 0, 7710, 2249, 3892, 7995, 0, 0, 0, 0, 1987, 0, 1579, 0, 0, 0, 0, 8465, 6569, 0, 1467, 0,
+		0, 0, 0, 0, 0, 3364, 0, 3164, 0, 0, 0, 0, 0, 0, 0, 2010, 0, 0, 2798, 0, 7323, 0, 0, 2855,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4329, 0, 3570, 0, 0, 0, 0, 0, 0, 0, 7309, 0, 0, 0, 0, 0, 0, 9969, 0, 0,
+		0, 0, 6320, 0, 0, 0, 0, 0, 0, 4600, 7353, 4937, 9242, 0, 0, 0, 480, 0, 619, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2870, 7775, 8401, 0, 0, 8511, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4513, 0, 0, 5005, 9678, 0, 0, 0, 0,
+		0, 0, 6730, 9283, 637, 0, 0, 0, 3744, 0, 0, 0, 0, 8705, 4273, 0, 0, 7771, 7645, 0, 6724, 0, 0, 0,
+		5505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1716, 1329, 0, 0, 0, 1671, 78, 1634, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4876, 0, 3889, 0, 7802, 0, 0, 0, 0, 0, 0, 2204, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 6677, 0, 0, 0, 0, 0, 5967, 3283, 0, 0, 0, 357, 3981, 0, 0, 2236, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1002, 3142, 0, 0, 0, 0, 4191, 0, 0, 0, 0, 1326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 7936, 4052, 0, 0, 8730, 0, 2586, 2672, 456, 0, 0, 8490, 0, 2567, 0, 4909, 0, 1127, 0, 0, 0,
+		1913, 0, 0, 1943, 0, 4442, 0, 0, 3490, 2293, 1110, 4579, 0, 930, 0, 0, 8997, 671, 2664, 5545, 5772, 3509, 3338, 6850,
+		0, 0, 0, 0, 3497, 0, 5801, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7218, 0, 0, 0, 8956, 942,
+		0, 8696, 0, 877, 0, 0, 164, 0, 0, 1178, 0, 0, 6952, 0, 0, 0, 0, 9056, 0, 9675, 0, 0, 1526, 0,
+		6982, 8263, 7288, 490, 3993, 4991, 0, 0, 0, 0, 0, 0, 0, 1544, 0, 0, 0, 0, 4117, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9159, 0, 0, 759, 0, 9514, 0, 0, 0, 0, 0, 598, 0, 0,
+		0, 0, 2599, 1910, 0, 0, 0, 0, 7126, 0, 9734, 0, 0, 0, 0, 0, 0, 1202, 7076, 0, 0, 0, 9050, 5569,
+		0, 0, 0, 0, 0, 3464, 0, 0, 0, 3864, 0, 2910, 1552, 0, 0, 0, 0, 0, 0, 2006, 0, 0, 0, 5263,
+		0, 2701, 1963, 2926, 8824, 9876, 0, 0, 0, 0, 0, 7135, 8830, 0, 0, 0, 0, 0, 459, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4340, 0, 0, 0, 0, 9081, 0, 0, 3433, 7224, 0, 0, 5129, 0, 0, 0, 0,
+		0, 0, 7838, 0, 0, 0, 0, 0, 0, 8635, 7971, 9869, 0, 0, 0, 5590, 0, 8659, 3907, 0, 1172, 0, 77, 4969,
+		5470, 0, 0, 0, 0, 0, 0, 0, 5184, 0, 0, 7081, 5733, 0, 0, 0, 0, 0, 4339, 9267, 2276, 0, 2300, 6581,
+		0, 0, 0, 0, 0, 0, 949, 0, 0, 0, 4348, 6788, 0, 0, 0, 494, 908, 645, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 5310, 9324, 0, 0, 0, 0, 0, 0, 0, 0, 4257, 0, 0, 0, 3037, 1494, 0,
+		0, 0, 0, 0, 0, 3785, 0, 0, 0, 4962, 0, 0, 2479, 9204, 0, 0, 0, 6516, 8850, 678, 7856, 0, 0, 0,
+		5525, 0, 0, 221, 0, 0, 5500, 2626, 0, 1338, 9257, 0, 0, 0, 0, 0, 0, 6800, 6006, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 9200, 9344, 0, 0, 0, 0, 0, 0, 0, 0, 3900, 0, 0, 0, 0, 0, 1830, 0, 0, 0,
+		0, 0, 1522, 2286, 0, 0, 0, 0, 9798, 716, 0, 0, 8841, 0, 0, 0, 0, 0, 0, 5143, 853, 6169, 0, 0,
+		6272, 0, 0, 2994, 0, 863, 0, 0, 0, 1431, 0, 479, 0, 0, 0, 0, 8874, 0, 0, 1806, 3361, 0, 0, 1093,
+		8450, 0, 0, 9286, 0, 0, 0, 0, 4542, 0, 0, 0, 0, 0, 0, 0, 2953, 1843, 0, 8998, 0, 0, 0, 8600,
+		9923, 6071, 0, 0, 0, 0, 0, 5763, 0, 0, 0, 0, 8174, 0, 9137, 0, 8, 8907, 0, 0, 0, 960, 2254, 1222,
+		8699, 7763, 0, 0, 0, 3270, 1863, 7834, 0, 130, 0, 7676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1611, 7591, 0,
+		0, 0, 5317, 0, 466, 7138, 0, 0, 8835, 0, 0, 0, 0, 0, 6331, 0, 6459, 7766, 3381, 0, 2812, 4789, 4113, 0,
+		0, 0, 0, 0, 3999, 0, 1065, 0, 6895, 0, 0, 0, 0, 0, 1054, 0, 0, 0, 0, 0, 0, 6984, 0, 0,
+		8610, 0, 4642, 6971, 6683, 9782, 0, 5996, 0, 0, 2415, 0, 0, 0, 404, 9655, 4123, 5392, 0, 2952, 6605, 0, 0, 0,
+		0, 0, 0, 0, 2309, 9302, 5205, 1359, 0, 0, 0, 7249, 0, 0, 7926, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 118, 6328, 0, 0, 0, 7702, 0, 6900, 0, 8728, 0, 0, 3835, 0, 0, 0, 0, 0, 0, 0, 2955, 0,
+		0, 0, 6408, 0, 0, 0, 9125, 0, 0, 0, 7393, 0, 0, 0, 0, 182, 7629, 0, 8467, 0, 0, 0, 0, 427,
+		6263, 6640, 0, 0, 0, 0, 0, 5867, 1613, 0, 6227, 0, 8285, 239, 7842, 4980, 1922, 0, 0, 0, 5644, 0, 3241, 0,
+		0, 0, 9429, 0, 9686, 0, 2805, 0, 0, 8081, 0, 9899, 408, 4153, 0, 0, 5658, 4290, 9007, 0, 0, 4328, 7460, 9046,
+		0, 0, 0, 0, 4084, 6845, 0, 0, 0, 0, 0, 9971, 0, 0, 0, 0, 5481, 3462, 7625, 0, 0, 8498, 0, 0,
+		0, 4183, 3978, 5078, 5368, 7061, 8126, 8933, 1439, 0, 0, 3472, 0, 0, 5097, 1104, 5847, 8590, 0, 0, 0, 0, 0, 0,
+		0, 6949, 0, 8098, 0, 0, 533, 7980, 2644, 0, 0, 0, 0, 0, 0, 0, 0, 6767, 0, 0, 0, 5006, 0, 0,
+		3998, 0, 0, 7176, 0, 0, 2152, 0, 0, 0, 0, 1336, 0, 0, 0, 0, 0, 0, 3378, 0, 0, 5275, 0, 0,
+		0, 3870, 6057, 9460, 9724, 9035, 9867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9590, 2468, 0, 0, 5296, 80, 0,
+		1969, 4688, 0, 0, 0, 0, 0, 0, 0, 3782, 0, 0, 0, 6870, 0, 0, 0, 0, 0, 0, 0, 0, 8025, 858,
+		3362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5855, 0, 0, 0, 0, 0, 7045, 5988, 0, 0,
+		0, 0, 1074, 2452, 7986, 0, 0, 0, 305, 5431, 0, 0, 6009, 0, 3039, 3483, 0, 0, 0, 8363, 5210, 0, 7437, 596,
+		5070, 0, 0, 0, 0, 861, 936, 3000, 5164, 0, 5714, 0, 2446, 0, 0, 2521, 0, 0, 0, 10, 2757, 0, 0, 4764,
+		5566, 7178, 5468, 2096, 4794, 0, 0, 2353, 6470, 9562, 0, 0, 0, 0, 0, 0, 2951, 8988, 0, 0, 0, 7643, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2627, 6748, 0, 0, 0, 1289, 0, 0, 5992, 0, 0, 0, 0, 0, 0, 3436,
+		0, 0, 0, 0, 4051, 5661, 0, 0, 6741, 7649, 0, 0, 0, 0, 0, 0, 0, 413, 948, 1073, 8068, 0, 4371, 8075,
+		4471, 0, 0, 957, 0, 485, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		5752, 5965, 7371, 7641, 0, 0, 7841, 0, 0, 7255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7511, 0, 0,
+		0, 0, 1396, 0, 0, 0, 0, 1106, 0, 5286, 3075, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2062, 0, 1642, 0, 0, 1182, 4122, 0, 0, 0, 0, 0, 0, 0, 3351, 0,
+		6811, 0, 0, 0, 0, 8108, 5077, 1197, 0, 0, 0, 0, 6827, 0, 0, 0, 323, 2648, 0, 0, 0, 5314, 0, 0,
+		0, 9453, 1465, 9140, 0, 0, 3608, 0, 0, 9891, 0, 1450, 1870, 9819, 8911, 0, 0, 0, 5288, 0, 0, 0, 0, 0,
+		4350, 0, 0, 95, 0, 1094, 0, 0, 0, 0, 4604, 9224, 0, 0, 0, 0, 4363, 7146, 7879, 0, 0, 899, 0, 2163,
+		0, 0, 0, 0, 5383, 8346, 0, 0, 0, 2014, 0, 0, 0, 9883, 0, 0, 0, 6197, 0, 0, 0, 0, 0, 2404,
+		8617, 0, 0, 0, 0, 1660, 0, 0, 0, 0, 0, 0, 0, 3917, 3477, 7897, 3878, 7906, 8883, 9668, 0, 0, 6223, 0,
+		0, 0, 1316, 4763, 9343, 0, 0, 0, 0, 0, 2624, 6022, 754, 4895, 1090, 8370, 0, 0, 0, 0, 0, 2972, 0, 0,
+		0, 0, 0, 0, 0, 0, 7313, 0, 2047, 0, 0, 0, 0, 0, 4263, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 8357, 2130, 0, 0, 0, 0, 3512, 0, 0, 2371, 0, 0, 0, 8871, 0, 0, 3787,
+		1496, 0, 953, 0, 0, 0, 0, 0, 0, 5993, 0, 0, 0, 0, 2710, 0, 0, 3914, 7128, 0, 0, 0, 0, 0,
+		0, 6266, 0, 1573, 7678, 0, 1308, 0, 0, 0, 2791, 3722, 6123, 0, 8462, 9624, 8790, 0, 0, 1131, 4770, 9260, 0, 0,
+		5150, 0, 1142, 0, 5282, 0, 5156, 5670, 4064, 6016, 0, 0, 0, 5746, 0, 5810, 6171, 9197, 0, 0, 0, 0, 105, 2934,
+		0, 0, 0, 0, 6095, 0, 0, 0, 0, 0, 131, 2675, 8094, 0, 0, 8504, 0, 2456, 0, 0, 0, 0, 0, 2861,
+		0, 0, 8127, 0, 0, 0, 0, 5657, 0, 0, 0, 0, 7921, 0, 6160, 931, 0, 0, 0, 0, 6319, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 7765, 0, 3553, 100, 6878, 0, 4823, 0, 3780, 1735, 0, 8581, 0, 0, 0, 0, 0, 0,
+		4591, 9264, 7391, 0, 0, 0, 0, 0, 0, 1253, 6501, 0, 9445, 0, 4057, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 8247, 0, 8906, 0, 4658, 8045, 2148, 9397, 0, 0, 0, 6782, 6996, 7172, 9622, 0,
+		0, 4307, 7190, 0, 0, 0, 0, 0, 2503, 0, 8050, 0, 0, 5795, 0, 0, 3866, 0, 0, 6155, 0, 0, 0, 0,
+		0, 0, 4197, 1770, 7923, 5478, 0, 0, 0, 2430, 0, 0, 9410, 0, 0, 0, 0, 2947, 0, 0, 0, 0, 2272, 0,
+		0, 0, 1429, 0, 0, 0, 0, 0, 0, 0, 1029, 0, 3742, 1934, 3916, 0, 0, 0, 2216, 0, 0, 0, 647, 1226,
+		4384, 0, 0, 7315, 7623, 0, 0, 0, 0, 0, 1096, 6430, 3154, 0, 9674, 1032, 0, 0, 0, 0, 0, 0, 0, 0,
+		4546, 6384, 0, 0, 0, 3849, 0, 0, 0, 0, 0, 9359, 0, 0, 0, 4847, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4915, 0, 0, 0, 4292, 0, 0, 5856, 0, 0,
+		0, 0, 0, 5428, 0, 0, 0, 8389, 0, 0, 0, 5459, 0, 0, 6165, 0, 0, 0, 0, 1468, 0, 2598, 0, 0,
+		0, 0, 0, 0, 1879, 0, 0, 0, 0, 1265, 843, 0, 0, 0, 0, 6812, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4896, 0, 0, 0, 0, 0, 0, 0, 0, 9250, 0, 9084, 0, 0, 0, 0, 4277, 0, 0, 0, 0, 0, 0,
+		1658, 0, 4544, 0, 0, 2091, 0, 0, 0, 4611, 0, 0, 0, 5001, 8781, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+		0, 0, 137, 9322, 0, 0, 0, 0, 0, 0, 0, 0, 6464, 0, 0, 0, 3880, 9936, 0, 5921, 6934, 0, 395, 0,
+		2986, 0, 0, 0, 0, 0, 0, 0, 1433, 0, 0, 658, 950, 0, 0, 0, 0, 317, 3122, 0, 0, 7300, 0, 3476,
+		0, 0, 0, 0, 0, 0, 3487, 6653, 0, 9712, 0, 868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+		0, 111, 8815, 0, 0, 0, 0, 0, 3672, 0, 2741, 4325, 0, 123, 0, 0, 3936, 656, 1370, 585, 7296, 0, 3798, 0,
+		0, 3906, 0, 0, 9589, 0, 2454, 0, 0, 4942, 0, 0, 0, 0, 9057, 0, 0, 0, 0, 0, 0, 0, 4456, 0,
+		0, 0, 9151, 3432, 0, 0, 0, 0, 4231, 9383, 4759, 3557, 8382, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		683, 0, 0, 0, 7547, 0, 0, 7563, 4930, 0, 9577, 0, 0, 0, 0, 0, 0, 0, 7609, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 8144, 0, 0, 0, 6145, 0, 0, 0, 0, 0, 0, 0, 2428, 1198, 0, 0, 0, 0, 0,
+		0, 0, 7434, 0, 0, 4072, 8216, 0, 425, 0, 0, 0, 0, 1212, 0, 0, 0, 0, 0, 8292, 0, 279, 0, 0,
+		433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7221, 0, 9775, 0, 0, 0, 0, 0, 0, 0, 0, 8599, 6251, 7493,
+		8017, 0, 0, 0, 5970, 0, 9839, 0, 0, 5271, 0, 6316, 0, 0, 0, 8115, 0, 0, 0, 0, 4580, 0, 335, 8710,
+		3317, 4407, 9002, 0, 9279, 0, 0, 0, 0, 0, 606, 2340, 0, 580, 0, 0, 0, 6723, 0, 6817, 0, 0, 3616, 0,
+		0, 0, 0, 4173, 0, 4085, 0, 2504, 0, 0, 0, 0, 0, 0, 6839, 0, 0, 0, 0, 0, 0, 9484, 0, 0,
+		5031, 3750, 0, 895, 0, 0, 1005, 0, 8510, 0, 0, 746, 6738, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7804, 0,
+		7933, 8010, 8589, 0, 0, 0, 0, 1531, 2427, 0, 3588, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8421, 9608, 0, 0,
+		0, 0, 0, 2691, 0, 0, 0, 0, 0, 0, 1744, 0, 0, 9074, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4020, 4922, 0, 0, 0, 1545, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 963, 8241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 8528, 0, 2305, 6233, 9592, 3976, 0, 2907, 5759, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1737, 0, 0, 6478, 0,
+		0, 7872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4419, 0, 0, 6200, 0, 0, 0, 0, 0, 0, 0, 0, 3520,
+		8889, 0, 0, 0, 2061, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2755, 3943, 5822,
+		5977, 6229, 8862, 595, 0, 0, 0, 8803, 0, 0, 0, 0, 813, 0, 0, 2876, 8513, 0, 0, 0, 7261, 8218, 0, 0,
+		0, 0, 0, 0, 0, 9432, 0, 0, 0, 0, 0, 0, 0, 0, 2932, 0, 3950, 0, 8648, 0, 3092, 0, 0, 0,
+		6241, 0, 0, 0, 0, 0, 0, 9726, 0, 0, 0, 0, 8403, 9910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3893,
+		0, 0, 0, 0, 263, 1601, 8675, 0, 0, 0, 0, 0, 4602, 8873, 0, 8783, 0, 0, 0, 0, 9249, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4150, 0, 0, 0, 0, 0, 2036, 1557, 6102, 0, 0, 0, 2162, 0, 0, 0, 0,
+		0, 2985, 0, 8104, 0, 0, 0, 4346, 3262, 6472, 7100, 3903, 0, 0, 0, 0, 7607, 0, 51, 0, 0, 0, 0, 0,
+		0, 9656, 0, 0, 7767, 0, 0, 8914, 9591, 0, 0, 0, 0, 0, 1915, 0, 0, 0, 0, 0, 0, 0, 4260, 0,
+		3544, 1683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5452, 8169, 0, 0, 4645, 0, 3191, 0, 0, 0, 5274,
+		0, 329, 4787, 730, 7613, 0, 0, 3028, 6885, 9277, 1949, 5923, 0, 0, 0, 0, 0, 1201, 0, 0, 0, 6081, 0, 0,
+		0, 0, 0, 8597, 0, 0, 0, 0, 1240, 0, 0, 0, 0, 0, 0, 0, 0, 4212, 0, 0, 0, 0, 0, 0,
+		2924, 630, 0, 9513, 2979, 2615, 0, 0, 9363, 987, 0, 0, 570, 2448, 3111, 0, 0, 0, 0, 2533, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 8477, 0, 0, 1317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 3455, 0, 2933, 8470, 0, 8224, 0, 0, 0, 0, 6168, 7005, 0, 9502, 0, 0, 0, 0,
+		0, 7101, 2978, 0, 3578, 0, 0, 0, 3055, 416, 0, 0, 0, 3310, 4040, 0, 4867, 0, 0, 0, 0, 0, 0, 0,
+		7915, 5932, 0, 0, 0, 3245, 9912, 0, 0, 0, 0, 7431, 0, 0, 0, 0, 9527, 0, 0, 7280, 0, 0, 2226, 17,
+		9029, 0, 1784, 0, 0, 0, 0, 9691, 0, 6045, 0, 3731, 0, 0, 0, 0, 0, 0, 1446, 0, 1291, 0, 0, 0,
+		0, 0, 0, 0, 9532, 0, 0, 5050, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6796, 0, 0, 0, 0, 2810, 6042,
+		4139, 4975, 8478, 0, 0, 0, 5633, 9441, 0, 8381, 0, 694, 0, 0, 5813, 0, 0, 860, 7486, 0, 0, 8910, 5771, 0,
+		0, 0, 0, 2323, 3108, 0, 0, 0, 0, 0, 0, 0, 0, 7452, 0, 0, 0, 0, 9241, 145, 0, 0, 0, 0,
+		0, 568, 1972, 4460, 4727, 1194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2414, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 452, 6099, 6618, 8384, 0, 0, 0, 0, 0, 464, 0, 3542, 0, 8308, 0, 833, 0, 0,
+		0, 1783, 309, 0, 0, 2622, 0, 0, 0, 4133, 9402, 0, 0, 0, 0, 0, 7494, 0, 9664, 0, 0, 2756, 3806, 0,
+		0, 0, 4509, 0, 0, 0, 0, 0, 0, 0, 2528, 0, 0, 0, 0, 4848, 5291, 0, 7770, 0, 5609, 4978, 0, 0,
+		0, 0, 0, 0, 0, 0, 9495, 0, 0, 0, 0, 0, 9062, 0, 0, 0, 0, 0, 0, 0, 3491, 0, 0, 0,
+		0, 1697, 4458, 0, 0, 6204, 0, 0, 0, 8254, 0, 0, 2954, 0, 0, 0, 0, 0, 0, 1748, 0, 1269, 4343, 4751,
+		6951, 0, 0, 0, 0, 0, 218, 6273, 7628, 0, 0, 0, 0, 0, 3215, 0, 0, 0, 0, 195, 4446, 6823, 9090, 0,
+		0, 6694, 0, 5515, 295, 1895, 0, 0, 7581, 0, 0, 1500, 5629, 0, 0, 0, 0, 0, 4812, 8608, 0, 0, 0, 8690,
+		0, 0, 0, 4951, 0, 0, 0, 0, 0, 0, 0, 6088, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1939,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 886, 0, 0, 0, 2445, 1556, 0, 7816, 8165, 0, 0, 0, 0, 0, 1013,
+		8584, 0, 0, 4264, 0, 0, 0, 0, 0, 0, 0, 6362, 0, 0, 0, 0, 0, 0, 8574, 0, 4857, 0, 0, 0,
+		0, 0, 0, 4781, 0, 0, 0, 0, 7739, 0, 4111, 0, 0, 9827, 7762, 0, 0, 0, 6407, 0, 0, 0, 0, 0,
+		3983, 0, 0, 0, 0, 0, 0, 6519, 0, 0, 0, 4449, 0, 0, 7884, 0, 0, 0, 6067, 0, 0, 2108, 0, 0,
+		0, 0, 0, 0, 0, 2146, 2298, 5420, 0, 9768, 0, 0, 0, 0, 0, 0, 0, 0, 2289, 3160, 3399, 6776, 0, 0,
+		3791, 0, 0, 0, 9494, 0, 3736, 0, 0, 0, 3400, 0, 0, 0, 747, 5492, 0, 0, 0, 2208, 8899, 0, 261, 8843,
+		0, 0, 7684, 0, 0, 0, 0, 9175, 0, 0, 0, 0, 0, 0, 803, 0, 0, 0, 0, 0, 0, 0, 0, 2390,
+		5608, 4524, 0, 0, 0, 0, 0, 0, 3169, 9310, 0, 0, 0, 3701, 701, 3527, 9462, 0, 0, 0, 8214, 0, 0, 0,
+		0, 1176, 0, 1501, 5768, 8073, 8282, 0, 2596, 0, 0, 0, 0, 5270, 9654, 0, 6142, 3659, 0, 3644, 3918, 0, 0, 0,
+		0, 0, 0, 115, 588, 5570, 8137, 8221, 4921, 0, 0, 0, 0, 6888, 9256, 0, 0, 0, 0, 5144, 1885, 0, 0, 0,
+		0, 0, 0, 0, 2292, 0, 0, 2874, 0, 0, 0, 0, 1767, 2461, 0, 0, 2726, 0, 0, 9213, 0, 0, 0, 2358,
+		0, 0, 0, 0, 0, 0, 0, 0, 818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 405, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2759, 8152, 0, 0, 0, 0, 0, 0, 0, 6764, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 7996, 0, 0, 0, 0, 9705, 0, 0, 2009, 8687, 0, 0, 249, 2840, 9284, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4719, 8063, 2936, 0, 0, 4154, 0, 0, 9193, 9820, 0, 0, 1593, 0, 0, 0, 0, 3057,
+		7402, 0, 0, 0, 6463, 9038, 3560, 0, 0, 0, 0, 0, 6988, 0, 0, 0, 0, 4700, 0, 0, 5677, 0, 0, 0,
+		3869, 0, 0, 150, 0, 0, 0, 288, 0, 737, 0, 0, 0, 0, 5209, 0, 0, 0, 0, 0, 6978, 0, 0, 7179,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9006, 0, 1448, 0, 0, 680, 4365, 6465, 0, 0, 3953, 0, 3955, 6027,
+		6225, 7468, 0, 0, 0, 0, 4776, 0, 0, 938, 0, 3394, 0, 4897, 0, 982, 0, 5402, 0, 0, 0, 0, 0, 0,
+		9325, 0, 1725, 0, 0, 2271, 0, 0, 0, 0, 0, 9949, 0, 0, 0, 0, 0, 0, 4034, 0, 0, 0, 9337, 0,
+		5770, 0, 0, 0, 0, 0, 7711, 0, 0, 7232, 0, 0, 0, 0, 6967, 0, 2101, 0, 0, 303, 1474, 9652, 0, 0,
+		0, 0, 3708, 6275, 0, 0, 0, 0, 1674, 3288, 4389, 4835, 0, 0, 2125, 0, 4475, 0, 0, 2332, 0, 7692, 8048, 9099,
+		0, 0, 0, 0, 2695, 9184, 1299, 5912, 9599, 0, 0, 3350, 0, 0, 0, 0, 0, 0, 7854, 0, 0, 0, 0, 9114,
+		0, 0, 0, 0, 0, 0, 0, 0, 1736, 4998, 0, 298, 0, 381, 0, 0, 9549, 0, 0, 0, 0, 4801, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2650, 8751, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 9434, 0, 0, 0, 0, 0, 3897, 0, 3503, 0, 0, 0, 2760, 0, 0, 707, 0, 0, 0, 0, 0, 0,
+		7298, 0, 0, 5497, 3417, 3538, 5788, 0, 6457, 9354, 0, 1398, 611, 1, 2177, 0, 0, 0, 0, 0, 3651, 7095, 0, 0,
+		0, 3712, 0, 0, 0, 4126, 7063, 589, 23, 7506, 0, 0, 0, 0, 9064, 0, 0, 0, 2921, 0, 0, 0, 0, 0,
+		2417, 0, 0, 1075, 0, 0, 0, 0, 0, 0, 0, 6355, 0, 0, 1918, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1409, 2372, 3508, 998, 0, 0, 0, 0, 0, 0, 7708, 0, 0, 9190, 0, 0, 0, 9395, 0, 0, 0,
+		0, 4601, 0, 0, 0, 0, 8686, 6239, 0, 8909, 0, 0, 0, 8749, 0, 0, 0, 0, 4121, 4469, 2851, 7545, 5750, 0,
+		0, 2480, 1373, 2412, 9228, 0, 0, 0, 0, 7931, 9491, 0, 0, 0, 1424, 0, 0, 0, 0, 0, 0, 3375, 9538, 0,
+		0, 2165, 0, 0, 0, 0, 0, 0, 8417, 8269, 0, 0, 0, 0, 0, 0, 0, 0, 5272, 0, 0, 7593, 0, 0,
+		0, 9792, 0, 0, 0, 0, 0, 0, 0, 3551, 0, 0, 0, 0, 0, 0, 7226, 0, 0, 0, 1604, 5756, 0, 0,
+		475, 8092, 0, 0, 0, 0, 0, 0, 0, 0, 6592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4495, 0, 0, 0,
+		3585, 0, 2442, 6381, 0, 0, 0, 0, 0, 977, 0, 0, 0, 0, 0, 1452, 0, 4202, 4366, 0, 0, 0, 0, 3572,
+		6500, 0, 1839, 0, 1006, 0, 4910, 0, 0, 0, 0, 0, 0, 2544, 0, 0, 0, 0, 0, 0, 0, 0, 5592, 0,
+		0, 0, 3398, 0, 0, 0, 2794, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4999, 6243, 0, 0, 0, 4405, 0, 2509,
+		0, 0, 481, 0, 0, 4120, 0, 3264, 7799, 0, 0, 2362, 2789, 582, 1284, 3479, 0, 5025, 6527, 6803, 9586, 9091, 291, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1346, 0, 0, 0, 2143, 7846, 2325, 0, 6981, 0, 0, 0, 0, 0, 8516, 0,
+		0, 0, 0, 4394, 6726, 0, 0, 0, 0, 0, 0, 7059, 0, 5304, 0, 266, 7556, 0, 0, 0, 7831, 6403, 0, 4550,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1853, 7768, 0, 6440, 0, 4322, 0, 0, 6250, 6244, 1428, 0, 0, 0, 0,
+		0, 7680, 8680, 0, 0, 0, 4044, 9451, 0, 6151, 0, 0, 2766, 1756, 0, 0, 0, 2477, 3758, 0, 0, 0, 19, 1752,
+		0, 0, 0, 0, 0, 6300, 0, 0, 7044, 1472, 0, 0, 8689, 3275, 0, 0, 0, 0, 4534, 0, 0, 6224, 0, 0,
+		0, 0, 0, 0, 2506, 0, 0, 5797, 0, 5506, 0, 0, 0, 0, 0, 616, 0, 0, 0, 0, 5457, 0, 8375, 2338,
+		6492, 3633, 0, 0, 209, 0, 0, 0, 0, 11, 586, 0, 0, 8987, 0, 0, 2043, 2147, 8973, 0, 0, 0, 0, 0,
+		0, 1067, 0, 9275, 5809, 9637, 7461, 0, 2391, 0, 0, 0, 0, 0, 3800, 0, 0, 3090, 3421, 0, 0, 0, 3902, 633,
+		0, 9394, 0, 0, 0, 7325, 7433, 0, 2234, 5158, 0, 9240, 0, 0, 1372, 0, 9339, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 2491, 3990, 6473, 0, 5378, 2308, 0, 8106, 0, 3211, 0, 0, 0, 0, 0, 0, 0, 7896, 0, 0, 0, 0,
+		0, 0, 1490, 0, 0, 0, 4356, 0, 0, 0, 0, 2989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1825, 2457,
+		0, 0, 6390, 7069, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 256, 7535, 0, 0, 0, 0, 2343, 0, 0, 0, 8195, 0, 0, 3257, 2764, 3810, 3379, 0, 0, 0, 1631, 0, 0,
+		0, 0, 0, 2222, 0, 0, 8432, 0, 0, 0, 0, 0, 0, 312, 8795, 0, 0, 2589, 0, 0, 0, 7622, 0, 0,
+		0, 0, 0, 3579, 8586, 1565, 0, 0, 0, 0, 0, 0, 0, 3256, 0, 0, 0, 3621, 0, 4391, 0, 0, 1418, 6025,
+		8030, 0, 0, 0, 0, 0, 0, 0, 0, 3007, 4523, 0, 7900, 6002, 9366, 0, 0, 0, 0, 3928, 5218, 0, 3574, 5549,
+		0, 5622, 8164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6536, 0, 0, 0, 8373, 6965, 0, 0, 0, 8895,
+		0, 0, 5852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8272, 0, 8682, 0, 0,
+		0, 0, 0, 0, 0, 7789, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5673, 0, 0, 0, 0, 0, 0,
+		4049, 6884, 0, 0, 2312, 7964, 0, 0, 0, 0, 0, 7675, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0,
+		0, 3370, 0, 0, 9336, 9964, 0, 0, 0, 3004, 0, 0, 7797, 0, 0, 0, 2771, 7085, 7617, 0, 0, 0, 0, 1562,
+		0, 0, 0, 0, 0, 4920, 0, 0, 1647, 0, 0, 0, 7634, 0, 0, 0, 0, 9480, 0, 0, 0, 0, 9225, 798,
+		0, 0, 8100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8757, 0, 0, 0, 0, 0, 0, 0, 8996, 0,
+		9489, 0, 6873, 0, 0, 2883, 1495, 7990, 0, 0, 5781, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7457, 0,
+		0, 0, 0, 0, 8656, 0, 0, 0, 6368, 0, 3259, 7385, 0, 4960, 8674, 7269, 0, 4707, 0, 0, 0, 0, 2554, 1355,
+		0, 0, 0, 0, 0, 0, 0, 6150, 0, 0, 0, 0, 0, 9780, 0, 0, 0, 0, 0, 9288, 0, 0, 6405, 0,
+		0, 7665, 9919, 0, 0, 0, 0, 0, 5699, 2401, 0, 0, 0, 0, 0, 0, 1200, 0, 0, 0, 0, 0, 0, 6946,
+		0, 1171, 0, 0, 9787, 0, 0, 0, 0, 0, 0, 0, 0, 3377, 0, 0, 0, 0, 0, 4036, 0, 0, 0, 7832,
+		0, 0, 8726, 8488, 0, 0, 0, 0, 8074, 0, 0, 0, 520, 0, 2467, 4047, 0, 0, 4905, 0, 4623, 0, 0, 0,
+		8605, 5532, 0, 0, 0, 0, 0, 6619, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 9853, 5724, 0, 0, 0, 0, 8399, 8509, 4408, 1633, 3260, 0, 0, 3114, 0, 0, 0, 4708, 3213, 0, 5937, 0,
+		0, 0, 0, 4060, 0, 6326, 8320, 0, 0, 1606, 4557, 0, 9719, 0, 0, 0, 0, 8630, 0, 0, 0, 0, 0, 0,
+		5513, 2273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2505, 0, 3705, 6899, 3593, 0, 0, 8935, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 976, 1088, 1732, 6148, 0, 1975,
+		0, 8650, 0, 0, 2568, 5632, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6419, 0, 0, 0, 0, 0, 0, 8123, 0,
+		0, 1384, 6164, 0, 0, 2813, 0, 0, 0, 0, 0, 2053, 0, 0, 0, 0, 0, 0, 0, 2424, 3063, 0, 0, 0,
+		0, 0, 7107, 0, 0, 0, 7321, 965, 9153, 9843, 0, 29, 2283, 3359, 4784, 6641, 2002, 0, 0, 0, 0, 0, 0, 7112,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2782, 2860, 4618, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6832, 0, 0, 0, 0, 0, 171,
+		7196, 0, 0, 0, 7472, 0, 0, 0, 0, 1427, 0, 0, 0, 0, 9424, 0, 1859, 0, 2265, 0, 0, 0, 0, 0,
+		0, 9783, 0, 0, 1750, 6846, 8222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 9186, 0, 0, 0, 0, 0, 894, 0, 0, 0, 0, 0, 0, 5777, 0, 0, 38, 0, 0, 0, 5096, 8125,
+		8390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 175, 0, 0, 0, 0, 0, 0, 4430, 0, 9127, 0, 2035, 0, 5215,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 5332, 0, 0, 0, 1460, 9609, 4395, 4280, 4992, 0, 0, 0, 0, 0, 0,
+		0, 3265, 0, 0, 0, 2800, 0, 0, 0, 0, 0, 5705, 0, 6872, 0, 2852, 0, 3911, 4709, 0, 1137, 0, 0, 0,
+		0, 0, 0, 0, 7114, 0, 0, 0, 0, 2872, 8720, 0, 4746, 9849, 0, 0, 3972, 2602, 0, 0, 0, 0, 6682, 8972,
+		0, 0, 0, 5460, 7983, 1205, 0, 0, 0, 3183, 0, 0, 0, 6806, 5597, 0, 0, 7481, 0, 0, 0, 1196, 1881, 8367,
+		2998, 0, 1964, 0, 0, 663, 6753, 2781, 6941, 7550, 0, 0, 0, 0, 0, 7942, 0, 6752, 2174, 7671, 8483, 0, 0, 0,
+		0, 9243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7554, 8725, 1765, 1369, 0, 0, 0, 9355, 9517, 0, 0,
+		0, 0, 0, 5281, 8054, 0, 0, 0, 0, 0, 0, 0, 8065, 0, 0, 3168, 3185, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 5618, 0, 2296, 0, 0, 0, 6432, 0, 0, 0, 0, 8039, 0, 0, 64, 9467, 939, 3583, 0, 0, 5662, 3641,
+		9508, 0, 6793, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7021, 0, 0, 0, 6844, 0, 0, 0, 7289, 0, 0, 0,
+		867, 0, 0, 0, 8809, 1789, 0, 9496, 0, 2189, 0, 0, 0, 0, 0, 0, 8343, 0, 0, 0, 7117, 9044, 0, 0,
+		0, 0, 0, 0, 7987, 4415, 0, 0, 0, 0, 0, 0, 5780, 0, 0, 2512, 4427, 0, 8466, 0, 2638, 0, 0, 8814,
+		0, 0, 0, 2474, 0, 9452, 0, 9556, 0, 7177, 0, 7082, 316, 0, 0, 0, 7213, 8615, 0, 4735, 0, 0, 0, 5338,
+		9634, 0, 0, 0, 0, 0, 9854, 0, 7256, 0, 0, 0, 8056, 0, 0, 3087, 3101, 0, 6426, 5887, 6559, 0, 0, 2817,
+		4882, 5530, 0, 0, 0, 0, 1668, 1157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5430, 3054, 7389,
+		4769, 5987, 8032, 4631, 0, 0, 0, 0, 8235, 8848, 0, 0, 0, 9211, 0, 0, 0, 0, 0, 8868, 4721, 0, 0, 0,
+		6774, 7338, 0, 9237, 0, 0, 0, 0, 0, 6855, 9621, 0, 0, 2651, 0, 0, 0, 0, 0, 0, 0, 3523, 8246, 9291,
+		0, 0, 3118, 0, 0, 0, 0, 0, 0, 7551, 0, 6509, 5630, 0, 0, 0, 0, 0, 5792, 0, 0, 2856, 1842, 0,
+		0, 0, 8878, 1349, 0, 0, 0, 3404, 4272, 0, 0, 0, 0, 0, 9393, 0, 1234, 0, 9313, 608, 0, 0, 1180, 0,
+		0, 0, 8554, 0, 0, 0, 0, 0, 4076, 0, 0, 0, 8049, 0, 0, 0, 3282, 0, 0, 4286, 0, 4062, 0, 0,
+		0, 0, 7606, 2536, 9115, 0, 3751, 8299, 0, 0, 0, 0, 0, 0, 2515, 6276, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7668, 9361,
+		0, 0, 0, 0, 1665, 0, 0, 8929, 0, 0, 0, 2660, 0, 0, 0, 0, 8742, 0, 0, 842, 7825, 7898, 0, 0,
+		0, 4733, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7861, 0, 2114, 0,
+		0, 0, 0, 1270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5580, 0, 0, 0, 0, 0, 0, 0, 2304, 8934,
+		9824, 0, 0, 0, 7225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6867, 0, 0, 0, 0, 5596, 0, 0, 5454, 0, 3754, 4628, 6398, 0, 4914, 0, 0, 0, 0, 0, 714, 0, 0, 353,
+		0, 0, 0, 0, 1648, 0, 0, 8341, 1727, 763, 6562, 7386, 2049, 0, 0, 7973, 0, 0, 417, 0, 8442, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 9682, 0, 0, 0, 4353, 6327, 0, 0, 9332, 3912, 0, 0, 0, 3431, 0, 0, 0, 5679,
+		7231, 0, 1209, 0, 0, 0, 0, 0, 0, 0, 0, 3258, 0, 0, 0, 0, 0, 3033, 0, 0, 0, 0, 0, 0,
+		6913, 1976, 0, 0, 0, 1809, 4496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1771,
+		0, 0, 0, 0, 0, 0, 0, 3034, 8567, 0, 0, 0, 7989, 8335, 0, 9943, 7596, 0, 4668, 0, 0, 8854, 0, 0,
+		9052, 0, 3070, 0, 0, 6050, 1334, 9043, 9236, 0, 0, 3407, 0, 0, 0, 0, 9372, 0, 0, 0, 7355, 9905, 3239, 3329,
+		4689, 0, 0, 0, 7924, 0, 0, 0, 0, 0, 3839, 0, 0, 0, 0, 0, 0, 6436, 0, 0, 0, 1323, 5512, 5065,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7772, 0, 0, 0, 0, 0, 0, 0, 640, 0, 2796, 6162, 0,
+		0, 0, 0, 0, 0, 7573, 0, 7438, 1048, 3456, 1354, 6706, 8225, 0, 887, 0, 0, 0, 2498, 0, 0, 5785, 6304, 0,
+		0, 0, 9638, 8143, 210, 9526, 0, 0, 0, 0, 0, 4256, 0, 9627, 0, 0, 9921, 6277, 7377, 6454, 5598, 9926, 590, 0,
+		2281, 0, 0, 0, 9771, 0, 0, 0, 0, 0, 9330, 0, 0, 7698, 1729, 9927, 594, 3123, 8305, 0, 0, 0, 4295, 0,
+		0, 0, 3002, 0, 0, 0, 0, 1516, 6630, 0, 0, 0, 0, 6891, 0, 0, 0, 5690, 1653, 5465, 0, 0, 6075, 0,
+		0, 0, 0, 0, 0, 0, 9873, 0, 0, 0, 0, 8178, 47, 8393, 8768, 6977, 0, 0, 0, 825, 0, 0, 0, 0,
+		3863, 0, 0, 0, 0, 0, 0, 2635, 0, 5528, 0, 6392, 0, 1782, 3358, 5404, 2346, 0, 0, 0, 0, 0, 8652, 0,
+		0, 0, 0, 0, 0, 0, 9071, 0, 0, 0, 1684, 0, 0, 0, 0, 0, 4672, 0, 0, 0, 0, 9342, 0, 584,
+		0, 6054, 0, 0, 4243, 0, 0, 0, 7664, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5467, 7159, 0, 8473,
+		4042, 0, 0, 0, 0, 0, 0, 5910, 0, 0, 0, 4634, 0, 4755, 0, 0, 4276, 6103, 1237, 0, 0, 0, 0, 0,
+		0, 0, 7161, 3951, 5087, 8079, 0, 9101, 0, 0, 0, 4228, 5868, 5013, 0, 3598, 0, 0, 6535, 3230, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 3635, 0, 5610, 0, 0, 5253, 5866, 4783, 0, 4135, 0, 0, 0, 0, 7830, 0, 0, 0, 0,
+		1857, 5299, 6437, 0, 0, 0, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7569, 0, 1411, 0, 0,
+		9920, 0, 0, 4021, 0, 3506, 0, 0, 0, 0, 0, 1403, 9455, 0, 0, 0, 0, 0, 0, 0, 7717, 0, 0, 0,
+		0, 0, 0, 0, 0, 6857, 0, 0, 8875, 9540, 0, 0, 3410, 7822, 0, 0, 7891, 0, 2153, 0, 0, 9422, 0, 0,
+		0, 0, 0, 1543, 0, 4900, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 207, 0, 7691, 0, 8789, 0,
+		4151, 0, 3139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6083, 0, 0, 6866, 3125, 0, 0,
+		0, 0, 0, 0, 2875, 6451, 6529, 8192, 0, 7448, 0, 4748, 0, 0, 0, 0, 0, 0, 0, 0, 4732, 0, 0, 0,
+		0, 0, 0, 0, 7345, 0, 7396, 0, 0, 0, 0, 0, 3380, 0, 0, 0, 4622, 5412, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4438, 0, 5650, 0, 0, 0, 0, 0, 3480, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1636, 9297,
+		5691, 0, 0, 0, 0, 9282, 0, 4239, 0, 0, 821, 0, 2737, 306, 2966, 3694, 3669, 4686, 7242, 212, 3035, 0, 2444, 0,
+		5812, 591, 0, 0, 0, 2777, 0, 0, 0, 0, 0, 5362, 0, 0, 0, 7400, 0, 592, 0, 0, 5490, 0, 0, 0,
+		0, 7818, 0, 0, 0, 0, 0, 8318, 0, 5749, 0, 0, 0, 0, 0, 0, 0, 3610, 0, 1225, 0, 0, 3345, 0,
+		1518, 9805, 0, 5981, 8385, 0, 0, 0, 0, 0, 3372, 0, 0, 0, 0, 0, 2843, 0, 0, 0, 0, 0, 0, 5966,
+		0, 6743, 7501, 0, 0, 0, 0, 0, 0, 3832, 0, 0, 0, 0, 0, 1838, 333, 6505, 9133, 9793, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 9903, 0, 6780, 0, 0, 1706, 0, 5250, 0, 6943, 7173, 9203, 36, 0, 0, 0, 0,
+		7499, 4236, 7587, 7686, 0, 0, 0, 0, 9235, 0, 0, 0, 8212, 0, 0, 3927, 7595, 0, 0, 6716, 0, 0, 0, 0,
+		1682, 0, 0, 0, 0, 0, 4636, 0, 1109, 3711, 4160, 0, 0, 0, 2028, 2141, 0, 6346, 0, 4261, 5187, 0, 0, 0,
+		0, 0, 0, 0, 0, 2029, 5027, 2103, 5219, 7652, 2545, 5154, 0, 0, 2655, 0, 0, 0, 3597, 0, 0, 0, 0, 0,
+		604, 0, 0, 1001, 0, 0, 0, 6975, 2291, 4063, 5442, 0, 0, 0, 0, 776, 0, 0, 0, 0, 0, 0, 7697, 0,
+		0, 0, 0, 0, 0, 0, 8298, 0, 711, 0, 0, 0, 0, 0, 3594, 0, 0, 7200, 0, 0, 0, 0, 1981, 7602,
+		5076, 0, 0, 0, 0, 0, 0, 0, 6587, 0, 0, 0, 8439, 0, 6684, 6507, 575, 0, 0, 0, 0, 5794, 1588, 2995,
+		6340, 3163, 6511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3837, 8252, 9633, 0, 0, 1696, 0, 0, 0, 0, 0,
+		0, 4337, 0, 0, 7773, 0, 3348, 0, 8627, 0, 0, 0, 0, 0, 0, 4437, 4682, 0, 0, 0, 0, 0, 3743, 0,
+		0, 0, 6589, 7750, 0, 7997, 0, 4805, 0, 0, 0, 0, 0, 0, 4506, 0, 0, 0, 3494, 0, 0, 0, 8022, 8392,
+		9181, 0, 0, 0, 9386, 0, 0, 3150, 0, 7892, 4493, 6625, 7451, 0, 0, 3117, 7624, 0, 1407, 2773, 0, 0, 8354, 0,
+		0, 0, 0, 8752, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9122, 4190, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 1546, 0, 0, 0, 5453, 0, 1912, 0, 0, 0, 2730, 0, 0, 0,
+		0, 8497, 0, 0, 0, 0, 0, 0, 0, 5140, 211, 2842, 7819, 0, 7959, 0, 0, 3689, 2443, 3675, 4804, 4863, 1061, 5224,
+		9252, 3645, 9611, 515, 620, 9147, 0, 0, 0, 0, 0, 8822, 0, 268, 5375, 0, 0, 0, 0, 0, 626, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4889, 7518, 0, 0, 0, 0, 3492, 0, 0, 0, 0, 0, 0, 4189, 0, 5760,
+		0, 0, 0, 0, 0, 0, 0, 0, 1845, 0, 0, 0, 9202, 6710, 1434, 9554, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1941, 6131, 2198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3307, 4953, 5626, 0, 8270, 0, 0, 3970, 0, 0, 1778,
+		4199, 0, 0, 8626, 7083, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2846, 5111, 0, 0, 0, 0, 4664, 0, 7006, 0,
+		0, 0, 0, 9230, 0, 0, 0, 0, 8866, 7592, 1068, 0, 0, 0, 4046, 0, 0, 0, 0, 0, 0, 0, 0, 8078,
+		0, 3018, 0, 0, 0, 4894, 0, 1184, 0, 0, 9346, 5426, 0, 1445, 5202, 0, 0, 8099, 0, 2105, 6351, 0, 0, 2383,
+		5116, 0, 1659, 214, 6863, 2214, 0, 0, 4515, 2630, 9258, 0, 0, 0, 371, 1796, 7366, 0, 0, 0, 5159, 3595, 0, 0,
+		0, 1139, 8162, 0, 0, 4148, 0, 167, 3602, 0, 342, 3655, 0, 0, 0, 8066, 9160, 7387, 0, 0, 3212, 0, 7223, 0,
+		0, 0, 0, 0, 4468, 8405, 1538, 3614, 0, 1484, 0, 717, 0, 0, 0, 0, 4961, 0, 0, 5642, 0, 0, 0, 9940,
+		2786, 0, 1917, 0, 0, 7811, 0, 0, 7115, 0, 0, 0, 838, 0, 0, 0, 0, 0, 8677, 0, 0, 0, 5474, 0,
+		0, 0, 0, 0, 0, 473, 1962, 0, 40, 0, 9244, 0, 3446, 9073, 0, 1646, 0, 8161, 0, 233, 0, 0, 0, 0,
+		0, 0, 1924, 0, 9068, 0, 0, 0, 0, 8008, 0, 0, 0, 0, 1886, 2220, 2562, 5174, 7726, 9837, 0, 0, 0, 0,
+		0, 2038, 3053, 4608, 0, 0, 0, 0, 0, 0, 6761, 2640, 9447, 0, 0, 0, 0, 2104, 0, 4619, 0, 0, 0, 9735,
+		788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6953, 0, 0,
+		0, 369, 0, 4009, 244, 0, 0, 5134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2830, 8703,
+		0, 0, 0, 0, 0, 0, 0, 2891, 0, 0, 0, 5727, 0, 9900, 0, 0, 1948, 9270, 0, 0, 4742, 0, 0, 1701,
+		0, 0, 0, 7384, 9512, 1497, 5706, 9246, 9087, 0, 1521, 241, 569, 0, 0, 0, 0, 0, 0, 0, 3683, 0, 3660, 0,
+		0, 0, 0, 0, 0, 483, 5823, 668, 0, 0, 7086, 0, 0, 1114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 679,
+		0, 0, 0, 2024, 0, 8153, 0, 3997, 0, 0, 6889, 5069, 0, 0, 0, 2816, 0, 0, 0, 0, 1548, 0, 0, 0,
+		9261, 0, 5711, 0, 0, 0, 0, 2547, 1703, 0, 0, 0, 6820, 391, 0, 0, 0, 0, 0, 0, 0, 0, 5877, 9552,
+		0, 0, 0, 6435, 0, 0, 0, 0, 0, 0, 0, 5322, 0, 0, 0, 2866, 7780, 0, 0, 5848, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 492, 0, 0, 0, 0, 0, 6452, 74, 9486, 3010, 0, 0, 0, 7087, 0, 0,
+		0, 7939, 0, 0, 7540, 0, 0, 0, 0, 0, 1010, 7163, 0, 0, 0, 0, 299, 5526, 7137, 7957, 4811, 428, 4071, 7165,
+		0, 0, 9128, 0, 0, 0, 0, 0, 6238, 0, 0, 0, 0, 0, 8506, 0, 468, 0, 0, 6458, 7487, 0, 300, 0,
+		0, 0, 0, 0, 1345, 0, 0, 0, 0, 0, 0, 0, 0, 4167, 0, 0, 0, 5784, 0, 0, 0, 0, 0, 0,
+		8562, 603, 0, 0, 0, 657, 0, 8731, 0, 6554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5899, 0, 8523, 0,
+		5214, 0, 8287, 0, 0, 0, 7404, 0, 0, 0, 6790, 0, 6191, 6033, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 7930, 5141, 8800, 0, 0, 0, 0, 3817, 0, 0, 0, 0, 7849, 0, 0, 0, 0, 0, 0, 0, 0, 9037, 0,
+		0, 0, 0, 5694, 0, 0, 0, 0, 0, 0, 0, 2037, 3960, 0, 0, 0, 0, 0, 0, 8759, 0, 0, 0, 0,
+		0, 0, 0, 0, 6307, 0, 0, 0, 0, 0, 0, 0, 5252, 0, 0, 0, 0, 0, 4142, 0, 0, 0, 0, 3019,
+		0, 0, 0, 0, 0, 0, 0, 0, 6649, 0, 0, 0, 9598, 0, 0, 1769, 0, 0, 0, 0, 0, 6166, 0, 0,
+		9478, 0, 0, 0, 0, 0, 8457, 0, 0, 0, 0, 0, 0, 9516, 1288, 0, 0, 0, 0, 0, 0, 3144, 2597, 0,
+		0, 0, 0, 0, 6655, 0, 0, 0, 7734, 0, 0, 0, 0, 0, 0, 0, 0, 1625, 0, 0, 0, 9476, 0, 0,
+		0, 0, 0, 0, 9341, 9828, 0, 0, 3991, 4613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3461, 1920, 5833,
+		0, 0, 873, 917, 5448, 8813, 0, 0, 0, 203, 5700, 0, 0, 0, 0, 0, 168, 791, 0, 0, 3932, 0, 0, 5211,
+		0, 0, 216, 0, 0, 0, 5021, 0, 0, 9832, 610, 2654, 0, 4566, 0, 0, 0, 0, 0, 0, 2072, 7265, 0, 7214,
+		1856, 3271, 7565, 8634, 617, 0, 0, 0, 8304, 9745, 3281, 0, 0, 0, 2473, 1533, 8430, 8739, 0, 0, 0, 0, 0, 0,
+		3867, 6122, 9713, 0, 0, 1740, 2838, 5720, 7382, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3157, 8033, 0, 7991, 0,
+		0, 0, 1996, 0, 0, 0, 2588, 1992, 0, 0, 0, 0, 0, 0, 0, 3012, 6214, 6880, 2245, 0, 5593, 0, 0, 7029,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7650, 1923, 0, 6471, 4220, 7557, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 488, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 1175, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2720, 0, 0, 0, 2818, 644, 1449, 7505, 0, 0, 4731, 0, 6231, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2579, 0, 0, 0, 0, 0, 2368, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6104, 0, 0, 5955, 7615, 0, 0, 0, 0, 2665, 5892,
+		2481, 0, 0, 397, 924, 8339, 0, 0, 0, 0, 2839, 8402, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 726, 0, 0, 0, 0, 3396, 0, 0, 0, 0, 0, 0, 0, 0, 2959, 0, 0, 0, 0, 2961, 0, 0,
+		0, 5660, 0, 0, 0, 0, 1023, 2507, 5702, 0, 2411, 2079, 0, 7250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 8337, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7733, 0, 0, 0, 0, 1441,
+		0, 0, 0, 0, 0, 0, 6010, 0, 0, 0, 7940, 785, 0, 0, 4836, 6955, 0, 0, 1378, 7027, 0, 0, 0, 0,
+		0, 6245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1261, 0, 0, 2993, 6128, 8622, 0, 0, 0,
+		0, 0, 0, 0, 0, 8396, 0, 0, 0, 0, 0, 0, 3971, 5041, 0, 0, 4445, 0, 0, 0, 0, 0, 0, 0,
+		5232, 6503, 0, 0, 7695, 4207, 4632, 9698, 0, 7365, 0, 2571, 4552, 7028, 9629, 0, 0, 0, 30, 0, 0, 8665, 7751, 4390,
+		0, 0, 0, 0, 0, 881, 0, 8356, 6082, 0, 0, 0, 8080, 0, 0, 0, 0, 0, 8128, 174, 8890, 0, 6377, 0,
+		2683, 0, 0, 9841, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5416,
+		7222, 0, 2938, 72, 0, 0, 0, 3809, 6664, 8461, 9594, 0, 1004, 0, 4757, 0, 1989, 2261, 0, 0, 1779, 0, 0, 9318,
+		0, 0, 0, 0, 0, 4124, 4813, 0, 5774, 2045, 0, 2976, 0, 0, 0, 8480, 0, 0, 0, 0, 0, 7839, 0, 0,
+		0, 9430, 0, 0, 0, 0, 2166, 5541, 0, 0, 819, 8623, 0, 0, 0, 0, 9171, 0, 8114, 0, 0, 0, 0, 5624,
+		0, 5859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9385, 0, 0, 0, 0, 0, 0, 2070, 9290, 0, 3776, 6543,
+		8447, 7732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4146, 0, 0, 0, 0, 0, 4027, 9567, 0,
+		0, 0, 0, 0, 0, 0, 1177, 8577, 0, 0, 0, 0, 3025, 0, 0, 0, 0, 0, 0, 0, 5086, 0, 0, 0,
+		8748, 0, 0, 0, 0, 0, 0, 0, 4616, 6199, 0, 9419, 0, 0, 2793, 0, 3962, 0, 3775, 0, 0, 0, 0, 0,
+		0, 0, 8315, 0, 0, 6986, 0, 0, 9058, 0, 0, 0, 0, 0, 0, 0, 3569, 0, 1498, 0, 3668, 0, 0, 0,
+		0, 8802, 5875, 6929, 7887, 0, 0, 2873, 3140, 3107, 6905, 0, 3220, 9292, 0, 7442, 0, 5751, 0, 0, 8518, 1386, 4242, 6201,
+		9972, 498, 5171, 0, 5611, 0, 0, 5151, 0, 0, 9220, 0, 0, 0, 1252, 0, 0, 6992, 8966, 0, 0, 2848, 0, 0,
+		0, 0, 6185, 0, 0, 0, 0, 3511, 9188, 5707, 8881, 0, 99, 8892, 0, 0, 0, 4507, 0, 0, 0, 0, 0, 0,
+		5840, 0, 0, 0, 0, 0, 0, 0, 1553, 1944, 4653, 0, 7706, 0, 0, 6911, 0, 0, 6874, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 8146, 0, 0, 0, 0, 0, 1246, 3948, 4785, 6510, 8264, 8845, 0, 0, 0, 5043, 3403, 0, 0,
+		0, 0, 0, 0, 5960, 0, 9660, 0, 0, 2067, 0, 3127, 0, 0, 0, 0, 5476, 0, 0, 0, 0, 7741, 5161, 0,
+		6080, 0, 7516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4484, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 6020, 0, 0, 0, 2280, 0, 572, 0, 0, 4196, 7651, 0, 196, 6688, 9953, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 9136, 0, 0, 0, 0, 0, 0, 5712, 8102, 0, 0, 0, 0, 8023, 0, 0,
+		8827, 6801, 124, 0, 0, 0, 0, 2999, 3654, 0, 5053, 0, 9130, 0, 0, 447, 3833, 5019, 4331, 6085, 6311, 7790, 6499, 8724,
+		8985, 0, 0, 0, 0, 7646, 0, 4730, 0, 0, 670, 0, 0, 0, 0, 0, 3678, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1267, 0, 0, 6163, 3584, 5168, 0, 5775, 6423, 0, 0, 0, 0, 0, 0, 0, 4491, 7358, 0, 6886,
+		7258, 0, 0, 0, 0, 0, 0, 5044, 0, 0, 6654, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7354, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2977, 0, 4007, 0, 0, 6546, 0,
+		0, 0, 4843, 4603, 6998, 2646, 0, 0, 9583, 0, 0, 0, 0, 0, 0, 0, 0, 4010, 0, 9503, 7136, 0, 4624, 5639,
+		0, 0, 0, 0, 0, 0, 5523, 0, 0, 0, 0, 3634, 0, 0, 0, 0, 0, 9821, 0, 3299, 0, 0, 0, 0,
+		0, 0, 0, 0, 1125, 2824, 8664, 0, 0, 0, 4214, 0, 0, 0, 8799, 1391, 0, 0, 0, 0, 0, 0, 363, 9001,
+		0, 7194, 9877, 0, 1926, 0, 0, 7183, 1574, 2264, 0, 0, 0, 0, 0, 0, 0, 8980, 8426, 1851, 0, 8558, 0, 3676,
+		6043, 2046, 9061, 0, 0, 2530, 0, 581, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8743, 0, 0, 0, 3424, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 728, 2322, 9378, 4297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5964, 6434, 0,
+		0, 0, 3278, 0, 1024, 1190, 0, 0, 0, 0, 0, 0, 5718, 0, 0, 0, 5889, 9358, 81, 0, 5849, 0, 0, 0,
+		0, 0, 0, 0, 0, 1908, 0, 0, 0, 0, 3065, 3925, 0, 6312, 9766, 4182, 6576, 2684, 0, 0, 0, 0, 0, 0,
+		0, 7586, 0, 0, 1097, 1602, 0, 0, 0, 0, 399, 9772, 5319, 0, 0, 9301, 9602, 0, 0, 0, 0, 5000, 9753, 2887,
+		8719, 0, 6450, 0, 0, 2944, 6514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2075, 0, 0, 2054, 0,
+		0, 0, 3194, 0, 7047, 0, 0, 9896, 0, 0, 0, 0, 0, 2946, 8386, 2326, 5090, 0, 3919, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 9092, 0, 0, 0, 6768, 0, 0, 9649, 0, 0, 0, 0, 0, 0, 7310, 0, 2950, 0, 2803,
+		0, 8261, 0, 0, 774, 9443, 5814, 0, 8236, 0, 0, 0, 4675, 3982, 4740, 0, 0, 0, 5761, 0, 0, 5915, 9790, 6864,
+		0, 208, 8671, 421, 3510, 4514, 8455, 9152, 2809, 0, 3188, 177, 3474, 0, 0, 0, 0, 0, 6303, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1998, 5585, 7852, 9808, 5323, 0, 0, 6305, 0, 622, 0, 0, 0, 0, 0, 3679, 0, 2295, 0, 0,
+		0, 0, 8460, 5192, 9580, 0, 0, 7132, 0, 0, 6220, 3592, 0, 0, 5767, 0, 0, 0, 8565, 0, 0, 6059, 0, 7421,
+		4070, 4179, 4607, 0, 0, 0, 0, 0, 1906, 0, 0, 4520, 2356, 5456, 6979, 0, 0, 4474, 0, 0, 9636, 0, 8326, 0,
+		0, 0, 0, 9822, 6956, 0, 0, 0, 5244, 0, 2464, 0, 7003, 0, 0, 0, 0, 0, 0, 9697, 0, 0, 0, 0,
+		6283, 0, 0, 0, 0, 3737, 0, 0, 0, 386, 0, 5865, 0, 0, 0, 0, 0, 7514, 0, 0, 0, 0, 6634, 0,
+		0, 0, 0, 0, 0, 6894, 0, 0, 0, 5511, 3729, 3980, 7349, 0, 0, 6483, 0, 8517, 0, 5063, 0, 0, 3121, 2575,
+		0, 0, 0, 1223, 0, 0, 9566, 0, 1700, 0, 4667, 0, 0, 0, 5049, 0, 0, 0, 0, 0, 0, 9779, 0, 0,
+		9835, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8547, 0, 0, 0, 0, 4917, 675, 0, 0, 0, 0, 0,
+		0, 0, 3662, 0, 0, 0, 0, 0, 1672, 0, 0, 0, 2082, 0, 380, 2099, 0, 0, 0, 0, 0, 8266, 0, 0,
+		0, 1039, 5425, 0, 0, 8817, 0, 6544, 9416, 0, 1507, 727, 4319, 0, 723, 0, 0, 0, 0, 7205, 0, 2499, 0, 0,
+		0, 0, 360, 5190, 0, 8190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4702, 1584, 0, 0, 0, 0, 941, 0, 8832,
+		0, 0, 6282, 3536, 0, 0, 0, 0, 2517, 0, 0, 0, 0, 1215, 5563, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 9763, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2423, 0, 0, 0, 0, 0,
+		0, 6760, 3887, 0, 0, 0, 0, 0, 3429, 0, 0, 4078, 0, 2259, 8424, 250, 1519, 8829, 0, 0, 0, 0, 0, 0,
+		5259, 7800, 3939, 0, 0, 5522, 0, 0, 0, 0, 0, 0, 0, 0, 0, 350, 0, 0, 0, 9222, 0, 0, 0, 2641,
+		0, 1160, 6018, 0, 0, 0, 0, 0, 1311, 0, 0, 9263, 0, 9075, 0, 0, 7108, 0, 9620, 3949, 0, 0, 0, 8051,
+		2490, 8526, 0, 0, 0, 0, 0, 0, 8342, 378, 0, 0, 0, 3022, 5904, 0, 0, 0, 7928, 41, 8186, 5458, 0, 6064,
+		0, 2470, 0, 0, 0, 0, 0, 0, 5678, 0, 5979, 0, 0, 0, 0, 0, 6779, 0, 0, 0, 0, 5802, 3178, 0,
+		0, 7636, 4728, 8606, 0, 0, 0, 8013, 0, 0, 7201, 5212, 0, 0, 0, 0, 0, 3587, 0, 0, 0, 0, 3680, 0,
+		0, 8431, 0, 0, 0, 0, 0, 0, 0, 0, 6945, 1640, 0, 0, 0, 0, 2093, 5773, 8035, 2472, 632, 6557, 9097, 6887,
+		1337, 0, 0, 0, 0, 0, 2967, 0, 8712, 4704, 0, 2908, 6098, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 8564, 4837, 0, 8210, 0, 0, 0, 4705, 5107, 2831, 0, 0, 0, 0, 0, 0, 4317, 0, 0, 1528, 0, 0,
+		9543, 0, 0, 0, 0, 0, 0, 9247, 0, 0, 3067, 0, 1670, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7151, 8189,
+		0, 5939, 0, 3924, 0, 0, 8234, 341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3137, 0, 0, 0, 0,
+		0, 0, 0, 529, 7700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4772, 6987,
+		1590, 0, 9138, 8838, 0, 1760, 0, 6692, 0, 0, 0, 9177, 0, 0, 0, 0, 0, 0, 8438, 4687, 6063, 9134, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7479, 8226, 0, 0, 7993, 0, 9428, 0, 0, 0, 0, 2317,
+		0, 1034, 4088, 5318, 0, 1621, 0, 0, 9499, 0, 0, 7181, 0, 5284, 6606, 0, 7259, 7317, 0, 0, 0, 2246, 3413, 6603,
+		0, 190, 0, 5927, 0, 0, 0, 0, 5125, 2178, 6012, 0, 0, 0, 0, 9573, 0, 5221, 3773, 2585, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 3531, 9533, 0, 0, 0, 0, 0, 7947, 0, 0, 7725, 0, 0, 0, 9677, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 5411, 0, 0, 5320, 0, 0, 0, 0, 1849, 0, 2574, 0, 0, 4599, 8681, 9889, 9131, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1027, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768,
+		0, 2167, 6126, 0, 0, 0, 0, 0, 0, 4872, 0, 0, 0, 0, 0, 0, 1940, 0, 0, 0, 9670, 0, 7443, 5277,
+		0, 0, 2318, 1733, 0, 0, 0, 0, 0, 9126, 5016, 784, 5343, 6703, 5519, 0, 0, 0, 4643, 0, 0, 6518, 5520, 8620,
+		2365, 5535, 8779, 4752, 0, 0, 0, 0, 0, 3268, 1791, 4559, 0, 0, 0, 8685, 0, 4490, 0, 0, 0, 0, 0, 6813,
+		0, 0, 0, 0, 0, 0, 0, 142, 3250, 352, 0, 3, 7270, 0, 4095, 0, 4258, 0, 0, 0, 7162, 0, 2497, 0,
+		5663, 0, 5038, 9299, 1327, 0, 0, 1643, 0, 0, 0, 2500, 0, 0, 0, 0, 1689, 1775, 3161, 0, 0, 0, 0, 0,
+		0, 3682, 9909, 0, 0, 0, 0, 2960, 4327, 4760, 8836, 0, 0, 0, 0, 0, 0, 0, 6533, 8767, 5783, 0, 8897, 5003,
+		4054, 0, 0, 0, 0, 0, 469, 277, 4413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1390, 8543, 3502, 2535, 7450, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8188, 1645, 0, 0, 0, 0, 2694, 0, 0,
+		0, 5273, 6627, 0, 2128, 4851, 0, 0, 429, 0, 0, 0, 9129, 0, 0, 8237, 0, 0, 0, 6127, 0, 9550, 0, 0,
+		0, 8415, 0, 0, 0, 8116, 3873, 8289, 0, 6396, 0, 2724, 0, 0, 0, 0, 5579, 6494, 0, 0, 0, 0, 0, 0,
+		0, 187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8088, 0, 0, 0, 0, 8072, 1462, 8808, 8454, 6575, 0, 0, 0,
+		0, 2923, 4140, 6938, 0, 8012, 7488, 0, 1829, 4834, 0, 0, 0, 0, 0, 9059, 0, 0, 0, 0, 4726, 0, 0, 0,
+		0, 0, 0, 1208, 6809, 0, 7590, 0, 0, 4465, 0, 2351, 0, 1389, 0, 0, 0, 0, 0, 0, 2205, 0, 0, 6990,
+		0, 7113, 0, 0, 0, 0, 0, 0, 0, 484, 524, 0, 0, 0, 0, 0, 0, 6395, 0, 1387, 0, 0, 4525, 5646,
+		0, 0, 6433, 1164, 1347, 4018, 8519, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 4089, 1247, 0, 5764, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7657, 5844, 0, 7496, 4203, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2549, 5567, 8771, 0, 0, 0, 0, 9148, 0, 314, 6476,
+		83, 0, 8527, 0, 5189, 1607, 7774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1251, 6258, 0, 0, 0, 0, 7620, 2827, 0, 450, 0, 6693, 9534, 0, 0, 0, 0, 9765, 0, 0, 0, 9908, 0,
+		0, 205, 9946, 0, 0, 6635, 0, 0, 2274, 6930, 7150, 9934, 0, 0, 1982, 0, 0, 9680, 0, 0, 0, 0, 5108, 0,
+		9406, 0, 0, 0, 0, 0, 1628, 2702, 3514, 424, 6374, 5553, 2199, 5195, 0, 3445, 0, 0, 0, 0, 8200, 0, 0, 7666,
+		0, 9254, 0, 2792, 5600, 0, 0, 0, 0, 7756, 143, 0, 0, 0, 0, 0, 0, 0, 0, 4274, 1335, 0, 3496, 0,
+		0, 0, 0, 0, 0, 0, 8717, 0, 0, 0, 0, 0, 0, 0, 3518, 1235, 5619, 0, 0, 0, 704, 0, 0, 0,
+		0, 4541, 0, 0, 3091, 34, 3688, 959, 6961, 0, 0, 7263, 8981, 0, 0, 0, 0, 0, 0, 0, 3605, 0, 0, 5791,
+		0, 0, 0, 0, 0, 0, 0, 0, 5878, 0, 0, 6789, 0, 0, 0, 0, 7429, 0, 0, 0, 0, 7084, 0, 0,
+		0, 0, 0, 0, 3700, 0, 0, 0, 0, 757, 9121, 0, 3577, 0, 0, 0, 6310, 0, 0, 0, 0, 6182, 0, 0,
+		0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1828, 0, 0, 153, 0, 0, 0, 0, 0,
+		0, 2806, 5804, 0, 0, 3726, 0, 0, 9042, 0, 0, 0, 0, 2410, 0, 0, 0, 3302, 0, 0, 0, 0, 0, 3623,
+		0, 5407, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7279, 8130, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2662, 0, 0, 0, 0, 0, 0, 0, 0, 4156, 1529,
+		5217, 7383, 0, 7369, 0, 0, 0, 0, 0, 0, 4649, 0, 0, 0, 0, 0, 2138, 2269, 0, 8495, 0, 8347, 0, 0,
+		0, 2151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6778, 0, 0, 0, 0, 0, 0, 0, 0, 735, 0, 0, 0,
+		0, 0, 0, 0, 8856, 0, 0, 9929, 0, 0, 0, 8653, 743, 1279, 2850, 0, 5615, 0, 0, 5664, 57, 4826, 0, 6523,
+		5828, 0, 0, 2077, 0, 6852, 0, 5203, 9774, 0, 7742, 0, 0, 0, 0, 5843, 0, 2403, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 3397, 6119, 0, 0, 0, 0, 4144, 0, 0, 4850, 8060, 0, 0, 0, 3209, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2184, 4229, 2081, 3882, 6940, 0, 0, 0, 0, 8394, 0, 0, 0, 4504, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4929, 0, 532, 9255, 0, 0, 0, 0, 3360, 4127, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 9449, 0, 9818, 0, 1259, 0, 0, 0, 0, 0, 0, 772, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 3279, 0, 0, 0, 0, 0, 0, 6114, 0, 0, 0, 0, 0, 0, 0, 6665, 0, 0, 0, 0, 0,
+		162, 3146, 2450, 0, 0, 0, 0, 1887, 0, 0, 0, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 3690, 0,
+		0, 7464, 8505, 9647, 0, 2551, 9960, 2837, 0, 0, 0, 6246, 0, 0, 0, 0, 0, 5595, 0, 8542, 0, 0, 9268, 709,
+		0, 0, 0, 2389, 0, 1388, 4254, 3693, 3096, 0, 0, 0, 0, 0, 0, 0, 0, 9351, 0, 0, 3895, 0, 6563, 0,
+		0, 0, 5776, 0, 7525, 0, 0, 0, 0, 6068, 0, 5871, 0, 8641, 0, 0, 0, 5046, 5329, 3408, 6248, 0, 0, 9334,
+		0, 0, 0, 8469, 0, 0, 6643, 0, 3624, 0, 1819, 0, 0, 0, 4570, 0, 6336, 0, 8077, 0, 0, 4701, 0, 0,
+		0, 0, 0, 0, 0, 5287, 0, 8481, 0, 0, 0, 0, 0, 0, 0, 2478, 2048, 2132, 512, 9945, 0, 0, 4817, 0,
+		0, 0, 4990, 0, 0, 0, 0, 7588, 0, 0, 9509, 9141, 0, 0, 4581, 4369, 6571, 0, 0, 5251, 1103, 8132, 0, 0,
+		0, 0, 5534, 0, 0, 0, 0, 0, 0, 0, 4714, 7883, 5971, 0, 1440, 5138, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 9706, 0, 0, 0, 0, 0, 4440, 8459, 0, 0, 0, 0, 8573, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 5441, 0, 0, 0, 0, 0, 0, 7352, 7737, 8070, 0, 3217, 6580, 7307, 0, 0, 1116, 1367, 0,
+		3626, 1957, 0, 0, 0, 0, 7851, 0, 0, 0, 0, 0, 0, 0, 2565, 0, 0, 0, 0, 0, 5374, 6367, 8328, 0,
+		1456, 4233, 0, 0, 0, 6933, 0, 9468, 6530, 0, 0, 0, 0, 0, 0, 0, 8446, 0, 0, 0, 0, 0, 0, 0,
+		3498, 5062, 6159, 5831, 0, 1302, 3599, 3987, 0, 0, 2385, 0, 1296, 9521, 0, 0, 0, 1681, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 5980, 0, 7303, 0, 0, 7520, 0, 0, 0, 0, 7885, 0, 0, 0, 0, 0, 2352, 4476, 0, 0,
+		6542, 0, 0, 0, 0, 7406, 0, 0, 0, 0, 9479, 0, 2548, 6759, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2374,
+		0, 0, 0, 0, 6555, 0, 0, 0, 0, 5471, 0, 0, 1206, 0, 0, 0, 0, 0, 0, 9811, 0, 5007, 8468, 5732,
+		0, 0, 0, 0, 9027, 0, 0, 0, 4575, 0, 0, 0, 6264, 0, 0, 0, 0, 2159, 3115, 0, 0, 0, 0, 0,
+		0, 0, 4633, 9405, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1958, 4907, 9950, 0, 0, 0, 0, 0,
+		0, 0, 0, 7979, 9207, 0, 2804, 0, 0, 0, 0, 0, 0, 0, 5010, 6881, 5014, 0, 0, 5533, 110, 5686, 0, 3021,
+		0, 0, 155, 0, 6629, 7234, 3344, 4291, 0, 0, 0, 7670, 0, 0, 0, 6382, 0, 0, 0, 0, 0, 1186, 0, 0,
+		0, 0, 7954, 0, 0, 0, 0, 0, 4547, 0, 4253, 0, 0, 0, 0, 0, 0, 7252, 7025, 1150, 0, 0, 1707, 4829,
+		0, 0, 0, 4216, 0, 392, 5782, 0, 0, 4451, 0, 0, 3280, 0, 5897, 0, 6495, 0, 8061, 8672, 0, 0, 0, 7916,
+		0, 0, 0, 0, 2546, 5616, 0, 5406, 0, 0, 0, 0, 0, 6972, 0, 771, 9826, 2129, 7791, 7329, 3266, 0, 0, 6515,
+		0, 5739, 0, 0, 0, 0, 3174, 0, 8213, 0, 0, 0, 0, 0, 3777, 7943, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 7749, 0, 0, 0, 3297, 0, 0, 5036, 6061, 6550, 9218, 3369, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 3187, 3898, 8919, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6721, 0, 0, 6919, 0, 2118, 9916, 0, 0, 0, 0, 2534, 0, 3642, 7271, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 7105, 7577, 0, 0, 0, 0, 8096, 9108, 5997, 0, 0, 7158, 2743, 9454, 0, 0, 0, 0, 0, 0, 0,
+		1877, 0, 8539, 0, 9404, 0, 8091, 0, 7760, 3851, 0, 1610, 7019, 4666, 0, 0, 0, 0, 0, 0, 5225, 0, 3938, 0,
+		0, 0, 729, 3825, 4712, 0, 0, 0, 0, 6032, 9208, 3427, 0, 8456, 2135, 471, 0, 0, 732, 1508, 0, 0, 9399, 0,
+		0, 0, 273, 0, 7395, 9847, 0, 0, 2007, 0, 9296, 7530, 0, 8722, 9146, 3894, 0, 0, 0, 0, 7637, 5841, 3405, 0,
+		0, 0, 0, 0, 0, 0, 628, 2981, 0, 0, 3240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4152, 0, 4654,
+		5181, 4555, 7065, 8028, 0, 0, 0, 2527, 0, 0, 0, 3106, 0, 0, 3295, 0, 0, 0, 0, 0, 0, 0, 5824, 0,
+		0, 0, 0, 3095, 3437, 0, 0, 0, 0, 2241, 0, 0, 0, 5486, 0, 442, 0, 0, 9906, 0, 0, 0, 3440, 0,
+		0, 0, 0, 7567, 8787, 0, 0, 0, 9493, 0, 0, 0, 0, 5100, 6859, 0, 0, 0, 0, 0, 0, 0, 0, 766,
+		0, 0, 0, 0, 0, 0, 0, 0, 6835, 0, 20, 366, 2716, 6689, 9715, 0, 0, 0, 2377, 0, 0, 198, 0, 6980,
+		0, 0, 2772, 3319, 0, 0, 0, 7072, 0, 2426, 0, 0, 3426, 0, 0, 0, 0, 9433, 0, 8185, 4030, 0, 7459, 0,
+		0, 0, 4288, 0, 2826, 0, 7297, 9711, 0, 0, 4301, 0, 0, 1041, 756, 0, 0, 0, 0, 0, 0, 0, 0, 2324,
+		5627, 0, 5235, 9456, 0, 695, 0, 0, 0, 6574, 6203, 0, 0, 4268, 0, 0, 3703, 0, 0, 6387, 5206, 5045, 6526, 0,
+		8149, 4198, 0, 0, 0, 0, 0, 0, 5798, 0, 1193, 2878, 0, 3333, 7612, 0, 0, 5885, 9604, 0, 5421, 7018, 8736, 0,
+		0, 0, 0, 0, 0, 5688, 9293, 0, 9717, 9769, 2360, 2879, 4621, 0, 0, 2494, 0, 0, 0, 0, 9459, 0, 0, 0,
+		0, 0, 4779, 1722, 0, 8293, 0, 0, 2485, 4574, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 3298, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3802, 7812, 0, 0, 0, 2154, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 992, 4247, 0, 0, 0, 0, 837, 0, 0, 0, 3884, 0, 9731, 0, 0, 5920, 1028,
+		4946, 0, 0, 0, 0, 1488, 0, 2169, 1243, 3179, 2538, 0, 0, 0, 0, 0, 0, 4626, 7824, 0, 0, 0, 0, 0,
+		0, 5503, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3559, 1692, 8482, 2844, 449, 0, 0, 0,
+		0, 1374, 0, 0, 0, 0, 3391, 0, 0, 0, 0, 0, 8823, 0, 4796, 4954, 8551, 8877, 0, 0, 0, 0, 0, 0,
+		0, 8773, 0, 0, 0, 6232, 9515, 9469, 8947, 669, 750, 9747, 9640, 7662, 0, 0, 0, 0, 0, 0, 0, 0, 9116, 0,
+		0, 0, 2117, 0, 7106, 4492, 1350, 0, 0, 0, 0, 0, 0, 3386, 5191, 6671, 525, 0, 3525, 0, 0, 0, 0, 0,
+		5869, 0, 2942, 0, 0, 4249, 0, 0, 0, 0, 0, 0, 0, 8499, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3875, 4308, 3292, 4671, 0, 0, 0, 0, 4061, 0, 0, 0, 0, 0, 0, 8155, 4762, 7572, 8876, 0, 0, 0, 0, 0,
+		0, 0, 0, 4931, 7023, 0, 0, 0, 0, 0, 0, 0, 1720, 0, 0, 0, 3923, 5736, 0, 4993, 0, 0, 3818, 6076,
+		0, 0, 0, 0, 0, 0, 0, 0, 5504, 0, 0, 0, 0, 7331, 2278, 4959, 5638, 0, 0, 9933, 0, 0, 3008, 5548,
+		0, 0, 8322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3059, 0, 4147, 9752, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2560, 0, 0, 1451, 0, 2700, 0, 338, 0, 0, 1790,
+		5959, 0, 8170, 0, 0, 4281, 0, 3684, 128, 5995, 0, 0, 1592, 0, 6297, 5830, 0, 0, 0, 0, 0, 0, 0, 1986,
+		0, 0, 0, 0, 0, 0, 0, 0, 9807, 0, 1264, 0, 0, 3206, 0, 0, 3648, 0, 0, 0, 0, 6939, 0, 0,
+		0, 1130, 577, 0, 0, 0, 0, 9054, 0, 0, 0, 5799, 8009, 2621, 0, 7212, 0, 0, 0, 0, 5961, 5091, 0, 3207,
+		7945, 0, 0, 0, 2319, 0, 0, 2357, 0, 0, 0, 172, 9117, 0, 602, 0, 1037, 0, 0, 0, 0, 782, 0, 0,
+		0, 0, 0, 0, 4248, 0, 0, 0, 0, 9610, 3774, 0, 7948, 0, 0, 0, 7821, 0, 1185, 2060, 0, 0, 0, 0,
+		6944, 0, 5884, 0, 2084, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5119, 0, 0, 0, 0, 0, 4814,
+		0, 0, 1652, 0, 0, 3392, 2492, 6964, 0, 0, 0, 0, 0, 6802, 0, 0, 0, 0, 0, 5172, 0, 0, 0, 3023,
+		0, 1966, 0, 3406, 9764, 5640, 0, 0, 0, 0, 0, 0, 4097, 0, 6648, 3495, 0, 1464, 4846, 6537, 8826, 0, 0, 5482,
+		8313, 9034, 0, 0, 0, 0, 0, 0, 0, 0, 3077, 0, 0, 4545, 6928, 0, 0, 0, 2790, 3554, 8908, 0, 8138, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1266, 0, 0, 0, 0, 0, 0, 0, 0, 1091, 824, 0, 4368, 6489, 9507, 697,
+		559, 4537, 3830, 975, 7204, 3190, 8338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2277, 978, 4349, 1866, 6284, 1513,
+		0, 0, 0, 9380, 7294, 9894, 4498, 0, 0, 8604, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6409, 8595, 6876, 0,
+		0, 0, 0, 5853, 6288, 0, 0, 0, 0, 0, 0, 0, 2190, 2301, 2868, 8820, 8594, 0, 0, 0, 0, 0, 0, 0,
+		1134, 0, 0, 4402, 477, 0, 0, 0, 761, 0, 0, 0, 0, 0, 345, 0, 0, 0, 0, 9720, 0, 0, 0, 0,
+		0, 0, 0, 0, 3844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6427, 0, 0, 0, 0, 3945,
+		0, 0, 0, 0, 4420, 736, 0, 0, 2669, 0, 4435, 0, 0, 0, 4892, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 2150, 6638, 0, 0, 0, 6882, 0, 0, 0, 0, 0, 0, 0, 0, 1803, 0, 5728, 6323, 8872, 3136, 3383, 0,
+		0, 3189, 0, 9506, 0, 0, 1821, 6892, 0, 0, 0, 4952, 0, 0, 0, 6039, 0, 0, 4316, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 9667, 0, 134, 1195, 4673, 1542, 9544, 0, 0, 0, 0, 0, 0, 7960, 8986,
+		0, 0, 3543, 0, 0, 8238, 0, 0, 0, 0, 0, 0, 6733, 7109, 0, 0, 0, 0, 6370, 7815, 0, 0, 0, 4433,
+		0, 0, 0, 0, 0, 6144, 2056, 0, 0, 0, 5228, 0, 0, 0, 343, 6602, 4660, 8160, 0, 0, 8733, 0, 0, 0,
+		0, 2176, 8344, 0, 0, 1203, 0, 0, 3720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 1050, 441, 0, 0, 0,
+		0, 0, 0, 0, 0, 5647, 0, 0, 0, 0, 0, 0, 8131, 0, 0, 0, 0, 0, 0, 0, 0, 8443, 0, 0,
+		0, 4055, 0, 0, 6211, 2752, 2201, 1459, 6120, 8219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4487, 5048, 0,
+		0, 0, 0, 0, 0, 0, 7035, 0, 0, 0, 0, 8076, 0, 0, 0, 0, 0, 0, 7705, 0, 0, 476, 0, 0,
+		0, 0, 0, 7491, 8059, 0, 0, 4511, 0, 0, 0, 0, 0, 0, 1867, 7237, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 984, 9646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8989, 6481, 4087, 0, 0, 0, 0, 653, 3548,
+		2400, 0, 0, 3254, 5745, 3942, 0, 0, 0, 0, 0, 0, 3643, 2211, 0, 1612, 5261, 0, 0, 0, 0, 4995, 0, 0,
+		0, 4638, 0, 0, 5246, 8624, 974, 9541, 6349, 0, 0, 1506, 0, 0, 8948, 0, 0, 0, 0, 2522, 7635, 9067, 0, 2320,
+		0, 0, 0, 7902, 0, 0, 0, 9298, 0, 9695, 0, 0, 0, 0, 0, 0, 0, 0, 3580, 0, 0, 0, 0, 9551,
+		5342, 0, 1930, 0, 0, 0, 9887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4585, 0, 0, 62, 7917,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2714, 7718, 4016, 0, 0, 0, 0, 4577, 0, 4981, 0, 0, 2537, 1686, 3171,
+		0, 0, 6651, 0, 2970, 0, 0, 0, 0, 0, 3470, 2905, 0, 0, 0, 0, 0, 0, 3571, 1312, 9049, 0, 0, 0,
+		0, 1301, 0, 0, 0, 0, 280, 4535, 0, 0, 0, 0, 0, 0, 7489, 0, 0, 0, 0, 0, 0, 0, 43, 457,
+		970, 2313, 4014, 0, 0, 0, 0, 0, 0, 0, 5484, 6212, 7142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2520, 0,
+		8314, 0, 0, 0, 0, 0, 0, 7904, 2540, 0, 0, 0, 0, 1616, 5169, 0, 8229, 8557, 0, 0, 7453, 0, 0, 0,
+		2948, 6824, 0, 6460, 0, 0, 0, 0, 217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3885, 0, 0, 4058,
+		0, 0, 0, 0, 0, 8479, 0, 0, 5645, 0, 0, 0, 0, 0, 0, 8380, 715, 4106, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4560, 0, 3316, 5574, 0, 0, 0, 4370, 4862, 0, 0, 0, 0, 0, 7268, 0, 5039,
+		0, 0, 0, 0, 7342, 0, 0, 0, 0, 0, 0, 0, 1220, 5083, 0, 0, 1541, 7062, 5376, 8727, 0, 0, 7248, 8486,
+		7681, 1776, 9109, 0, 8812, 6462, 0, 0, 0, 4669, 2144, 3959, 0, 0, 0, 0, 0, 0, 0, 0, 4250, 0, 3442, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6141, 4045, 0, 0, 5888, 5953, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5055, 0, 7908, 9890, 0, 0, 0, 1117, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 487, 1933, 2555, 0, 3763, 0, 9938, 0, 0, 0, 0, 7865, 0, 0,
+		7284, 0, 0, 33, 4157, 0, 1764, 2511, 7191, 0, 3854, 0, 0, 0, 0, 0, 0, 9642, 0, 0, 4397, 0, 0, 0,
+		7118, 54, 0, 0, 0, 0, 0, 0, 8416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6921, 0, 0, 2657, 0,
+		0, 0, 0, 0, 0, 0, 6593, 7658, 0, 8784, 0, 0, 0, 0, 0, 0, 0, 1486, 5695, 0, 6406, 0, 0, 0,
+		0, 0, 0, 1587, 9948, 0, 0, 0, 0, 2898, 0, 5068, 4141, 0, 0, 0, 0, 0, 0, 1162, 0, 0, 0, 0,
+		0, 0, 0, 3247, 0, 0, 0, 0, 8902, 5845, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2901, 0, 0, 3930, 4661, 0, 1148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2073, 0, 0, 0,
+		5436, 0, 0, 3890, 0, 8666, 0, 0, 0, 0, 2673, 5405, 0, 0, 0, 3779, 0, 0, 0, 0, 0, 4335, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1688, 0, 0, 1615, 0, 0, 0, 3274, 0, 0, 0, 1509, 3665, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4188, 0, 0, 0, 0, 7187, 0, 4378, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2137, 0, 0, 0, 0, 1344, 2335, 7075,
+		0, 3273, 0, 0, 0, 0, 0, 0, 0, 6281, 0, 0, 0, 0, 0, 7080, 9859, 0, 0, 0, 0, 0, 4262, 0,
+		5715, 4204, 7584, 0, 9144, 0, 0, 0, 0, 0, 0, 2577, 315, 8846, 0, 0, 160, 721, 4221, 7208, 0, 0, 0, 0,
+		0, 3650, 0, 0, 0, 4955, 0, 0, 0, 0, 1156, 3186, 0, 0, 0, 0, 0, 3652, 6539, 3224, 5821, 7043, 1442, 3027,
+		7154, 3198, 9951, 9523, 0, 5860, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7206, 0,
+		0, 2956, 0, 0, 0, 0, 0, 5136, 0, 0, 2086, 1801, 0, 0, 8753, 0, 0, 0, 0, 0, 4816, 9448, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1491, 0, 0, 0, 0, 2605, 362, 0, 6234, 1377, 7040, 0, 0, 0, 0, 2733, 5494,
+		0, 0, 426, 35, 1444, 2744, 0, 1712, 0, 508, 0, 0, 0, 0, 0, 0, 0, 0, 6079, 67, 0, 0, 0, 0,
+		0, 0, 3071, 4647, 0, 9739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6810, 0, 0, 5757,
+		0, 0, 0, 0, 4665, 0, 0, 0, 0, 0, 0, 4230, 0, 0, 6247, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1532, 0, 0, 0, 0, 0, 6520, 0, 0, 8014, 0, 0, 2693, 5167, 0, 0, 0, 4529, 5060, 0, 0, 0, 0, 0,
+		5223, 0, 0, 0, 0, 0, 986, 0, 0, 0, 0, 0, 937, 0, 2975, 0, 0, 4067, 9306, 9874, 5081, 6652, 8946, 0,
+		0, 0, 0, 0, 943, 0, 0, 9028, 5147, 0, 7913, 0, 0, 0, 0, 0, 0, 829, 4019, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 854, 0, 0, 0, 5895, 2238, 3449, 0, 0, 0, 0, 3331, 0, 6799, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 6633, 2350, 1140, 8778, 0, 0, 0, 7182, 0, 0, 0, 0, 8071, 0, 5952, 0, 2592,
+		0, 0, 0, 2750, 0, 0, 0, 0, 0, 0, 0, 3790, 0, 0, 5496, 0, 0, 0, 0, 8407, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2689, 0, 0, 6549, 0, 9593, 0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 0, 9814,
+		267, 0, 0, 0, 9158, 9227, 0, 0, 0, 8182, 0, 9931, 0, 0, 5665, 0, 6701, 0, 0, 0, 8938, 0, 0, 0,
+		0, 4932, 0, 0, 0, 0, 9626, 2845, 0, 0, 0, 1011, 6218, 0, 0, 8258, 0, 1905, 9838, 0, 0, 0, 0, 830,
+		0, 7423, 0, 0, 0, 7836, 0, 0, 0, 0, 0, 9643, 0, 0, 0, 6306, 0, 0, 0, 281, 7949, 0, 0, 0,
+		0, 0, 0, 448, 0, 8134, 2903, 0, 0, 0, 0, 0, 87, 4522, 0, 0, 0, 0, 0, 3466, 0, 9651, 5893, 9003,
+		0, 0, 0, 0, 3658, 1889, 1753, 0, 0, 5386, 0, 1751, 7631, 8418, 8449, 0, 0, 0, 0, 0, 3664, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1723, 2250, 0, 9180, 7344, 0, 0, 0, 0, 1931, 921, 7174, 0, 0, 0, 3102, 0, 0,
+		5347, 0, 0, 0, 7731, 2930, 0, 2980, 0, 0, 0, 3820, 6291, 0, 0, 0, 7843, 0, 9630, 0, 0, 4802, 1062, 0,
+		0, 4670, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2569, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 9738, 0, 0, 0, 0, 4499, 0, 7103, 0, 0, 0, 5863, 0, 0, 0, 0, 0,
+		3340, 0, 0, 2191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6705, 3757, 4808, 0,
+		7820, 9584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2729, 8912, 0, 0, 0, 0, 8762, 0, 0, 0, 0,
+		0, 5978, 0, 0, 0, 7776, 6292, 7467, 0, 2935, 0, 0, 0, 3126, 0, 0, 0, 0, 7152, 0, 0, 0, 339, 0,
+		0, 0, 0, 0, 7364, 8124, 0, 0, 0, 2940, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8863, 0, 0, 0, 0,
+		0, 6424, 0, 958, 3138, 0, 0, 8737, 0, 0, 0, 0, 0, 1935, 0, 0, 1741, 0, 0, 3335, 0, 0, 0, 0,
+		6091, 0, 1520, 0, 8678, 0, 0, 3764, 0, 0, 0, 859, 3526, 0, 0, 5881, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2828, 0, 0, 3251, 0, 0, 0, 0, 0, 7477, 7840, 1651, 7424, 0, 0, 0, 0, 0, 0, 0,
+		0, 5194, 0, 0, 2173, 0, 0, 8741, 8806, 0, 0, 0, 0, 0, 0, 0, 8107, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 9458, 0, 0, 0, 0, 0, 0, 200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 3852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9510, 0, 0, 0, 2023, 0, 0, 0, 4859, 531, 3856, 6456, 0,
+		0, 0, 999, 0, 8445, 0, 0, 0, 0, 3501, 8474, 0, 0, 0, 2482, 0, 0, 0, 3935, 0, 9168, 0, 0, 0,
+		0, 0, 0, 0, 0, 7220, 0, 0, 0, 1979, 4464, 534, 0, 0, 0, 0, 0, 0, 3827, 7549, 0, 0, 0, 121,
+		6556, 8284, 0, 0, 4615, 0, 0, 6818, 2087, 7853, 0, 0, 0, 0, 0, 9145, 31, 7264, 0, 0, 0, 0, 3481, 3227,
+		0, 0, 0, 0, 0, 0, 0, 3666, 4386, 7236, 9370, 0, 0, 1984, 0, 0, 0, 0, 0, 4025, 7057, 6541, 8575, 0,
+		0, 0, 5808, 0, 4697, 2431, 0, 0, 0, 0, 0, 0, 7517, 2451, 0, 0, 0, 0, 0, 913, 0, 0, 0, 4569,
+		0, 6842, 0, 0, 0, 0, 0, 0, 0, 5472, 0, 0, 0, 0, 0, 0, 0, 5352, 0, 6084, 7578, 0, 0, 0,
+		0, 0, 70, 8959, 0, 4797, 7969, 9615, 9757, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8706,
+		0, 0, 0, 1576, 7320, 0, 0, 0, 0, 0, 0, 0, 0, 8718, 0, 9347, 7122, 0, 0, 7408, 0, 0, 0, 5524,
+		0, 8001, 4296, 0, 0, 0, 0, 0, 1482, 0, 0, 0, 4587, 0, 0, 5555, 0, 0, 8923, 0, 0, 0, 0, 0,
+		0, 2069, 0, 3778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1523, 0, 412, 0, 6755, 6078, 0, 0,
+		0, 2558, 6708, 1268, 0, 0, 0, 0, 0, 0, 1187, 0, 0, 0, 0, 0, 0, 0, 5403, 8434, 0, 9206, 0, 0,
+		0, 0, 0, 0, 0, 0, 2784, 27, 8093, 0, 0, 140, 988, 0, 0, 8716, 0, 0, 0, 0, 0, 3649, 1303, 0,
+		0, 0, 1620, 5716, 0, 0, 0, 0, 0, 0, 7373, 1064, 0, 0, 0, 0, 0, 0, 7480, 0, 0, 0, 0, 458,
+		1759, 0, 3995, 0, 8172, 0, 0, 0, 8578, 0, 0, 0, 8970, 0, 0, 0, 0, 0, 5872, 3457, 0, 0, 0, 0,
+		0, 0, 0, 0, 6037, 0, 0, 9047, 0, 0, 0, 0, 0, 0, 0, 0, 9481, 3249, 0, 0, 0, 0, 4130, 1807,
+		5637, 1230, 0, 0, 0, 0, 0, 0, 6616, 0, 3986, 5112, 0, 0, 0, 5109, 8609, 0, 1864, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1561, 0, 0, 0, 0, 0, 7318, 0, 0, 0, 5101, 0, 2122,
+		0, 0, 0, 0, 9426, 0, 0, 8113, 0, 0, 7090, 8766, 9504, 0, 0, 0, 0, 0, 0, 0, 9403, 3765, 0, 2943,
+		4558, 8583, 0, 2896, 6583, 0, 0, 0, 0, 0, 0, 0, 0, 3152, 478, 0, 0, 0, 0, 0, 2583, 0, 0, 0,
+		7348, 0, 0, 0, 0, 0, 0, 5236, 1085, 2243, 1785, 6711, 0, 0, 6468, 6821, 8334, 1833, 1909, 61, 1204, 3084, 4129, 5117,
+		0, 6206, 0, 0, 0, 0, 0, 0, 8159, 5765, 0, 6188, 0, 0, 21, 9704, 0, 928, 0, 4825, 0, 0, 0, 0,
+		0, 6935, 6565, 0, 0, 0, 0, 6121, 0, 0, 3667, 0, 4684, 0, 0, 0, 2853, 0, 0, 0, 8860, 9777, 0, 0,
+		0, 5698, 3670, 0, 0, 5820, 0, 0, 0, 3415, 0, 0, 0, 0, 0, 5148, 0, 0, 1677, 0, 0, 0, 0, 0,
+		0, 0, 7690, 0, 5488, 0, 0, 0, 4015, 0, 5249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6798, 8006,
+		0, 4411, 6947, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5423, 8201,
+		0, 7216, 0, 0, 3289, 0, 0, 0, 0, 0, 0, 0, 1956, 2704, 0, 5957, 0, 0, 0, 0, 0, 0, 0, 0,
+		5941, 0, 0, 0, 0, 0, 6666, 0, 0, 0, 0, 0, 0, 0, 0, 3368, 0, 0, 6261, 0, 0, 0, 0, 0,
+		423, 3311, 3725, 5753, 8117, 0, 3263, 437, 8772, 6124, 6691, 0, 0, 0, 0, 4480, 4612, 1408, 3964, 0, 0, 0, 0, 1502,
+		0, 9100, 9669, 0, 0, 0, 1031, 9271, 0, 0, 7145, 0, 0, 0, 0, 2706, 0, 0, 0, 9708, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4163, 0, 0, 1310, 0, 2170, 1371, 7654, 1009, 1300, 5004, 6035, 0, 0, 7210, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1476, 0, 0, 0, 0, 1626, 0,
+		1569, 8643, 2862, 0, 0, 0, 0, 1020, 0, 0, 0, 1454, 3290, 5298, 3112, 0, 0, 0, 0, 0, 0, 5870, 0, 0,
+		3724, 0, 0, 0, 0, 0, 0, 3244, 4988, 0, 0, 767, 5826, 8750, 0, 9645, 0, 0, 0, 0, 0, 5022, 0, 8931,
+		0, 0, 0, 0, 0, 0, 0, 0, 3009, 0, 0, 0, 0, 0, 1669, 0, 0, 0, 0, 2078, 0, 8406, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 6007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9475, 6696, 0, 0,
+		0, 0, 197, 2171, 0, 0, 0, 0, 0, 990, 0, 0, 4676, 7561, 0, 6008, 0, 0, 6675, 9470, 0, 0, 0, 0,
+		0, 0, 0, 6765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5735, 2005,
+		0, 0, 0, 0, 4630, 5560, 0, 0, 0, 0, 0, 9362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8839, 375, 2708, 2367, 1112, 9179,
+		9348, 0, 0, 0, 0, 0, 7755, 9893, 0, 6455, 0, 0, 0, 3671, 0, 0, 8990, 1559, 0, 6174, 0, 8857, 0, 0,
+		0, 0, 0, 0, 0, 3674, 0, 0, 5836, 0, 8209, 0, 0, 0, 0, 8901, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4472, 0, 6656, 0, 0, 0, 0, 0, 5908, 0, 0, 5462, 6149, 0, 0, 0, 0, 0, 0, 0, 0, 8954, 9718,
+		0, 0, 0, 0, 0, 0, 0, 0, 8502, 0, 0, 8842, 0, 0, 4310, 0, 0, 0, 1413, 8309, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 967, 0, 0, 0, 0, 0, 8531, 0, 2587, 0, 4501, 4745,
+		6974, 0, 0, 4806, 0, 0, 0, 0, 0, 0, 0, 4842, 5561, 0, 5543, 9505, 0, 0, 8487, 9450, 0, 2380, 8688, 9163,
+		0, 0, 0, 0, 0, 4444, 6942, 0, 0, 0, 6000, 0, 0, 0, 962, 8560, 0, 0, 9082, 0, 7207, 0, 0, 0,
+		0, 0, 0, 9094, 0, 4749, 0, 3052, 4077, 989, 2799, 7048, 0, 0, 0, 0, 2747, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 474, 0, 0, 2116, 5477, 0, 4398, 0, 0, 0, 0, 0, 0, 0, 6003, 6093, 0, 613, 4184, 3058, 0,
+		0, 0, 0, 3130, 0, 0, 0, 0, 0, 2270, 2200, 0, 0, 0, 7653, 0, 3165, 0, 4865, 7168, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1274, 403, 0, 5803, 5687, 0, 9607, 0, 0, 0, 8508, 0, 0, 0, 4000, 0, 7682, 0,
+		7544, 0, 0, 7485, 555, 0, 0, 3636, 0, 0, 6066, 8400, 0, 0, 8501, 0, 0, 3031, 2227, 0, 0, 6836, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4741, 7984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3745, 5283, 0, 8387, 2436, 0,
+		5958, 0, 0, 0, 0, 0, 0, 0, 0, 805, 0, 0, 2384, 7899, 0, 0, 0, 5149, 0, 0, 0, 5968, 2458, 0,
+		0, 0, 639, 0, 0, 0, 0, 6015, 0, 0, 0, 5514, 0, 7093, 7327, 0, 5516, 0, 0, 0, 0, 0, 0, 0,
+		6041, 2237, 0, 0, 0, 0, 4957, 0, 0, 0, 0, 513, 0, 0, 5160, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 463, 8670, 0, 4334, 5672, 8628, 0, 3714, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8044, 0,
+		0, 0, 3296, 0, 0, 2608, 9918, 815, 0, 7164, 8171, 0, 0, 0, 0, 5697, 0, 0, 2253, 2348, 0, 0, 0, 0,
+		4155, 0, 0, 0, 0, 0, 1070, 3453, 9229, 0, 0, 0, 3255, 0, 3615, 0, 0, 0, 0, 3086, 0, 0, 0, 0,
+		0, 0, 0, 4589, 0, 0, 0, 0, 4043, 0, 2983, 0, 0, 0, 1124, 0, 0, 0, 0, 0, 9196, 0, 5207, 0,
+		0, 0, 2228, 4904, 0, 0, 0, 0, 0, 0, 2552, 0, 5335, 0, 0, 0, 1052, 1358, 0, 8029, 6439, 0, 0, 0,
+		0, 2767, 0, 0, 0, 0, 0, 528, 0, 0, 3243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4380, 0, 0,
+		0, 0, 0, 0, 7786, 0, 0, 0, 0, 454, 257, 0, 5179, 0, 0, 6237, 0, 0, 0, 0, 4174, 0, 0, 0,
+		4313, 9164, 0, 0, 0, 9485, 0, 7914, 7985, 4540, 6208, 1810, 3698, 0, 0, 0, 0, 5099, 9601, 0, 0, 0, 0, 0,
+		0, 4426, 8840, 0, 0, 0, 0, 0, 0, 9492, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1690, 0, 0, 0, 672,
+		0, 0, 0, 0, 84, 8215, 0, 6397, 0, 0, 0, 0, 1272, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 8464, 601, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3576, 0, 0, 0, 0, 0, 0, 0, 618,
+		228, 6586, 0, 0, 0, 6353, 0, 0, 0, 0, 0, 0, 0, 8217, 0, 6739, 2397, 9797, 0, 0, 0, 0, 0, 0,
+		5123, 0, 6680, 0, 0, 0, 0, 0, 809, 0, 0, 0, 0, 6924, 0, 3609, 0, 0, 0, 0, 0, 0, 8423, 9371,
+		1680, 6029, 0, 5902, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6108, 0, 0, 0, 0,
+		2601, 0, 0, 0, 0, 0, 0, 0, 243, 0, 8974, 7905, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2895, 0, 0,
+		8193, 0, 0, 3739, 0, 0, 0, 0, 0, 8317, 0, 0, 422, 1974, 0, 0, 0, 0, 0, 9710, 2897, 0, 0, 0,
+		0, 0, 0, 6210, 4648, 8365, 9490, 0, 1797, 6610, 7319, 0, 0, 445, 0, 2556, 0, 0, 0, 1276, 0, 1480, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5604, 0, 0, 0, 0, 0, 538, 0, 0, 7753, 0, 0, 0,
+		5262, 8362, 9191, 0, 0, 9939, 0, 0, 0, 0, 0, 0, 6031, 0, 0, 0, 0, 4791, 0, 1731, 2321, 0, 0, 0,
+		0, 4026, 0, 0, 0, 8492, 0, 0, 0, 0, 4284, 13, 0, 6959, 25, 7781, 0, 0, 5701, 0, 2387, 0, 0, 0,
+		0, 0, 0, 8735, 7560, 0, 6993, 8191, 0, 6475, 0, 4003, 0, 206, 6995, 4871, 9673, 0, 0, 3618, 0, 0, 7238, 419,
+		3219, 0, 0, 7419, 9396, 2459, 9956, 6404, 6485, 0, 6582, 1015, 3622, 0, 5827, 0, 9860, 5529, 0, 0, 1848, 7134, 2642, 7813,
+		0, 0, 0, 0, 0, 3759, 7244, 898, 7199, 7720, 8924, 1902, 0, 6841, 0, 56, 0, 0, 0, 1071, 4101, 0, 0, 0,
+		6784, 0, 0, 0, 0, 5340, 4050, 0, 0, 289, 5517, 0, 0, 0, 0, 0, 5033, 0, 0, 0, 3385, 0, 0, 0,
+		4913, 8414, 0, 9329, 0, 0, 0, 0, 0, 0, 0, 2297, 7340, 9221, 0, 0, 0, 0, 0, 0, 609, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 8612, 2788, 0, 0, 0, 0, 0, 0, 0, 2221, 8855, 0, 0, 9382, 0, 0, 0,
+		0, 0, 0, 9941, 0, 0, 0, 0, 0, 0, 0, 2814, 0, 0, 0, 5231, 0, 3769, 8632, 9915, 0, 0, 0, 6156,
+		0, 0, 0, 0, 0, 0, 0, 3166, 8257, 0, 0, 0, 6718, 0, 0, 0, 0, 0, 0, 2109, 1524, 0, 0, 6695,
+		3573, 0, 0, 0, 0, 8220, 0, 0, 0, 3080, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7257, 0, 0, 2248, 4692,
+		0, 0, 624, 7614, 0, 0, 0, 0, 2922, 86, 0, 0, 0, 0, 0, 0, 0, 0, 1105, 7409, 4790, 8086, 1008, 1928,
+		1608, 283, 0, 752, 0, 9498, 0, 0, 0, 0, 0, 4169, 9308, 0, 5366, 0, 0, 0, 2161, 4172, 3269, 0, 6808, 0,
+		0, 0, 0, 0, 964, 6136, 4119, 3463, 666, 5464, 9413, 0, 7632, 0, 0, 7597, 0, 0, 0, 0, 1393, 4650, 0, 0,
+		9690, 0, 7149, 0, 0, 0, 0, 0, 0, 8936, 0, 242, 9444, 9565, 0, 0, 9834, 0, 0, 5787, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1977, 6274, 0, 0, 0, 0, 0, 0, 0, 9810, 2196, 0, 0, 4138, 2722, 6100,
+		7470, 9316, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9118, 0, 9387, 0, 0, 8040, 0, 9816, 0, 0, 0, 0,
+		0, 0, 0, 3896, 0, 1536, 0, 0, 0, 0, 0, 8930, 0, 6129, 4556, 0, 0, 9398, 0, 7963, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 6883, 0, 0, 0, 3401, 5675, 0, 0, 1837, 0, 2713, 0, 6712, 1199, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 147, 8619, 0, 7143, 0, 4289, 108, 0, 1019, 0, 0, 0, 0, 5710, 8756, 0,
+		0, 7330, 3414, 0, 0, 0, 0, 7687, 9595, 0, 0, 1713, 0, 751, 4436, 9545, 0, 0, 0, 0, 3811, 0, 0, 9427,
+		0, 0, 0, 0, 0, 0, 7418, 0, 2971, 0, 0, 0, 3287, 0, 0, 0, 0, 5829, 4567, 0, 0, 313, 4193, 5449,
+		8544, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 359, 3148, 0, 0, 0, 0, 0, 0, 0, 1081, 5551,
+		7787, 0, 8248, 0, 5201, 0, 0, 0, 5589, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 2142, 0, 0, 4452, 0, 7721, 1679, 3120, 0, 0, 0, 0, 0, 6153, 3286, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 7399, 0, 1170, 0, 0, 0, 5864, 0, 0, 0, 0, 0, 0, 0, 5463, 4269, 6657, 0, 0, 6968, 6044, 0,
+		0, 157, 0, 0, 2051, 0, 7492, 0, 0, 7432, 0, 0, 0, 4699, 5738, 8807, 0, 0, 3813, 0, 7374, 0, 0, 0,
+		0, 0, 0, 0, 5216, 0, 0, 0, 0, 0, 5564, 0, 0, 6207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		7877, 8786, 0, 0, 6840, 0, 0, 0, 0, 2593, 3989, 0, 0, 0, 0, 5052, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 6771, 0, 0, 0, 673, 0, 0, 8804, 0, 0, 0, 0, 0, 0, 5606, 0, 0, 0, 0, 0, 0, 0, 0,
+		4406, 995, 6446, 7009, 9132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 822, 0, 0, 222, 6038, 0, 0, 3176, 0, 0,
+		0, 0, 0, 0, 0, 8097, 0, 0, 0, 0, 3482, 0, 0, 0, 0, 0, 0, 0, 0, 6143, 0, 0, 0, 786,
+		7848, 8747, 0, 0, 0, 0, 0, 5747, 0, 7054, 91, 3162, 0, 0, 247, 0, 344, 0, 0, 0, 0, 0, 3015, 8958,
+		2115, 0, 0, 5584, 6599, 0, 0, 0, 0, 0, 0, 3505, 7243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 797,
+		4662, 0, 0, 0, 0, 0, 0, 0, 2619, 0, 9032, 0, 0, 0, 9831, 461, 0, 6215, 643, 0, 1836, 2262, 4736, 6531,
+		5708, 7500, 0, 0, 5990, 1869, 0, 2347, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2119, 2284,
+		0, 0, 2333, 0, 0, 0, 8353, 2255, 0, 0, 0, 0, 0, 0, 5268, 0, 2123, 0, 0, 1757, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 7041, 0, 1780, 0, 1862, 0, 7140, 0, 0, 113, 4866, 535, 1089, 0, 0, 0,
+		5779, 6058, 7484, 0, 500, 2419, 7621, 0, 0, 0, 0, 3877, 0, 1321, 8278, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6700, 3625, 0, 0, 1832, 0, 2349, 6646, 5890, 1379, 7855, 0, 4073, 8940, 8915, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 5418, 6308, 0, 0, 0, 0, 0, 0, 6092, 0, 906, 5466, 3082, 2742, 3961, 0, 0, 0, 0, 4756, 6216,
+		7051, 1126, 0, 0, 0, 0, 792, 5557, 0, 1773, 944, 8950, 0, 0, 0, 327, 0, 0, 8016, 0, 0, 0, 0, 8853,
+		0, 0, 0, 0, 0, 0, 0, 1993, 3156, 9809, 0, 0, 0, 5480, 0, 0, 0, 0, 3771, 4080, 6107, 6240, 6828, 0,
+		2715, 9689, 6594, 0, 0, 0, 6117, 1099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3677, 0, 0, 0,
+		0, 0, 0, 0, 0, 3276, 5114, 0, 0, 0, 6749, 1629, 0, 0, 0, 0, 0, 0, 2402, 0, 0, 0, 0, 465,
+		0, 9844, 0, 0, 0, 0, 0, 2779, 0, 0, 0, 0, 1382, 4489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 3339, 0, 0, 0, 9564, 0, 486, 2336, 0, 0, 0, 6298, 0, 0, 0, 0,
+		0, 0, 0, 0, 8090, 0, 3110, 5502, 0, 0, 0, 0, 0, 0, 6318, 0, 0, 5185, 9898, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1163, 4158, 0, 7302, 0, 8593, 0, 0, 4069, 8383, 0, 811, 0, 0, 0, 0, 0, 0,
+		0, 8540, 0, 0, 6371, 8601, 648, 9365, 0, 820, 0, 0, 5945, 0, 5669, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1954, 4947, 0, 0, 0, 605, 0, 0, 9576, 1804, 2609, 0, 0, 2880, 0, 245, 7570, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 5583, 7881, 0, 4639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7351, 0, 0, 0, 1375,
+		8858, 0, 3032, 0, 0, 2808, 5586, 0, 0, 0, 0, 0, 5071, 0, 8020, 2928, 8262, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 2210, 4875, 5703, 2019, 0, 0, 8194, 0, 0, 4068, 0, 0, 0, 0, 0, 0, 0, 0, 5985, 0, 2987,
+		4517, 0, 0, 0, 6658, 0, 0, 8711, 0, 0, 0, 2682, 0, 1365, 7339, 0, 0, 0, 1888, 0, 8168, 0, 0, 8245,
+		8206, 5121, 0, 0, 3300, 7982, 0, 4112, 384, 9754, 0, 3153, 8894, 0, 0, 0, 0, 502, 0, 0, 3208, 0, 0, 0,
+		0, 0, 7801, 2649, 2098, 9789, 0, 4082, 0, 0, 0, 0, 0, 0, 0, 0, 9952, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 3628, 0, 1967, 4974, 6545, 0, 0, 0, 7911, 7504, 0, 0, 1361, 2257, 0, 0, 0, 1123, 0, 0,
+		8388, 0, 0, 0, 0, 0, 6313, 7744, 0, 0, 0, 0, 0, 0, 0, 2202, 7422, 1436, 8067, 1594, 0, 0, 6868, 0,
+		0, 301, 1082, 7895, 4576, 0, 0, 3969, 0, 793, 5936, 254, 8951, 0, 5384, 0, 0, 0, 321, 7466, 4392, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5507, 8378, 0, 0, 9760, 1262, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4663, 0, 0, 0, 0, 0, 5432, 5851, 0, 4518, 5916, 0, 0, 0, 0, 9381,
+		0, 8158, 0, 0, 0, 0, 1078, 8111, 5387, 0, 2513, 0, 0, 0, 0, 1938, 0, 0, 0, 0, 0, 1708, 0, 0,
+		0, 0, 0, 0, 0, 4382, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2783, 0, 0, 1904,
+		8303, 8031, 0, 0, 6670, 0, 0, 0, 0, 0, 0, 0, 2982, 0, 0, 1213, 8476, 0, 0, 0, 0, 0, 3857, 6125,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2962, 0, 5315, 4428, 0, 0, 0, 8003, 3079, 0, 2502, 5372, 1539,
+		0, 5365, 1189, 7017, 3879, 0, 0, 0, 0, 0, 0, 0, 0, 3963, 2030, 1596, 0, 0, 0, 0, 827, 368, 0, 0,
+		0, 5248, 0, 0, 0, 0, 0, 0, 3214, 0, 5755, 0, 826, 0, 0, 5944, 3486, 0, 0, 5873, 3828, 0, 0, 8999,
+		7639, 0, 0, 8941, 0, 773, 7543, 9862, 0, 0, 0, 0, 0, 0, 6295, 0, 0, 0, 0, 0, 224, 5577, 75, 6287,
+		0, 0, 0, 0, 0, 3965, 0, 0, 5676, 5382, 0, 9232, 0, 0, 7436, 0, 0, 0, 8348, 0, 9881, 0, 0, 0,
+		0, 0, 0, 0, 0, 8777, 0, 0, 0, 0, 0, 0, 0, 0, 2355, 3312, 0, 0, 0, 0, 0, 0, 0, 0,
+		3957, 0, 0, 0, 0, 3233, 5692, 0, 4118, 0, 2260, 0, 0, 0, 1192, 6444, 0, 0, 0, 0, 0, 0, 0, 5491,
+		0, 0, 0, 0, 0, 0, 4091, 7599, 0, 0, 0, 3985, 6466, 0, 0, 0, 0, 0, 347, 0, 0, 0, 0, 0,
+		0, 0, 0, 1244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9511, 188, 9907, 0, 9913, 0, 0, 0, 0,
+		0, 0, 0, 0, 9641, 0, 5786, 2018, 4873, 8580, 0, 0, 0, 0, 0, 0, 0, 6357, 0, 0, 0, 3105, 0, 0,
+		7427, 3519, 0, 0, 0, 0, 0, 3629, 1786, 0, 2393, 6805, 2044, 4222, 7474, 0, 0, 0, 0, 9571, 0, 2092, 0, 3632,
+		3794, 0, 0, 0, 0, 0, 3308, 0, 9966, 8570, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 4324, 8120, 9215, 0,
+		0, 0, 0, 0, 4887, 7053, 9154, 0, 0, 0, 0, 0, 799, 6011, 0, 0, 0, 0, 370, 6062, 0, 0, 0, 8064,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5042, 0, 2378, 9176, 0, 0, 6997, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1466, 8837, 0, 6394, 8419, 7910, 8702, 9041, 9379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1961, 0, 0, 470, 6756, 7788, 5721, 0, 0, 7392, 0, 0, 0, 2819, 0, 0, 0, 0, 0, 0, 0, 0, 8811, 0,
+		0, 0, 0, 229, 0, 0, 0, 0, 7316, 7458, 0, 6702, 0, 0, 2071, 0, 0, 0, 0, 0, 169, 0, 0, 0,
+		0, 0, 0, 0, 9794, 0, 0, 0, 0, 9536, 9676, 2059, 6522, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 7704, 8355, 8000, 0, 0, 0, 8522, 251, 1960, 6513, 0, 0, 0, 0, 0, 0, 0, 4691, 0, 6337, 7217, 7475, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 3814, 0, 0, 0, 0, 0, 7873, 1872, 6285, 0, 0, 0, 0, 9106, 0, 0,
+		0, 0, 4543, 0, 0, 0, 0, 0, 5754, 0, 9098, 8655, 0, 0, 893, 1907, 6209, 0, 0, 0, 4553, 0, 5882, 0,
+		0, 0, 9000, 7962, 8494, 0, 0, 1306, 3001, 8569, 4734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 173,
+		0, 0, 0, 0, 0, 0, 7049, 0, 0, 9375, 0, 0, 5367, 1578, 8755, 836, 0, 0, 0, 0, 0, 0, 1120, 0,
+		2836, 3050, 7155, 9736, 0, 383, 0, 0, 0, 0, 0, 0, 0, 7647, 0, 0, 0, 0, 9557, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2399, 0, 0, 4853, 0, 0, 0, 0, 0, 0, 3768, 0, 7531, 0, 0, 0, 0, 0, 0, 4562,
+		8151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2495, 9463, 8769, 0, 0, 0, 0, 4485, 0, 638, 7537, 0,
+		0, 0, 5683, 0, 2080, 0, 4548, 0, 1325, 0, 6269, 8833, 0, 0, 0, 0, 8243, 0, 689, 6259, 0, 0, 0, 0,
+		0, 0, 0, 9269, 0, 748, 0, 0, 0, 5131, 5793, 0, 0, 1305, 0, 0, 0, 0, 9139, 0, 0, 0, 0, 0,
+		0, 3448, 0, 5537, 693, 6829, 940, 0, 0, 0, 0, 0, 4573, 0, 0, 0, 0, 0, 0, 2841, 0, 0, 7293, 0,
+		0, 0, 2514, 0, 0, 0, 0, 0, 0, 0, 0, 5285, 0, 0, 1173, 0, 0, 0, 0, 0, 4024, 4768, 0, 3966,
+		0, 0, 0, 0, 0, 0, 0, 0, 6902, 4149, 6962, 1861, 9089, 9648, 0, 808, 0, 0, 0, 9079, 0, 0, 0, 0,
+		6418, 787, 796, 1777, 6714, 8964, 5601, 0, 4773, 0, 0, 4739, 0, 0, 0, 0, 0, 4367, 0, 132, 9748, 0, 0, 0,
+		0, 2217, 2734, 7091, 8027, 0, 2275, 0, 1761, 0, 382, 0, 3129, 0, 2306, 0, 0, 201, 1003, 7907, 5891, 0, 0, 1800,
+		9612, 9723, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		5726, 0, 966, 0, 0, 0, 238, 0, 0, 0, 3796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7669, 2807, 0,
+		0, 762, 4168, 9875, 0, 0, 136, 0, 0, 0, 0, 0, 4788, 0, 0, 0, 4503, 0, 0, 389, 8228, 0, 0, 0,
+		0, 0, 0, 0, 0, 6130, 0, 0, 0, 0, 7372, 0, 0, 1473, 0, 0, 0, 0, 1406, 2425, 4175, 0, 0, 0,
+		0, 0, 7955, 688, 1038, 8949, 0, 2493, 9911, 0, 4383, 0, 0, 504, 0, 0, 0, 0, 0, 9699, 0, 0, 0, 0,
+		0, 0, 828, 0, 0, 0, 0, 0, 0, 4244, 0, 0, 0, 0, 0, 0, 8267, 0, 0, 0, 0, 5926, 0, 5028,
+		8275, 5896, 0, 0, 0, 0, 0, 0, 0, 0, 2187, 0, 0, 0, 548, 2965, 8295, 9431, 0, 8273, 0, 9085, 0, 8714,
+		7066, 7719, 0, 0, 0, 2680, 0, 3606, 0, 0, 0, 0, 0, 0, 0, 3143, 0, 0, 0, 0, 0, 1973, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8103, 0, 213, 9572, 0, 0, 0, 0, 0,
+		1927, 7380, 0, 0, 0, 0, 0, 0, 0, 1852, 1435, 0, 2182, 5762, 0, 0, 0, 0, 0, 0, 0, 69, 2698, 5290,
+		6757, 0, 0, 0, 6763, 0, 0, 0, 0, 0, 0, 8704, 0, 0, 0, 0, 0, 0, 3707, 0, 0, 0, 0, 0,
+		0, 0, 0, 8616, 0, 0, 0, 0, 0, 0, 0, 3237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3795, 430, 0,
+		4824, 0, 8167, 0, 0, 7, 0, 0, 0, 0, 2231, 0, 0, 0, 0, 1988, 0, 0, 0, 8774, 3591, 0, 0, 0,
+		0, 9788, 0, 0, 7648, 0, 0, 1505, 0, 0, 0, 0, 9968, 3638, 0, 0, 0, 340, 0, 0, 0, 0, 6267, 0,
+		0, 308, 0, 0, 6591, 3639, 7370, 0, 0, 0, 0, 9855, 0, 0, 0, 0, 0, 0, 0, 9063, 0, 0, 0, 0,
+		407, 0, 6296, 4902, 9597, 0, 0, 0, 0, 7042, 0, 0, 0, 0, 0, 0, 0, 6632, 0, 1083, 1030, 0, 0, 5369,
+		0, 0, 0, 236, 802, 5222, 0, 0, 0, 0, 0, 2531, 7024, 0, 0, 0, 0, 0, 3072, 0, 1609, 4625, 8281, 0,
+		0, 0, 0, 8019, 0, 0, 1644, 0, 2012, 0, 0, 0, 0, 2550, 0, 0, 0, 0, 0, 3416, 0, 0, 0, 5898,
+		0, 1107, 7864, 0, 0, 460, 5135, 0, 0, 4868, 0, 0, 0, 0, 6493, 0, 9802, 0, 3933, 0, 0, 0, 0, 8018,
+		0, 0, 4720, 4205, 9954, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5198, 6560, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 152, 0, 0, 0, 5790, 0, 5289, 9743, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 2785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2904, 4891, 4187, 2422, 0, 0, 0, 587, 0, 0, 0,
+		0, 0, 6609, 8533, 9217, 439, 0, 0, 0, 0, 5438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215, 8870, 9658, 0,
+		1585, 6236, 5648, 0, 0, 6257, 0, 0, 0, 549, 0, 0, 0, 804, 9407, 0, 4311, 387, 0, 9616, 872, 0, 8512, 0,
+		0, 4357, 7141, 0, 181, 3336, 0, 0, 0, 0, 8475, 654, 3195, 0, 0, 4685, 0, 0, 0, 0, 3246, 0, 0, 0,
+		6344, 7616, 6804, 0, 0, 231, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3913, 0, 0, 5325, 915, 0, 0, 0,
+		0, 0, 0, 3826, 0, 0, 0, 8485, 0, 0, 2725, 0, 0, 0, 4696, 0, 1363, 2000, 4958, 8571, 0, 0, 0, 0,
+		0, 0, 0, 583, 0, 0, 5614, 0, 0, 6660, 0, 6056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4883, 6561, 4107,
+		8776, 0, 0, 0, 0, 816, 0, 0, 0, 248, 1292, 5450, 8785, 0, 0, 6948, 9345, 4595, 0, 1394, 1600, 0, 0, 0,
+		4375, 900, 0, 0, 0, 0, 8760, 0, 1035, 2822, 0, 0, 0, 0, 45, 9785, 0, 0, 0, 0, 0, 1687, 2016, 0,
+		6597, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9617, 0, 0, 0, 0, 0, 493, 0, 0, 0, 2663,
+		0, 0, 0, 4414, 5257, 1831, 8374, 1421, 0, 0, 706, 2697, 0, 2566, 0, 4431, 0, 0, 0, 0, 3177, 2373, 4206, 0,
+		232, 0, 0, 0, 0, 351, 0, 0, 4282, 0, 6428, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 681,
+		3753, 0, 0, 0, 932, 2658, 0, 0, 0, 0, 9806, 0, 3545, 7058, 0, 0, 1154, 9210, 0, 0, 6731, 0, 0, 0,
+		0, 0, 5360, 3489, 0, 0, 227, 0, 0, 7007, 0, 0, 0, 7359, 0, 0, 0, 0, 0, 0, 8005, 0, 0, 0,
+		0, 0, 0, 1813, 0, 0, 5483, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8369, 0, 0, 0, 0, 3783, 7828,
+		7010, 0, 0, 0, 0, 0, 0, 0, 0, 7976, 3093, 4429, 0, 0, 0, 0, 8002, 0, 7513, 0, 68, 4512, 0, 0,
+		0, 0, 0, 5067, 0, 0, 5344, 0, 0, 0, 0, 2279, 0, 0, 0, 9848, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 7759, 0, 8898, 4192, 0, 2215, 2676, 0, 0, 0, 0, 7934, 4681, 2337, 7589, 6639, 0, 0, 0,
+		6985, 0, 9581, 0, 0, 0, 0, 0, 0, 2973, 0, 367, 0, 0, 1999, 8150, 0, 0, 0, 8199, 9189, 0, 0, 0,
+		1754, 3363, 6490, 0, 724, 0, 5330, 0, 0, 0, 0, 0, 733, 5398, 0, 0, 0, 0, 8738, 0, 0, 0, 0, 0,
+		0, 7230, 0, 4434, 0, 0, 0, 0, 0, 0, 0, 0, 545, 4171, 4976, 3547, 0, 8707, 0, 0, 0, 0, 0, 878,
+		5437, 9857, 0, 5962, 0, 0, 0, 0, 0, 0, 0, 7410, 8173, 9471, 0, 0, 0, 7157, 5034, 8861, 402, 0, 0, 7580,
+		8429, 4023, 8831, 0, 0, 6871, 0, 0, 318, 0, 1822, 0, 0, 0, 0, 2068, 0, 3915, 0, 0, 636, 5358, 5684, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3402, 0, 0, 0, 0, 0, 0, 0, 9023, 0, 0, 0,
+		0, 0, 2610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 646, 0, 0, 0, 0, 9967, 0, 0, 0, 0, 0, 4782, 2829, 1873, 0, 0, 0, 0, 0, 7523,
+		5461, 0, 0, 0, 1340, 0, 0, 0, 0, 0, 4423, 0, 0, 0, 0, 5176, 0, 0, 3799, 0, 0, 7390, 9531, 6252,
+		0, 0, 0, 6600, 0, 178, 8782, 0, 0, 5175, 0, 2739, 0, 0, 0, 0, 0, 0, 5976, 0, 0, 3821, 9795, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 5118, 0, 0, 0, 0, 700, 7131, 0, 0, 0, 0, 0, 0, 3546, 1278, 3229,
+		0, 0, 0, 2160, 0, 0, 0, 0, 0, 0, 8122, 4294, 5208, 8684, 0, 0, 0, 0, 6552, 0, 0, 0, 0, 0,
+		0, 0, 4005, 0, 0, 0, 0, 0, 1115, 0, 0, 0, 5568, 0, 4245, 0, 0, 0, 0, 0, 0, 7764, 0, 0,
+		0, 3789, 0, 0, 0, 0, 0, 2974, 0, 0, 0, 0, 0, 0, 0, 0, 753, 0, 0, 0, 0, 0, 0, 4271,
+		864, 7869, 0, 1419, 282, 2795, 0, 4093, 0, 6669, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1469, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 5876, 7104, 7927, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7568, 0, 0, 3155, 0, 0, 0,
+		0, 5410, 0, 0, 0, 2553, 0, 0, 0, 8503, 276, 0, 0, 6989, 0, 0, 6540, 0, 0, 0, 8740, 4651, 0, 8819,
+		0, 0, 9446, 6548, 9518, 539, 0, 0, 0, 0, 6480, 0, 2462, 0, 0, 0, 0, 0, 0, 1826, 0, 0, 0, 0,
+		8042, 0, 3384, 0, 0, 0, 0, 0, 9368, 8083, 8816, 7033, 0, 0, 0, 8566, 0, 0, 6077, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 810, 3850, 0, 0, 0, 0, 0, 5440, 8928, 0, 4912, 0, 0, 0, 0, 0,
+		6157, 0, 0, 0, 0, 0, 1586, 0, 0, 482, 8087, 1343, 0, 0, 9373, 415, 0, 0, 3550, 5556, 9205, 0, 0, 0,
+		8969, 6040, 0, 0, 2735, 6631, 945, 0, 9335, 0, 2314, 5857, 0, 0, 7783, 0, 4888, 5901, 0, 1145, 8148, 4373, 0, 542,
+		0, 0, 0, 0, 0, 5226, 3016, 5789, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9823, 0, 8411,
+		5357, 0, 0, 0, 8463, 4620, 0, 0, 1661, 6877, 7026, 4309, 0, 3716, 0, 0, 0, 2287, 0, 1685, 0, 0, 6286, 0,
+		7929, 4218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5713, 7304, 0,
+		0, 3836, 6785, 0, 1277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 0, 0, 2095, 0, 0,
+		4858, 3859, 393, 5089, 9542, 0, 0, 0, 0, 3908, 0, 0, 8775, 0, 0, 8709, 0, 7229, 0, 6116, 0, 7696, 0, 0,
+		0, 6138, 0, 0, 0, 0, 0, 0, 4898, 0, 0, 0, 0, 0, 4533, 8788, 4844, 0, 0, 0, 0, 8231, 8244, 192,
+		3541, 9223, 0, 0, 0, 0, 2578, 0, 0, 0, 0, 0, 5075, 0, 0, 5388, 0, 0, 0, 6055, 0, 0, 0, 971,
+		0, 0, 0, 3131, 1258, 7247, 9563, 0, 0, 9392, 354, 6983, 0, 0, 4303, 3704, 783, 7022, 0, 0, 0, 0, 0, 0,
+		0, 0, 4982, 0, 0, 0, 0, 0, 0, 0, 6517, 0, 2240, 8448, 6746, 8109, 0, 0, 3561, 0, 0, 0, 0, 0,
+		0, 0, 5495, 0, 4565, 0, 8952, 0, 1275, 0, 0, 3134, 0, 769, 0, 896, 7827, 0, 5276, 5730, 0, 0, 0, 0,
+		8350, 7068, 0, 865, 7745, 0, 8297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2911, 0, 0, 5685, 0, 0,
+		0, 0, 0, 0, 0, 3504, 0, 0, 5917, 8618, 9864, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5544, 0, 1158,
+		0, 0, 0, 0, 0, 0, 3967, 0, 2331, 0, 0, 0, 6360, 0, 0, 0, 0, 0, 3984, 0, 0, 4056, 82, 2869,
+		7784, 0, 0, 674, 0, 0, 0, 1069, 0, 0, 0, 0, 0, 6854, 0, 8916, 0, 0, 0, 0, 0, 702, 5245, 2266,
+		0, 0, 0, 2564, 0, 0, 0, 0, 0, 4637, 0, 0, 3874, 9895, 0, 9093, 4989, 0, 0, 2802, 0, 9665, 0, 0,
+		0, 7011, 0, 0, 4584, 0, 0, 9685, 0, 0, 0, 0, 0, 0, 3423, 0, 0, 7498, 738, 0, 1983, 0, 0, 0,
+		0, 7998, 0, 0, 0, 0, 3047, 4743, 0, 0, 0, 0, 7793, 0, 0, 0, 5766, 0, 0, 0, 0, 3556, 0, 6183,
+		0, 0, 0, 0, 3926, 0, 0, 0, 0, 0, 0, 1511, 0, 0, 0, 0, 0, 0, 0, 2188, 0, 0, 6588, 3151,
+		1850, 0, 0, 7937, 8253, 0, 0, 6235, 0, 0, 0, 0, 4610, 972, 330, 0, 0, 183, 6679, 8198, 7707, 8232, 9119, 5128,
+		0, 0, 7397, 5353, 240, 1260, 0, 0, 0, 0, 0, 0, 9017, 0, 0, 0, 0, 0, 0, 0, 0, 4718, 0, 0,
+		4008, 0, 1191, 1016, 4729, 5635, 0, 0, 0, 0, 0, 4657, 0, 8667, 578, 4447, 0, 3824, 0, 0, 0, 0, 0, 8761,
+		0, 4241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4181, 1718, 3132, 0, 3231, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 8859, 4083, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 5422, 0, 834, 0, 4032, 0, 0, 8701, 0,
+		5381, 0, 0, 1597, 0, 0, 1499, 0, 8879, 3014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 8291, 0, 0, 0, 0, 0, 0, 39, 3804, 0, 0, 0, 734, 8536, 4986, 5742, 1878, 5861, 0, 0,
+		2631, 0, 0, 8794, 0, 0, 9209, 0, 3881, 0, 0, 0, 0, 0, 0, 8118, 5079, 0, 0, 0, 5295, 0, 0, 7078,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8043, 346, 2618, 0, 6339, 3552, 0, 8524,
+		0, 0, 0, 0, 0, 0, 1368, 0, 0, 0, 0, 0, 0, 0, 0, 246, 0, 0, 0, 5433, 0, 0, 3128, 0,
+		0, 0, 0, 0, 0, 3699, 855, 0, 0, 0, 0, 180, 4453, 4500, 6366, 8957, 0, 0, 4115, 0, 0, 0, 0, 6024,
+		0, 0, 0, 4176, 9737, 7868, 0, 0, 0, 0, 0, 0, 6849, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6217, 0, 0, 0, 9657, 8249, 0, 1282, 26, 6504, 0, 0, 0, 0, 0, 8433, 0, 0, 0, 0, 0, 4839, 0, 5110,
+		0, 0, 956, 0, 0, 0, 0, 0, 0, 6909, 7536, 0, 0, 0, 6758, 0, 0, 2186, 1294, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 969, 2949, 2620, 2988, 9632, 0, 0, 8633, 0, 0, 0, 0, 0, 0, 2020, 0, 0, 0, 0, 0,
+		0, 0, 7440, 5671, 9155, 0, 0, 0, 0, 2787, 0, 0, 0, 0, 0, 0, 3076, 4822, 0, 0, 0, 5142, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7189, 0, 0, 0, 0, 0, 0, 0, 0, 9352, 0, 0, 0, 0,
+		0, 0, 0, 9663, 0, 0, 8968, 2032, 0, 0, 0, 1228, 0, 3524, 5689, 0, 9309, 0, 0, 0, 0, 5652, 5879, 0,
+		0, 7694, 0, 0, 0, 0, 0, 2008, 0, 0, 0, 0, 6570, 795, 9709, 0, 0, 324, 0, 0, 0, 0, 0, 0,
+		3147, 7246, 0, 0, 0, 0, 5345, 0, 5094, 0, 7988, 0, 0, 2858, 3784, 0, 0, 0, 0, 1487, 5030, 0, 0, 0,
+		0, 0, 8136, 0, 0, 0, 0, 8825, 4422, 0, 0, 665, 5092, 5364, 0, 0, 0, 7533, 9333, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 5415, 0, 0, 1567, 1455, 6856, 9025, 0, 0, 0, 9886, 4409, 6766, 0, 0, 3225, 3781,
+		4795, 0, 0, 1517, 3393, 5919, 0, 0, 0, 0, 5409, 0, 9, 0, 6196, 8925, 0, 0, 9331, 0, 3277, 0, 2815, 0,
+		0, 0, 7219, 1534, 0, 0, 0, 0, 1527, 0, 0, 0, 3145, 0, 0, 0, 7469, 0, 0, 0, 4717, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1241, 0, 0, 0, 0, 0, 0, 0, 0, 3180, 0, 0, 5649,
+		0, 0, 0, 6441, 3347, 6380, 0, 6524, 0, 0, 0, 0, 8534, 0, 0, 0, 6118, 0, 0, 3719, 5807, 0, 777, 0,
+		846, 7876, 5933, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4143, 7285, 857, 3803, 4979, 0, 9173, 0, 0, 1942,
+		0, 0, 0, 0, 0, 0, 0, 4306, 0, 8041, 0, 0, 0, 0, 6106, 0, 5238, 0, 0, 0, 0, 7008, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1256, 856, 4298, 0, 0, 0, 0, 0, 0, 0, 2172, 7723, 0, 0, 6819, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4235, 0, 0, 0, 0, 0, 7110, 0, 0, 0, 5643, 2316, 2606,
+		4226, 4457, 9172, 0, 0, 0, 9022, 0, 0, 1794, 4441, 1420, 0, 0, 0, 0, 0, 0, 5348, 8409, 0, 0, 0, 0,
+		287, 3766, 0, 5613, 0, 0, 2394, 3834, 0, 0, 6299, 0, 0, 0, 0, 0, 0, 0, 8660, 6101, 0, 0, 0, 0,
+		0, 0, 0, 7209, 0, 0, 0, 0, 0, 0, 1512, 3929, 9048, 0, 0, 0, 0, 0, 2914, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 8885, 2381, 0, 0, 6572, 3752, 7555, 0, 2633, 0, 0, 0, 0, 3734, 9294, 2025,
+		0, 0, 7133, 0, 0, 0, 0, 0, 0, 0, 4861, 0, 0, 0, 0, 7314, 0, 1763, 5628, 0, 4225, 0, 0, 0,
+		1880, 2871, 1995, 9040, 0, 0, 0, 6999, 9287, 0, 0, 923, 1624, 2131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 290, 0, 0, 2849,
+		0, 0, 7970, 0, 5023, 0, 5328, 0, 0, 0, 0, 0, 0, 0, 6112, 0, 2476, 6254, 7792, 4224, 9606, 0, 0, 0,
+		0, 1820, 0, 0, 0, 0, 0, 0, 0, 4936, 5056, 4926, 431, 0, 0, 0, 0, 2811, 1650, 0, 6747, 744, 3309, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2328, 0, 0, 0, 0, 2379, 0, 0, 3081, 3303, 7534, 9024, 0, 0, 0,
+		0, 4539, 0, 0, 0, 0, 0, 0, 0, 1997, 0, 6637, 4761, 0, 1795, 0, 1936, 0, 0, 0, 7743, 5292, 0, 0,
+		0, 8026, 7420, 7343, 8412, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8939, 0, 0, 0,
+		9846, 0, 0, 0, 0, 0, 0, 505, 0, 0, 0, 9703, 0, 0, 0, 0, 0, 7503, 9438, 0, 0, 0, 740, 9104,
+		0, 0, 7863, 2120, 519, 0, 0, 0, 0, 0, 7239, 3003, 0, 0, 0, 0, 0, 0, 0, 8052, 7604, 0, 0, 0,
+		0, 2386, 0, 0, 7375, 0, 7267, 2745, 0, 0, 5982, 5942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 377, 4845, 4104,
+		9178, 0, 0, 0, 0, 0, 0, 1128, 0, 0, 0, 0, 0, 0, 5886, 0, 6256, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4841, 4968, 0, 0, 0, 3500, 6615, 8211, 0, 0, 852, 0, 0, 0, 0, 0, 0, 6901, 0, 0, 0, 0,
+		0, 6072, 0, 0, 4170, 0, 0, 0, 0, 0, 0, 0, 3979, 0, 9096, 0, 2193, 3954, 0, 0, 0, 0, 0, 0,
+		0, 0, 2344, 5183, 7715, 0, 0, 0, 0, 6090, 8729, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4330, 1892,
+		0, 0, 0, 0, 4166, 0, 8440, 0, 3886, 0, 4775, 3232, 6021, 7233, 5408, 848, 0, 0, 0, 0, 4677, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 7251, 664, 9537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3792,
+		0, 0, 9072, 2124, 0, 0, 0, 0, 0, 0, 0, 7803, 0, 0, 0, 0, 0, 0, 0, 0, 274, 0, 1211, 9625,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4799, 2441, 0, 1798, 5623, 260, 0, 1458,
+		9321, 9340, 8993, 7367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 6158, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6074, 0, 0, 0, 0, 1045, 0, 0, 0, 6402, 0, 0, 0, 284,
+		8038, 0, 0, 0, 0, 0, 0, 2285, 0, 0, 0, 0, 0, 0, 4344, 0, 571, 9749, 0, 0, 708, 0, 0, 0,
+		0, 0, 0, 0, 9561, 9958, 0, 0, 0, 0, 9307, 0, 0, 0, 2294, 2076, 1925, 0, 0, 0, 0, 0, 0, 0,
+		0, 9659, 607, 8112, 0, 0, 0, 0, 0, 5769, 0, 7124, 2727, 8962, 9417, 0, 0, 1356, 0, 0, 0, 2594, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2033, 5439, 0, 0, 0, 0, 0, 0, 2359, 2405, 2600, 4815, 0, 0, 3242,
+		0, 0, 4377, 0, 0, 5731, 0, 0, 0, 0, 0, 0, 0, 4695, 0, 50, 0, 0, 1898, 6970, 0, 0, 0, 0,
+		0, 0, 92, 6179, 0, 2455, 0, 0, 0, 0, 0, 0, 0, 0, 2637, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4159, 0, 0, 0, 9575, 9053, 0, 6491, 6704, 0, 0, 0, 0, 0, 9888, 0, 0, 0, 2282, 0, 0, 0, 0,
+		0, 2721, 0, 7034, 758, 0, 0, 0, 9635, 0, 0, 0, 0, 0, 5947, 0, 6137, 0, 0, 933, 0, 7286, 7308, 0,
+		0, 0, 0, 879, 0, 8119, 0, 0, 0, 5313, 1135, 0, 1341, 0, 6192, 0, 0, 6221, 530, 4527, 2820, 7097, 8953, 0,
+		0, 0, 0, 1566, 0, 9871, 0, 0, 0, 0, 6442, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4949, 0, 1307, 3238, 0, 0, 0, 1715, 0, 0, 0, 3322, 0, 1412, 4483, 0, 2688, 0, 0, 7826, 0,
+		3721, 0, 0, 4028, 9408, 0, 0, 5531, 0, 4532, 0, 0, 0, 1847, 0, 3808, 0, 0, 0, 0, 0, 0, 7867, 0,
+		0, 4347, 0, 1483, 0, 0, 311, 0, 0, 0, 6690, 0, 0, 0, 0, 0, 0, 2823, 0, 0, 7015, 0, 0, 0,
+		0, 4985, 1914, 7482, 0, 1426, 219, 0, 0, 0, 0, 0, 0, 0, 0, 2666, 5636, 1400, 1319, 0, 8319, 0, 1100, 0,
+		0, 1477, 9866, 9928, 4219, 6814, 8587, 0, 0, 0, 0, 2437, 6030, 7806, 0, 0, 0, 6479, 337, 0, 9587, 0, 0, 0,
+		9716, 0, 0, 0, 1053, 8223, 0, 0, 7185, 0, 0, 1383, 0, 0, 0, 7169, 0, 179, 0, 3119, 8183, 9858, 0, 5594,
+		0, 0, 0, 9060, 0, 8992, 5247, 8847, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3537, 0,
+		0, 5858, 8537, 2582, 4827, 1929, 8645, 5862, 0, 2516, 0, 0, 0, 9570, 0, 3471, 0, 5312, 5696, 0, 0, 6350, 0, 1855,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8321, 8977, 5925, 659, 8588, 0, 0, 0, 0, 6958, 1802, 8034, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4293, 0, 0, 0, 6115, 154, 3823, 0, 0, 0, 1792, 0,
+		0, 0, 0, 0, 0, 1471, 4635, 6429, 1710, 0, 0, 0, 5796, 9965, 6325, 0, 0, 0, 0, 0, 7965, 9700, 0, 0,
+		8110, 0, 5401, 2290, 0, 0, 0, 1691, 4478, 0, 0, 0, 0, 3718, 0, 0, 0, 0, 0, 0, 0, 116, 4510, 0,
+		9251, 0, 650, 1007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9414, 9547, 0, 0, 0, 5132, 0, 8271, 0, 2677, 0,
+		0, 0, 0, 0, 0, 0, 3713, 2447, 3952, 6135, 0, 0, 0, 0, 1673, 0, 0, 0, 0, 0, 0, 0, 0, 1572,
+		0, 0, 0, 0, 2463, 0, 0, 0, 0, 0, 5573, 0, 3020, 9751, 0, 0, 0, 0, 0, 0, 4358, 0, 0, 0,
+		0, 237, 0, 0, 0, 6903, 0, 0, 278, 0, 0, 7077, 0, 1401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 3327, 0, 0, 0, 0, 507, 1147, 4090, 1698, 7378, 0, 0, 0, 0, 3182, 1133,
+		6140, 7958, 9683, 567, 0, 0, 0, 4966, 0, 7428, 0, 0, 0, 0, 0, 0, 0, 9497, 0, 0, 0, 0, 0, 6879,
+		0, 0, 0, 0, 0, 0, 0, 1919, 6019, 0, 0, 0, 0, 0, 6673, 6047, 7975, 0, 4899, 0, 9295, 0, 0, 5950,
+		635, 3865, 0, 0, 7394, 4002, 9289, 0, 0, 0, 2687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 5130, 7564, 0, 0, 0, 8329, 0, 0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4075, 8316, 9436, 0, 0,
+		0, 0, 0, 1655, 0, 0, 0, 0, 0, 0, 0, 6750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 8203, 3321, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5717, 0, 9280, 0,
+		0, 0, 0, 0, 0, 0, 4439, 1072, 0, 0, 5349, 3772, 0, 0, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0,
+		1564, 443, 1581, 9317, 8147, 2833, 8493, 9113, 0, 0, 0, 0, 0, 0, 0, 0, 5020, 5127, 0, 2674, 3899, 0, 0, 0,
+		0, 4314, 5680, 0, 5880, 7699, 0, 0, 0, 3756, 0, 0, 745, 0, 2686, 0, 7870, 7274, 0, 0, 1846, 0, 0, 0,
+		6314, 1051, 6607, 0, 1181, 297, 8351, 9937, 7346, 275, 3760, 0, 6858, 0, 0, 0, 0, 0, 5333, 2864, 8520, 0, 0, 0,
+		0, 0, 696, 9901, 0, 8157, 3931, 0, 0, 1599, 6762, 0, 8792, 9812, 0, 4285, 0, 0, 0, 0, 176, 3968, 6412, 4798,
+		8676, 0, 0, 0, 3170, 0, 0, 8352, 0, 0, 0, 0, 0, 186, 0, 7305, 0, 8713, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5126, 0, 0, 0, 0, 6004, 5924, 0, 0, 0, 0, 0,
+		2890, 6410, 0, 0, 0, 991, 4217, 0, 0, 0, 4450, 0, 0, 0, 0, 0, 0, 7875, 9559, 0, 0, 2902, 0, 0,
+		0, 0, 0, 0, 0, 0, 1229, 1793, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9187, 0, 5018,
+		0, 0, 0, 8746, 89, 0, 0, 3530, 0, 0, 0, 8886, 7619, 0, 6361, 4035, 8053, 1503, 9799, 0, 6697, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 9842, 0, 1816, 3373, 1693, 4879, 0, 0, 0, 0, 6087, 0, 0, 7553, 0, 5607, 0, 0,
+		0, 0, 0, 0, 0, 0, 7644, 3046, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3604, 0, 7748, 0,
+		0, 0, 1141, 2439, 3656, 3740, 558, 8277, 0, 0, 7878, 0, 0, 6777, 6973, 98, 0, 2705, 0, 0, 0, 851, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 6385, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 5930, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7575, 1263, 44, 0, 1410, 0, 0, 0, 0, 0,
+		0, 0, 7281, 0, 0, 0, 0, 0, 0, 1461, 0, 7508, 0, 7476, 0, 1555, 7509, 9174, 7941, 7056, 0, 0, 0, 1079,
+		0, 0, 3175, 7866, 0, 3044, 4925, 0, 0, 0, 0, 6838, 0, 0, 0, 9639, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 9962, 0, 0, 1084, 1239, 0, 0, 0, 0, 0, 3761, 0, 0, 0, 0, 0, 166,
+		302, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1493, 0, 0, 0, 4099, 0, 0, 0, 0, 0, 2723, 0, 0, 4039, 3710, 5037, 8796, 0, 0, 563, 4006, 4943, 0,
+		0, 0, 0, 0, 0, 0, 4038, 7528, 0, 0, 9304, 0, 0, 0, 0, 0, 8978, 497, 8036, 0, 1726, 8810, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9879, 0, 0, 0, 0, 7728, 0, 4803, 0, 7088, 0, 0, 0, 0,
+		0, 5518, 0, 0, 0, 0, 0, 0, 0, 9401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 6687, 7171, 7585, 0, 0, 0, 0, 0, 0, 0, 0, 5850, 0, 1188, 4944, 0,
+		9194, 4820, 0, 0, 1430, 4596, 0, 0, 0, 4856, 0, 7701, 0, 0, 0, 0, 0, 0, 0, 0, 4737, 6722, 0, 4448,
+		6417, 0, 0, 2712, 0, 9947, 0, 0, 3515, 4551, 0, 0, 3746, 0, 0, 0, 0, 0, 6727, 0, 0, 1823, 0, 0,
+		0, 0, 8922, 0, 0, 0, 0, 0, 0, 0, 1214, 3535, 0, 0, 9614, 0, 7337, 0, 0, 0, 3956, 0, 0, 0,
+		390, 0, 0, 0, 1098, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 510, 0, 0, 0, 0, 0, 6413, 7253,
+		0, 4079, 7656, 7411, 0, 0, 0, 0, 0, 0, 0, 7227, 0, 0, 0, 6932, 0, 0, 8920, 0, 194, 0, 0, 0,
+		0, 0, 3940, 0, 0, 1152, 0, 6052, 0, 0, 0, 0, 0, 4526, 8965, 9856, 0, 0, 0, 0, 0, 0, 0, 0,
+		889, 1894, 0, 0, 0, 7478, 517, 0, 6249, 6375, 7156, 0, 0, 3357, 9015, 0, 0, 7038, 0, 310, 0, 0, 0, 3732,
+		7123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8614, 0, 0, 0, 5152, 8312, 6152, 9884, 0, 6628,
+		0, 0, 0, 0, 0, 0, 7073, 0, 0, 0, 0, 0, 0, 0, 0, 322, 687, 866, 3843, 6862, 9226, 1021, 0, 0,
+		0, 4777, 0, 0, 3901, 0, 2634, 0, 0, 9166, 0, 0, 0, 2235, 660, 0, 1563, 2219, 0, 0, 5213, 0, 0, 0,
+		806, 0, 0, 90, 9376, 4421, 5307, 8288, 0, 7716, 0, 0, 0, 0, 0, 0, 1402, 0, 8301, 0, 0, 0, 4116, 0,
+		4364, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 6791, 0, 0, 9784, 4488, 6226, 7412,
+		0, 0, 0, 5419, 0, 0, 0, 0, 0, 4267, 6685, 0, 0, 0, 8991, 566, 9216, 9388, 0, 0, 2112, 4341, 0, 0,
+		9861, 0, 910, 5029, 0, 0, 1560, 0, 0, 0, 2941, 4652, 5725, 5900, 0, 1342, 5008, 5948, 661, 4318, 6190, 0, 5331, 0,
+		0, 0, 0, 0, 440, 0, 6315, 0, 0, 0, 0, 547, 0, 0, 0, 1711, 0, 0, 0, 6268, 7416, 7611, 8961, 0,
+		0, 0, 0, 0, 4830, 0, 0, 0, 0, 0, 9588, 0, 0, 0, 0, 9384, 0, 0, 0, 0, 0, 4302, 4941, 7532,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9319, 9836, 0, 0, 0, 5778, 0, 0,
+		4180, 9311, 4208, 0, 0, 0, 0, 4583, 0, 0, 0, 418, 8691, 0, 1808, 5334, 0, 0, 2834, 9112, 0, 0, 0, 9902,
+		4693, 3640, 0, 4519, 0, 0, 0, 0, 0, 3513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4870, 5394, 0,
+		0, 0, 0, 0, 5264, 0, 0, 0, 7857, 6097, 6177, 9740, 0, 0, 0, 0, 0, 1248, 2656, 8084, 7454, 0, 0, 0,
+		0, 0, 1990, 0, 0, 5429, 0, 0, 2616, 9568, 0, 7357, 0, 0, 9488, 6391, 849, 0, 0, 6506, 0, 6681, 8525, 0,
+		4945, 5204, 0, 0, 0, 7925, 0, 0, 3223, 0, 7608, 0, 4881, 6069, 4996, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 3172, 0, 7413, 0, 0, 5133, 0, 0, 0, 719, 3024, 0, 0, 4606, 3564, 0, 0, 0, 0, 0,
+		0, 0, 0, 1457, 0, 0, 501, 2376, 0, 0, 0, 0, 9852, 0, 509, 3210, 414, 0, 0, 0, 0, 0, 3451, 0,
+		0, 0, 0, 2223, 9409, 0, 0, 0, 0, 0, 3447, 0, 0, 1589, 0, 0, 3367, 5390, 0, 0, 0, 0, 527, 0,
+		5155, 0, 0, 1298, 0, 0, 0, 0, 0, 0, 8869, 0, 0, 0, 0, 0, 0, 491, 4774, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 961, 0, 0, 0, 0, 0, 0, 5058, 4646, 328, 0, 0, 0, 0, 0,
+		0, 6338, 0, 0, 0, 0, 0, 0, 1057, 0, 0, 6865, 0, 0, 3409, 8668, 4679, 8715, 0, 5082, 0, 0, 3475, 0,
+		0, 0, 0, 6178, 0, 6797, 0, 0, 0, 0, 0, 8265, 9198, 0, 0, 0, 0, 0, 0, 1617, 0, 0, 0, 3575,
+		8621, 0, 0, 0, 0, 0, 0, 0, 0, 2963, 0, 0, 0, 0, 0, 7519, 8887, 5146, 2181, 4194, 7278, 6729, 1746, 0,
+		0, 0, 0, 0, 0, 4234, 0, 850, 1547, 2469, 7724, 5587, 0, 7579, 7808, 0, 0, 4590, 2886, 0, 0, 3568, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 4200, 4443, 0, 0, 0, 8496, 0, 0, 0, 0, 0, 8427, 0, 0, 3988,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 554, 0, 0, 0, 0, 49, 0, 6623, 0, 5547,
+		3422, 0, 0, 0, 0, 0, 6280, 9558, 0, 7823, 7893, 9124, 4753, 0, 0, 0, 0, 0, 2670, 1525, 2288, 2327, 0, 8202,
+		3695, 6184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8349, 0, 0, 2647, 0, 0, 0, 0, 0, 1397, 0,
+		5805, 0, 8963, 0, 4771, 6477, 9546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3709, 0, 5914, 1818, 4810, 5073, 0,
+		0, 0, 1695, 0, 0, 0, 536, 0, 4387, 0, 0, 0, 0, 0, 0, 0, 1598, 5243, 0, 0, 0, 0, 1169, 2518,
+		0, 0, 0, 0, 7627, 8514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1550, 0, 1575, 2881,
+		7013, 9356, 0, 0, 1166, 5445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3786, 0, 0, 0, 0, 0,
+		7956, 0, 0, 8163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3687, 8129, 3197, 6205, 0, 220, 7074,
+		0, 5321, 0, 0, 0, 5911, 0, 0, 0, 0, 0, 0, 7287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7693, 0,
+		0, 0, 5311, 6187, 5508, 6553, 7722, 4098, 6096, 0, 0, 5653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7332, 7946, 0,
+		0, 3452, 0, 0, 0, 0, 882, 0, 0, 0, 0, 4792, 0, 0, 0, 0, 0, 0, 0, 6302, 0, 0, 0, 0,
+		0, 0, 0, 4563, 0, 400, 0, 8745, 0, 3607, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 6330, 0, 0, 2090, 5040, 6642, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1827, 336, 0, 1179,
+		3428, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9377, 0, 6853, 1478, 0, 7844, 3730, 0,
+		0, 0, 0, 0, 5424, 8366, 0, 0, 0, 0, 0, 0, 0, 3204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		7952, 7245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4399, 0, 1119, 4455, 6925, 8903, 0, 0, 0, 1331,
+		2525, 3216, 0, 0, 0, 3313, 0, 0, 0, 0, 9758, 0, 0, 0, 0, 0, 8306, 0, 0, 2041, 8891, 4967, 0, 0,
+		0, 0, 0, 0, 0, 0, 2206, 7805, 0, 0, 0, 4706, 3026, 9014, 0, 0, 0, 0, 6094, 0, 0, 0, 0, 0,
+		5301, 0, 801, 0, 0, 560, 7356, 2155, 5582, 4809, 9212, 0, 6322, 2345, 8011, 9605, 0, 553, 2539, 0, 0, 0, 8156, 0,
+		0, 6111, 0, 552, 0, 0, 0, 0, 0, 5326, 0, 0, 0, 48, 720, 4916, 9234, 3860, 0, 0, 0, 0, 0, 2203,
+		0, 0, 0, 3691, 0, 6294, 0, 0, 120, 0, 0, 5293, 0, 7435, 0, 6707, 7944, 2758, 0, 0, 0, 185, 2524, 4012,
+		0, 0, 0, 2900, 0, 0, 537, 0, 6927, 0, 6579, 6172, 2613, 3831, 0, 0, 0, 0, 8345, 0, 0, 6601, 0, 3173,
+		0, 0, 0, 0, 0, 0, 0, 9030, 0, 0, 0, 0, 1911, 0, 2057, 0, 2106, 8330, 0, 0, 0, 0, 4972, 0,
+		0, 0, 0, 0, 7020, 0, 0, 4186, 3159, 0, 0, 0, 3805, 3135, 6525, 0, 0, 0, 0, 1618, 271, 0, 0, 0,
+		0, 0, 9435, 0, 0, 1637, 3567, 0, 9970, 0, 0, 0, 0, 5922, 6213, 8548, 8744, 0, 0, 0, 0, 0, 9245, 0,
+		4404, 0, 0, 0, 0, 0, 3441, 0, 3493, 0, 0, 0, 0, 0, 4997, 0, 0, 0, 6167, 0, 3692, 0, 0, 0,
+		0, 0, 265, 0, 2510, 2632, 6399, 0, 6668, 0, 0, 3332, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9065, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2209, 3221, 8975, 0, 0, 0, 0, 5612, 2465, 3029, 3958, 0, 0,
+		7079, 0, 0, 0, 3478, 0, 0, 8646, 4497, 888, 0, 0, 0, 0, 6352, 0, 3459, 8204, 0, 0, 0, 0, 6309, 0,
+		0, 0, 4572, 1551, 0, 0, 0, 0, 0, 0, 0, 0, 1614, 2762, 0, 0, 0, 0, 2557, 0, 1890, 0, 0, 0,
+		0, 0, 8657, 0, 0, 0, 0, 0, 0, 0, 7886, 0, 0, 6732, 5578, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7031, 0, 0, 8818, 0, 0, 0, 0, 0, 6065, 1443, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 2052, 0, 5434, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2179, 0,
+		0, 7858, 0, 0, 2263, 4800, 5199, 6612, 0, 0, 0, 8636, 0, 0, 0, 0, 0, 0, 0, 4725, 9320, 0, 1136, 6482,
+		8140, 0, 3819, 0, 3235, 0, 7967, 0, 0, 0, 0, 0, 2915, 3324, 0, 0, 0, 5385, 0, 0, 0, 0, 0, 5562,
+		0, 7195, 9721, 576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7449, 0, 0, 0, 0, 0, 0, 6289, 0, 0, 9725,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 1076, 7148, 1649, 1102, 0, 1978, 652, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 556, 0, 4933, 0, 0, 53, 0, 5200, 0, 5956, 0, 0, 0, 0, 0, 0, 3284, 0,
+		0, 0, 0, 4100, 0, 7796, 4278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1479, 0, 0, 6736, 8397, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1994, 9285, 0, 0, 0, 0, 0, 8300, 0, 8529, 0, 0, 1965, 5443, 0, 0, 0, 0,
+		0, 5414, 0, 2050, 0, 0, 6957, 0, 0, 0, 0, 0, 4086, 1218, 4477, 0, 0, 0, 0, 0, 5444, 0, 0, 5447,
+		0, 7833, 8538, 0, 0, 0, 7981, 1932, 0, 7847, 0, 0, 0, 0, 2195, 9350, 9360, 9741, 7601, 0, 0, 0, 0, 5854,
+		0, 0, 0, 0, 0, 0, 6725, 3747, 0, 0, 1101, 2158, 5451, 6833, 7752, 0, 997, 1357, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 7674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9421, 3113, 0, 3872, 0, 7262, 0, 0, 3696,
+		0, 0, 0, 0, 0, 6604, 0, 0, 0, 0, 0, 0, 1348, 0, 2768, 0, 901, 0, 0, 884, 0, 0, 0, 0,
+		0, 0, 0, 3349, 3596, 6425, 0, 0, 0, 0, 0, 0, 5177, 5265, 0, 3104, 0, 0, 0, 0, 6904, 5542, 0, 4973,
+		0, 0, 0, 0, 0, 0, 0, 0, 4864, 0, 0, 0, 0, 1876, 0, 0, 5991, 0, 0, 0, 0, 0, 0, 7640,
+		0, 0, 0, 3450, 4530, 5806, 9278, 0, 4977, 0, 8561, 0, 0, 2382, 0, 8535, 0, 0, 0, 0, 0, 0, 0, 0,
+		3733, 5469, 3017, 0, 0, 0, 0, 0, 0, 0, 0, 2242, 0, 4462, 0, 0, 0, 0, 0, 0, 2055, 5400, 0, 0,
+		0, 0, 9265, 0, 7526, 6598, 2127, 0, 0, 0, 2964, 8311, 0, 0, 0, 7507, 0, 0, 0, 0, 6672, 0, 0, 0,
+		1835, 3099, 0, 4424, 3419, 0, 0, 0, 7301, 0, 506, 0, 0, 0, 0, 0, 0, 0, 3517, 0, 0, 0, 9105, 0,
+		0, 5737, 8556, 5266, 6994, 0, 8926, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5308, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 5722, 0, 0, 1012, 4903, 125, 4403, 0, 0, 2388, 0, 5371, 7012, 8391, 0,
+		0, 0, 0, 0, 755, 0, 0, 0, 0, 0, 0, 2667, 0, 0, 0, 0, 0, 4053, 9701, 0, 0, 0, 0, 0,
+		2740, 3465, 0, 0, 0, 7326, 9619, 0, 3613, 0, 0, 0, 0, 0, 2863, 1059, 0, 0, 6343, 5026, 9314, 0, 2315, 0,
+		0, 0, 764, 3994, 5395, 0, 1249, 4418, 0, 0, 0, 0, 4270, 6270, 4374, 76, 5485, 8420, 5811, 0, 0, 0, 3905, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2916, 4265, 2003, 9473, 0, 0, 0, 5984, 5294, 9696, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 6898, 0, 5631, 0, 612, 2801, 4505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6568, 0,
+		0, 0, 0, 0, 104, 0, 0, 3661, 2797, 0, 0, 0, 0, 0, 789, 4376, 2738, 7977, 4655, 7683, 9323, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2754, 6445, 7361, 4029, 7445, 8259, 6966, 8546, 9776, 0, 4065, 0, 0, 0, 0, 0,
+		0, 7241, 9150, 0, 0, 5620, 0, 5455, 0, 0, 1351, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6109, 0,
+		0, 3522, 0, 0, 0, 0, 4927, 0, 0, 0, 0, 0, 7306, 0, 4893, 0, 0, 4336, 0, 0, 2089, 3637, 6333, 8239,
+		0, 0, 4266, 9553, 0, 0, 9474, 0, 0, 101, 0, 3390, 4715, 6775, 0, 1470, 6622, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6976, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8105, 0,
+		546, 765, 5818, 8179, 9315, 0, 0, 0, 0, 4918, 5527, 0, 0, 0, 7381, 0, 0, 4965, 0, 0, 0, 0, 0, 0,
+		1404, 9817, 0, 0, 0, 0, 0, 6960, 8700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1515, 0, 0,
+		0, 0, 3741, 4786, 9778, 0, 489, 0, 883, 946, 0, 0, 0, 0, 0, 0, 5032, 0, 4880, 5015, 4906, 0, 0, 15,
+		8640, 6950, 0, 0, 8361, 7060, 0, 0, 0, 3069, 0, 0, 0, 1535, 3389, 0, 0, 0, 0, 0, 0, 0, 952, 0,
+		0, 0, 0, 0, 0, 9066, 0, 0, 0, 0, 0, 0, 9767, 2559, 6484, 0, 0, 0, 0, 0, 0, 1868, 0, 0,
+		9825, 1080, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3855, 2746, 5122, 0, 0, 0, 2991,
+		1315, 3702, 0, 0, 0, 0, 2013, 7727, 847, 8572, 8647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 5909, 7740, 0, 1332, 0, 1591, 5913, 0, 8327, 0, 0, 0, 6487, 0, 0, 0, 0, 7211, 8444, 0, 0, 1055, 0,
+		5989, 0, 541, 2015, 0, 0, 0, 0, 0, 0, 0, 7198, 6584, 2065, 0, 4255, 0, 7809, 0, 5391, 7363, 0, 0, 0,
+		0, 0, 0, 1959, 0, 0, 2857, 0, 4092, 0, 0, 0, 2859, 0, 0, 0, 0, 0, 2133, 0, 1216, 5302, 5093, 0,
+		0, 0, 0, 7283, 0, 9732, 0, 0, 0, 5227, 8971, 0, 0, 7859, 0, 0, 0, 0, 0, 0, 1605, 0, 0, 5170,
+		8184, 0, 0, 0, 0, 1571, 9569, 0, 0, 0, 0, 0, 3200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2034, 0,
+		7502, 8625, 0, 5487, 0, 0, 8721, 1066, 0, 0, 0, 191, 0, 0, 0, 0, 0, 5011, 0, 0, 0, 0, 0, 4425,
+		5380, 0, 0, 0, 0, 5846, 0, 0, 0, 0, 0, 3064, 0, 0, 0, 0, 9070, 0, 0, 561, 0, 3910, 0, 0,
+		5104, 4984, 8555, 0, 3485, 0, 0, 0, 2001, 0, 0, 0, 0, 348, 0, 0, 0, 0, 5659, 52, 4305, 8851, 0, 0,
+		0, 0, 0, 0, 0, 4279, 8324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5552, 7953, 0, 0, 0, 0, 907, 2692,
+		3973, 891, 0, 0, 0, 1663, 2017, 0, 0, 3601, 0, 0, 0, 0, 0, 6372, 2063, 3617, 6822, 0, 0, 3941, 0, 0,
+		0, 0, 7125, 436, 0, 0, 0, 3801, 9457, 9501, 1432, 0, 0, 3460, 0, 1504, 3291, 2690, 869, 3619, 3320, 5734, 66, 6348,
+		0, 0, 9078, 0, 2728, 0, 6662, 2486, 2563, 0, 0, 0, 0, 3841, 0, 0, 0, 432, 4213, 5254, 6053, 0, 0, 0,
+		0, 0, 0, 0, 1882, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5498, 6608, 0, 0, 5102, 0, 0, 6595, 0, 6585,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 543, 0, 0, 1161, 3285, 6770, 7810, 0, 0, 0, 0, 0, 0, 0, 1947,
+		5064, 0, 0, 0, 0, 1595, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1738, 0, 0, 0, 4502, 0, 0, 0,
+		0, 0, 0, 0, 9349, 0, 0, 0, 0, 0, 0, 0, 0, 8046, 0, 0, 0, 0, 0, 3883, 0, 0, 0, 0,
+		0, 0, 0, 4461, 0, 0, 0, 6301, 0, 8230, 0, 0, 0, 1705, 4185, 1285, 0, 2671, 0, 0, 0, 0, 4886, 0,
+		0, 1841, 0, 0, 0, 0, 0, 0, 3193, 7254, 0, 0, 0, 0, 4355, 0, 0, 0, 0, 0, 9272, 0, 2731, 703,
+		0, 2778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4345, 0, 9761, 0, 6735, 5800, 0, 0, 1111, 0, 0,
+		0, 3797, 8302, 7605, 5413, 372, 0, 0, 0, 8791, 0, 3920, 0, 0, 0, 0, 6786, 2969, 5641, 0, 4360, 0, 1971, 3330,
+		0, 6917, 0, 0, 0, 7951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7398, 0, 0, 133, 8207, 0, 0,
+		0, 0, 0, 0, 0, 6193, 0, 0, 1087, 0, 0, 0, 0, 0, 0, 0, 0, 8180, 0, 0, 6017, 4393, 0, 0,
+		0, 4578, 4852, 2529, 0, 0, 0, 0, 0, 0, 0, 0, 4750, 0, 0, 0, 7978, 0, 0, 0, 0, 2364, 7754, 0,
+		0, 0, 0, 0, 1238, 2149, 9110, 0, 9800, 0, 0, 0, 0, 0, 0, 0, 0, 6502, 0, 0, 0, 0, 0, 1231,
+		6773, 0, 8428, 9461, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1834, 0, 0, 0, 0,
+		0, 0, 8268, 0, 0, 0, 0, 0, 0, 7290, 0, 0, 0, 4466, 4521, 0, 0, 3236, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 2256, 0, 0, 0, 0, 0, 0, 0, 2100, 0, 0, 1283, 0, 0, 0, 0, 521, 0, 7228,
+		8944, 0, 1774, 6271, 876, 0, 0, 0, 0, 0, 0, 0, 0, 9914, 7153, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		8976, 0, 0, 3376, 0, 0, 0, 780, 0, 0, 0, 3975, 7050, 0, 0, 0, 0, 0, 0, 0, 3374, 875, 0, 0,
+		0, 0, 0, 0, 3469, 1875, 8694, 1583, 4210, 0, 0, 0, 5825, 0, 3133, 0, 0, 0, 6847, 8187, 0, 0, 0, 0,
+		0, 0, 0, 8900, 0, 0, 0, 0, 0, 2164, 0, 0, 0, 0, 0, 0, 0, 2929, 0, 0, 0, 0, 0, 0,
+		0, 0, 6661, 0, 4074, 0, 0, 3326, 4361, 8695, 0, 0, 551, 0, 0, 0, 0, 0, 6915, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 6388, 0, 0, 0, 0, 8642, 0, 3904, 0, 2299, 9149, 0, 0, 3371, 0, 6709, 9684,
+		0, 4994, 0, 0, 0, 713, 3203, 0, 7497, 0, 0, 0, 0, 0, 0, 7463, 0, 3840, 0, 0, 0, 925, 0, 0,
+		0, 0, 0, 0, 0, 7894, 8141, 0, 0, 7444, 4885, 0, 0, 0, 2375, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 9555, 0, 3888, 4911, 5361, 0, 1447, 0, 0, 0, 0, 0, 2997, 0, 0, 6893, 0, 0, 0, 0, 934,
+		0, 0, 7273, 0, 0, 1242, 0, 5943, 8673, 7703, 0, 6508, 0, 2094, 8176, 0, 0, 0, 3098, 9262, 234, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 3097, 0, 5074, 0, 2736, 7618, 2573, 0, 0, 0, 184, 4004, 544, 0, 0, 0, 2021, 9603,
+		0, 5588, 2398, 0, 0, 0, 2917, 6474, 3563, 7738, 0, 4482, 0, 446, 0, 2595, 0, 0, 3686, 1968, 5057, 0, 0, 127,
+		0, 0, 0, 7447, 6290, 0, 6663, 0, 0, 0, 0, 9733, 0, 0, 4017, 0, 0, 0, 1635, 0, 0, 0, 0, 9672,
+		3267, 0, 3871, 0, 0, 0, 0, 4094, 6831, 0, 0, 0, 0, 0, 0, 3045, 0, 0, 0, 4528, 0, 0, 5654, 396,
+		0, 1254, 0, 0, 0, 9528, 0, 0, 0, 3922, 0, 0, 0, 0, 0, 435, 1026, 6923, 6918, 7672, 9653, 0, 0, 0,
+		7630, 0, 0, 0, 0, 0, 9750, 2699, 0, 3248, 2252, 0, 0, 0, 2058, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 85, 0, 1017, 5163, 3353, 0, 0, 0, 9199, 0, 0, 0, 0, 0, 0, 0, 0, 835, 1207, 0, 0,
+		0, 0, 0, 0, 6329, 6512, 0, 1417, 5237, 8422, 0, 7845, 7777, 0, 0, 718, 5297, 0, 0, 0, 0, 0, 994, 0,
+		9662, 0, 0, 8945, 914, 0, 7473, 870, 0, 0, 0, 0, 0, 0, 0, 4716, 0, 0, 0, 361, 7102, 7807, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8734, 0, 0, 0, 0, 8279, 0, 0, 9922, 0, 0, 0, 0, 3647,
+		0, 0, 0, 0, 8651, 0, 0, 8359, 0, 0, 7215, 6461, 0, 5373, 7782, 6922, 8770, 0, 0, 1046, 0, 0, 2361, 0,
+		1233, 7094, 7405, 0, 0, 1399, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7471, 0, 8377, 0, 574, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6699, 0, 0, 3184, 0, 0, 0, 0, 3788, 0, 0,
+		0, 0, 1799, 1817, 1745, 1257, 2213, 7688, 8888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4536, 0, 158, 252, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4884, 0,
+		3365, 0, 540, 4246, 0, 0, 954, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8452, 0,
+		0, 1950, 4928, 0, 0, 0, 0, 2580, 0, 0, 6365, 7582, 0, 2614, 4315, 235, 6414, 6713, 0, 0, 0, 817, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 5744, 0, 0, 5946, 8662, 4110, 0, 3388, 8260, 0, 7052, 0, 4765, 0, 0, 0, 0,
+		0, 0, 0, 2643, 1568, 0, 0, 0, 0, 3488, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4338, 496, 269, 2711,
+		5634, 9276, 0, 0, 4201, 9932, 0, 9963, 0, 0, 0, 0, 0, 0, 0, 0, 2022, 0, 0, 2604, 0, 4860, 0, 0,
+		5681, 9004, 0, 0, 0, 8507, 9440, 6667, 0, 0, 0, 0, 0, 0, 8398, 0, 0, 0, 0, 0, 0, 5815, 0, 8754,
+		0, 0, 0, 0, 5581, 6590, 0, 0, 0, 0, 0, 4103, 9102, 0, 8358, 9233, 0, 8559, 0, 7677, 3657, 6113, 9069, 0,
+		0, 0, 760, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8408, 0, 6347, 7817, 0, 0, 0, 0, 0, 0,
+		4388, 0, 0, 0, 6534, 0, 523, 374, 7456, 0, 7918, 0, 0, 1330, 0, 0, 0, 2761, 0, 0, 0, 0, 0, 4710,
+		0, 1675, 2088, 2681, 3947, 4240, 0, 0, 0, 4164, 6843, 0, 0, 0, 0, 7336, 0, 0, 5173, 0, 0, 0, 0, 0,
+		9039, 0, 4627, 0, 0, 0, 0, 0, 0, 6049, 0, 0, 0, 5327, 3858, 4747, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2519, 0, 0, 922, 0, 0, 0, 0, 0, 0, 7689, 0, 0, 0, 3590, 0, 0, 0, 0, 0,
+		0, 649, 4136, 9574, 0, 0, 0, 0, 0, 0, 3315, 4022, 0, 790, 4134, 0, 0, 0, 0, 0, 0, 2939, 0, 3727,
+		0, 0, 0, 929, 0, 0, 0, 5197, 0, 0, 0, 0, 0, 0, 7757, 9623, 0, 0, 5816, 0, 0, 0, 5061, 6674,
+		0, 0, 0, 0, 0, 1352, 0, 0, 259, 0, 0, 0, 0, 0, 0, 3304, 0, 4571, 0, 7778, 0, 0, 2765, 0,
+		0, 0, 0, 0, 0, 0, 6728, 9729, 0, 7548, 0, 0, 0, 0, 0, 2543, 0, 0, 597, 1510, 0, 0, 6422, 0,
+		0, 0, 0, 0, 9077, 0, 0, 8251, 0, 0, 0, 0, 0, 0, 253, 0, 0, 0, 5842, 0, 0, 0, 0, 0,
+		0, 264, 1219, 3073, 8372, 0, 0, 1742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9833, 0, 9389, 0, 0, 0,
+		0, 0, 6134, 0, 0, 0, 2409, 0, 0, 4592, 0, 0, 0, 0, 0, 9437, 0, 0, 7055, 0, 0, 511, 5743, 3261,
+		0, 0, 9830, 7903, 3355, 3454, 0, 8435, 9214, 4479, 0, 5355, 0, 0, 0, 0, 0, 0, 226, 2157, 2267, 3458, 0, 0,
+		0, 420, 2584, 4232, 6991, 8368, 0, 4033, 6624, 0, 0, 0, 0, 0, 4629, 0, 0, 0, 96, 0, 0, 4983, 0, 0,
+		2678, 0, 0, 0, 2912, 0, 3226, 6431, 0, 0, 0, 0, 0, 0, 8069, 0, 2501, 0, 0, 0, 5417, 8576, 5940, 2625,
+		6566, 0, 0, 2366, 9578, 9924, 0, 5363, 0, 0, 4738, 0, 0, 3412, 3562, 0, 0, 0, 0, 0, 3715, 0, 0, 0,
+		3909, 0, 0, 0, 8310, 0, 0, 0, 1883, 8882, 7439, 0, 0, 0, 0, 2121, 0, 0, 0, 634, 0, 0, 2310, 2532,
+		4041, 0, 6345, 0, 1086, 0, 0, 0, 0, 2408, 1781, 0, 93, 0, 1227, 0, 3222, 0, 0, 5113, 9423, 0, 0, 0,
+		0, 2212, 2774, 0, 1900, 0, 0, 0, 7909, 6488, 0, 8532, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9935, 0, 0, 0, 0, 6416, 0, 0, 0,
+		7860, 0, 2244, 0, 0, 0, 0, 0, 579, 0, 0, 0, 0, 0, 0, 0, 0, 3876, 0, 0, 0, 0, 1385, 1313,
+		7368, 0, 0, 0, 0, 0, 0, 8296, 0, 0, 0, 1899, 6356, 0, 0, 0, 0, 7829, 9253, 4840, 4901, 1805, 151, 8918,
+		6332, 0, 0, 4821, 3006, 0, 0, 7276, 0, 0, 0, 0, 0, 0, 1860, 4940, 627, 839, 7188, 0, 0, 3582, 0, 2719,
+		0, 7538, 0, 0, 0, 0, 0, 2918, 8133, 0, 1324, 4766, 7510, 8541, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 3443, 0, 3630, 912, 0, 0, 8995, 0, 5193, 6335, 0, 0, 455, 0, 0, 0, 5975, 0, 0, 0, 0,
+		0, 0, 1530, 0, 0, 4950, 0, 0, 0, 0, 0, 1366, 3272, 0, 0, 0, 9600, 5103, 0, 5012, 6781, 0, 6260, 8884,
+		684, 4470, 6341, 9161, 9804, 9851, 0, 0, 0, 0, 0, 6567, 0, 0, 0, 0, 0, 0, 0, 0, 3425, 5105, 0, 0,
+		0, 8563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6293, 0, 2140, 2031, 0, 0, 0, 0,
+		9870, 0, 0, 0, 0, 0, 0, 0, 394, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9374, 9201, 0, 0, 9156,
+		0, 0, 6497, 0, 0, 0, 0, 947, 0, 0, 0, 0, 0, 0, 0, 7610, 0, 9925, 9273, 0, 0, 0, 0, 0,
+		1328, 0, 0, 0, 0, 0, 0, 2420, 106, 0, 0, 0, 0, 0, 5350, 8698, 7583, 4211, 0, 0, 0, 3013, 0, 2865,
+		9762, 2487, 0, 88, 0, 0, 844, 3439, 3946, 0, 0, 0, 4838, 0, 4195, 1955, 5928, 0, 0, 0, 0, 3301, 2363, 0,
+		0, 0, 0, 0, 0, 225, 2996, 0, 1871, 5817, 7235, 0, 0, 0, 0, 0, 0, 4831, 1699, 6807, 8982, 6373, 0, 0,
+		0, 7417, 9080, 2039, 7888, 0, 4287, 6715, 0, 0, 5370, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9248, 0, 0,
+		0, 0, 0, 3085, 3663, 8196, 1702, 5682, 9095, 7679, 0, 0, 5536, 9051, 0, 8333, 8024, 9714, 0, 0, 1714, 0, 0, 7291,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5341, 0, 0, 0, 0, 0, 0, 0, 2145, 0, 0, 0,
+		0, 0, 0, 8154, 7814, 0, 0, 0, 161, 3748, 0, 270, 0, 0, 0, 0, 0, 0, 6783, 0, 0, 0, 7197, 2685,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 364, 6486, 0,
+		0, 0, 0, 6719, 0, 0, 0, 7089, 7119, 0, 0, 0, 0, 5974, 0, 0, 0, 495, 0, 0, 0, 2066, 6036, 0,
+		0, 0, 0, 2139, 6202, 6931, 0, 0, 0, 4013, 0, 4724, 0, 0, 5047, 0, 0, 1721, 8880, 0, 9882, 0, 5115, 1000,
+		9009, 2435, 3056, 0, 0, 0, 0, 5501, 0, 4102, 4251, 6912, 0, 0, 0, 0, 0, 0, 0, 676, 0, 0, 0, 0,
+		0, 0, 4385, 0, 0, 0, 0, 0, 9917, 0, 0, 0, 0, 0, 0, 0, 1049, 1149, 5605, 6073, 8693, 0, 0, 0,
+		0, 2894, 0, 0, 0, 0, 0, 6110, 0, 920, 0, 0, 0, 0, 0, 0, 0, 7425, 0, 9185, 0, 0, 0, 379,
+		4454, 3060, 5839, 0, 0, 1281, 0, 0, 8015, 9338, 6617, 0, 0, 0, 2508, 0, 0, 8552, 0, 2709, 0, 0, 2440, 0,
+		0, 0, 0, 0, 1897, 6262, 0, 258, 9086, 0, 0, 2354, 0, 0, 0, 0, 1453, 1772, 0, 7994, 0, 65, 0, 514,
+		7046, 3735, 651, 6139, 0, 0, 0, 0, 5241, 1423, 9692, 2040, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2679, 0, 7175,
+		9367, 9596, 0, 9961, 7127, 0, 0, 0, 3342, 0, 0, 0, 8371, 0, 7455, 6186, 3328, 0, 0, 0, 775, 6792, 1858, 1945,
+		0, 0, 0, 0, 9955, 0, 0, 0, 0, 7882, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7571, 0, 0, 0, 6376,
+		0, 9786, 0, 0, 0, 2581, 0, 0, 9519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6686, 4854, 0, 0, 0,
+		332, 4066, 0, 0, 6745, 5256, 6133, 0, 0, 0, 0, 2570, 8904, 0, 2247, 5546, 0, 0, 0, 8197, 0, 0, 0, 2484,
+		0, 0, 0, 0, 0, 1047, 8793, 0, 325, 0, 3996, 3603, 4605, 0, 0, 9281, 0, 0, 0, 0, 557, 6969, 0, 0,
+		0, 0, 0, 0, 0, 0, 2885, 0, 0, 5509, 5625, 0, 0, 0, 2083, 294, 0, 2893, 6875, 0, 0, 1063, 1694, 3048,
+		4877, 0, 0, 0, 0, 0, 3673, 3341, 814, 6532, 202, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0, 0, 0,
+		0, 2258, 0, 0, 0, 0, 5832, 6255, 5473, 0, 6046, 5740, 0, 7795, 0, 5095, 0, 0, 0, 5240, 0, 5550, 0, 0,
+		2707, 0, 0, 0, 6573, 0, 0, 0, 0, 0, 4283, 2639, 0, 6914, 0, 6034, 0, 0, 3558, 0, 0, 7922, 0, 7972,
+		0, 2239, 0, 4081, 2429, 0, 0, 0, 0, 0, 7521, 0, 0, 0, 6013, 600, 1619, 6772, 0, 2931, 0, 0, 0, 0,
+		0, 0, 2413, 0, 0, 0, 0, 0, 0, 0, 0, 7685, 4793, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		5934, 0, 0, 0, 6577, 0, 0, 1392, 0, 0, 0, 0, 0, 0, 5521, 1724, 0, 0, 9850, 0, 0, 0, 0, 7673,
+		0, 800, 7275, 0, 0, 7490, 0, 0, 0, 1537, 0, 0, 5084, 0, 0, 0, 871, 0, 1656, 0, 3749, 8663, 614, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1224, 0, 0, 0, 71, 0, 0, 0, 9231, 9400, 550, 6596, 6860,
+		0, 0, 4598, 0, 1762, 2696, 7192, 3444, 0, 0, 2438, 0, 905, 0, 0, 6173, 0, 0, 0, 3484, 5316, 8332, 874, 919,
+		0, 0, 0, 4698, 0, 0, 0, 0, 0, 0, 0, 4105, 6026, 0, 0, 0, 0, 6815, 9618, 0, 0, 0, 993, 0,
+		2, 9165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1463, 0, 0, 0, 0, 1210, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1815, 0, 6963, 0, 0, 4538, 3089, 0, 0, 4459, 94, 0, 0, 0, 0, 0, 0, 0,
+		1380, 0, 0, 0, 0, 2233, 0, 0, 0, 0, 0, 9863, 2042, 2229, 9327, 0, 0, 0, 4938, 9885, 685, 3318, 5258, 0,
+		0, 0, 0, 0, 0, 9466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9411, 0,
+		2329, 0, 0, 0, 0, 7160, 8530, 0, 6198, 9465, 0, 0, 0, 0, 7594, 0, 0, 6175, 0, 0, 0, 0, 0, 0,
+		1153, 2407, 3435, 326, 4237, 0, 0, 6742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4849, 5157, 2769, 0, 0,
+		0, 0, 7180, 0, 0, 526, 0, 0, 0, 0, 3252, 331, 4508, 0, 0, 0, 8521, 0, 0, 0, 0, 9957, 0, 0,
+		0, 0, 0, 0, 0, 8638, 6926, 4223, 0, 0, 0, 0, 5617, 0, 0, 0, 5346, 1678, 7932, 9192, 7871, 9930, 0, 0,
+		0, 8135, 662, 0, 1766, 0, 0, 6421, 0, 0, 0, 0, 0, 0, 5, 0, 2302, 5303, 0, 5918, 0, 0, 0, 0,
+		1290, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 916, 6897, 0, 0, 5085, 6621, 0, 0, 0, 4778, 5220, 0, 0,
+		0, 163, 4549, 0, 0, 0, 3005, 4874, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4037, 0, 8708, 9693, 0, 3109, 503, 8489, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 5396, 0, 1221, 6717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 7574, 5651, 0, 0, 4351, 5668, 0, 0, 9773, 0, 0, 0, 0, 0, 6383, 0,
+		0, 0, 0, 0, 794, 8550, 9008, 0, 8867, 0, 0, 0, 7334, 8758, 0, 5572, 0, 3816, 3011, 880, 4177, 8227, 5278, 0,
+		0, 0, 5539, 6737, 0, 0, 0, 0, 2434, 5139, 8283, 0, 0, 0, 0, 0, 0, 0, 3041, 0, 0, 0, 1132, 0,
+		0, 0, 9944, 0, 0, 0, 0, 742, 0, 0, 0, 4723, 1043, 6438, 7835, 911, 6564, 0, 3977, 0, 0, 0, 0, 0,
+		0, 927, 7661, 3847, 18, 0, 0, 0, 5834, 0, 0, 0, 3815, 0, 8145, 0, 6626, 0, 0, 0, 0, 0, 0, 3934,
+		0, 0, 0, 0, 0, 0, 0, 8585, 0, 0, 0, 0, 7116, 0, 0, 1143, 1485, 2958, 5479, 4125, 0, 0, 9535, 3062,
+		0, 3306, 0, 0, 4703, 0, 564, 9644, 0, 6744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2541, 0, 0, 0, 6496,
+		2607, 0, 4744, 1946, 0, 0, 0, 0, 0, 0, 0, 7598, 0, 0, 0, 1622, 3356, 0, 0, 0, 0, 0, 0, 9687,
+		0, 0, 0, 0, 0, 9045, 0, 0, 3346, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2913, 0, 0, 0,
+		7186, 7558, 0, 0, 0, 0, 0, 3205, 0, 0, 4048, 0, 5838, 0, 0, 0, 0, 16, 0, 2888, 5088, 0, 3767, 980,
+		0, 0, 0, 0, 0, 0, 320, 7600, 0, 3438, 0, 0, 0, 7850, 0, 0, 0, 0, 0, 1304, 7170, 0, 0, 138,
+		3868, 5949, 0, 0, 0, 0, 0, 5969, 3051, 4354, 60, 7414, 3030, 0, 0, 9083, 6830, 0, 0, 0, 2180, 0, 1155, 0,
+		5540, 0, 6147, 9415, 0, 7709, 0, 1422, 0, 8917, 0, 8286, 0, 5180, 0, 5591, 0, 5973, 0, 4178, 7935, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 6189, 0, 0, 0, 0, 0, 0, 3681, 0, 0, 0, 0, 0, 0, 410,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6659, 0, 2668, 5954, 0, 0, 0, 0, 8844, 3314, 6070,
+		3853, 0, 0, 1666, 2225, 0, 0, 0, 0, 7712, 5903, 0, 1271, 1438, 1743, 8089, 0, 0, 0, 2102, 0, 0, 0, 0,
+		0, 3717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5758, 0, 0, 0, 0, 0, 0, 0, 9755, 0,
+		0, 0, 4935, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2192,
+		3944, 4162, 2307, 4807, 9694, 9801, 0, 1865, 0, 0, 0, 0, 0, 0, 4964, 0, 0, 6751, 0, 334, 0, 9815, 7912, 0,
+		0, 0, 0, 0, 0, 0, 9305, 0, 3845, 9018, 0, 0, 0, 6578, 0, 0, 9076, 9865, 0, 0, 0, 0, 0, 0,
+		0, 0, 8491, 0, 0, 0, 462, 1014, 0, 0, 698, 5182, 6907, 0, 0, 37, 2717, 0, 0, 3891, 4396, 0, 0, 0,
+		6401, 4417, 0, 0, 0, 0, 0, 0, 0, 0, 9671, 0, 8441, 3434, 7862, 0, 0, 0, 897, 0, 2194, 0, 0, 0,
+		0, 0, 0, 7730, 909, 0, 0, 0, 0, 3467, 5835, 7312, 0, 1811, 3141, 0, 0, 0, 0, 5306, 0, 0, 2542, 0,
+		0, 0, 0, 5234, 7039, 0, 1108, 7130, 0, 0, 0, 0, 699, 0, 0, 0, 0, 7667, 9628, 0, 0, 0, 4109, 0,
+		7037, 0, 8765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2591, 0,
+		0, 0, 1022, 0, 0, 5066, 2339, 0, 0, 0, 4617, 4401, 5565, 5017, 8007, 0, 0, 1884, 2406, 2957, 0, 0, 28, 0,
+		0, 0, 778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2168, 0, 0, 0, 0, 0, 4372, 3627, 7096, 8256, 0, 0,
+		0, 0, 1768, 9872, 0, 0, 0, 4678, 0, 0, 0, 0, 0, 0, 0, 0, 3036, 7004, 7552, 0, 3473, 9840, 3738, 3049,
+		9303, 0, 5337, 0, 0, 2909, 6837, 6645, 4463, 7465, 9364, 6834, 8603, 9142, 0, 0, 0, 0, 0, 5558, 0, 0, 0, 0,
+		0, 4467, 0, 0, 1293, 0, 0, 0, 0, 8937, 0, 0, 0, 0, 3589, 0, 0, 319, 0, 0, 1425, 1144, 3793, 0,
+		9031, 1728, 0, 8413, 0, 562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7522, 0, 0, 0, 0, 0, 0, 0, 0,
+		9759, 0, 4855, 968, 0, 0, 0, 9539, 0, 0, 0, 0, 0, 2867, 1540, 0, 0, 1730, 5674, 3685, 12, 0, 5894, 0,
+		0, 6469, 0, 0, 0, 0, 9560, 0, 0, 0, 0, 6265, 8101, 0, 0, 0, 0, 0, 0, 0, 0, 1058, 0, 9892,
+		0, 0, 0, 5336, 5153, 0, 6614, 3181, 0, 0, 8732, 1025, 7347, 0, 0, 0, 0, 0, 0, 0, 1893, 4554, 0, 0,
+		0, 0, 0, 0, 5972, 0, 0, 0, 0, 0, 0, 1844, 0, 812, 1991, 0, 0, 0, 0, 0, 0, 2780, 8798, 0,
+		0, 0, 2453, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3199, 0, 0, 2919, 1739, 8095, 4869, 779, 9412, 6521, 9942, 0,
+		0, 0, 1217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4359, 0, 0, 1095, 0, 4970, 0,
+		4137, 0, 5435, 0, 0, 0, 0, 499, 0, 8290, 0, 9011, 0, 0, 0, 0, 0, 0, 0, 0, 6650, 0, 7736, 0,
+		6613, 0, 0, 0, 9959, 5035, 7798, 0, 3387, 0, 0, 0, 2753, 3088, 3611, 8379, 0, 1314, 0, 4586, 0, 0, 0, 0,
+		8250, 0, 0, 262, 0, 0, 0, 0, 0, 0, 0, 0, 0, 731, 0, 0, 3533, 0, 8484, 0, 7441, 904, 0, 1287,
+		5510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5599, 0, 0, 0, 0, 7092, 0, 0, 1044, 0, 0, 8233, 0, 0,
+		0, 0, 0, 0, 0, 2968, 8955, 9813, 0, 0, 0, 0, 0, 0, 170, 705, 0, 0, 8763, 0, 0, 6132, 0, 0,
+		4908, 2126, 5602, 7890, 6400, 3842, 0, 2854, 0, 0, 0, 2027, 2134, 0, 0, 0, 0, 0, 7282, 0, 0, 0, 0, 0,
+		0, 0, 0, 8821, 0, 0, 985, 0, 0, 0, 593, 0, 0, 0, 0, 0, 0, 3812, 8280, 8325, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 7546, 0, 2821, 0, 0, 0, 7950, 0, 0, 0, 0, 5999, 8579, 0, 4333, 7071, 9369,
+		0, 0, 0, 0, 0, 0, 0, 2064, 0, 1627, 0, 0, 3038, 6379, 9880, 0, 7483, 0, 0, 4588, 1360, 6787, 0, 4,
+		741, 4410, 5051, 0, 8166, 0, 0, 6354, 0, 4011, 0, 0, 0, 8360, 0, 0, 0, 0, 1734, 0, 0, 0, 0, 1236,
+		1554, 0, 0, 0, 0, 0, 0, 8896, 0, 0, 6449, 0, 0, 4640, 0, 0, 0, 3581, 0, 0, 304, 9016, 0, 0,
+		0, 0, 0, 0, 1138, 2636, 2889, 9529, 0, 0, 58, 193, 7524, 0, 0, 0, 0, 0, 1717, 0, 0, 0, 0, 1747,
+		0, 5356, 0, 0, 0, 0, 5166, 0, 3555, 0, 0, 770, 1318, 7311, 0, 0, 8979, 0, 3653, 1903, 8669, 573, 0, 0,
+		0, 0, 0, 6954, 5951, 6342, 7388, 6848, 6014, 9742, 7462, 0, 8471, 7193, 8276, 9791, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1662, 4145, 5162, 7036, 0, 0, 0, 0, 0, 0, 2576, 0, 0, 8553, 0, 0, 0, 6890, 0, 6242, 0, 0,
+		0, 0, 9661, 0, 6861, 1018, 0, 8611
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,514 @@
+#ifndef ROARINGBITMAP_H
+#define ROARINGBITMAP_H
+
+#include "Vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+//compressed set of uint32_t in the roaring layout. Values are grouped by their top 16 bits into containers, each holding
+//the low halves as a sorted array while it has up to ARRAY_MAX of them and as a 65536 bit bitmap past that, whichever is
+//smaller. Set operations go container by container: arrays merge, bitmaps combine in straight loops over 1024 words
+//that the compiler turns into vector instructions
+class RoaringBitmap
+{
+private:
+	static constexpr std::size_t ARRAY_MAX = 4096; //past this the 8KB bitmap is smaller than the array
+	static constexpr std::size_t WORDS = 1024;
+
+	struct Container
+	{
+		uint16_t key = 0; //top 16 bits shared by every value here
+		uint32_t count = 0;
+		Vector<uint16_t> values; //sorted, while count <= ARRAY_MAX
+		Vector<uint64_t> words; //WORDS words once count is past ARRAY_MAX, empty before
+
+		bool isBitmap() const
+		{
+			return !words.empty();
+		}
+
+		bool has(uint16_t low) const
+		{
+			if (isBitmap())
+				return (words[low >> 6] >> (low & 63)) & 1;
+
+			std::size_t at = lowerBound(values, low);
+			return at < values.size() && values[at] == low;
+		}
+	};
+
+	Vector<Container> m_containers; //ascending by key
+
+	static unsigned popcount(uint64_t w)
+	{
+		w = w - ((w >> 1) & 0x5555555555555555ull);
+		w = (w & 0x3333333333333333ull) + ((w >> 2) & 0x3333333333333333ull);
+		w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+		return static_cast<unsigned>((w * 0x0101010101010101ull) >> 56);
+	}
+
+	//trailing zero count of a non zero word
+	static unsigned lowestBit(uint64_t w)
+	{
+		return popcount((w & (0 - w)) - 1);
+	}
+
+	//first position in values not below low
+	static std::size_t lowerBound(const Vector<uint16_t>& values, uint16_t low)
+	{
+		std::size_t first = 0;
+		std::size_t last = values.size();
+
+		while (first < last)
+		{
+			std::size_t mid = first + (last - first) / 2;
+
+			if (values[mid] < low)
+				first = mid + 1;
+			else
+				last = mid;
+		}
+
+		return first;
+	}
+
+	//position of the container for key, or where it would go
+	std::size_t findContainer(uint16_t key) const
+	{
+		std::size_t first = 0;
+		std::size_t last = m_containers.size();
+
+		//values usually arrive in ascending order, so try the last container first
+		if (last > 0 && m_containers[last - 1].key < key)
+			return last;
+
+		while (first < last)
+		{
+			std::size_t mid = first + (last - first) / 2;
+
+			if (m_containers[mid].key < key)
+				first = mid + 1;
+			else
+				last = mid;
+		}
+
+		return first;
+	}
+
+	static void toBitmap(Container& c)
+	{
+		c.words = Vector<uint64_t>(WORDS, 0);
+
+		for (uint16_t low : c.values)
+			c.words[low >> 6] |= 1ull << (low & 63);
+
+		c.values = Vector<uint16_t>();
+	}
+
+	static void toArray(Container& c)
+	{
+		Vector<uint16_t> values;
+		values.reserve(c.count);
+
+		for (std::size_t i{ 0 }; i < WORDS; ++i)
+			for (uint64_t w = c.words[i]; w; w &= w - 1)
+				values.emplace_back(static_cast<uint16_t>(i * 64 + lowestBit(w)));
+
+		c.values.swap(values);
+		c.words = Vector<uint64_t>();
+	}
+
+	//the representation c.count calls for
+	static void normalize(Container& c)
+	{
+		if (c.isBitmap() && c.count <= ARRAY_MAX)
+			toArray(c);
+		else if (!c.isBitmap() && c.count > ARRAY_MAX)
+			toBitmap(c);
+	}
+
+	//a container over the bits of words, counted
+	static Container fromWords(uint16_t key, Vector<uint64_t>&& words)
+	{
+		Container c;
+		c.key = key;
+
+		const uint64_t* w = words.data();
+
+		for (std::size_t i{ 0 }; i < WORDS; ++i)
+			c.count += popcount(w[i]);
+
+		c.words = std::move(words);
+		normalize(c);
+
+		return c;
+	}
+
+	//a container over sorted values
+	static Container fromValues(uint16_t key, Vector<uint16_t>&& values)
+	{
+		Container c;
+		c.key = key;
+		c.count = static_cast<uint32_t>(values.size());
+		c.values = std::move(values);
+		normalize(c);
+
+		return c;
+	}
+
+	static Container intersect(const Container& a, const Container& b)
+	{
+		if (a.isBitmap() && b.isBitmap())
+		{
+			Vector<uint64_t> words(WORDS);
+
+			//raw pointers, Vector's checked operator[] would keep the loop from vectorizing
+			uint64_t* out = words.data();
+			const uint64_t* x = a.words.data();
+			const uint64_t* y = b.words.data();
+
+			for (std::size_t i{ 0 }; i < WORDS; ++i)
+				out[i] = x[i] & y[i];
+
+			return fromWords(a.key, std::move(words));
+		}
+
+		//an array against anything: keep the array values the other side has
+		const Container& small = a.isBitmap() ? b : a;
+		const Container& other = a.isBitmap() ? a : b;
+
+		Vector<uint16_t> values;
+		values.reserve(small.count);
+
+		if (other.isBitmap())
+		{
+			for (uint16_t low : small.values)
+				if ((other.words[low >> 6] >> (low & 63)) & 1)
+					values.emplace_back(low);
+		}
+		else
+		{
+			std::size_t i = 0;
+			std::size_t j = 0;
+
+			while (i < small.values.size() && j < other.values.size())
+			{
+				if (small.values[i] < other.values[j])
+					++i;
+				else if (other.values[j] < small.values[i])
+					++j;
+				else
+				{
+					values.emplace_back(small.values[i]);
+					++i;
+					++j;
+				}
+			}
+		}
+
+		return fromValues(a.key, std::move(values));
+	}
+
+	static Container unite(const Container& a, const Container& b)
+	{
+		if (a.isBitmap() || b.isBitmap())
+		{
+			Vector<uint64_t> words = a.isBitmap() ? a.words : b.words;
+			const Container& other = a.isBitmap() ? b : a;
+
+			if (other.isBitmap())
+			{
+				uint64_t* out = words.data();
+				const uint64_t* y = other.words.data();
+
+				for (std::size_t i{ 0 }; i < WORDS; ++i)
+					out[i] |= y[i];
+			}
+			else
+			{
+				for (uint16_t low : other.values)
+					words[low >> 6] |= 1ull << (low & 63);
+			}
+
+			return fromWords(a.key, std::move(words));
+		}
+
+		Vector<uint16_t> values;
+		values.reserve(a.count + b.count);
+
+		std::size_t i = 0;
+		std::size_t j = 0;
+
+		while (i < a.values.size() || j < b.values.size())
+		{
+			if (j == b.values.size() || (i < a.values.size() && a.values[i] < b.values[j]))
+				values.emplace_back(a.values[i++]);
+			else if (i == a.values.size() || b.values[j] < a.values[i])
+				values.emplace_back(b.values[j++]);
+			else
+			{
+				values.emplace_back(a.values[i]);
+				++i;
+				++j;
+			}
+		}
+
+		return fromValues(a.key, std::move(values));
+	}
+
+	//a without the values of b
+	static Container subtract(const Container& a, const Container& b)
+	{
+		if (a.isBitmap())
+		{
+			Vector<uint64_t> words = a.words;
+
+			if (b.isBitmap())
+			{
+				uint64_t* out = words.data();
+				const uint64_t* y = b.words.data();
+
+				for (std::size_t i{ 0 }; i < WORDS; ++i)
+					out[i] &= ~y[i];
+			}
+			else
+			{
+				for (uint16_t low : b.values)
+					words[low >> 6] &= ~(1ull << (low & 63));
+			}
+
+			return fromWords(a.key, std::move(words));
+		}
+
+		Vector<uint16_t> values;
+		values.reserve(a.count);
+
+		for (uint16_t low : a.values)
+			if (!b.has(low))
+				values.emplace_back(low);
+
+		return fromValues(a.key, std::move(values));
+	}
+
+public:
+	void add(uint32_t value)
+	{
+		uint16_t key = static_cast<uint16_t>(value >> 16);
+		uint16_t low = static_cast<uint16_t>(value);
+
+		std::size_t at = findContainer(key);
+
+		if (at == m_containers.size() || m_containers[at].key != key)
+		{
+			Container fresh;
+			fresh.key = key;
+			m_containers.emplace(at, std::move(fresh));
+		}
+
+		Container& c = m_containers[at];
+
+		if (c.isBitmap())
+		{
+			uint64_t& word = c.words[low >> 6];
+			uint64_t bit = 1ull << (low & 63);
+
+			if (!(word & bit))
+			{
+				word |= bit;
+				++c.count;
+			}
+
+			return;
+		}
+
+		//appending is the common case, a rebuild adds positions in order
+		std::size_t pos = (c.values.empty() || c.values[c.values.size() - 1] < low) ? c.values.size() : lowerBound(c.values, low);
+
+		if (pos < c.values.size() && c.values[pos] == low)
+			return;
+
+		c.values.emplace(pos, low);
+		++c.count;
+
+		normalize(c);
+	}
+
+	void remove(uint32_t value)
+	{
+		uint16_t key = static_cast<uint16_t>(value >> 16);
+		uint16_t low = static_cast<uint16_t>(value);
+
+		std::size_t at = findContainer(key);
+
+		if (at == m_containers.size() || m_containers[at].key != key || !m_containers[at].has(low))
+			return;
+
+		Container& c = m_containers[at];
+
+		if (c.isBitmap())
+			c.words[low >> 6] &= ~(1ull << (low & 63));
+		else
+			c.values.erase_index(lowerBound(c.values, low));
+
+		if (--c.count == 0)
+		{
+			m_containers.erase_index(at);
+			return;
+		}
+
+		normalize(c);
+	}
+
+	bool contains(uint32_t value) const
+	{
+		uint16_t key = static_cast<uint16_t>(value >> 16);
+		std::size_t at = findContainer(key);
+
+		return at < m_containers.size() && m_containers[at].key == key && m_containers[at].has(static_cast<uint16_t>(value));
+	}
+
+	std::size_t cardinality() const
+	{
+		std::size_t total = 0;
+
+		for (const Container& c : m_containers)
+			total += c.count;
+
+		return total;
+	}
+
+	bool empty() const
+	{
+		return m_containers.empty();
+	}
+
+	void clear()
+	{
+		m_containers.clear();
+	}
+
+	//fn(value) for every value, ascending
+	template <typename Fn>
+	void forEach(Fn&& fn) const
+	{
+		for (const Container& c : m_containers)
+		{
+			uint32_t high = static_cast<uint32_t>(c.key) << 16;
+
+			if (!c.isBitmap())
+			{
+				for (uint16_t low : c.values)
+					fn(high | low);
+
+				continue;
+			}
+
+			for (std::size_t i{ 0 }; i < WORDS; ++i)
+				for (uint64_t w = c.words[i]; w; w &= w - 1)
+					fn(high | static_cast<uint32_t>(i * 64 + lowestBit(w)));
+		}
+	}
+
+	//0 through count - 1
+	static RoaringBitmap upTo(uint32_t count)
+	{
+		RoaringBitmap all;
+
+		for (uint32_t start{ 0 }; start < count; start += 65536)
+		{
+			uint32_t n = count - start < 65536 ? count - start : 65536;
+			Vector<uint64_t> words(WORDS, 0);
+
+			for (uint32_t i{ 0 }; i < n / 64; ++i)
+				words[i] = ~0ull;
+
+			if (n % 64)
+				words[n / 64] = (1ull << (n % 64)) - 1;
+
+			all.m_containers.emplace_back(fromWords(static_cast<uint16_t>(start >> 16), std::move(words)));
+		}
+
+		return all;
+	}
+
+	//values in both
+	static RoaringBitmap intersect(const RoaringBitmap& a, const RoaringBitmap& b)
+	{
+		RoaringBitmap out;
+		std::size_t i = 0;
+		std::size_t j = 0;
+
+		while (i < a.m_containers.size() && j < b.m_containers.size())
+		{
+			const Container& x = a.m_containers[i];
+			const Container& y = b.m_containers[j];
+
+			if (x.key < y.key)
+				++i;
+			else if (y.key < x.key)
+				++j;
+			else
+			{
+				Container c = intersect(x, y);
+
+				if (c.count > 0)
+					out.m_containers.emplace_back(std::move(c));
+
+				++i;
+				++j;
+			}
+		}
+
+		return out;
+	}
+
+	//values in either
+	static RoaringBitmap unite(const RoaringBitmap& a, const RoaringBitmap& b)
+	{
+		RoaringBitmap out;
+		std::size_t i = 0;
+		std::size_t j = 0;
+
+		while (i < a.m_containers.size() || j < b.m_containers.size())
+		{
+			if (j == b.m_containers.size() || (i < a.m_containers.size() && a.m_containers[i].key < b.m_containers[j].key))
+				out.m_containers.emplace_back(a.m_containers[i++]);
+			else if (i == a.m_containers.size() || b.m_containers[j].key < a.m_containers[i].key)
+				out.m_containers.emplace_back(b.m_containers[j++]);
+			else
+				out.m_containers.emplace_back(unite(a.m_containers[i++], b.m_containers[j++]));
+		}
+
+		return out;
+	}
+
+	//values in a but not in b
+	static RoaringBitmap subtract(const RoaringBitmap& a, const RoaringBitmap& b)
+	{
+		RoaringBitmap out;
+		std::size_t j = 0;
+
+		for (const Container& x : a.m_containers)
+		{
+			while (j < b.m_containers.size() && b.m_containers[j].key < x.key)
+				++j;
+
+			if (j == b.m_containers.size() || b.m_containers[j].key != x.key)
+			{
+				out.m_containers.emplace_back(x);
+				continue;
+			}
+
+			Container c = subtract(x, b.m_containers[j]);
+
+			if (c.count > 0)
+				out.m_containers.emplace_back(std::move(c));
+		}
+
+		return out;
+	}
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+#ifndef SAVEWORKER_H
+#define SAVEWORKER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+//background writer with write coalescing. The owner submits immutable states (anything with a uint64_t version member),
+//the worker writes only the newest one. Handoff is a single atomic slot: submitting overwrites whatever is still pending,
+//so ten back to back mutations cost one write of the latest state, never ten. std::atomic<std::shared_ptr> is not lock free
+//on any current standard library, but its lock only covers the pointer swap, never a write.
+//failures surface from flush(). The destructor drains the slot but can't throw, so owners flush before they go away
+template <typename State>
+class SaveWorker
+{
+private:
+	std::atomic<std::shared_ptr<const State>> m_pending; //latest unsaved state, nullptr when caught up
+	std::atomic<uint64_t> m_signal{ 0 }; //bumped on every submit and on stop, the worker waits on it
+	std::atomic<uint64_t> m_submitted{ 0 }; //version of the newest state handed in
+	std::atomic<uint64_t> m_written{ 0 }; //version of the newest state on disk
+	std::atomic<bool> m_failed{ false };
+	std::atomic<bool> m_stop{ false };
+
+	std::function<void(const State&)> m_write;
+	std::thread m_thread;
+
+	void run()
+	{
+		uint64_t seen = 0;
+
+		for (;;)
+		{
+			//sleep until something changes
+			m_signal.wait(seen);
+			seen = m_signal.load();
+
+			//take the newest state, anything older was already replaced in the slot
+			std::shared_ptr<const State> state = m_pending.exchange(nullptr);
+
+			if (state)
+			{
+				try
+				{
+					m_write(*state);
+				}
+				catch (...)
+				{
+					m_failed = true;
+				}
+
+				m_written = state->version;
+				m_written.notify_all();
+			}
+
+			//stop only once the slot is drained, the last submit always reaches disk
+			if (m_stop && m_pending.load() == nullptr)
+				return;
+		}
+	}
+
+public:
+	explicit SaveWorker(std::function<void(const State&)> write)
+		: m_write(std::move(write))
+	{
+		m_thread = std::thread(&SaveWorker::run, this);
+	}
+
+	//drains the last pending state before returning
+	~SaveWorker()
+	{
+		m_stop = true;
+		++m_signal;
+		m_signal.notify_one();
+
+		m_thread.join();
+	}
+
+	SaveWorker(const SaveWorker&) = delete;
+	SaveWorker& operator= (const SaveWorker&) = delete;
+
+	//hand off a state and return immediately
+	void submit(std::shared_ptr<const State> state)
+	{
+		m_submitted = state->version;
+		m_pending.store(std::move(state));
+		++m_signal;
+		m_signal.notify_one();
+	}
+
+	//true if everything submitted so far has been written
+	bool idle() const
+	{
+		return m_written.load() >= m_submitted.load();
+	}
+
+	//block until everything submitted so far is on disk. Throws if a background write failed since the last flush
+	void flush()
+	{
+		uint64_t version = m_submitted.load();
+		uint64_t written = m_written.load();
+
+		while (written < version)
+		{
+			m_written.wait(written);
+			written = m_written.load();
+		}
+
+		if (m_failed.exchange(false))
+			throw std::runtime_error("Background save failed");
+	}
+};
+
+#endif
\ No newline at end of file
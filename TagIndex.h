@@ -0,0 +1,214 @@
+#ifndef TAGINDEX_H
+#define TAGINDEX_H
+
+#include "FlatMultimap.h"
+#include "RoaringBitmap.h"
+#include "UniquePointer.h"
+#include "Vector.h"
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+//tag -> RoaringBitmap of the positions of the entries carrying it, kept in step with the vault like the website indexes.
+//a tag query combines whole bitmaps, so a filtered listing costs the size of the tag sets rather than a pass over every entry
+class TagIndex
+{
+private:
+	FlatMultimap<uint32_t> m_lookup; //hash of tag -> slot
+	Vector<UniquePtr<char[]>> m_names; //slot -> tag
+	Vector<RoaringBitmap> m_sets; //slot -> positions
+
+	//slot of tag, or m_names.size()
+	std::size_t slotOf(const char* tag, std::size_t length) const
+	{
+		std::size_t slot = m_names.size();
+
+		m_lookup.forEach(fnv1a(tag, length), [&](uint32_t s)
+			{
+				if (std::strlen(m_names[s].get()) == length && std::memcmp(m_names[s].get(), tag, length) == 0)
+					slot = s;
+			});
+
+		return slot;
+	}
+
+	//query grammar, loosest binding first:
+	//  any  := all ('|' all)...
+	//  all  := term ('&' term)...
+	//  term := '!' term | '(' any ')' | tag:<name>
+	class Parser
+	{
+	private:
+		const TagIndex& m_index;
+		const char* m_p;
+		uint32_t m_count; //entries in the vault, what '!' takes its complement against
+
+		struct Term
+		{
+			RoaringBitmap set;
+			bool negated;
+		};
+
+		void skipSpace()
+		{
+			while (*m_p && std::isspace(static_cast<unsigned char>(*m_p)))
+				++m_p;
+		}
+
+		//true and past c if it is next
+		bool accept(char c)
+		{
+			skipSpace();
+
+			if (*m_p != c)
+				return false;
+
+			++m_p;
+			return true;
+		}
+
+		Term term()
+		{
+			if (accept('!'))
+			{
+				Term inner = term();
+				inner.negated = !inner.negated;
+				return inner;
+			}
+
+			if (accept('('))
+			{
+				RoaringBitmap set = any();
+
+				if (!accept(')'))
+					throw std::runtime_error("Missing ) in tag query");
+
+				return Term{ std::move(set), false };
+			}
+
+			if (std::strncmp(m_p, "tag:", 4) != 0)
+				throw std::runtime_error("Tag queries look like tag:a & (tag:b | !tag:c)");
+
+			m_p += 4;
+
+			const char* name = m_p;
+
+			while (*m_p && !std::isspace(static_cast<unsigned char>(*m_p)) && !std::strchr(",&|!()", *m_p))
+				++m_p;
+
+			std::size_t length = static_cast<std::size_t>(m_p - name);
+
+			if (length == 0)
+				throw std::runtime_error("Empty tag in tag query");
+
+			std::size_t slot = m_index.slotOf(name, length);
+
+			return Term{ slot < m_index.m_sets.size() ? m_index.m_sets[slot] : RoaringBitmap(), false };
+		}
+
+		//intersect the plain terms smallest first, then take the negated ones out, so a & !b never builds the complement of b
+		RoaringBitmap all()
+		{
+			Vector<Term> terms;
+			terms.emplace_back(term());
+
+			while (accept('&'))
+				terms.emplace_back(term());
+
+			std::size_t first = terms.size();
+
+			for (std::size_t i{ 0 }; i < terms.size(); ++i)
+				if (!terms[i].negated && (first == terms.size() || terms[i].set.cardinality() < terms[first].set.cardinality()))
+					first = i;
+
+			RoaringBitmap result = first < terms.size() ? std::move(terms[first].set) : RoaringBitmap::upTo(m_count);
+
+			for (std::size_t i{ 0 }; i < terms.size(); ++i)
+			{
+				if (i == first)
+					continue;
+
+				if (terms[i].negated)
+					result = RoaringBitmap::subtract(result, terms[i].set);
+				else
+					result = RoaringBitmap::intersect(result, terms[i].set);
+			}
+
+			return result;
+		}
+
+		RoaringBitmap any()
+		{
+			RoaringBitmap result = all();
+
+			while (accept('|'))
+				result = RoaringBitmap::unite(result, all());
+
+			return result;
+		}
+
+	public:
+		Parser(const TagIndex& index, const char* expression, uint32_t count)
+			: m_index{ index }, m_p{ expression }, m_count{ count }
+		{
+		}
+
+		RoaringBitmap parse()
+		{
+			RoaringBitmap result = any();
+
+			skipSpace();
+
+			if (*m_p != '\0')
+				throw std::runtime_error("Unexpected text in tag query");
+
+			return result;
+		}
+	};
+
+public:
+	void add(const char* tag, uint32_t position)
+	{
+		std::size_t length = std::strlen(tag);
+		std::size_t slot = slotOf(tag, length);
+
+		if (slot == m_names.size())
+		{
+			UniquePtr<char[]> name = makeUnique<char[]>(length + 1);
+			std::memcpy(name.get(), tag, length + 1);
+
+			m_lookup.insert(fnv1a(tag, length), static_cast<uint32_t>(slot));
+			m_names.emplace_back(std::move(name));
+			m_sets.emplace_back();
+		}
+
+		m_sets[slot].add(position);
+	}
+
+	void remove(const char* tag, uint32_t position)
+	{
+		std::size_t slot = slotOf(tag, std::strlen(tag));
+
+		if (slot < m_names.size())
+			m_sets[slot].remove(position);
+	}
+
+	void clear()
+	{
+		m_lookup.clear();
+		m_names.clear();
+		m_sets.clear();
+	}
+
+	//positions matching expression, e.g. "tag:prod & tag:db" or "(tag:a | tag:b) & !tag:old", out of count entries
+	RoaringBitmap query(const char* expression, uint32_t count) const
+	{
+		return Parser(*this, expression, count).parse();
+	}
+};
+
+#endif
\ No newline at end of file
@@ -21,6 +21,9 @@ private:
 	std::size_t m_CurrentSize; //# of elements currently in the Vector
 	std::size_t m_Capacity; //total # of elements the allocated array can hold before resize is necessary
 
+	//arbitrary number for now, 1 mil
+	static constexpr std::size_t CAPACITY_LIMIT = 1000000;
+
 	void Reallocate(std::size_t newCapacity)
 	{
 		//----------------------------------------------------------------------------//
@@ -28,9 +31,9 @@ private:
 		if (newCapacity < m_CurrentSize)
 			throw std::runtime_error("newCapacity cannot be < currentSize");
 
-		//arbitrary number for now, 1 mil
-		else if (newCapacity > 1000000)
-			return;
+		//every caller writes into the new capacity next, so refusing quietly would have it write past the buffer
+		else if (newCapacity > CAPACITY_LIMIT)
+			throw std::runtime_error("Vector cannot grow past its capacity limit");
 
 		//do nothing
 		else if (newCapacity <= m_Capacity)
@@ -74,6 +77,15 @@ private:
 		m_Capacity = newCapacity;
 	}
 
+	//capacity to grow a full Vector to: 50% more, at least 2 more, no more than the limit
+	std::size_t grownCapacity() const
+	{
+		if (m_Capacity >= CAPACITY_LIMIT)
+			throw std::runtime_error("Vector cannot grow past its capacity limit");
+
+		return std::min(m_Capacity + std::max<std::size_t>(m_Capacity / 2, 2), CAPACITY_LIMIT);
+	}
+
 										//big ass helper func for insert_range
 //================================================================================================================================//
 	template <typename It>
@@ -540,8 +552,8 @@ public:
 
 	const std::size_t size() const { return m_CurrentSize; }
 
-	//theoretical limit to how many Ts a Vector can contain
-	std::size_t max_size() const { return std::numeric_limits<std::size_t>::max() / sizeof(T); }
+	//most Ts a Vector can grow to, past it growing throws
+	std::size_t max_size() const { return CAPACITY_LIMIT; }
 
 	bool reserve(std::size_t new_cap)
 	{
@@ -1215,11 +1227,54 @@ public:
 		return erase(pos);
 	}
 
+	//erase every index in the sorted, duplicate free range [first, last) in one pass. Each survivor is moved at most once, O(size) total
+	T* erase_indices(const std::size_t* first, const std::size_t* last)
+	{
+		//nothing to erase
+		if (first == last)
+			return end();
+
+		//validate before moving anything so a bad list leaves the Vector untouched
+		for (const std::size_t* it{ first }; it != last; ++it)
+		{
+			if (*it >= m_CurrentSize)
+				throw std::runtime_error("Index out of bounds");
+
+			if (it != first && *it <= it[-1])
+				throw std::runtime_error("Indices must be sorted and unique");
+		}
+
+		std::size_t oldSize = m_CurrentSize;
+		std::size_t write = *first;		//[1][x][3][x][x][6] -> [1][3][6][x][x][6] -> [1][3][6]
+		const std::size_t* next = first;
+
+		for (std::size_t read{ *first }; read < oldSize; ++read)
+		{
+			//skip the slot being erased
+			if (next != last && *next == read)
+			{
+				++next;
+				continue;
+			}
+
+			m_Arr[write] = std::move(m_Arr[read]);
+			++write;
+		}
+
+		//destroy moved from tail
+		for (std::size_t i{ write }; i < oldSize; ++i)
+			m_Arr[i].~T();
+
+		m_CurrentSize = write;
+
+		return m_Arr + *first;
+	}
+
 	//add value at the end of the array
 	void push_back(T val)
 	{
 		if (m_CurrentSize >= m_Capacity)
-			Reallocate(m_Capacity + (m_Capacity / 2)); //Grow by 50%
+			Reallocate(grownCapacity());
 
 		void* slot = &m_Arr[m_CurrentSize];
 
@@ -1230,11 +1285,8 @@ public:
 	template <typename... Args>
 	T* emplace_back(Args&&... args)
 	{
-		if (m_Capacity == 0)
-			Reallocate(2);
-
 		if (m_CurrentSize >= m_Capacity)
-			Reallocate(m_Capacity + (m_Capacity / 2)); //grow by 50%
+			Reallocate(grownCapacity());
 
 		void* slot = &m_Arr[m_CurrentSize];
 
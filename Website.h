@@ -0,0 +1,223 @@
+#ifndef WEBSITE_H
+#define WEBSITE_H
+
+#include "FlatMultimap.h"
+#include "PublicSuffix.h"
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+//websites are free form, "https://www.Example.com:443/login" and "example.com" must land on the same key.
+//normalizing writes into a stack buffer so lookups never allocate
+namespace Website
+{
+	//longest DNS name is 253 chars, anything longer is truncated consistently on both sides of a compare
+	constexpr std::size_t MAX_HOST = 256;
+
+	char lower(char c)
+	{
+		return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+	}
+
+	//whether the lowercase host [begin, end) loses a leading "www.": only while what is left is still longer than its public
+	//suffix, so "www.example.com" -> "example.com" but "www.co.uk" is not cut to the suffix "co.uk", and "www.ck" (an
+	//exception rule, registrable itself) keeps its "www."
+	constexpr bool dropsWww(const char* begin, const char* end)
+	{
+		return end - begin > 4 && begin[0] == 'w' && begin[1] == 'w' && begin[2] == 'w' && begin[3] == '.' && !PublicSuffix::isSuffix(begin + 4, end);
+	}
+
+	constexpr bool dropsWww(const char* host)
+	{
+		return dropsWww(host, host + PublicSuffix::constLength(host));
+	}
+
+	static_assert(dropsWww("www.example.com") && dropsWww("www.bbc.co.uk"), "www. before a registrable domain goes");
+	static_assert(!dropsWww("www.co.uk") && !dropsWww("www.ck") && !dropsWww("www.com"), "www. before a bare suffix stays");
+
+	//lowercase host of website into out, returns its length. Strips whitespace, scheme, userinfo, port, path, query, fragment
+	//and trailing dot, a leading "www." stays
+	std::size_t lowerHost(const char* website, char (&out)[MAX_HOST])
+	{
+		const char* begin = website;
+		const char* end = website + strlen(website);
+
+		//trim surrounding whitespace
+		while (begin < end && std::isspace(static_cast<unsigned char>(*begin)))
+			++begin;
+
+		while (end > begin && std::isspace(static_cast<unsigned char>(end[-1])))
+			--end;
+
+		//skip "scheme://"
+		for (const char* c = begin; c + 2 < end && *c != '/' && *c != '.'; ++c)
+		{
+			if (c[0] == ':' && c[1] == '/' && c[2] == '/')
+			{
+				begin = c + 3;
+				break;
+			}
+		}
+
+		//authority ends at the first '/', '?' or '#'
+		const char* authorityEnd = begin;
+		while (authorityEnd < end && *authorityEnd != '/' && *authorityEnd != '?' && *authorityEnd != '#')
+			++authorityEnd;
+
+		//skip "user:pass@"
+		for (const char* c = authorityEnd; c > begin; --c)
+		{
+			if (c[-1] == '@')
+			{
+				begin = c;
+				break;
+			}
+		}
+
+		const char* hostEnd = begin;
+
+		//bracketed IPv6 literal keeps its colons
+		if (hostEnd < authorityEnd && *hostEnd == '[')
+		{
+			while (hostEnd < authorityEnd && *hostEnd != ']')
+				++hostEnd;
+
+			if (hostEnd < authorityEnd)
+				++hostEnd;
+		}
+		else
+		{
+			//drop ":port"
+			while (hostEnd < authorityEnd && *hostEnd != ':')
+				++hostEnd;
+		}
+
+		//"example.com." is the same host as "example.com"
+		while (hostEnd > begin && hostEnd[-1] == '.')
+			--hostEnd;
+
+		std::size_t length = 0;
+		for (const char* c = begin; c < hostEnd && length < MAX_HOST - 1; ++c)
+			out[length++] = lower(*c);
+
+		out[length] = '\0';
+
+		return length;
+	}
+
+	//lowerHost, then a leading "www." dropped where dropsWww allows
+	std::size_t normalizeHost(const char* website, char (&out)[MAX_HOST])
+	{
+		std::size_t length = lowerHost(website, out);
+
+		if (dropsWww(out, out + length))
+		{
+			std::memmove(out, out + 4, length - 4 + 1); //+1 keeps the null terminator
+			length -= 4;
+		}
+
+		return length;
+	}
+
+	//true for IPv4 / IPv6 literals, these have no registrable domain
+	bool isAddress(const char* host, std::size_t length)
+	{
+		if (length > 0 && host[0] == '[')
+			return true;
+
+		for (std::size_t i{ 0 }; i < length; ++i)
+			if (!std::isdigit(static_cast<unsigned char>(host[i])) && host[i] != '.')
+				return false;
+
+		return length > 0;
+	}
+
+	//registrable domain ("mail.google.co.uk" -> "google.co.uk") of website into out, returns its length
+	std::size_t normalizeDomain(const char* website, char (&out)[MAX_HOST])
+	{
+		std::size_t length = normalizeHost(website, out);
+
+		if (isAddress(out, length))
+			return length;
+
+		const char* start = PublicSuffix::registrableStart(out, out + length);
+		std::size_t offset = static_cast<std::size_t>(start - out);
+
+		if (offset > 0)
+		{
+			std::memmove(out, start, length - offset + 1); //+1 keeps the null terminator
+			length -= offset;
+		}
+
+		return length;
+	}
+
+	//hash of the normalized host
+	uint64_t hash(const char* website)
+	{
+		char host[MAX_HOST];
+		std::size_t length = normalizeHost(website, host);
+
+		return fnv1a(host, length);
+	}
+
+	//hash that picks an entry's shard file. Placement is on disk, so this keeps the rule sharded vaults were written with
+	//and drops a leading "www." unconditionally. Lookups go through hash()
+	uint64_t placementHash(const char* website)
+	{
+		char host[MAX_HOST];
+		std::size_t length = lowerHost(website, host);
+
+		if (length > 4 && std::memcmp(host, "www.", 4) == 0)
+			return fnv1a(host + 4, length - 4);
+
+		return fnv1a(host, length);
+	}
+
+	//true if both websites normalize to the same host
+	bool equal(const char* a, const char* b)
+	{
+		char aHost[MAX_HOST];
+		char bHost[MAX_HOST];
+		std::size_t aLength = normalizeHost(a, aHost);
+		std::size_t bLength = normalizeHost(b, bHost);
+
+		return aLength == bLength && std::memcmp(aHost, bHost, aLength) == 0;
+	}
+
+	//digest of a (host, username) pair, seeded apart from hash() so site keys and credential keys share one filter
+	uint64_t credentialHash(const char* website, const char* username)
+	{
+		char host[MAX_HOST];
+		std::size_t length = normalizeHost(website, host);
+
+		uint64_t h = fnv1a(host, length, FNV_OFFSET ^ 0xC3EDu);
+		h = fnv1aStep(h, 0); //separator so ("ab", "c") != ("a", "bc")
+
+		return fnv1a(username, strlen(username), h);
+	}
+
+	//hash of the registrable domain
+	uint64_t domainHash(const char* website)
+	{
+		char domain[MAX_HOST];
+		std::size_t length = normalizeDomain(website, domain);
+
+		return fnv1a(domain, length);
+	}
+
+	//true if both websites share a registrable domain
+	bool sameDomain(const char* a, const char* b)
+	{
+		char aDomain[MAX_HOST];
+		char bDomain[MAX_HOST];
+		std::size_t aLength = normalizeDomain(a, aDomain);
+		std::size_t bLength = normalizeDomain(b, bDomain);
+
+		return aLength == bLength && std::memcmp(aDomain, bDomain, aLength) == 0;
+	}
+}
+
+#endif
\ No newline at end of file
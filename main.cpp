@@ -1,18 +1,104 @@
 #include "Vector.h"
 #include "Cryption.h"
+#include "FileWatcher.h"
 #include "Helpers.h"
 
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <mutex>
 
-int main()
+int main(int argc, char* argv[])
 {
     bool exit = false;
     Vault vault;
 
+        //non interactive: pm --batch <file | -> [--yes]. Runs the whole script against one loaded vault and saves once
+        if (argc > 1 && strcmp(argv[1], "--batch") == 0)
+        {
+            if (argc < 3)
+            {
+                std::cerr << "usage: pm --batch <file | -> [--yes] [--sync-every N]\n";
+                return 2;
+            }
+
+            //scripts can't answer the delete prompt, --yes confirms every delete, otherwise deletes fail
+            vault.setConfirmPolicy(ConfirmPolicy::Refuse);
+
+            //no full listing after the final save, stdout is the script's output
+            vault.setQuiet(true);
+            for (int i{ 3 }; i < argc; ++i)
+            {
+                if (strcmp(argv[i], "--yes") == 0)
+                    vault.setConfirmPolicy(ConfirmPolicy::Always);
+                else if (strcmp(argv[i], "--sync-every") == 0 && i + 1 < argc)
+                    vault.setSyncEvery(static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10)));
+            }
+
+            try
+            {
+                std::size_t failures;
+
+                if (strcmp(argv[2], "-") == 0)
+                    failures = Helpers::runBatch(std::cin, vault);
+                else
+                {
+                    std::ifstream script(argv[2], std::ios::binary);
+                    if (!script)
+                    {
+                        std::cerr << "Could not open " << argv[2] << "\n";
+                        return 2;
+                    }
+
+                    failures = Helpers::runBatch(script, vault);
+                }
+
+                return failures == 0 ? 0 : 1;
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << e.what() << "\n";
+                return 1;
+            }
+        }
+
+        //pm --watch: interactive, and reload whenever another process saves entries.bin
+        bool watch = argc == 2 && strcmp(argv[1], "--watch") == 0;
+
+        //one shot: pm get <website>, pm has <website> ... Runs one command and exits without the interactive loop
+        if (argc > 1 && !watch)
+            return Helpers::runCommand(argc, argv, vault);
+
         std::cout << std::setw(70) << "Password Manager Loaded\n";
         //list cmds
         vault.displayCmds();
 
+        //saves run on a background thread so the prompt comes back right away, flush waits for them
+        vault.enableAsyncSave();
+
+        //the watcher reloads from its own thread, vaultLock keeps that apart from commands typed here
+        std::mutex vaultLock;
+        UniquePtr<FileWatcher> watcher;
+
+        if (watch)
+        {
+            watcher = makeUnique<FileWatcher>("entries.bin", [&]()
+                {
+                    std::lock_guard<std::mutex> lock(vaultLock);
+
+                    try
+                    {
+                        if (vault.reloadIfChanged())
+                            std::cout << "\nentries.bin changed on disk, reloaded\n";
+                    }
+                    catch (const std::exception& e)
+                    {
+                        std::cout << "\nReload failed: " << e.what() << "\n";
+                    }
+                });
+        }
+
         //for storing variable user input for parsing
         Vector<char> userInput;
 
@@ -30,15 +116,36 @@ int main()
                 userInput.push_back(c);
             }
 
+            //end of input, leave the loop so ~Vault drains any pending background save
+            if (!std::cin)
+                exit = true;
+
             userInput.push_back('\0');
 
             char* usernPut = userInput.data();
 
-            Helpers::parseUserInput(usernPut, vault);
+            //report instead of terminating, an uncaught throw would skip the pending save
+            try
+            {
+                std::lock_guard<std::mutex> lock(vaultLock);
+                Helpers::parseUserInput(usernPut, vault);
+            }
+            catch (const std::exception& e)
+            {
+                std::cout << e.what() << "\n";
+            }
         }
 
-
-
+        //saves run in the background, so wait for the last one here. A failure has to reach the exit code, ~Vault can only drop it
+        try
+        {
+            vault.flush();
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << e.what() << "\n";
+            return 1;
+        }
 
     return 0;
 
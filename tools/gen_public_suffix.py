@@ -0,0 +1,143 @@
+# generates PublicSuffixRules.h from the Public Suffix List.
+#
+#   python3 tools/gen_public_suffix.py public_suffix_list.dat > PublicSuffixRules.h
+#
+# the list is at https://publicsuffix.org/list/public_suffix_list.dat. Both the ICANN and the private section are kept,
+# private suffixes (github.io, herokuapp.com, ...) hand subdomains to different owners too. Unicode rules are emitted
+# twice, as UTF-8 and as their xn-- form, since a saved website can be spelled either way.
+#
+# the hash table is laid out here rather than by the compiler: it is FNV-1a (FlatMultimap.h) with linear probing, exactly
+# what PublicSuffix::lookup probes, and the checks in PublicSuffix.h fail to compile if the two ever disagree
+
+import sys
+
+NORMAL = 1
+WILDCARD = 2
+EXCEPTION = 4
+
+FNV_OFFSET = 14695981039346656037
+FNV_PRIME = 1099511628211
+
+
+def fnv1a(data):
+    h = FNV_OFFSET
+    for byte in data:
+        h = ((h ^ byte) * FNV_PRIME) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def ace(name):
+    labels = []
+    for label in name.split("."):
+        if label.isascii():
+            labels.append(label)
+        else:
+            labels.append("xn--" + label.encode("punycode").decode("ascii"))
+    return ".".join(labels)
+
+
+def parse(path):
+    rules = {}
+    version = ""
+
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+
+            if line.startswith("// VERSION:"):
+                version = line[len("// VERSION:"):].strip()
+
+            if not line or line.startswith("//"):
+                continue
+
+            # a rule ends at the first whitespace
+            rule = line.split()[0].lower()
+            kind = NORMAL
+
+            if rule.startswith("!"):
+                rule, kind = rule[1:], EXCEPTION
+            elif rule.startswith("*."):
+                rule, kind = rule[2:], WILDCARD
+
+            for name in dict.fromkeys((rule, ace(rule))):
+                rules[name] = rules.get(name, 0) | kind
+
+    return rules, version
+
+
+def literal(name):
+    # octal escapes take at most three digits, so unlike \x they never run into the next character
+    return '"' + "".join(chr(b) if b < 0x80 else "\\%03o" % b for b in name.encode("utf-8")) + '"'
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: gen_public_suffix.py public_suffix_list.dat > PublicSuffixRules.h")
+
+    rules, version = parse(sys.argv[1])
+    names = list(rules)
+
+    table_size = 1
+    while table_size < len(names) * 2:
+        table_size *= 2
+
+    if len(names) >= 0xFFFF:
+        sys.exit("too many rules for uint16_t slots")
+
+    table = [0] * table_size
+    for index, name in enumerate(names):
+        slot = fnv1a(name.encode("utf-8")) & (table_size - 1)
+        while table[slot] != 0:
+            slot = (slot + 1) & (table_size - 1)
+        table[slot] = index + 1
+
+    kinds = {NORMAL: "Normal", WILDCARD: "Wildcard", EXCEPTION: "Exception"}
+
+    def kind_text(kind):
+        return " | ".join(kinds[k] for k in (NORMAL, WILDCARD, EXCEPTION) if kind & k)
+
+    out = []
+    out.append("#ifndef PUBLICSUFFIXRULES_H")
+    out.append("#define PUBLICSUFFIXRULES_H")
+    out.append("")
+    out.append("//generated by tools/gen_public_suffix.py from public_suffix_list.dat" + (" (" + version + ")" if version else "") + ", do not edit.")
+    out.append("//rerun the script on a newer list to update. Included by PublicSuffix.h, which defines Rule and RuleKind")
+    out.append("namespace PublicSuffix")
+    out.append("{")
+    out.append("\tconstexpr Rule PUBLIC_SUFFIX_RULES[] =")
+    out.append("\t{")
+
+    line = ""
+    for index, name in enumerate(names):
+        item = "{ " + literal(name) + ", " + kind_text(rules[name]) + " }" + ("," if index + 1 < len(names) else "")
+
+        if line and len(line) + len(item) > 116:
+            out.append("\t\t" + line.rstrip())
+            line = ""
+
+        line += item + " "
+
+    out.append("\t\t" + line.rstrip())
+    out.append("\t};")
+    out.append("")
+    out.append("\tconstexpr std::size_t TABLE_SIZE = %d;" % table_size)
+    out.append("")
+    out.append("\t//slot -> rule index + 1, 0 is empty. FNV-1a of the rule name, linear probing")
+    out.append("\tconstexpr uint16_t TABLE[TABLE_SIZE] =")
+    out.append("\t{")
+
+    for start in range(0, table_size, 24):
+        row = table[start:start + 24]
+        out.append("\t\t" + ", ".join(str(v) for v in row) + ("," if start + 24 < table_size else ""))
+
+    out.append("\t};")
+    out.append("}")
+    out.append("")
+    out.append("#endif")
+
+    # the tree is CRLF, and its headers end at #endif without a final newline
+    sys.stdout.buffer.write("\r\n".join(out).encode("ascii"))
+
+
+if __name__ == "__main__":
+    main()